@@ -226,6 +226,37 @@ namespace bs
 		}
 	}
 
+	ResourceMemoryUsage AnimationClip::getMemoryUsage() const
+	{
+		const auto getCurvesSize = [](const auto& curves)
+		{
+			UINT64 size = 0;
+			for (auto& entry : curves)
+				size += entry.curve.getNumKeyFrames() * sizeof(entry.curve.getKeyFrame(0));
+
+			return size;
+		};
+
+		ResourceMemoryUsage output;
+
+		if (mCurves != nullptr)
+		{
+			output.cpu += getCurvesSize(mCurves->position);
+			output.cpu += getCurvesSize(mCurves->rotation);
+			output.cpu += getCurvesSize(mCurves->scale);
+			output.cpu += getCurvesSize(mCurves->generic);
+		}
+
+		if (mRootMotion != nullptr)
+		{
+			output.cpu += mRootMotion->position.getNumKeyFrames() * sizeof(TKeyframe<Vector3>);
+			output.cpu += mRootMotion->rotation.getNumKeyFrames() * sizeof(TKeyframe<Quaternion>);
+		}
+
+		output.cpu += mEvents.size() * sizeof(AnimationEvent);
+		return output;
+	}
+
 	void AnimationClip::initialize()
 	{
 		buildNameMapping();
@@ -241,6 +241,9 @@ namespace bs
 		 */
 		UINT64 getVersion() const { return mVersion; }
 
+		/** @copydoc Resource::getMemoryUsage */
+		ResourceMemoryUsage getMemoryUsage() const override;
+
 		/**
 		 * Creates an animation clip with no curves. After creation make sure to register some animation curves before
 		 * using it.
@@ -10,6 +10,7 @@
 #include "Animation/BsMorphShapes.h"
 #include "Mesh/BsMeshData.h"
 #include "Mesh/BsMeshUtility.h"
+#include "Allocators/BsMemoryTracker.h"
 
 namespace bs
 {
@@ -35,6 +36,8 @@ namespace bs
 
 	const EvaluatedAnimationData* AnimationManager::update(bool async)
 	{
+		MemoryTagScope memoryTag(MemoryTag::Animation);
+
 		// Wait for any workers to complete
 		{
 			Lock lock(mMutex);
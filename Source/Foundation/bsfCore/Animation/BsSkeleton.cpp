@@ -313,8 +313,8 @@ namespace bs
 				calcGlobal(i);
 		}
 
-		for (UINT32 i = 0; i < mNumBones; i++)
-			pose[i] = pose[i] * mInvBindPoses[i];
+		// Bone and inverse bind pose matrices are both affine, so the products can be done in a batch
+		Matrix4::multiplyAffine(pose, mInvBindPoses, pose, mNumBones);
 
 		bs_stack_free(isGlobal);
 		bs_stack_free(hasAnimCurve);
@@ -23,6 +23,29 @@ namespace bs
 		Resource::initialize();
 	}
 
+	ResourceMemoryUsage AudioClip::getMemoryUsage() const
+	{
+		ResourceMemoryUsage output;
+
+		// Note: Audio backends keep sample data in system memory, so it's all reported as CPU memory
+		switch (mDesc.readMode)
+		{
+		case AudioReadMode::LoadDecompressed:
+			output.cpu = (UINT64)mNumSamples * (mDesc.bitDepth / 8);
+
+			if (mKeepSourceData)
+				output.cpu += mStreamSize;
+			break;
+		case AudioReadMode::LoadCompressed:
+			output.cpu = mStreamSize;
+			break;
+		case AudioReadMode::Stream:
+			break;
+		}
+
+		return output;
+	}
+
 	HAudioClip AudioClip::create(const SPtr<DataStream>& samples, UINT32 streamSize, UINT32 numSamples, const AUDIO_CLIP_DESC& desc)
 	{
 		return static_resource_cast<AudioClip>(gResources()._createResourceHandle(_createPtr(samples, streamSize, numSamples, desc)));
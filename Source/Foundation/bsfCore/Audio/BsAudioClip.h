@@ -113,6 +113,9 @@ namespace bs
 		BS_SCRIPT_EXPORT(n:NumSamples,pr:getter)
 		UINT32 getNumSamples() const { return mNumSamples; }
 
+		/** @copydoc Resource::getMemoryUsage */
+		ResourceMemoryUsage getMemoryUsage() const override;
+
 		/** Determines will the clip be played a spatial 3D sound, or as a normal sound (for example music). */
 		BS_SCRIPT_EXPORT(n:Is3D,pr:getter)
 		bool is3D() const { return mDesc.is3D; }
@@ -45,6 +45,7 @@
 #include "Renderer/BsParamBlocks.h"
 #include "Particles/BsParticleManager.h"
 #include "Particles/BsVectorField.h"
+#include "Text/BsFontManager.h"
 
 namespace bs
 {
@@ -76,6 +77,9 @@ namespace bs
 		CrashHandler::startUp(desc.crashHandling);
 		if(desc.logCallback)
 			gDebug().setLogCallback(desc.logCallback);
+
+		// Format and dispatch log messages on a separate thread, so logging doesn't stall the threads doing the work
+		gDebug().startAsyncLogging();
 	}
 
 	CoreApplication::~CoreApplication()
@@ -94,6 +98,7 @@ namespace bs
 		ct::ParamBlockManager::shutDown();
 		StringTableManager::shutDown();
 		Resources::shutDown();
+		FontManager::shutDown();
 		GameObjectManager::shutDown();
 
 		// Audio manager must be released before the ResourceListenerManager, as any one-shot audio sources need to be
@@ -139,6 +144,7 @@ namespace bs
 		MemStack::endThread();
 		Platform::_shutDown();
 
+		gDebug().stopAsyncLogging();
 		CrashHandler::shutDown();
 	}
 
@@ -163,6 +169,7 @@ namespace bs
 		DynLibManager::startUp();
 		CoreObjectManager::startUp();
 		GameObjectManager::startUp();
+		FontManager::startUp();
 		Resources::startUp();
 		ResourceListenerManager::startUp();
 		GpuProgramManager::startUp();
@@ -286,6 +293,7 @@ namespace bs
 		PROFILE_CALL(gSceneManager()._update(), "Scene update");
 		gAudio()._update();
 		gPhysics().update();
+		gResources()._update();
 
 		// Update plugins
 		for (auto& pluginUpdateFunc : mPluginUpdateFunctions)
@@ -293,6 +301,9 @@ namespace bs
 
 		postUpdate();
 
+		// Upload any glyphs rasterized by dynamic fonts this frame (e.g. during GUI update)
+		FontManager::instance()._update();
+
 		PerFrameData perFrameData;
 
 		// Evaluate animation after scene and plugin updates because the renderer will just now be displaying the
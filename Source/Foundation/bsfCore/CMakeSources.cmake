@@ -111,6 +111,7 @@ set(BS_CORE_INC_RENDERER
 	"bsfCore/Renderer/BsIBLUtility.h"
 	"bsfCore/Renderer/BsGpuResourcePool.h"
 	"bsfCore/Renderer/BsDecal.h"
+	"bsfCore/Renderer/BsOcclusionBuffer.h"
 )
 
 set(BS_CORE_SRC_LOCALIZATION
@@ -243,6 +244,9 @@ set(BS_CORE_INC_TEXT
 	"bsfCore/Text/BsFontImportOptions.h"
 	"bsfCore/Text/BsFontDesc.h"
 	"bsfCore/Text/BsFont.h"
+	"bsfCore/Text/BsGlyphRasterizer.h"
+	"bsfCore/Text/BsFontManager.h"
+	"bsfCore/Text/BsDynamicFontAtlas.h"
 )
 
 set(BS_CORE_SRC_PROFILING
@@ -407,6 +411,7 @@ set(BS_CORE_SRC_RENDERER
 	"bsfCore/Renderer/BsIBLUtility.cpp"
 	"bsfCore/Renderer/BsGpuResourcePool.cpp"
 	"bsfCore/Renderer/BsDecal.cpp"
+	"bsfCore/Renderer/BsOcclusionBuffer.cpp"
 )
 
 set(BS_CORE_SRC_RESOURCES
@@ -463,6 +468,8 @@ set(BS_CORE_SRC_TEXT
 	"bsfCore/Text/BsFont.cpp"
 	"bsfCore/Text/BsFontImportOptions.cpp"
 	"bsfCore/Text/BsTextData.cpp"
+	"bsfCore/Text/BsFontManager.cpp"
+	"bsfCore/Text/BsDynamicFontAtlas.cpp"
 )
 
 set(BS_CORE_SRC_RENDERAPI
@@ -56,7 +56,25 @@ namespace bs
 		/** @copydoc Renderable::getCullDistanceFactor */
 		BS_SCRIPT_EXPORT(n:CullDistance, pr:getter)
 		float getCullDistanceFactor() const { return mInternal->getCullDistanceFactor(); }
-		
+
+		/** @copydoc Renderable::setLODMeshes */
+		void setLODMeshes(const Vector<HMesh>& meshes) { mInternal->setLODMeshes(meshes); }
+
+		/** @copydoc Renderable::getLODMeshes */
+		const Vector<HMesh>& getLODMeshes() const { return mInternal->getLODMeshes(); }
+
+		/** @copydoc Renderable::setLODScreenSizes */
+		void setLODScreenSizes(const Vector<float>& screenSizes) { mInternal->setLODScreenSizes(screenSizes); }
+
+		/** @copydoc Renderable::getLODScreenSizes */
+		const Vector<float>& getLODScreenSizes() const { return mInternal->getLODScreenSizes(); }
+
+		/** @copydoc Renderable::setOccluder */
+		void setOccluder(bool enable) { mInternal->setOccluder(enable); }
+
+		/** @copydoc Renderable::isOccluder */
+		bool isOccluder() const { return mInternal->isOccluder(); }
+
 		/** @copydoc Renderable::setLayer */
 		BS_SCRIPT_EXPORT(n:Layers,pr:setter)
 		void setLayer(UINT64 layer) { mInternal->setLayer(layer); }
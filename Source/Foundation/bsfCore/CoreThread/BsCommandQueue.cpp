@@ -4,6 +4,7 @@
 #include "Error/BsException.h"
 #include "CoreThread/BsCoreThread.h"
 #include "Debug/BsDebug.h"
+#include "Debug/BsProfilerTimeline.h"
 
 namespace bs
 {
@@ -104,6 +105,9 @@ namespace bs
 		if(commands == nullptr)
 			return;
 
+		static const UINT32 timelineEventId = ProfilerTimeline::getEventId("CommandBatch");
+		ProfilerTimelineScope timelineScope(timelineEventId);
+
 		while(!commands->empty())
 		{
 			QueuedCommand& command = commands->front();
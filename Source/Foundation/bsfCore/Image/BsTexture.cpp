@@ -167,6 +167,36 @@ namespace bs
 		return op;
 	}
 
+	ResourceMemoryUsage Texture::getMemoryUsage() const
+	{
+		ResourceMemoryUsage output;
+
+		UINT32 width = mProperties.getWidth();
+		UINT32 height = mProperties.getHeight();
+		UINT32 depth = mProperties.getDepth();
+		for (UINT32 mip = 0; mip <= mProperties.getNumMipmaps(); mip++)
+		{
+			output.gpu += PixelUtil::getMemorySize(width, height, depth, mProperties.getFormat());
+
+			width = std::max(1U, width / 2);
+			height = std::max(1U, height / 2);
+			depth = std::max(1U, depth / 2);
+		}
+
+		output.gpu *= mProperties.getNumFaces() * std::max(1U, mProperties.getNumSamples());
+
+		for (auto& subresource : mCPUSubresourceData)
+		{
+			if (subresource != nullptr)
+				output.cpu += subresource->getSize();
+		}
+
+		if (mInitData != nullptr)
+			output.cpu += mInitData->getSize();
+
+		return output;
+	}
+
 	UINT32 Texture::calculateSize() const
 	{
 		return mProperties.getNumFaces() * PixelUtil::getMemorySize(mProperties.getWidth(),
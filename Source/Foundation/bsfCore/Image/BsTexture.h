@@ -270,6 +270,9 @@ namespace bs
 		/**	Retrieves a core implementation of a texture usable only from the core thread. */
 		SPtr<ct::Texture> getCore() const;
 
+		/** @copydoc Resource::getMemoryUsage */
+		ResourceMemoryUsage getMemoryUsage() const override;
+
 		/************************************************************************/
 		/* 								STATICS		                     		*/
 		/************************************************************************/
@@ -144,6 +144,23 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		Vector<ImportedAnimationEvents> animationEvents;
 
+		/**
+		 * If enabled, triangles and vertices of the imported mesh will be reordered for more efficient rendering. Triangles
+		 * are ordered so they make better use of the post-transform vertex cache and cause less overdraw, and vertices
+		 * are ordered so they are read from memory sequentially. Statistics before and after the optimization are logged.
+		 */
+		bool optimizeMesh = false;
+
+		/**
+		 * Number of lower detail versions of the mesh to generate by simplifying the imported geometry. Generated meshes
+		 * are available as sub-resources returned by the importer, named "LOD1", "LOD2" and so on, and can be assigned to
+		 * a Renderable through Renderable::setLODMeshes().
+		 */
+		UINT32 numGeneratedLODs = 0;
+
+		/** Fraction of triangles each generated level of detail keeps, relative to the previous level. */
+		float lodTriangleRatio = 0.5f;
+
 		/** Creates a new import options object that allows you to customize how are meshes imported. */
 		BS_SCRIPT_EXPORT(ec:T)
 		static SPtr<MeshImportOptions> create();
@@ -32,13 +32,20 @@ namespace bs
 	{
 	String sNullLang = "null";
 
-	/** Null GPU program used in place of GPU programs we cannot create. Null programs don't do anything. */
+	/**
+	 * Null GPU program used in place of GPU programs we cannot create. Null programs don't do anything, but they do report
+	 * the parameters described by the bytecode they were created with, so materials bind parameters the same as they
+	 * would on a real backend.
+	 */
 	class NullProgram final : public GpuProgram
 	{
 	public:
-		NullProgram()
+		NullProgram(const GPU_PROGRAM_DESC& desc = GPU_PROGRAM_DESC())
 			:GpuProgram(GPU_PROGRAM_DESC(), GDF_DEFAULT)
-		{ }
+		{
+			if(desc.bytecode != nullptr && desc.bytecode->paramDesc != nullptr)
+				mParametersDesc = desc.bytecode->paramDesc;
+		}
 
 		~NullProgram() = default;
 
@@ -47,7 +54,7 @@ namespace bs
 
 	SPtr<GpuProgram> NullProgramFactory::create(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask)
 	{
-		SPtr<NullProgram> ret = bs_shared_ptr_new<NullProgram>();
+		SPtr<NullProgram> ret = bs_shared_ptr_new<NullProgram>(desc);
 		ret->_setThisPtr(ret);
 
 		return ret;
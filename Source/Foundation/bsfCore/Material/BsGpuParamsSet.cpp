@@ -800,6 +800,53 @@ namespace bs
 			bs_frame_free(offsets);
 		}
 		bs_frame_clear();
+
+		// Group bindings of all parameters by material parameter, so modified parameters can be updated directly
+		const UINT32 numMaterialParams = params->getNumParams();
+		mParamBindingOffsets.resize(numMaterialParams + 1, 0);
+
+		Vector<ParamBinding> bindings;
+		for (UINT32 i = 0; i < (UINT32)mDataParamInfos.size(); i++)
+			bindings.push_back({ ParamBindingType::Data, 0, i, nullptr });
+
+		for (UINT32 i = 0; i < numPasses; i++)
+		{
+			for (UINT32 j = 0; j < NUM_STAGES; j++)
+			{
+				const StageParamInfo& stageInfo = mPassParamInfos[i].stages[j];
+
+				for (UINT32 k = 0; k < stageInfo.numTextures; k++)
+					bindings.push_back({ ParamBindingType::Texture, i, 0, &stageInfo.textures[k] });
+
+				for (UINT32 k = 0; k < stageInfo.numLoadStoreTextures; k++)
+					bindings.push_back({ ParamBindingType::LoadStoreTexture, i, 0, &stageInfo.loadStoreTextures[k] });
+
+				for (UINT32 k = 0; k < stageInfo.numBuffers; k++)
+					bindings.push_back({ ParamBindingType::Buffer, i, 0, &stageInfo.buffers[k] });
+
+				for (UINT32 k = 0; k < stageInfo.numSamplerStates; k++)
+					bindings.push_back({ ParamBindingType::SamplerState, i, 0, &stageInfo.samplerStates[k] });
+			}
+		}
+
+		auto getParamIdx = [this](const ParamBinding& binding)
+		{
+			if (binding.type == ParamBindingType::Data)
+				return mDataParamInfos[binding.index].paramIdx;
+
+			return binding.objectParam->paramIdx;
+		};
+
+		for (auto& binding : bindings)
+			mParamBindingOffsets[getParamIdx(binding) + 1]++;
+
+		for (UINT32 i = 0; i < numMaterialParams; i++)
+			mParamBindingOffsets[i + 1] += mParamBindingOffsets[i];
+
+		Vector<UINT32> fillOffsets(mParamBindingOffsets.begin(), mParamBindingOffsets.end() - 1);
+		mParamBindings.resize(bindings.size());
+		for (auto& binding : bindings)
+			mParamBindings[fillOffsets[getParamIdx(binding)]++] = binding;
 	}
 
 	template<bool Core>
@@ -885,301 +932,382 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TGpuParamsSet<Core>::update(const SPtr<MaterialParamsType>& params, float t, bool updateAll)
+	bool TGpuParamsSet<Core>::isAnimated(const MaterialParamsType& params, const MaterialParamsBase::ParamData& paramData)
 	{
-		// Note: Instead of iterating over every single parameter, it might be more efficient for @p params to keep
-		// a ring buffer and a version number. Then we could just iterate over the ring buffer and only access dirty
-		// parameters. If the version number is too high (larger than ring buffer can store), then we force update for all.
-
-		// Update data params
-		for(auto& paramInfo : mDataParamInfos)
+		const UINT32 arraySize = paramData.arraySize == 0 ? 1 : paramData.arraySize;
+		for(UINT32 i = 0; i < arraySize; i++)
 		{
-			ParamBlockPtrType paramBlock = mBlocks[paramInfo.blockIdx].buffer;
-			if (paramBlock == nullptr || !mBlocks[paramInfo.blockIdx].allowUpdate)
-				continue;
+			if(params.isAnimated(paramData, i))
+				return true;
+		}
 
-			const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-			UINT32 arraySize = materialParamInfo->arraySize == 0 ? 1 : materialParamInfo->arraySize;
-			
-			bool isAnimated = false;
-			for(UINT32 i = 0; i < arraySize; i++)
-			{
-				isAnimated = params->isAnimated(*materialParamInfo, i);
-				if(isAnimated)
-					break;
-			}
+		return false;
+	}
 
-			if (materialParamInfo->version <= mParamVersion && !updateAll && !isAnimated)
-				continue;
+	template<bool Core>
+	void TGpuParamsSet<Core>::writeDataParam(const MaterialParamsType& params, const DataParamInfo& paramInfo,
+		bool isAnimated, float t)
+	{
+		ParamBlockPtrType paramBlock = mBlocks[paramInfo.blockIdx].buffer;
+		if (paramBlock == nullptr || !mBlocks[paramInfo.blockIdx].allowUpdate)
+			return;
 
-			if(materialParamInfo->dataType != GPDT_STRUCT)
-			{
-				const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)materialParamInfo->dataType];
+		const MaterialParams::ParamData* materialParamInfo = params.getParamData(paramInfo.paramIdx);
+		UINT32 arraySize = materialParamInfo->arraySize == 0 ? 1 : materialParamInfo->arraySize;
 
-				UINT32 paramSize;
-				if(materialParamInfo->dataType != GPDT_COLOR)
-					paramSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
-				else
-					paramSize = paramInfo.arrayStride * typeInfo.baseTypeSize;
+		if(materialParamInfo->dataType != GPDT_STRUCT)
+		{
+			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)materialParamInfo->dataType];
 
-				UINT8* data = params->getData(materialParamInfo->index);
-				if (!isAnimated)
+			UINT32 paramSize;
+			if(materialParamInfo->dataType != GPDT_COLOR)
+				paramSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
+			else
+				paramSize = paramInfo.arrayStride * typeInfo.baseTypeSize;
+
+			UINT8* data = params.getData(materialParamInfo->index);
+			if (!isAnimated)
+			{
+				const bool transposeMatrices = ct::gCaps().conventions.matrixOrder == Conventions::MatrixOrder::ColumnMajor;
+				if (transposeMatrices)
 				{
-					const bool transposeMatrices = ct::gCaps().conventions.matrixOrder == Conventions::MatrixOrder::ColumnMajor;
-					if (transposeMatrices)
+					auto writeTransposed = [&paramInfo, &paramSize, &arraySize, &paramBlock, data](auto& temp)
 					{
-						auto writeTransposed = [&paramInfo, &paramSize, &arraySize, &paramBlock, data](auto& temp)
-						{
-							for (UINT32 i = 0; i < arraySize; i++)
-							{
-								UINT32 readOffset = i * paramSize;
-								memcpy(&temp, data + readOffset, paramSize);
-								auto transposed = temp.transpose();
-
-								UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
-								paramBlock->write(writeOffset, &transposed, paramSize);
-							}
-						};
-
-						switch (materialParamInfo->dataType)
-						{
-						case GPDT_MATRIX_2X2:
-						{
-							MatrixNxM<2, 2> matrix;
-							writeTransposed(matrix);
-						}
-						break;
-						case GPDT_MATRIX_2X3:
-						{
-							MatrixNxM<2, 3> matrix;
-							writeTransposed(matrix);
-						}
-						break;
-						case GPDT_MATRIX_2X4:
-						{
-							MatrixNxM<2, 4> matrix;
-							writeTransposed(matrix);
-						}
-						break;
-						case GPDT_MATRIX_3X2:
-						{
-							MatrixNxM<3, 2> matrix;
-							writeTransposed(matrix);
-						}
-						break;
-						case GPDT_MATRIX_3X3:
-						{
-							Matrix3 matrix;
-							writeTransposed(matrix);
-						}
-						break;
-						case GPDT_MATRIX_3X4:
-						{
-							MatrixNxM<3, 4> matrix;
-							writeTransposed(matrix);
-						}
-						break;
-						case GPDT_MATRIX_4X2:
-						{
-							MatrixNxM<4, 2> matrix;
-							writeTransposed(matrix);
-						}
-						break;
-						case GPDT_MATRIX_4X3:
-						{
-							MatrixNxM<4, 3> matrix;
-							writeTransposed(matrix);
-						}
-						break;
-						case GPDT_MATRIX_4X4:
-						{
-							Matrix4 matrix;
-							writeTransposed(matrix);
-						}
-						break;
-						default:
+						for (UINT32 i = 0; i < arraySize; i++)
 						{
-							for (UINT32 i = 0; i < arraySize; i++)
-							{
-								UINT32 arrayOffset = i * paramSize;
-								UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
-								paramBlock->write(writeOffset, data + arrayOffset, paramSize);
-							}
-							break;
-						}
+							UINT32 readOffset = i * paramSize;
+							memcpy(&temp, data + readOffset, paramSize);
+							auto transposed = temp.transpose();
+
+							UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
+							paramBlock->write(writeOffset, &transposed, paramSize);
 						}
+					};
+
+					switch (materialParamInfo->dataType)
+					{
+					case GPDT_MATRIX_2X2:
+					{
+						MatrixNxM<2, 2> matrix;
+						writeTransposed(matrix);
 					}
-					else
+					break;
+					case GPDT_MATRIX_2X3:
+					{
+						MatrixNxM<2, 3> matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					case GPDT_MATRIX_2X4:
+					{
+						MatrixNxM<2, 4> matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					case GPDT_MATRIX_3X2:
+					{
+						MatrixNxM<3, 2> matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					case GPDT_MATRIX_3X3:
+					{
+						Matrix3 matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					case GPDT_MATRIX_3X4:
+					{
+						MatrixNxM<3, 4> matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					case GPDT_MATRIX_4X2:
+					{
+						MatrixNxM<4, 2> matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					case GPDT_MATRIX_4X3:
+					{
+						MatrixNxM<4, 3> matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					case GPDT_MATRIX_4X4:
+					{
+						Matrix4 matrix;
+						writeTransposed(matrix);
+					}
+					break;
+					default:
 					{
 						for (UINT32 i = 0; i < arraySize; i++)
 						{
-							UINT32 readOffset = i * paramSize;
+							UINT32 arrayOffset = i * paramSize;
 							UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
-							paramBlock->write(writeOffset, data + readOffset, paramSize);
+							paramBlock->write(writeOffset, data + arrayOffset, paramSize);
 						}
+						break;
+					}
 					}
 				}
-				else // Animated
+				else
 				{
-					if (materialParamInfo->dataType == GPDT_FLOAT1)
+					for (UINT32 i = 0; i < arraySize; i++)
 					{
-						assert(paramSize == sizeof(float));
-
-						for (UINT32 i = 0; i < arraySize; i++)
-						{
-							UINT32 readOffset = i * paramSize;
-							UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
+						UINT32 readOffset = i * paramSize;
+						UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
+						paramBlock->write(writeOffset, data + readOffset, paramSize);
+					}
+				}
+			}
+			else // Animated
+			{
+				if (materialParamInfo->dataType == GPDT_FLOAT1)
+				{
+					assert(paramSize == sizeof(float));
 
-							float value;
-							if (params->isAnimated(*materialParamInfo, i))
-							{
-								const TAnimationCurve<float>& curve = params->template getCurveParam<float>(*materialParamInfo, i);
+					for (UINT32 i = 0; i < arraySize; i++)
+					{
+						UINT32 readOffset = i * paramSize;
+						UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
 
-								value = curve.evaluate(t, true);
-							}
-							else
-								memcpy(&value, data + readOffset, paramSize);
+						float value;
+						if (params.isAnimated(*materialParamInfo, i))
+						{
+							const TAnimationCurve<float>& curve = params.template getCurveParam<float>(*materialParamInfo, i);
 
-							paramBlock->write(writeOffset, &value, paramSize);
+							value = curve.evaluate(t, true);
 						}
+						else
+							memcpy(&value, data + readOffset, paramSize);
+
+						paramBlock->write(writeOffset, &value, paramSize);
 					}
-					else if (materialParamInfo->dataType == GPDT_FLOAT4)
-					{
-						assert(paramSize == sizeof(Rect2));
+				}
+				else if (materialParamInfo->dataType == GPDT_FLOAT4)
+				{
+					assert(paramSize == sizeof(Rect2));
 
-						CoreVariantHandleType<SpriteTexture, Core> spriteTexture =
-							params->getOwningSpriteTexture(*materialParamInfo);
+					CoreVariantHandleType<SpriteTexture, Core> spriteTexture =
+						params.getOwningSpriteTexture(*materialParamInfo);
 
-						UINT32 writeOffset = paramInfo.offset * sizeof(UINT32);
-						Rect2 uv = Rect2(0.0f, 0.0f, 1.0f, 1.0f);
-						if (spriteTexture != nullptr)
-							uv = spriteTexture->evaluate(t);
+					UINT32 writeOffset = paramInfo.offset * sizeof(UINT32);
+					Rect2 uv = Rect2(0.0f, 0.0f, 1.0f, 1.0f);
+					if (spriteTexture != nullptr)
+						uv = spriteTexture->evaluate(t);
 
-						paramBlock->write(writeOffset, &uv, paramSize);
+					paramBlock->write(writeOffset, &uv, paramSize);
 
-						// Only the first array element receives sprite UVs, the rest are treated as normal
-						for (UINT32 i = 1; i < arraySize; i++)
-						{
-							UINT32 readOffset = i * paramSize;
-							writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
+					// Only the first array element receives sprite UVs, the rest are treated as normal
+					for (UINT32 i = 1; i < arraySize; i++)
+					{
+						UINT32 readOffset = i * paramSize;
+						writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
 
-							paramBlock->write(writeOffset, data + readOffset, paramSize);
-						}
+						paramBlock->write(writeOffset, data + readOffset, paramSize);
 					}
-					else if (materialParamInfo->dataType == GPDT_COLOR)
+				}
+				else if (materialParamInfo->dataType == GPDT_COLOR)
+				{
+					for (UINT32 i = 0; i < arraySize; i++)
 					{
-						for (UINT32 i = 0; i < arraySize; i++)
-						{
-							assert(paramSize == sizeof(Color));
+						assert(paramSize == sizeof(Color));
 
-							UINT32 readOffset = i * paramSize;
-							UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
-
-							Color value;
-							if (params->isAnimated(*materialParamInfo, i))
-							{
-								const ColorGradientHDR& gradient = params->getColorGradientParam(*materialParamInfo, i);
+						UINT32 readOffset = i * paramSize;
+						UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
 
-								const float wrappedT = Math::repeat(t, gradient.getDuration());
-								value = gradient.evaluate(wrappedT);
-							}
-							else
-								memcpy(&value, data + readOffset, paramSize);
+						Color value;
+						if (params.isAnimated(*materialParamInfo, i))
+						{
+							const ColorGradientHDR& gradient = params.getColorGradientParam(*materialParamInfo, i);
 
-							paramBlock->write(writeOffset, &value, paramSize);
+							const float wrappedT = Math::repeat(t, gradient.getDuration());
+							value = gradient.evaluate(wrappedT);
 						}
+						else
+							memcpy(&value, data + readOffset, paramSize);
+
+						paramBlock->write(writeOffset, &value, paramSize);
 					}
 				}
 			}
-			else
+		}
+		else
+		{
+			UINT32 paramSize = params.getStructSize(*materialParamInfo);
+			void* paramData = bs_stack_alloc(paramSize);
+			for (UINT32 i = 0; i < arraySize; i++)
 			{
-				UINT32 paramSize = params->getStructSize(*materialParamInfo);
-				void* paramData = bs_stack_alloc(paramSize);
-				for (UINT32 i = 0; i < arraySize; i++)
-				{
-					params->getStructData(*materialParamInfo, paramData, paramSize, i);
+				params.getStructData(*materialParamInfo, paramData, paramSize, i);
 
-					UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
-					paramBlock->write(writeOffset, paramData, paramSize);
-				}	
-				bs_stack_free(paramData);
-			}
+				UINT32 writeOffset = (paramInfo.offset + paramInfo.arrayStride * i) * sizeof(UINT32);
+				paramBlock->write(writeOffset, paramData, paramSize);
+			}	
+			bs_stack_free(paramData);
 		}
+	}
 
-		// Update object params
-		const auto numPasses = (UINT32)mPassParams.size();
+	template<bool Core>
+	void TGpuParamsSet<Core>::writeObjectParam(const MaterialParamsType& params, UINT32 passIdx, ParamBindingType type,
+		const ObjectParamInfo& paramInfo)
+	{
+		const SPtr<GpuParamsType>& paramPtr = mPassParams[passIdx];
+		const MaterialParams::ParamData* materialParamInfo = params.getParamData(paramInfo.paramIdx);
 
-		for(UINT32 i = 0; i < numPasses; i++)
+		switch(type)
 		{
-			SPtr<GpuParamsType> paramPtr = mPassParams[i];
+		case ParamBindingType::Texture:
+		{
+			TextureSurface surface;
+			TextureType texture;
+			params.getTexture(*materialParamInfo, texture, surface);
 
-			for(UINT32 j = 0; j < NUM_STAGES; j++)
-			{
-				const StageParamInfo& stageInfo = mPassParamInfos[i].stages[j];
+			paramPtr->setTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
+		}
+		break;
+		case ParamBindingType::LoadStoreTexture:
+		{
+			TextureSurface surface;
+			TextureType texture;
+			params.getLoadStoreTexture(*materialParamInfo, texture, surface);
 
-				for(UINT32 k = 0; k < stageInfo.numTextures; k++)
-				{
-					const ObjectParamInfo& paramInfo = stageInfo.textures[k];
+			paramPtr->setLoadStoreTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
+		}
+		break;
+		case ParamBindingType::Buffer:
+		{
+			BufferType buffer;
+			params.getBuffer(*materialParamInfo, buffer);
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+			paramPtr->setBuffer(paramInfo.setIdx, paramInfo.slotIdx, buffer);
+		}
+		break;
+		case ParamBindingType::SamplerState:
+		{
+			SamplerStateType samplerState;
+			params.getSamplerState(*materialParamInfo, samplerState);
 
-					TextureSurface surface;
-					TextureType texture;
-					params->getTexture(*materialParamInfo, texture, surface);
+			paramPtr->setSamplerState(paramInfo.setIdx, paramInfo.slotIdx, samplerState);
+		}
+		break;
+		default:
+			break;
+		}
+	}
 
-					paramPtr->setTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
-				}
+	template<bool Core>
+	void TGpuParamsSet<Core>::update(const SPtr<MaterialParamsType>& params, float t, bool updateAll)
+	{
+		const UINT64 paramVersion = params->getParamVersion();
 
-				for (UINT32 k = 0; k < stageInfo.numLoadStoreTextures; k++)
-				{
-					const ObjectParamInfo& paramInfo = stageInfo.loadStoreTextures[k];
+		// If only a few parameters changed since the last update, find them through the dirty parameter ring buffer
+		// instead of checking every parameter
+		const bool updateDirtyOnly = !updateAll && params.get() == mLastParams && !mParamBindingOffsets.empty() &&
+			paramVersion - mParamVersion <= MaterialParamsBase::DIRTY_PARAM_RING_SIZE;
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+		if(updateDirtyOnly)
+		{
+			bool objectParamsDirty = false;
+			for(UINT64 version = mParamVersion + 1; version <= paramVersion; version++)
+			{
+				const UINT32 paramIdx = params->getDirtyParam(version);
+				const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramIdx);
 
-					TextureSurface surface;
-					TextureType texture;
-					params->getLoadStoreTexture(*materialParamInfo, texture, surface);
+				// Parameter was modified again afterwards, handle it only once, at its latest version
+				if(materialParamInfo->version != version)
+					continue;
 
-					paramPtr->setLoadStoreTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
+				for(UINT32 i = mParamBindingOffsets[paramIdx]; i < mParamBindingOffsets[paramIdx + 1]; i++)
+				{
+					const ParamBinding& binding = mParamBindings[i];
+					if(binding.type == ParamBindingType::Data)
+					{
+						const bool animated = isAnimated(*params, *materialParamInfo);
+						writeDataParam(*params, mDataParamInfos[binding.index], animated, t);
+
+						auto iterFind = std::find(mAnimatedDataParams.begin(), mAnimatedDataParams.end(), binding.index);
+						if(animated && iterFind == mAnimatedDataParams.end())
+							mAnimatedDataParams.push_back(binding.index);
+						else if(!animated && iterFind != mAnimatedDataParams.end())
+							mAnimatedDataParams.erase(iterFind);
+					}
+					else
+					{
+						writeObjectParam(*params, binding.passIdx, binding.type, *binding.objectParam);
+						objectParamsDirty = true;
+					}
 				}
+			}
 
-				for (UINT32 k = 0; k < stageInfo.numBuffers; k++)
-				{
-					const ObjectParamInfo& paramInfo = stageInfo.buffers[k];
+			// Animated parameters need to be re-evaluated every update
+			for(auto& entry : mAnimatedDataParams)
+				writeDataParam(*params, mDataParamInfos[entry], true, t);
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+			if(objectParamsDirty)
+			{
+				for(auto& paramPtr : mPassParams)
+					paramPtr->_markCoreDirty();
+			}
+		}
+		else
+		{
+			// Update data params
+			mAnimatedDataParams.clear();
+			for(UINT32 i = 0; i < (UINT32)mDataParamInfos.size(); i++)
+			{
+				const DataParamInfo& paramInfo = mDataParamInfos[i];
+				const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
 
-					BufferType buffer;
-					params->getBuffer(*materialParamInfo, buffer);
+				const bool animated = isAnimated(*params, *materialParamInfo);
+				if(animated)
+					mAnimatedDataParams.push_back(i);
 
-					paramPtr->setBuffer(paramInfo.setIdx, paramInfo.slotIdx, buffer);
-				}
+				if (materialParamInfo->version <= mParamVersion && !updateAll && !animated)
+					continue;
 
-				for (UINT32 k = 0; k < stageInfo.numSamplerStates; k++)
+				writeDataParam(*params, paramInfo, animated, t);
+			}
+
+			// Update object params
+			const auto numPasses = (UINT32)mPassParams.size();
+
+			for(UINT32 i = 0; i < numPasses; i++)
+			{
+				for(UINT32 j = 0; j < NUM_STAGES; j++)
 				{
-					const ObjectParamInfo& paramInfo = stageInfo.samplerStates[k];
+					const StageParamInfo& stageInfo = mPassParamInfos[i].stages[j];
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+					auto updateObjectParams = [&](const ObjectParamInfo* paramInfos, UINT32 numParams,
+						ParamBindingType type)
+					{
+						for(UINT32 k = 0; k < numParams; k++)
+						{
+							const ObjectParamInfo& paramInfo = paramInfos[k];
 
-					SamplerStateType samplerState;
-					params->getSamplerState(*materialParamInfo, samplerState);
+							const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
+							if (materialParamInfo->version <= mParamVersion && !updateAll)
+								continue;
+
+							writeObjectParam(*params, i, type, paramInfo);
+						}
+					};
 
-					paramPtr->setSamplerState(paramInfo.setIdx, paramInfo.slotIdx, samplerState);
+					updateObjectParams(stageInfo.textures, stageInfo.numTextures, ParamBindingType::Texture);
+					updateObjectParams(stageInfo.loadStoreTextures, stageInfo.numLoadStoreTextures,
+						ParamBindingType::LoadStoreTexture);
+					updateObjectParams(stageInfo.buffers, stageInfo.numBuffers, ParamBindingType::Buffer);
+					updateObjectParams(stageInfo.samplerStates, stageInfo.numSamplerStates,
+						ParamBindingType::SamplerState);
 				}
-			}
 
-			paramPtr->_markCoreDirty();
+				mPassParams[i]->_markCoreDirty();
+			}
 		}
 
-		mParamVersion = params->getParamVersion();
+		mParamVersion = paramVersion;
+		mLastParams = params.get();
 	}
 
 	template class TGpuParamsSet <false>;
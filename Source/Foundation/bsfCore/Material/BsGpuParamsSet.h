@@ -99,6 +99,21 @@ namespace bs
 			StageParamInfo stages[GPT_COUNT];
 		};
 
+		/** Types of bindings a material parameter can have within the parameter set. */
+		enum class ParamBindingType
+		{
+			Data, Texture, LoadStoreTexture, Buffer, SamplerState
+		};
+
+		/** Location of a single binding of a material parameter, used for updating only the modified parameters. */
+		struct ParamBinding
+		{
+			ParamBindingType type;
+			UINT32 passIdx;
+			UINT32 index;
+			const ObjectParamInfo* objectParam;
+		};
+
 	public:
 		TGpuParamsSet() = default;
 		TGpuParamsSet(const SPtr<TechniqueType>& technique, const ShaderType& shader,
@@ -171,11 +186,35 @@ namespace bs
 	private:
 		template<bool Core2> friend class TMaterial;
 
+		/** Checks if any array element of the provided data parameter is animated. */
+		static bool isAnimated(const MaterialParamsType& params, const MaterialParamsBase::ParamData& paramData);
+
+		/**
+		 * Writes the value of a data parameter into its parameter block buffer. Animated values are evaluated at time
+		 * @p t.
+		 */
+		void writeDataParam(const MaterialParamsType& params, const DataParamInfo& paramInfo, bool isAnimated, float t);
+
+		/** Assigns the value of an object parameter to the GPU parameters of the specified pass. */
+		void writeObjectParam(const MaterialParamsType& params, UINT32 passIdx, ParamBindingType type,
+			const ObjectParamInfo& paramInfo);
+
 		Vector<SPtr<GpuParamsType>> mPassParams;
 		Vector<BlockInfo> mBlocks;
 		Vector<DataParamInfo> mDataParamInfos;
 		PassParamInfo* mPassParamInfos;
 
+		/**
+		 * Bindings of all material parameters, grouped per material parameter. Bindings of parameter with index i are
+		 * in range [mParamBindingOffsets[i], mParamBindingOffsets[i + 1]).
+		 */
+		Vector<ParamBinding> mParamBindings;
+		Vector<UINT32> mParamBindingOffsets;
+
+		/** Indices into mDataParamInfos for parameters that need to be re-evaluated on every update. */
+		Vector<UINT32> mAnimatedDataParams;
+
+		const MaterialParamsType* mLastParams = nullptr;
 		UINT64 mParamVersion;
 		UINT8* mData;
 	};
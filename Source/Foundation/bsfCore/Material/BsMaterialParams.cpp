@@ -234,7 +234,7 @@ namespace bs
 
 		paramInfo.colorGradient = bs_pool_new<ColorGradientHDR>(input);
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	UINT32 MaterialParamsBase::getParamIndex(const String& name) const
@@ -643,7 +643,7 @@ namespace bs
 		}
 
 		memcpy(structParam.data, value, structParam.dataSize);
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -675,7 +675,7 @@ namespace bs
 		textureParam.isLoadStore = false;
 		textureParam.surface = surface;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -694,7 +694,7 @@ namespace bs
 		textureParam.isLoadStore = false;
 		textureParam.surface = TextureSurface::COMPLETE;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -708,7 +708,7 @@ namespace bs
 	{
 		mBufferParams[param.index].value = value;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -728,7 +728,7 @@ namespace bs
 		textureParam.isLoadStore = true;
 		textureParam.surface = surface;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -742,7 +742,7 @@ namespace bs
 	{
 		mSamplerStateParams[param.index].value = value;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -1235,8 +1235,6 @@ namespace bs
 		rtti_read(numDirtySamplerParams, stream);
 		rtti_read(numDirtyStructParams, stream);
 
-		mParamVersion++;
-
 		for(UINT32 i = 0; i < numDirtyDataParams; i++)
 		{
 			// Param index
@@ -1244,7 +1242,7 @@ namespace bs
 			rtti_read(paramIdx, stream);
 
 			ParamData& param = mParams[paramIdx];
-			param.version = mParamVersion;
+			markParamDirty(param);
 
 			const UINT32 arraySize = param.arraySize > 1 ? param.arraySize : 1;
 			const GpuParamDataTypeInfo& typeInfo = bs::GpuParams::PARAM_SIZES.lookup[(int)param.dataType];
@@ -1292,7 +1290,7 @@ namespace bs
 			rtti_read(paramIdx, stream);
 
 			ParamData& param = mParams[paramIdx];
-			param.version = mParamVersion;
+			markParamDirty(param);
 
 			MaterialParamTextureDataCore* sourceTexData = (MaterialParamTextureDataCore*)stream.cursor();
 			stream.skipBytes(sizeof(MaterialParamTextureDataCore));
@@ -1307,7 +1305,7 @@ namespace bs
 			rtti_read(paramIdx, stream);
 
 			ParamData& param = mParams[paramIdx];
-			param.version = mParamVersion;
+			markParamDirty(param);
 
 			MaterialParamBufferDataCore* sourceBufferData = (MaterialParamBufferDataCore*)stream.cursor();
 			stream.skipBytes(sizeof(MaterialParamBufferDataCore));
@@ -1322,7 +1320,7 @@ namespace bs
 			rtti_read(paramIdx, stream);
 
 			ParamData& param = mParams[paramIdx];
-			param.version = mParamVersion;
+			markParamDirty(param);
 
 			MaterialParamSamplerStateDataCore* sourceSamplerStateData = (MaterialParamSamplerStateDataCore*)stream.cursor();
 			stream.skipBytes(sizeof(MaterialParamSamplerStateDataCore));
@@ -1338,7 +1336,7 @@ namespace bs
 			rtti_read(paramIdx, stream);
 
 			ParamData& param = mParams[paramIdx];
-			param.version = mParamVersion;
+			markParamDirty(param);
 
 			const UINT32 arraySize = param.arraySize > 1 ? param.arraySize : 1;
 			const ParamStructDataType& paramData = mStructParams[param.index];
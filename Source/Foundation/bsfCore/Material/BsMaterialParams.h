@@ -321,7 +321,7 @@ namespace bs
 			assert(sizeof(input) == paramTypeSize);
 			memcpy(&mDataParamsBuffer[paramInfo.offset], &input, paramTypeSize);
 
-			param.version = ++mParamVersion;
+			markParamDirty(param);
 		}
 
 		/**
@@ -365,7 +365,7 @@ namespace bs
 
 				paramInfo.floatCurve = bs_pool_new<TAnimationCurve<T>>(std::move(input));
 
-				param.version = ++mParamVersion;
+				markParamDirty(param);
 			}
 		}
 
@@ -392,9 +392,31 @@ namespace bs
 		/** Returns a counter that gets incremented whenever a parameter gets updated. */
 		UINT64 getParamVersion() const { return mParamVersion; }
 
+		/**
+		 * Returns the index of the parameter that was modified when the parameter version counter was incremented to
+		 * @p version. Only the last DIRTY_PARAM_RING_SIZE versions are tracked, for older versions the returned value
+		 * is undefined.
+		 */
+		UINT32 getDirtyParam(UINT64 version) const { return mDirtyParams[version % DIRTY_PARAM_RING_SIZE]; }
+
+		/**
+		 * Number of most recent parameter modifications tracked in the dirty parameter ring buffer. See getDirtyParam().
+		 */
+		static constexpr UINT32 DIRTY_PARAM_RING_SIZE = 64;
+
 	protected:
 		const static UINT32 STATIC_BUFFER_SIZE = 256;
 
+		/**
+		 * Increments the parameter version counter, assigns the new version to the parameter and records it in the
+		 * dirty parameter ring buffer.
+		 */
+		void markParamDirty(const ParamData& param) const
+		{
+			param.version = ++mParamVersion;
+			mDirtyParams[mParamVersion % DIRTY_PARAM_RING_SIZE] = (UINT32)(&param - mParams.data());
+		}
+
 		UnorderedMap<String, UINT32> mParamLookup;
 		Vector<ParamData> mParams;
 
@@ -409,6 +431,7 @@ namespace bs
 		UINT32 mNumSamplerParams = 0;
 
 		mutable UINT64 mParamVersion = 1;
+		mutable UINT32 mDirtyParams[DIRTY_PARAM_RING_SIZE] = { };
 		mutable StaticAlloc<STATIC_BUFFER_SIZE> mAlloc;
 	};
 
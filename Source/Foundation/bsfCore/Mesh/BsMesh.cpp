@@ -104,6 +104,22 @@ namespace bs
 		return std::static_pointer_cast<ct::Mesh>(mCoreSpecific);
 	}
 
+	ResourceMemoryUsage Mesh::getMemoryUsage() const
+	{
+		ResourceMemoryUsage output;
+
+		if (mVertexDesc != nullptr)
+			output.gpu += (UINT64)mProperties.getNumVertices() * mVertexDesc->getVertexStride();
+
+		const UINT32 indexSize = mIndexType == IT_16BIT ? sizeof(UINT16) : sizeof(UINT32);
+		output.gpu += (UINT64)mProperties.getNumIndices() * indexSize;
+
+		if (mCPUData != nullptr)
+			output.cpu += mCPUData->getSize();
+
+		return output;
+	}
+
 	SPtr<ct::CoreObject> Mesh::createCore() const
 	{
 		MESH_DESC desc;
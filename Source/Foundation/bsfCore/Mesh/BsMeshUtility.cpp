@@ -5,6 +5,9 @@
 #include "Math/BsVector3.h"
 #include "Math/BsVector2.h"
 #include "Math/BsPlane.h"
+#include "Mesh/BsMeshData.h"
+#include "RenderAPI/BsSubMesh.h"
+#include "RenderAPI/BsVertexDataDesc.h"
 
 namespace bs
 {
@@ -724,6 +727,60 @@ namespace bs
 		bs_frame_clear();
 	}
 
+	/** Symmetric 4x4 matrix accumulating the squared distances to a set of planes, used for mesh simplification. */
+	struct Quadric
+	{
+		/** Adds a plane with the provided normal and distance to the quadric, scaled by the provided weight. */
+		void addPlane(const Vector3& normal, float distance, float weight)
+		{
+			const double a = normal.x;
+			const double b = normal.y;
+			const double c = normal.z;
+			const double d = distance;
+
+			a00 += weight * a * a; a01 += weight * a * b; a02 += weight * a * c; a03 += weight * a * d;
+			a11 += weight * b * b; a12 += weight * b * c; a13 += weight * b * d;
+			a22 += weight * c * c; a23 += weight * c * d;
+			a33 += weight * d * d;
+		}
+
+		/** Returns the sum of squared distances from the provided point to all the planes in the quadric. */
+		double evaluate(const Vector3& point) const
+		{
+			const double x = point.x;
+			const double y = point.y;
+			const double z = point.z;
+
+			return a00 * x * x + 2.0 * a01 * x * y + 2.0 * a02 * x * z + 2.0 * a03 * x +
+				a11 * y * y + 2.0 * a12 * y * z + 2.0 * a13 * y +
+				a22 * z * z + 2.0 * a23 * z +
+				a33;
+		}
+
+		Quadric& operator+=(const Quadric& rhs)
+		{
+			a00 += rhs.a00; a01 += rhs.a01; a02 += rhs.a02; a03 += rhs.a03;
+			a11 += rhs.a11; a12 += rhs.a12; a13 += rhs.a13;
+			a22 += rhs.a22; a23 += rhs.a23;
+			a33 += rhs.a33;
+
+			return *this;
+		}
+
+		double a00 = 0.0, a01 = 0.0, a02 = 0.0, a03 = 0.0;
+		double a11 = 0.0, a12 = 0.0, a13 = 0.0;
+		double a22 = 0.0, a23 = 0.0;
+		double a33 = 0.0;
+	};
+
+	/** Potential collapse of vertex @p from onto vertex @p to, considered during mesh simplification. */
+	struct EdgeCollapse
+	{
+		double cost;
+		UINT32 from;
+		UINT32 to;
+	};
+
 	void MeshUtility::calculateNormals(Vector3* vertices, UINT8* indices, UINT32 numVertices,
 		UINT32 numIndices, Vector3* normals, UINT32 indexSize)
 	{
@@ -935,4 +992,808 @@ namespace bs
 			ptr += stride;
 		}
 	}
+
+	SPtr<MeshData> MeshUtility::simplify(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes,
+		float triangleRatio, Vector<SubMesh>& outSubMeshes)
+	{
+		outSubMeshes.clear();
+
+		const UINT32 numVertices = meshData->getNumVertices();
+		const UINT32 numIndices = meshData->getNumIndices();
+		const bool is32Bit = meshData->getIndexType() == IT_32BIT;
+
+		auto readIndex = [&meshData, is32Bit](UINT32 idx) -> UINT32
+		{
+			return is32Bit ? meshData->getIndices32()[idx] : meshData->getIndices16()[idx];
+		};
+
+		// Read positions
+		Vector<Vector3> positions(numVertices);
+		VertexElemIter<Vector3> positionIter = meshData->getVec3DataIter(VES_POSITION);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			positions[i] = positionIter.getValue();
+			positionIter.moveNext();
+		}
+
+		// Gather triangles of all triangle list sub-meshes, remembering which sub-mesh they belong to
+		Vector<UINT32> triangles;
+		Vector<UINT32> triangleSubMeshes;
+		for (UINT32 i = 0; i < (UINT32)subMeshes.size(); i++)
+		{
+			const SubMesh& subMesh = subMeshes[i];
+			if (subMesh.drawOp != DOT_TRIANGLE_LIST)
+				continue;
+
+			const UINT32 numTriangles = std::min(subMesh.indexCount, numIndices - subMesh.indexOffset) / 3;
+			for (UINT32 j = 0; j < numTriangles; j++)
+			{
+				for (UINT32 k = 0; k < 3; k++)
+					triangles.push_back(readIndex(subMesh.indexOffset + j * 3 + k));
+
+				triangleSubMeshes.push_back(i);
+			}
+		}
+
+		// Find vertices sharing the same position. Such vertices form attribute seams.
+		Vector<UINT32> positionGroup(numVertices);
+		Vector<UINT32> groupSize(numVertices, 0);
+		{
+			Vector<UINT32> sorted(numVertices);
+			for (UINT32 i = 0; i < numVertices; i++)
+				sorted[i] = i;
+
+			auto lessPosition = [&positions](UINT32 a, UINT32 b)
+			{
+				const Vector3& pa = positions[a];
+				const Vector3& pb = positions[b];
+
+				if (pa.x != pb.x) return pa.x < pb.x;
+				if (pa.y != pb.y) return pa.y < pb.y;
+				return pa.z < pb.z;
+			};
+
+			std::sort(sorted.begin(), sorted.end(), lessPosition);
+
+			for (UINT32 i = 0; i < numVertices; i++)
+			{
+				const bool isNewGroup = i == 0 || positions[sorted[i]] != positions[sorted[i - 1]];
+				positionGroup[sorted[i]] = isNewGroup ? sorted[i] : positionGroup[sorted[i - 1]];
+				groupSize[positionGroup[sorted[i]]]++;
+			}
+		}
+
+		// Lock vertices on seams and open borders, as collapsing them would tear the mesh
+		Vector<bool> locked(numVertices, false);
+		{
+			Vector<UINT64> edges;
+			edges.reserve(triangles.size());
+
+			for (UINT32 i = 0; i < (UINT32)triangles.size(); i += 3)
+			{
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					UINT64 a = positionGroup[triangles[i + j]];
+					UINT64 b = positionGroup[triangles[i + (j + 1) % 3]];
+
+					if (a > b)
+						std::swap(a, b);
+
+					edges.push_back((a << 32) | b);
+				}
+			}
+
+			std::sort(edges.begin(), edges.end());
+
+			Vector<bool> borderGroup(numVertices, false);
+			for (UINT32 i = 0; i < (UINT32)edges.size();)
+			{
+				UINT32 count = 1;
+				while (i + count < (UINT32)edges.size() && edges[i + count] == edges[i])
+					count++;
+
+				if (count == 1)
+				{
+					borderGroup[(UINT32)(edges[i] >> 32)] = true;
+					borderGroup[(UINT32)(edges[i] & 0xFFFFFFFF)] = true;
+				}
+
+				i += count;
+			}
+
+			for (UINT32 i = 0; i < numVertices; i++)
+				locked[i] = groupSize[positionGroup[i]] > 1 || borderGroup[positionGroup[i]];
+		}
+
+		// Accumulate area weighted triangle planes into per-position quadrics
+		Vector<Quadric> quadrics(numVertices);
+		for (UINT32 i = 0; i < (UINT32)triangles.size(); i += 3)
+		{
+			const Vector3& p0 = positions[triangles[i + 0]];
+			const Vector3& p1 = positions[triangles[i + 1]];
+			const Vector3& p2 = positions[triangles[i + 2]];
+
+			Vector3 normal = Vector3::cross(p1 - p0, p2 - p0);
+			const float area = normal.length();
+			if (area <= std::numeric_limits<float>::epsilon())
+				continue;
+
+			normal /= area;
+			const float distance = -normal.dot(p0);
+
+			for (UINT32 j = 0; j < 3; j++)
+				quadrics[positionGroup[triangles[i + j]]].addPlane(normal, distance, area);
+		}
+
+		const UINT32 numSourceTriangles = (UINT32)triangleSubMeshes.size();
+		const UINT32 targetTriangles = (UINT32)(numSourceTriangles * Math::clamp01(triangleRatio));
+
+		Vector<UINT32> remap(numVertices);
+		Vector<UINT32> adjacencyOffsets;
+		Vector<UINT32> adjacency;
+		Vector<EdgeCollapse> collapses;
+		Vector<bool> touched;
+
+		UINT32 numTriangles = numSourceTriangles;
+		while (numTriangles > targetTriangles)
+		{
+			// Build vertex -> triangle adjacency for the current set of triangles
+			adjacencyOffsets.assign(numVertices + 1, 0);
+			for (auto& vertexIdx : triangles)
+				adjacencyOffsets[vertexIdx + 1]++;
+
+			for (UINT32 i = 0; i < numVertices; i++)
+				adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+
+			adjacency.resize(triangles.size());
+			{
+				Vector<UINT32> writeOffsets(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+				for (UINT32 i = 0; i < (UINT32)triangles.size(); i++)
+					adjacency[writeOffsets[triangles[i]]++] = i / 3;
+			}
+
+			// Evaluate the cost of collapsing every unlocked vertex onto each of its neighbors
+			collapses.clear();
+			for (UINT32 i = 0; i < (UINT32)triangles.size(); i += 3)
+			{
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					const UINT32 from = triangles[i + j];
+					if (locked[from])
+						continue;
+
+					for (UINT32 k = 1; k < 3; k++)
+					{
+						const UINT32 to = triangles[i + (j + k) % 3];
+
+						Quadric quadric = quadrics[positionGroup[from]];
+						quadric += quadrics[positionGroup[to]];
+
+						collapses.push_back({ quadric.evaluate(positions[to]), from, to });
+					}
+				}
+			}
+
+			std::sort(collapses.begin(), collapses.end(),
+				[](const EdgeCollapse& a, const EdgeCollapse& b) { return a.cost < b.cost; });
+
+			for (UINT32 i = 0; i < numVertices; i++)
+				remap[i] = i;
+
+			// Perform as many non-overlapping collapses as possible in this pass, cheapest first
+			touched.assign(numVertices, false);
+
+			UINT32 numRemoved = 0;
+			for (auto& collapse : collapses)
+			{
+				if (numTriangles - numRemoved <= targetTriangles)
+					break;
+
+				if (touched[collapse.from] || touched[collapse.to])
+					continue;
+
+				// Reject collapses that would flip any of the remaining triangles
+				bool isValid = true;
+				UINT32 numCollapsedTriangles = 0;
+				for (UINT32 j = adjacencyOffsets[collapse.from]; j < adjacencyOffsets[collapse.from + 1]; j++)
+				{
+					const UINT32* triangle = &triangles[adjacency[j] * 3];
+					if (triangle[0] == collapse.to || triangle[1] == collapse.to || triangle[2] == collapse.to)
+					{
+						numCollapsedTriangles++;
+						continue;
+					}
+
+					Vector3 oldPositions[3];
+					Vector3 newPositions[3];
+					for (UINT32 k = 0; k < 3; k++)
+					{
+						oldPositions[k] = positions[triangle[k]];
+						newPositions[k] = triangle[k] == collapse.from ? positions[collapse.to] : oldPositions[k];
+					}
+
+					const Vector3 oldNormal = Vector3::cross(oldPositions[1] - oldPositions[0], oldPositions[2] - oldPositions[0]);
+					const Vector3 newNormal = Vector3::cross(newPositions[1] - newPositions[0], newPositions[2] - newPositions[0]);
+
+					// Also reject collapses that rotate a triangle too far, as they tend to produce slivers and folds
+					if (oldNormal.dot(newNormal) <= 0.25f * oldNormal.length() * newNormal.length())
+					{
+						isValid = false;
+						break;
+					}
+				}
+
+				if (!isValid || numCollapsedTriangles == 0)
+					continue;
+
+				remap[collapse.from] = collapse.to;
+				quadrics[positionGroup[collapse.to]] += quadrics[positionGroup[collapse.from]];
+				numRemoved += numCollapsedTriangles;
+
+				// Neighbors can't be modified again in this pass, as the flip test above wouldn't account for it
+				for (UINT32 j = adjacencyOffsets[collapse.from]; j < adjacencyOffsets[collapse.from + 1]; j++)
+				{
+					const UINT32* triangle = &triangles[adjacency[j] * 3];
+					for (UINT32 k = 0; k < 3; k++)
+						touched[triangle[k]] = true;
+				}
+			}
+
+			if (numRemoved == 0)
+				break;
+
+			// Apply the collapses and remove degenerate triangles
+			UINT32 numWritten = 0;
+			for (UINT32 i = 0; i < numTriangles; i++)
+			{
+				const UINT32 a = remap[triangles[i * 3 + 0]];
+				const UINT32 b = remap[triangles[i * 3 + 1]];
+				const UINT32 c = remap[triangles[i * 3 + 2]];
+
+				if (a == b || b == c || a == c)
+					continue;
+
+				triangles[numWritten * 3 + 0] = a;
+				triangles[numWritten * 3 + 1] = b;
+				triangles[numWritten * 3 + 2] = c;
+				triangleSubMeshes[numWritten] = triangleSubMeshes[i];
+				numWritten++;
+			}
+
+			numTriangles = numWritten;
+			triangles.resize(numTriangles * 3);
+			triangleSubMeshes.resize(numTriangles);
+		}
+
+		// Output the simplified mesh, sharing vertices with the source mesh
+		UINT32 numOutputIndices = numTriangles * 3;
+		for (auto& subMesh : subMeshes)
+		{
+			if (subMesh.drawOp != DOT_TRIANGLE_LIST)
+				numOutputIndices += subMesh.indexCount;
+		}
+
+		SPtr<MeshData> output = MeshData::create(numVertices, numOutputIndices, meshData->getVertexDesc(),
+			meshData->getIndexType());
+		memcpy(output->getStreamData(0), meshData->getStreamData(0), meshData->getStreamSize());
+
+		UINT32 writeIdx = 0;
+		auto writeIndex = [&output, &writeIdx, is32Bit](UINT32 value)
+		{
+			if (is32Bit)
+				output->getIndices32()[writeIdx++] = value;
+			else
+				output->getIndices16()[writeIdx++] = (UINT16)value;
+		};
+
+		for (UINT32 i = 0; i < (UINT32)subMeshes.size(); i++)
+		{
+			const SubMesh& subMesh = subMeshes[i];
+			const UINT32 indexOffset = writeIdx;
+
+			if (subMesh.drawOp != DOT_TRIANGLE_LIST)
+			{
+				for (UINT32 j = 0; j < subMesh.indexCount; j++)
+					writeIndex(readIndex(subMesh.indexOffset + j));
+			}
+			else
+			{
+				for (UINT32 j = 0; j < numTriangles; j++)
+				{
+					if (triangleSubMeshes[j] != i)
+						continue;
+
+					for (UINT32 k = 0; k < 3; k++)
+						writeIndex(triangles[j * 3 + k]);
+				}
+			}
+
+			outSubMeshes.push_back(SubMesh(indexOffset, writeIdx - indexOffset, subMesh.drawOp));
+		}
+
+		return output;
+	}
+
+	void MeshUtility::optimizeVertexCache(UINT32* indices, UINT32 numIndices, UINT32 numVertices, UINT32 cacheSize)
+	{
+		const UINT32 numTriangles = numIndices / 3;
+		if (numTriangles == 0)
+			return;
+
+		// Build vertex -> triangle adjacency
+		Vector<UINT32> liveTriangles(numVertices, 0);
+		for (UINT32 i = 0; i < numTriangles * 3; i++)
+			liveTriangles[indices[i]]++;
+
+		Vector<UINT32> adjacencyOffsets(numVertices + 1, 0);
+		for (UINT32 i = 0; i < numVertices; i++)
+			adjacencyOffsets[i + 1] = adjacencyOffsets[i] + liveTriangles[i];
+
+		Vector<UINT32> adjacency(numTriangles * 3);
+		{
+			Vector<UINT32> fillOffsets(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+			for (UINT32 i = 0; i < numTriangles * 3; i++)
+				adjacency[fillOffsets[indices[i]]++] = i / 3;
+		}
+
+		// Tipsify: Emit all triangles around a fanning vertex, then continue with a vertex that is still likely to be
+		// in the cache, or restart from a recently used vertex if no such vertex exists
+		Vector<UINT32> cacheTimestamps(numVertices, 0);
+		Vector<bool> emitted(numTriangles, false);
+		Vector<UINT32> deadEnds;
+		Vector<UINT32> candidates;
+		Vector<UINT32> output;
+		output.reserve(numTriangles * 3);
+
+		UINT32 timestamp = cacheSize + 1;
+		UINT32 cursor = 0;
+
+		auto skipDeadEnd = [&]() -> UINT32
+		{
+			while (!deadEnds.empty())
+			{
+				const UINT32 vertex = deadEnds.back();
+				deadEnds.pop_back();
+
+				if (liveTriangles[vertex] > 0)
+					return vertex;
+			}
+
+			for (; cursor < numVertices; cursor++)
+			{
+				if (liveTriangles[cursor] > 0)
+					return cursor;
+			}
+
+			return (UINT32)-1;
+		};
+
+		UINT32 fanningVertex = skipDeadEnd();
+		while (fanningVertex != (UINT32)-1)
+		{
+			candidates.clear();
+			for (UINT32 i = adjacencyOffsets[fanningVertex]; i < adjacencyOffsets[fanningVertex + 1]; i++)
+			{
+				const UINT32 triangleIdx = adjacency[i];
+				if (emitted[triangleIdx])
+					continue;
+
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					const UINT32 vertex = indices[triangleIdx * 3 + j];
+
+					output.push_back(vertex);
+					deadEnds.push_back(vertex);
+					candidates.push_back(vertex);
+					liveTriangles[vertex]--;
+
+					if (timestamp - cacheTimestamps[vertex] > cacheSize)
+						cacheTimestamps[vertex] = timestamp++;
+				}
+
+				emitted[triangleIdx] = true;
+			}
+
+			// Prefer the oldest vertex that will still be in the cache once all of its triangles are emitted
+			UINT32 nextVertex = (UINT32)-1;
+			INT32 bestPriority = -1;
+			for (auto& vertex : candidates)
+			{
+				if (liveTriangles[vertex] == 0)
+					continue;
+
+				INT32 priority = 0;
+				const UINT32 age = timestamp - cacheTimestamps[vertex];
+				if (age + 2 * liveTriangles[vertex] <= cacheSize)
+					priority = (INT32)age;
+
+				if (priority > bestPriority)
+				{
+					bestPriority = priority;
+					nextVertex = vertex;
+				}
+			}
+
+			if (nextVertex == (UINT32)-1)
+				nextVertex = skipDeadEnd();
+
+			fanningVertex = nextVertex;
+		}
+
+		memcpy(indices, output.data(), output.size() * sizeof(UINT32));
+	}
+
+	void MeshUtility::optimizeOverdraw(UINT32* indices, UINT32 numIndices, const Vector3* positions, UINT32 numVertices,
+		float threshold, UINT32 cacheSize)
+	{
+		const UINT32 numTriangles = numIndices / 3;
+		if (numTriangles == 0)
+			return;
+
+		Vector<UINT32> cacheTimestamps(numVertices, 0);
+		UINT32 timestamp = cacheSize + 1;
+
+		auto flushCache = [&timestamp, cacheSize]()
+		{
+			timestamp += cacheSize + 1;
+		};
+
+		auto simulateTriangle = [&](UINT32 triangleIdx)
+		{
+			UINT32 numMisses = 0;
+			for (UINT32 i = 0; i < 3; i++)
+			{
+				const UINT32 vertex = indices[triangleIdx * 3 + i];
+				if (timestamp - cacheTimestamps[vertex] > cacheSize)
+				{
+					cacheTimestamps[vertex] = timestamp++;
+					numMisses++;
+				}
+			}
+
+			return numMisses;
+		};
+
+		// Triangles on which every vertex misses the cache start a new cluster, as splitting there costs nothing
+		Vector<UINT32> hardBoundaries;
+		hardBoundaries.push_back(0);
+		simulateTriangle(0);
+
+		for (UINT32 i = 1; i < numTriangles; i++)
+		{
+			if (simulateTriangle(i) == 3)
+				hardBoundaries.push_back(i);
+		}
+
+		hardBoundaries.push_back(numTriangles);
+
+		// Split the clusters further at points where the cache miss ratio up to that point is low enough
+		Vector<UINT32> clusters;
+		for (UINT32 i = 0; i < (UINT32)hardBoundaries.size() - 1; i++)
+		{
+			const UINT32 start = hardBoundaries[i];
+			const UINT32 end = hardBoundaries[i + 1];
+
+			flushCache();
+
+			UINT32 numMisses = 0;
+			for (UINT32 j = start; j < end; j++)
+				numMisses += simulateTriangle(j);
+
+			const float clusterThreshold = threshold * numMisses / (float)(end - start);
+
+			flushCache();
+			clusters.push_back(start);
+
+			UINT32 clusterStart = start;
+			numMisses = 0;
+			for (UINT32 j = start; j < end - 1; j++)
+			{
+				numMisses += simulateTriangle(j);
+
+				if (numMisses <= clusterThreshold * (j + 1 - clusterStart))
+				{
+					clusters.push_back(j + 1);
+					clusterStart = j + 1;
+					numMisses = 0;
+
+					flushCache();
+				}
+			}
+		}
+
+		const UINT32 numClusters = (UINT32)clusters.size();
+		clusters.push_back(numTriangles);
+
+		// Calculate area weighted centroid and normal of each cluster, and of the whole mesh
+		Vector<Vector3> clusterCentroids(numClusters, Vector3::ZERO);
+		Vector<Vector3> clusterNormals(numClusters, Vector3::ZERO);
+		Vector3 meshCentroid = Vector3::ZERO;
+		float meshArea = 0.0f;
+
+		for (UINT32 i = 0; i < numClusters; i++)
+		{
+			float clusterArea = 0.0f;
+			for (UINT32 j = clusters[i]; j < clusters[i + 1]; j++)
+			{
+				const Vector3& a = positions[indices[j * 3 + 0]];
+				const Vector3& b = positions[indices[j * 3 + 1]];
+				const Vector3& c = positions[indices[j * 3 + 2]];
+
+				const Vector3 normal = Vector3::cross(b - a, c - a);
+				const float area = normal.length();
+
+				clusterCentroids[i] += (a + b + c) * (area / 3.0f);
+				clusterNormals[i] += normal;
+				clusterArea += area;
+			}
+
+			meshCentroid += clusterCentroids[i];
+			meshArea += clusterArea;
+
+			if (clusterArea > 0.0f)
+				clusterCentroids[i] /= clusterArea;
+
+			clusterNormals[i].normalize();
+		}
+
+		if (meshArea > 0.0f)
+			meshCentroid /= meshArea;
+
+		// Render clusters facing away from the mesh center first, as they are most likely to occlude other clusters
+		Vector<float> sortKeys(numClusters);
+		Vector<UINT32> order(numClusters);
+		for (UINT32 i = 0; i < numClusters; i++)
+		{
+			sortKeys[i] = Vector3::dot(clusterCentroids[i] - meshCentroid, clusterNormals[i]);
+			order[i] = i;
+		}
+
+		std::stable_sort(order.begin(), order.end(), [&sortKeys](UINT32 a, UINT32 b)
+		{
+			return sortKeys[a] > sortKeys[b];
+		});
+
+		Vector<UINT32> output;
+		output.reserve(numTriangles * 3);
+
+		for (auto& clusterIdx : order)
+		{
+			for (UINT32 i = clusters[clusterIdx] * 3; i < clusters[clusterIdx + 1] * 3; i++)
+				output.push_back(indices[i]);
+		}
+
+		memcpy(indices, output.data(), output.size() * sizeof(UINT32));
+	}
+
+	void MeshUtility::optimizeVertexFetch(const SPtr<MeshData>& meshData, Vector<UINT32>* outRemap)
+	{
+		const UINT32 numVertices = meshData->getNumVertices();
+		const UINT32 numIndices = meshData->getNumIndices();
+		const bool is32Bit = meshData->getIndexType() == IT_32BIT;
+
+		// Assign new vertex indices in order of first use
+		Vector<UINT32> remap(numVertices, (UINT32)-1);
+		UINT32 nextVertex = 0;
+
+		for (UINT32 i = 0; i < numIndices; i++)
+		{
+			if (is32Bit)
+			{
+				UINT32& index = meshData->getIndices32()[i];
+				if (remap[index] == (UINT32)-1)
+					remap[index] = nextVertex++;
+
+				index = remap[index];
+			}
+			else
+			{
+				UINT16& index = meshData->getIndices16()[i];
+				if (remap[index] == (UINT32)-1)
+					remap[index] = nextVertex++;
+
+				index = (UINT16)remap[index];
+			}
+		}
+
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			if (remap[i] == (UINT32)-1)
+				remap[i] = nextVertex++;
+		}
+
+		// Move the vertex data of every stream to its new location
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		const UINT32 maxStreamIdx = vertexDesc->getMaxStreamIdx();
+
+		Vector<UINT8> sourceData;
+		for (UINT32 i = 0; i <= maxStreamIdx; i++)
+		{
+			if (!vertexDesc->hasStream(i))
+				continue;
+
+			const UINT32 stride = vertexDesc->getVertexStride(i);
+			UINT8* data = meshData->getStreamData(i);
+
+			sourceData.assign(data, data + numVertices * stride);
+			for (UINT32 j = 0; j < numVertices; j++)
+				memcpy(data + remap[j] * stride, sourceData.data() + j * stride, stride);
+		}
+
+		if (outRemap)
+			*outRemap = std::move(remap);
+	}
+
+	void MeshUtility::optimize(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes, bool reorderVertices)
+	{
+		const UINT32 numVertices = meshData->getNumVertices();
+		const UINT32 numIndices = meshData->getNumIndices();
+		const bool is32Bit = meshData->getIndexType() == IT_32BIT;
+
+		if (!meshData->getVertexDesc()->hasElement(VES_POSITION))
+		{
+			BS_LOG(Warning, Mesh, "Cannot optimize a mesh without vertex positions.");
+			return;
+		}
+
+		Vector<Vector3> positions(numVertices);
+		VertexElemIter<Vector3> positionIter = meshData->getVec3DataIter(VES_POSITION);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			positions[i] = positionIter.getValue();
+			positionIter.moveNext();
+		}
+
+		Vector<UINT32> indices;
+		for (auto& subMesh : subMeshes)
+		{
+			if (subMesh.drawOp != DOT_TRIANGLE_LIST || subMesh.indexOffset >= numIndices)
+				continue;
+
+			const UINT32 indexCount = (std::min(subMesh.indexCount, numIndices - subMesh.indexOffset) / 3) * 3;
+			indices.resize(indexCount);
+
+			for (UINT32 i = 0; i < indexCount; i++)
+			{
+				const UINT32 srcIdx = subMesh.indexOffset + i;
+				indices[i] = is32Bit ? meshData->getIndices32()[srcIdx] : meshData->getIndices16()[srcIdx];
+			}
+
+			optimizeVertexCache(indices.data(), indexCount, numVertices);
+			optimizeOverdraw(indices.data(), indexCount, positions.data(), numVertices);
+
+			for (UINT32 i = 0; i < indexCount; i++)
+			{
+				const UINT32 dstIdx = subMesh.indexOffset + i;
+				if (is32Bit)
+					meshData->getIndices32()[dstIdx] = indices[i];
+				else
+					meshData->getIndices16()[dstIdx] = (UINT16)indices[i];
+			}
+		}
+
+		if (reorderVertices)
+			optimizeVertexFetch(meshData);
+	}
+
+	VertexCacheStatistics MeshUtility::analyzeVertexCache(const UINT32* indices, UINT32 numIndices, UINT32 numVertices,
+		UINT32 vertexStride, UINT32 cacheSize)
+	{
+		static constexpr UINT32 CACHE_LINE_SIZE = 64;
+		static constexpr UINT32 FETCH_CACHE_LINES = 64;
+
+		VertexCacheStatistics stats;
+
+		const UINT32 numTriangles = numIndices / 3;
+		if (numTriangles == 0 || numVertices == 0)
+			return stats;
+
+		// Post-transform cache, simulated as a FIFO
+		Vector<UINT32> cacheTimestamps(numVertices, 0);
+		UINT32 timestamp = cacheSize + 1;
+
+		// Vertex fetch cache, a FIFO of cache lines
+		const UINT32 numLines = (numVertices * vertexStride + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE;
+		Vector<UINT32> lineTimestamps(numLines, 0);
+		UINT32 lineTimestamp = FETCH_CACHE_LINES + 1;
+
+		Vector<bool> referenced(numVertices, false);
+		UINT32 numUnique = 0;
+
+		for (UINT32 i = 0; i < numTriangles * 3; i++)
+		{
+			const UINT32 vertex = indices[i];
+			if (!referenced[vertex])
+			{
+				referenced[vertex] = true;
+				numUnique++;
+			}
+
+			if (timestamp - cacheTimestamps[vertex] <= cacheSize)
+				continue;
+
+			cacheTimestamps[vertex] = timestamp++;
+			stats.numTransformed++;
+
+			if (vertexStride == 0)
+				continue;
+
+			const UINT32 firstLine = (vertex * vertexStride) / CACHE_LINE_SIZE;
+			const UINT32 lastLine = (vertex * vertexStride + vertexStride - 1) / CACHE_LINE_SIZE;
+			for (UINT32 line = firstLine; line <= lastLine; line++)
+			{
+				if (lineTimestamp - lineTimestamps[line] > FETCH_CACHE_LINES)
+				{
+					lineTimestamps[line] = lineTimestamp++;
+					stats.numBytesFetched += CACHE_LINE_SIZE;
+				}
+			}
+		}
+
+		stats.acmr = stats.numTransformed / (float)numTriangles;
+		stats.atvr = stats.numTransformed / (float)numUnique;
+
+		if (vertexStride > 0)
+			stats.overfetch = stats.numBytesFetched / (float)(numUnique * vertexStride);
+
+		return stats;
+	}
+
+	VertexCacheStatistics MeshUtility::analyzeVertexCache(const SPtr<MeshData>& meshData,
+		const Vector<SubMesh>& subMeshes, UINT32 cacheSize)
+	{
+		const UINT32 numVertices = meshData->getNumVertices();
+		const UINT32 numIndices = meshData->getNumIndices();
+		const bool is32Bit = meshData->getIndexType() == IT_32BIT;
+
+		Vector<UINT32> indices;
+		for (auto& subMesh : subMeshes)
+		{
+			if (subMesh.drawOp != DOT_TRIANGLE_LIST || subMesh.indexOffset >= numIndices)
+				continue;
+
+			const UINT32 indexCount = (std::min(subMesh.indexCount, numIndices - subMesh.indexOffset) / 3) * 3;
+			for (UINT32 i = 0; i < indexCount; i++)
+			{
+				const UINT32 srcIdx = subMesh.indexOffset + i;
+				indices.push_back(is32Bit ? meshData->getIndices32()[srcIdx] : meshData->getIndices16()[srcIdx]);
+			}
+		}
+
+		Vector<bool> referenced(numVertices, false);
+		UINT32 numUnique = 0;
+		for (auto& index : indices)
+		{
+			if (!referenced[index])
+			{
+				referenced[index] = true;
+				numUnique++;
+			}
+		}
+
+		// Each vertex stream is fetched separately, so simulate them individually and sum up the fetched data
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		const UINT32 maxStreamIdx = vertexDesc->getMaxStreamIdx();
+
+		VertexCacheStatistics output;
+		UINT32 numBytesFetched = 0;
+		UINT32 referencedSize = 0;
+		for (UINT32 i = 0; i <= maxStreamIdx; i++)
+		{
+			if (!vertexDesc->hasStream(i))
+				continue;
+
+			const UINT32 stride = vertexDesc->getVertexStride(i);
+			output = analyzeVertexCache(indices.data(), (UINT32)indices.size(), numVertices, stride, cacheSize);
+
+			numBytesFetched += output.numBytesFetched;
+			referencedSize += numUnique * stride;
+		}
+
+		output.numBytesFetched = numBytesFetched;
+		if (referencedSize > 0)
+			output.overfetch = numBytesFetched / (float)referencedSize;
+
+		return output;
+	}
 }
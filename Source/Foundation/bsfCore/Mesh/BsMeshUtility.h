@@ -25,6 +25,31 @@ namespace bs
 		UINT32 packed;
 	};
 
+	/** Describes how efficiently a GPU can process an indexed triangle list. See MeshUtility::analyzeVertexCache(). */
+	struct VertexCacheStatistics
+	{
+		/** Number of vertex shader invocations, assuming a FIFO post-transform cache. */
+		UINT32 numTransformed = 0;
+
+		/** Number of bytes read from vertex buffers, assuming 64 byte cache lines. */
+		UINT32 numBytesFetched = 0;
+
+		/**
+		 * Average cache miss ratio - the number of transformed vertices per triangle. Ranges from 3 (no reuse) down to
+		 * roughly 0.5 for large regular meshes.
+		 */
+		float acmr = 0.0f;
+
+		/** Average transform to vertex ratio - the number of transformed vertices per unique vertex. Ideally 1. */
+		float atvr = 0.0f;
+
+		/**
+		 * Number of bytes fetched from vertex buffers divided by the size of the referenced vertex data. Ideally 1,
+		 * higher values mean cache lines are loaded more than once.
+		 */
+		float overfetch = 0.0f;
+	};
+
 	/** Performs various operations on mesh geometry. */
 	class BS_CORE_EXPORT MeshUtility
 	{
@@ -179,6 +204,96 @@ namespace bs
 		 */
 		static void unpackNormals(UINT8* source, Vector4* destination, UINT32 count, UINT32 stride);
 
+		/**
+		 * Reduces the number of triangles in a mesh by collapsing edges, picking the collapses that introduce the least
+		 * error according to quadric error metrics. A vertex is always collapsed onto one of its neighbors rather than
+		 * moved, so all vertex attributes remain valid. Vertices on open borders and on attribute seams (multiple vertices
+		 * sharing the same position) are never removed.
+		 *
+		 * @param[in]	meshData		Mesh to simplify. Must contain 3D vertex positions.
+		 * @param[in]	subMeshes		Sub-meshes of @p meshData. Only sub-meshes containing triangle lists will be
+		 *								simplified, others are copied as is.
+		 * @param[in]	triangleRatio	Fraction of triangles to keep, in range [0, 1]. Simplification can stop early if
+		 *								no more valid collapses can be found.
+		 * @param[out]	outSubMeshes	Sub-meshes of the returned mesh, one for each entry in @p subMeshes.
+		 * @return						Simplified mesh. It contains the same vertices as the source mesh, and a reduced
+		 *								set of indices.
+		 */
+		static SPtr<MeshData> simplify(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes,
+			float triangleRatio, Vector<SubMesh>& outSubMeshes);
+
+		/**
+		 * Reorders triangles of an indexed triangle list so consecutive triangles reuse recently transformed vertices,
+		 * reducing the number of vertex shader invocations. Uses the Tipsify algorithm which is tuned for a specific
+		 * post-transform cache size, but performs well on other sizes as well.
+		 *
+		 * @param[in, out]	indices		Triangle list indices to reorder. Winding of individual triangles is preserved.
+		 * @param[in]		numIndices	Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]		numVertices	Number of vertices referenced by @p indices.
+		 * @param[in]		cacheSize	Number of entries in the post-transform cache to optimize for.
+		 */
+		static void optimizeVertexCache(UINT32* indices, UINT32 numIndices, UINT32 numVertices, UINT32 cacheSize = 16);
+
+		/**
+		 * Reorders clusters of triangles so that outward facing clusters are rendered first, reducing overdraw from
+		 * most view directions. Should be called after optimizeVertexCache(). Triangles are only reordered at points where
+		 * that doesn't increase the cache miss ratio by more than @p threshold.
+		 *
+		 * @param[in, out]	indices		Triangle list indices to reorder. Winding of individual triangles is preserved.
+		 * @param[in]		numIndices	Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]		positions	Vertex positions referenced by @p indices.
+		 * @param[in]		numVertices	Number of entries in the @p positions array.
+		 * @param[in]		threshold	Maximum allowed increase of the cache miss ratio, e.g. 1.05 for 5%.
+		 * @param[in]		cacheSize	Number of entries in the post-transform cache, same as for optimizeVertexCache().
+		 */
+		static void optimizeOverdraw(UINT32* indices, UINT32 numIndices, const Vector3* positions, UINT32 numVertices,
+			float threshold = 1.05f, UINT32 cacheSize = 16);
+
+		/**
+		 * Reorders vertices in all vertex streams of the mesh in the order they are first referenced by the index buffer,
+		 * and remaps the indices accordingly. This improves locality of vertex buffer reads. Vertices not referenced by
+		 * any index are moved to the end of the buffer.
+		 *
+		 * @param[in]	meshData	Mesh whose vertices and indices to reorder.
+		 * @param[out]	outRemap	Optional array that will receive the new index of every vertex, indexed by its old
+		 *							index. Can be used for remapping other data referencing the mesh vertices.
+		 */
+		static void optimizeVertexFetch(const SPtr<MeshData>& meshData, Vector<UINT32>* outRemap = nullptr);
+
+		/**
+		 * Runs the vertex cache and overdraw optimizations on each triangle list sub-mesh of the provided mesh, followed
+		 * by the vertex fetch optimization if @p reorderVertices is true. Sub-mesh index ranges remain unchanged.
+		 *
+		 * @param[in]	meshData		Mesh to optimize. Must contain 3D vertex positions.
+		 * @param[in]	subMeshes		Sub-meshes of @p meshData. Sub-meshes not containing triangle lists are ignored.
+		 * @param[in]	reorderVertices	If true, vertices will be reordered as well. Should be disabled if there is other
+		 *								data referencing the vertices by index, like morph shapes.
+		 */
+		static void optimize(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes,
+			bool reorderVertices = true);
+
+		/**
+		 * Simulates the post-transform vertex cache and the vertex fetch cache of a typical GPU while processing an
+		 * indexed triangle list, and returns statistics that can be used for evaluating the efficiency of the mesh
+		 * layout without requiring a GPU.
+		 *
+		 * @param[in]	indices			Triangle list indices.
+		 * @param[in]	numIndices		Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]	numVertices		Number of vertices referenced by @p indices.
+		 * @param[in]	vertexStride	Size of a single vertex in bytes.
+		 * @param[in]	cacheSize		Number of entries in the simulated post-transform cache.
+		 */
+		static VertexCacheStatistics analyzeVertexCache(const UINT32* indices, UINT32 numIndices, UINT32 numVertices,
+			UINT32 vertexStride, UINT32 cacheSize = 16);
+
+		/**
+		 * Analyzes all triangle list sub-meshes of the provided mesh, as if they were rendered one after another.
+		 *
+		 * @see analyzeVertexCache(const UINT32*, UINT32, UINT32, UINT32, UINT32)
+		 */
+		static VertexCacheStatistics analyzeVertexCache(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes,
+			UINT32 cacheSize = 16);
+
 		/** Decodes a normal from 4D 8-bit packed format into a 32-bit float format. */
 		static Vector3 unpackNormal(const UINT8* source)
 		{
@@ -1456,11 +1456,8 @@ namespace bs
 		// If in world-space we apply the transform here, otherwise we apply it in the rendering code
 		if(state.worldSpace)
 		{
-			for (UINT32 i = firstIdx; i < endIdx; i++)
-				particles.position[i] = state.localToWorld.multiplyAffine(particles.position[i]);
-
-			for (UINT32 i = firstIdx; i < endIdx; i++)
-				particles.velocity[i] = state.localToWorld.multiplyDirection(particles.velocity[i]);
+			state.localToWorld.multiplyAffine(&particles.position[firstIdx], &particles.position[firstIdx], count);
+			state.localToWorld.multiplyDirection(&particles.velocity[firstIdx], &particles.velocity[firstIdx], count);
 		}
 
 		bs_stack_free(emitterT);
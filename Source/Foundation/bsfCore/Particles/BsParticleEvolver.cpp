@@ -730,11 +730,9 @@ namespace bs
 
 			if(!state.worldSpace)
 			{
-				for (UINT32 i = 0; i < numRays; i++)
-				{
-					segments[i].start = state.localToWorld.multiplyAffine(segments[i].start);
-					segments[i].end = state.localToWorld.multiplyAffine(segments[i].end);
-				}
+				// Segments are stored as consecutive start/end points, so all of them can be transformed in one batch
+				static_assert(sizeof(LineSegment3) == sizeof(Vector3) * 2, "Unexpected line segment layout.");
+				state.localToWorld.multiplyAffine(&segments[0].start, &segments[0].start, numRays * 2);
 			}
 
 			const PhysicsScene& physicsScene = *state.scene->getPhysicsScene();
@@ -25,6 +25,7 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(bold, 4)
 			BS_RTTI_MEMBER_PLAIN(italic, 5)
 			BS_RTTI_MEMBER_PLAIN(charIndexRanges, 6)
+			BS_RTTI_MEMBER_PLAIN(dynamic, 7)
 		BS_END_RTTI_MEMBERS
 
 		// For compability with old version
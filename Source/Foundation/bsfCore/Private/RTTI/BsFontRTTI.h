@@ -7,6 +7,7 @@
 #include "Private/RTTI/BsCharDescRTTI.h"
 #include "Text/BsFont.h"
 #include "Image/BsTexture.h"
+#include "FileSystem/BsDataStream.h"
 
 namespace bs
 {
@@ -49,6 +50,13 @@ namespace bs
 	class BS_CORE_EXPORT FontRTTI : public RTTIType<Font, Resource, FontRTTI>
 	{
 	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN_NAMED(renderMode, mDynamicDesc.renderMode, 2)
+			BS_RTTI_MEMBER_PLAIN_NAMED(dpi, mDynamicDesc.dpi, 3)
+			BS_RTTI_MEMBER_PLAIN_NAMED(pageSize, mDynamicDesc.pageSize, 4)
+			BS_RTTI_MEMBER_PLAIN_NAMED(maxPages, mDynamicDesc.maxPages, 5)
+		BS_END_RTTI_MEMBERS
+
 		FontBitmap& getBitmap(Font* obj, UINT32 idx)
 		{
 			if(idx >= obj->mFontDataPerSize.size())
@@ -69,6 +77,10 @@ namespace bs
 
 		UINT32 getNumBitmaps(Font* obj)
 		{
+			// Bitmaps of dynamic fonts are created at runtime
+			if(obj->isDynamic())
+				return 0;
+
 			return (UINT32)obj->mFontDataPerSize.size();
 		}
 
@@ -77,10 +89,38 @@ namespace bs
 			mFontDataPerSize.resize(size);
 		}
 
+		SPtr<DataStream> getSourceData(Font* obj, UINT32& size)
+		{
+			if(obj->mSourceData == nullptr)
+			{
+				size = 0;
+				return bs_shared_ptr_new<MemoryDataStream>();
+			}
+
+			size = (UINT32)obj->mSourceData->size();
+			return bs_shared_ptr_new<MemoryDataStream>(obj->mSourceData->data(), obj->mSourceData->size());
+		}
+
+		void setSourceData(Font* obj, const SPtr<DataStream>& value, UINT32 size)
+		{
+			if(size == 0)
+				return;
+
+			auto buffer = (UINT8*)bs_stack_alloc(size);
+			value->read(buffer, size);
+
+			mSourceData = bs_shared_ptr_new<MemoryDataStream>(size);
+			mSourceData->write(buffer, size);
+			mSourceData->seek(0);
+
+			bs_stack_free(buffer);
+		}
+
 	public:
 		FontRTTI()
 		{
 			addReflectableArrayField("mBitmaps", 0, &FontRTTI::getBitmap, &FontRTTI::getNumBitmaps, &FontRTTI::setBitmap, &FontRTTI::setNumBitmaps);
+			addDataBlockField("mSourceData", 1, &FontRTTI::getSourceData, &FontRTTI::setSourceData);
 		}
 
 		const String& getRTTIName() override
@@ -103,10 +143,15 @@ namespace bs
 		void onDeserializationEnded(IReflectable* obj, SerializationContext* context) override
 		{
 			Font* font = static_cast<Font*>(obj);
-			font->initialize(mFontDataPerSize);
+
+			if(mSourceData != nullptr)
+				font->initialize(mSourceData, font->mDynamicDesc);
+			else
+				font->initialize(mFontDataPerSize);
 		}
 
 		Vector<SPtr<FontBitmap>> mFontDataPerSize;
+		SPtr<MemoryDataStream> mSourceData;
 	};
 
 	/** @} */
@@ -27,7 +27,11 @@ namespace bs
 		BS_END_RTTI_MEMBERS
 
 		SPtr<SceneObject> getSceneObject(Prefab* obj) { return obj->mRoot.getInternalPtr(); }
-		void setSceneObject(Prefab* obj, SPtr<SceneObject> value) { obj->mRoot = value->getHandle(); }
+		void setSceneObject(Prefab* obj, SPtr<SceneObject> value)
+		{
+			obj->mRoot = value->getHandle();
+			obj->mInstanceTemplate = nullptr;
+		}
 
 	public:
 		PrefabRTTI()
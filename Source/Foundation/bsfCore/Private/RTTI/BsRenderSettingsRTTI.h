@@ -385,6 +385,7 @@ namespace bs
 			BS_RTTI_MEMBER_REFL(bloom, 19)
 			BS_RTTI_MEMBER_REFL(screenSpaceLensFlare, 20)
 			BS_RTTI_MEMBER_REFL(motionBlur, 21)
+			BS_RTTI_MEMBER_PLAIN(enableOcclusionCulling, 22)
 		BS_END_RTTI_MEMBERS
 
 	public:
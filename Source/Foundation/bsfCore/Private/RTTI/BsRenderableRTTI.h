@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "Reflection/BsRTTIType.h"
+#include "RTTI/BsStdRTTI.h"
 #include "Renderer/BsRenderable.h"
 
 namespace bs
@@ -24,6 +25,9 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(mLayer, 4)
 			BS_RTTI_MEMBER_REFL_ARRAY(mMaterials, 5)
 			BS_RTTI_MEMBER_PLAIN(mCullDistanceFactor, 6)
+			BS_RTTI_MEMBER_REFL_ARRAY(mLODMeshes, 7)
+			BS_RTTI_MEMBER_PLAIN(mLODScreenSizes, 8)
+			BS_RTTI_MEMBER_PLAIN(mIsOccluder, 9)
 		BS_END_RTTI_MEMBERS
 
 	public:
@@ -3,7 +3,23 @@
 #include "Testing/BsConsoleTestOutput.h"
 #include "Testing/BsTestSuite.h"
 #include "Animation/BsAnimationCurve.h"
+#include "Animation/BsSkeleton.h"
+#include "Animation/BsSkeletonMask.h"
 #include "Particles/BsParticleDistribution.h"
+#include "Mesh/BsMeshUtility.h"
+#include "Mesh/BsMeshData.h"
+#include "Material/BsMaterialParams.h"
+#include "Material/BsShader.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "Renderer/BsRenderable.h"
+#include "Renderer/BsOcclusionBuffer.h"
+#include "Math/BsAABox.h"
+#include "Math/BsRandom.h"
+#include "Profiling/BsProfilerCPU.h"
+#include "Utility/BsTimer.h"
+#include "Text/BsFont.h"
+#include "Text/BsDynamicFontAtlas.h"
+#include "Text/BsGlyphRasterizer.h"
 
 namespace bs
 {
@@ -17,6 +33,44 @@ namespace bs
 		return acceleration * time;
 	}
 
+	/** Rasterizer that outputs square glyphs of the same size for every character, and no missing glyph. */
+	class TestGlyphRasterizer : public GlyphRasterizer
+	{
+	public:
+		static constexpr UINT32 GLYPH_SIZE = 16;
+
+		bool getSizeMetrics(UINT32 size, FontSizeMetrics& output) override
+		{
+			output.baselineOffset = (INT32)size;
+			output.lineHeight = size;
+			output.spaceWidth = size / 2;
+			return true;
+		}
+
+		bool rasterize(UINT32 charId, UINT32 size, RasterizedGlyph& output) override
+		{
+			output.desc.charId = charId;
+			output.desc.width = GLYPH_SIZE;
+			output.desc.height = GLYPH_SIZE;
+			output.desc.xAdvance = GLYPH_SIZE;
+			output.pixels.assign(GLYPH_SIZE * GLYPH_SIZE, 255);
+			return true;
+		}
+
+		bool rasterizeMissingGlyph(UINT32 size, RasterizedGlyph& output) override
+		{
+			return false;
+		}
+
+		INT32 getKerning(UINT32 left, UINT32 right, UINT32 size) override
+		{
+			numKerningQueries++;
+			return -(INT32)((left + right) % 3);
+		}
+
+		UINT32 numKerningQueries = 0;
+	};
+
 	class CoreTestSuite : public TestSuite
 	{
 	public:
@@ -25,12 +79,32 @@ namespace bs
 	private:
 		void testAnimCurveIntegration();
 		void testLookupTable();
+		void testMeshOptimization();
+		void testMeshSimplification();
+		void testLODSelection();
+		void testMaterialParamVersion();
+		void testOcclusionBuffer();
+		void testScopedProfiler();
+		void testFontLookup();
+		void testDynamicFontPacking();
+		void testDynamicFontEviction();
+		void testSkeletonPose();
 	};
 
 	CoreTestSuite::CoreTestSuite()
 	{
 		BS_ADD_TEST(CoreTestSuite::testAnimCurveIntegration);
 		BS_ADD_TEST(CoreTestSuite::testLookupTable);
+		BS_ADD_TEST(CoreTestSuite::testMeshOptimization);
+		BS_ADD_TEST(CoreTestSuite::testMeshSimplification);
+		BS_ADD_TEST(CoreTestSuite::testLODSelection);
+		BS_ADD_TEST(CoreTestSuite::testMaterialParamVersion);
+		BS_ADD_TEST(CoreTestSuite::testOcclusionBuffer);
+		BS_ADD_TEST(CoreTestSuite::testScopedProfiler);
+		BS_ADD_TEST(CoreTestSuite::testFontLookup);
+		BS_ADD_TEST(CoreTestSuite::testDynamicFontPacking);
+		BS_ADD_TEST(CoreTestSuite::testDynamicFontEviction);
+		BS_ADD_TEST(CoreTestSuite::testSkeletonPose);
 	}
 
 	void CoreTestSuite::testAnimCurveIntegration()
@@ -143,6 +217,619 @@ namespace bs
 				BS_TEST_ASSERT(Math::approxEquals(valueLookup[j], valueCurve[j], EPSILON));
 		}
 	}
+
+	void CoreTestSuite::testMeshOptimization()
+	{
+		static constexpr UINT32 GRID_SIZE = 32;
+		static constexpr UINT32 NUM_VERTICES = (GRID_SIZE + 1) * (GRID_SIZE + 1);
+
+		Vector<Vector3> positions;
+		for (UINT32 y = 0; y <= GRID_SIZE; y++)
+		{
+			for (UINT32 x = 0; x <= GRID_SIZE; x++)
+				positions.push_back(Vector3((float)x, 0.0f, (float)y));
+		}
+
+		// Build the grid with triangles in a scattered order, which is worst case for the vertex cache
+		Vector<UINT32> indices;
+		for (UINT32 i = 0; i < GRID_SIZE * GRID_SIZE; i++)
+		{
+			const UINT32 cell = (i * 97) % (GRID_SIZE * GRID_SIZE);
+			const UINT32 x = cell % GRID_SIZE;
+			const UINT32 y = cell / GRID_SIZE;
+
+			const UINT32 a = y * (GRID_SIZE + 1) + x;
+			const UINT32 b = a + 1;
+			const UINT32 c = a + GRID_SIZE + 1;
+			const UINT32 d = c + 1;
+
+			indices.insert(indices.end(), { a, c, b, b, c, d });
+		}
+
+		const UINT32 numIndices = (UINT32)indices.size();
+		auto sortedTriangles = [](const Vector<UINT32>& input)
+		{
+			// Rotate each triangle so it starts with its lowest index, preserving winding
+			Vector<std::array<UINT32, 3>> triangles;
+			for (UINT32 i = 0; i < (UINT32)input.size(); i += 3)
+			{
+				std::array<UINT32, 3> triangle = { input[i], input[i + 1], input[i + 2] };
+				std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+
+				triangles.push_back(triangle);
+			}
+
+			std::sort(triangles.begin(), triangles.end());
+			return triangles;
+		};
+
+		VertexCacheStatistics statsBefore = MeshUtility::analyzeVertexCache(indices.data(), numIndices, NUM_VERTICES,
+			sizeof(Vector3));
+
+		Vector<UINT32> optimized = indices;
+		MeshUtility::optimizeVertexCache(optimized.data(), numIndices, NUM_VERTICES);
+
+		VertexCacheStatistics statsCache = MeshUtility::analyzeVertexCache(optimized.data(), numIndices, NUM_VERTICES,
+			sizeof(Vector3));
+
+		BS_TEST_ASSERT(sortedTriangles(optimized) == sortedTriangles(indices));
+		BS_TEST_ASSERT(statsCache.acmr < 1.0f);
+		BS_TEST_ASSERT(statsCache.acmr < statsBefore.acmr * 0.5f);
+
+		MeshUtility::optimizeOverdraw(optimized.data(), numIndices, positions.data(), NUM_VERTICES);
+
+		VertexCacheStatistics statsOverdraw = MeshUtility::analyzeVertexCache(optimized.data(), numIndices,
+			NUM_VERTICES, sizeof(Vector3));
+
+		BS_TEST_ASSERT(sortedTriangles(optimized) == sortedTriangles(indices));
+		BS_TEST_ASSERT(statsOverdraw.acmr <= statsCache.acmr * 1.1f);
+	}
+
+	void CoreTestSuite::testMeshSimplification()
+	{
+		static constexpr UINT32 GRID_SIZE = 32;
+		static constexpr UINT32 NUM_VERTICES = (GRID_SIZE + 1) * (GRID_SIZE + 1);
+		static constexpr UINT32 NUM_TRIANGLES = GRID_SIZE * GRID_SIZE * 2;
+
+		// Flat grid, so every collapse of an interior vertex introduces no error
+		Vector<Vector3> positions;
+		for (UINT32 y = 0; y <= GRID_SIZE; y++)
+		{
+			for (UINT32 x = 0; x <= GRID_SIZE; x++)
+				positions.push_back(Vector3((float)x, 0.0f, (float)y));
+		}
+
+		Vector<UINT32> indices;
+		for (UINT32 y = 0; y < GRID_SIZE; y++)
+		{
+			for (UINT32 x = 0; x < GRID_SIZE; x++)
+			{
+				const UINT32 a = y * (GRID_SIZE + 1) + x;
+				const UINT32 b = a + 1;
+				const UINT32 c = a + GRID_SIZE + 1;
+				const UINT32 d = c + 1;
+
+				indices.insert(indices.end(), { a, c, b, b, c, d });
+			}
+		}
+
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+
+		SPtr<MeshData> meshData = MeshData::create(NUM_VERTICES, (UINT32)indices.size(), vertexDesc);
+		meshData->setVertexData(VES_POSITION, positions.data(), NUM_VERTICES * sizeof(Vector3));
+		memcpy(meshData->getIndices32(), indices.data(), indices.size() * sizeof(UINT32));
+
+		// Split the grid in two sub-meshes, to ensure they are simplified separately
+		const UINT32 halfIndices = (UINT32)indices.size() / 2;
+		const Vector<SubMesh> subMeshes = { SubMesh(0, halfIndices, DOT_TRIANGLE_LIST),
+			SubMesh(halfIndices, halfIndices, DOT_TRIANGLE_LIST) };
+
+		const float ratios[] = { 1.0f, 0.5f, 0.25f };
+		for(auto& ratio : ratios)
+		{
+			Vector<SubMesh> outSubMeshes;
+			SPtr<MeshData> simplified = MeshUtility::simplify(meshData, subMeshes, ratio, outSubMeshes);
+
+			BS_TEST_ASSERT(simplified->getNumVertices() == NUM_VERTICES);
+			BS_TEST_ASSERT(outSubMeshes.size() == subMeshes.size());
+
+			const UINT32 numIndices = simplified->getNumIndices();
+			const UINT32 numTriangles = numIndices / 3;
+			BS_TEST_ASSERT(numIndices % 3 == 0);
+			BS_TEST_ASSERT(numTriangles > 0);
+
+			// Allow some slack, as collapses remove two triangles at a time and border vertices are never removed
+			BS_TEST_ASSERT(numTriangles <= (UINT32)(NUM_TRIANGLES * ratio) + NUM_TRIANGLES / 16);
+			if (ratio == 1.0f)
+				BS_TEST_ASSERT(numTriangles == NUM_TRIANGLES);
+
+			UINT32 subMeshIndices = 0;
+			for (auto& subMesh : outSubMeshes)
+			{
+				BS_TEST_ASSERT(subMesh.indexOffset == subMeshIndices);
+				BS_TEST_ASSERT(subMesh.drawOp == DOT_TRIANGLE_LIST);
+				BS_TEST_ASSERT(subMesh.indexCount > 0);
+
+				subMeshIndices += subMesh.indexCount;
+			}
+
+			BS_TEST_ASSERT(subMeshIndices == numIndices);
+
+			// No degenerate triangles or out of range vertices
+			const UINT32* outIndices = simplified->getIndices32();
+			for (UINT32 i = 0; i < numTriangles; i++)
+			{
+				const UINT32 a = outIndices[i * 3 + 0];
+				const UINT32 b = outIndices[i * 3 + 1];
+				const UINT32 c = outIndices[i * 3 + 2];
+
+				BS_TEST_ASSERT(a < NUM_VERTICES && b < NUM_VERTICES && c < NUM_VERTICES);
+				BS_TEST_ASSERT(a != b && b != c && a != c);
+			}
+		}
+	}
+
+	void CoreTestSuite::testLODSelection()
+	{
+		const Vector<float> screenSizes = { 0.5f, 0.25f, 0.1f };
+		static constexpr UINT32 NUM_LODS = 4;
+
+		// Without a previous level, the level is picked purely from the thresholds
+		BS_TEST_ASSERT(ct::Renderable::selectLOD(1.0f, screenSizes, NUM_LODS, 0) == 0);
+		BS_TEST_ASSERT(ct::Renderable::selectLOD(0.4f, screenSizes, NUM_LODS, 1) == 1);
+		BS_TEST_ASSERT(ct::Renderable::selectLOD(0.2f, screenSizes, NUM_LODS, 2) == 2);
+		BS_TEST_ASSERT(ct::Renderable::selectLOD(0.01f, screenSizes, NUM_LODS, 3) == 3);
+
+		// Levels without a mesh are never used
+		BS_TEST_ASSERT(ct::Renderable::selectLOD(0.01f, screenSizes, 2, 0) == 1);
+		BS_TEST_ASSERT(ct::Renderable::selectLOD(0.01f, screenSizes, 1, 0) == 0);
+
+		// Levels without a screen size are never used
+		BS_TEST_ASSERT(ct::Renderable::selectLOD(0.01f, { 0.5f }, NUM_LODS, 0) == 1);
+
+		// Moving slightly past a threshold keeps the current level, moving sufficiently past it switches
+		BS_TEST_ASSERT(ct::Renderable::selectLOD(0.48f, screenSizes, NUM_LODS, 0) == 0);
+		BS_TEST_ASSERT(ct::Renderable::selectLOD(0.4f, screenSizes, NUM_LODS, 0) == 1);
+		BS_TEST_ASSERT(ct::Renderable::selectLOD(0.52f, screenSizes, NUM_LODS, 1) == 1);
+		BS_TEST_ASSERT(ct::Renderable::selectLOD(0.6f, screenSizes, NUM_LODS, 1) == 0);
+
+		// Large jumps skip intermediate levels
+		BS_TEST_ASSERT(ct::Renderable::selectLOD(0.01f, screenSizes, NUM_LODS, 0) == 3);
+		BS_TEST_ASSERT(ct::Renderable::selectLOD(1.0f, screenSizes, NUM_LODS, 3) == 0);
+	}
+
+	void CoreTestSuite::testMaterialParamVersion()
+	{
+		Map<String, SHADER_DATA_PARAM_DESC> dataParams;
+		dataParams["gScale"] = SHADER_DATA_PARAM_DESC("gScale", "gScale", GPDT_FLOAT1);
+		dataParams["gTint"] = SHADER_DATA_PARAM_DESC("gTint", "gTint", GPDT_FLOAT4);
+
+		MaterialParamsBase params(dataParams, {}, {}, {}, 1);
+
+		const UINT32 scaleIdx = params.getParamIndex("gScale");
+		const UINT32 tintIdx = params.getParamIndex("gTint");
+		const MaterialParamsBase::ParamData* scaleParam = params.getParamData(scaleIdx);
+		const MaterialParamsBase::ParamData* tintParam = params.getParamData(tintIdx);
+
+		// Every modification advances the version, and records the modified parameter
+		const UINT64 initialVersion = params.getParamVersion();
+		params.setDataParam(*scaleParam, 0, 2.0f);
+
+		BS_TEST_ASSERT(params.getParamVersion() == initialVersion + 1);
+		BS_TEST_ASSERT(scaleParam->version == params.getParamVersion());
+		BS_TEST_ASSERT(params.getDirtyParam(params.getParamVersion()) == scaleIdx);
+
+		params.setDataParam(*tintParam, 0, Vector4(1.0f, 0.5f, 0.25f, 1.0f));
+
+		BS_TEST_ASSERT(params.getParamVersion() == initialVersion + 2);
+		BS_TEST_ASSERT(tintParam->version == params.getParamVersion());
+		BS_TEST_ASSERT(scaleParam->version == initialVersion + 1);
+		BS_TEST_ASSERT(params.getDirtyParam(params.getParamVersion()) == tintIdx);
+
+		float scale = 0.0f;
+		params.getDataParam(*scaleParam, 0, scale);
+		BS_TEST_ASSERT(scale == 2.0f);
+
+		// Ring buffer keeps track of the most recent modifications only
+		for (UINT32 i = 0; i < MaterialParamsBase::DIRTY_PARAM_RING_SIZE; i++)
+			params.setDataParam(*scaleParam, 0, (float)i);
+
+		BS_TEST_ASSERT(params.getParamVersion() == initialVersion + 2 + MaterialParamsBase::DIRTY_PARAM_RING_SIZE);
+		BS_TEST_ASSERT(scaleParam->version == params.getParamVersion());
+		BS_TEST_ASSERT(params.getDirtyParam(params.getParamVersion()) == scaleIdx);
+	}
+
+	void CoreTestSuite::testOcclusionBuffer()
+	{
+		// Camera at origin looking down the negative Z axis, with OpenGL style [-1, 1] depth range
+		const Matrix4 proj = Matrix4::projectionPerspective(Degree(90.0f), 2.0f, 0.1f, 1000.0f);
+		const Matrix4 view = Matrix4::view(Vector3::ZERO, Quaternion::IDENTITY);
+
+		OcclusionBuffer buffer(256, 128);
+		buffer.clear(proj * view, -1.0f);
+
+		// Wall occluder in front of the camera
+		const Vector3 positions[] = { Vector3(-5, -5, -10), Vector3(5, -5, -10), Vector3(5, 5, -10), Vector3(-5, 5, -10) };
+		const UINT32 indices[] = { 0, 1, 2, 0, 2, 3 };
+
+		buffer.rasterize(Matrix4::IDENTITY, (const UINT8*)positions, sizeof(Vector3), 4, indices, 6);
+		buffer.buildHierarchy();
+
+		auto isVisible = [&buffer](const Vector3& center, float extent)
+		{
+			const Vector3 extents(extent, extent, extent);
+			return buffer.isVisible(AABox(center - extents, center + extents));
+		};
+
+		// Fully hidden behind the wall
+		BS_TEST_ASSERT(!isVisible(Vector3(0.0f, 0.0f, -20.0f), 1.0f));
+
+		// In front of the wall, larger than the wall, to the side of the wall, or intersecting the wall
+		BS_TEST_ASSERT(isVisible(Vector3(0.0f, 0.0f, -5.0f), 1.0f));
+		BS_TEST_ASSERT(isVisible(Vector3(0.0f, 0.0f, -20.0f), 15.0f));
+		BS_TEST_ASSERT(isVisible(Vector3(30.0f, 0.0f, -20.0f), 1.0f));
+		BS_TEST_ASSERT(isVisible(Vector3(0.0f, 0.0f, -10.5f), 1.0f));
+
+		// Intersecting the near plane
+		BS_TEST_ASSERT(isVisible(Vector3::ZERO, 1.0f));
+	}
+
+	void CoreTestSuite::testScopedProfiler()
+	{
+		ProfilerCPU::startUp();
+
+		// Same name registered twice maps to the same sample
+		const UINT32 idA = ProfilerCPU::registerScopedSample("TestScope", ProfilerCPU::hashSampleName("TestScope"));
+		const UINT32 idB = ProfilerCPU::registerScopedSample("TestScope", ProfilerCPU::hashSampleName("TestScope"));
+		BS_TEST_ASSERT(idA == idB);
+
+		static_assert(ProfilerCPU::hashSampleName("TestScope") != ProfilerCPU::hashSampleName("TestScope2"),
+			"Sample name hash must be evaluated at compile time.");
+
+		// Benchmark a tight loop with and without instrumentation
+		static constexpr UINT32 NUM_ITERATIONS = 200000;
+		volatile UINT32 sink = 0;
+
+		auto work = [&sink](UINT32 i)
+		{
+			sink = sink + i * i;
+		};
+
+		gProfilerCPU().beginThread("Test");
+
+		Timer timer;
+		for(UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			work(i);
+		const UINT64 uninstrumentedUs = timer.getMicroseconds();
+
+		timer.reset();
+		for(UINT32 i = 0; i < NUM_ITERATIONS; i++)
+		{
+			BS_PROFILE_SCOPE(General, "BenchmarkScoped");
+			work(i);
+		}
+		const UINT64 scopedUs = timer.getMicroseconds();
+
+		timer.reset();
+		for(UINT32 i = 0; i < NUM_ITERATIONS; i++)
+		{
+			gProfilerCPU().beginSample("BenchmarkSample");
+			work(i);
+			gProfilerCPU().endSample("BenchmarkSample");
+		}
+		const UINT64 sampledUs = timer.getMicroseconds();
+
+		gProfilerCPU().endThread();
+
+		CPUProfilerReport report = gProfilerCPU().generateReport();
+		gProfilerCPU().reset();
+
+		const CPUProfilerScopedSamplingEntry* scopedEntry = nullptr;
+		for(auto& entry : report.getScopedSamplingData())
+		{
+			if(entry.name == "BenchmarkScoped")
+				scopedEntry = &entry;
+		}
+
+		BS_TEST_ASSERT(scopedEntry != nullptr);
+		if(scopedEntry)
+		{
+			BS_TEST_ASSERT(scopedEntry->numCalls == NUM_ITERATIONS);
+			BS_TEST_ASSERT(scopedEntry->maxTimeMs <= scopedEntry->totalTimeMs);
+			BS_TEST_ASSERT(scopedEntry->estimatedOverheadMs > 0.0);
+
+			BS_LOG(Info, Profiler, "Profiler benchmark ({0} iterations): uninstrumented {1} us, BS_PROFILE_SCOPE {2} us, "
+				"beginSample/endSample {3} us. Estimated scoped sample overhead: {4} ms.", NUM_ITERATIONS,
+				uninstrumentedUs, scopedUs, sampledUs, scopedEntry->estimatedOverheadMs);
+		}
+
+		// Resetting clears the accumulated data
+		report = gProfilerCPU().generateReport();
+		BS_TEST_ASSERT(report.getScopedSamplingData().empty());
+
+		ProfilerCPU::shutDown();
+	}
+
+	void CoreTestSuite::testFontLookup()
+	{
+		// Latin, Cyrillic, Arabic and a portion of CJK characters
+		const std::pair<UINT32, UINT32> ranges[] = { { 32, 127 }, { 0x410, 0x450 }, { 0x600, 0x700 }, { 0x4E00, 0x5200 } };
+
+		FontBitmap font;
+		font.missingGlyph.charId = 0;
+		font.missingGlyph.xAdvance = 1;
+
+		for(auto& range : ranges)
+		{
+			for(UINT32 i = range.first; i < range.second; i++)
+			{
+				CharDesc& desc = font.characters[i];
+				desc.charId = i;
+				desc.xAdvance = 5 + i % 7;
+
+				// Give upper case letters a set of kerning pairs, similar to what a typical font would have
+				if(i >= 'A' && i <= 'Z')
+				{
+					for(UINT32 j = 'a'; j <= 'z'; j += 2)
+						desc.kerningPairs.push_back({ j, -(INT32)((i + j) % 3) - 1 });
+				}
+			}
+		}
+
+		// Copies don't inherit lookup tables, so this one uses the map and linear kerning search
+		FontBitmap fontNoLookup = font;
+		font._buildLookup();
+
+		// Long multilingual string, with a character missing from the font
+		const U32String words[] = { U"The Quick Brown Fox ", U"\u0421\u044a\u0435\u0448\u044c ", U"\u0645\u0631\u062d\u0628\u0627 ",
+			U"\u4f60\u597d\u4e16\u754c ", U"AVATAR Tower ", U"\U0001F600 " };
+
+		U32String text;
+		for(UINT32 i = 0; i < 20000; i++)
+			text += words[(i * 7) % (sizeof(words) / sizeof(words[0]))];
+
+		auto measure = [&text](const FontBitmap& bitmap)
+		{
+			INT64 width = 0;
+			const CharDesc* prevDesc = nullptr;
+			for(auto& charId : text)
+			{
+				const CharDesc& desc = bitmap.getCharDesc(charId);
+
+				width += desc.xAdvance;
+				if(prevDesc != nullptr)
+					width += bitmap.getKerning(*prevDesc, desc);
+
+				prevDesc = &desc;
+			}
+
+			return width;
+		};
+
+		for(auto& charId : U"AVax\u0430\u0628\u4e16\U0001F600")
+		{
+			if(charId == 0)
+				break;
+
+			BS_TEST_ASSERT(font.getCharDesc(charId).charId == fontNoLookup.getCharDesc(charId).charId);
+			BS_TEST_ASSERT(font.getCharDesc(charId).xAdvance == fontNoLookup.getCharDesc(charId).xAdvance);
+		}
+
+		BS_TEST_ASSERT(font.getKerning(font.getCharDesc('A'), font.getCharDesc('c')) == -3);
+		BS_TEST_ASSERT(font.getKerning(font.getCharDesc('A'), font.getCharDesc('b')) == 0);
+		BS_TEST_ASSERT(font.getCharDesc(0x1F600).xAdvance == 1);
+
+		Timer timer;
+		const INT64 widthNoLookup = measure(fontNoLookup);
+		const UINT64 noLookupUs = timer.getMicroseconds();
+
+		timer.reset();
+		const INT64 widthLookup = measure(font);
+		const UINT64 lookupUs = timer.getMicroseconds();
+
+		BS_TEST_ASSERT(widthLookup == widthNoLookup);
+
+		BS_LOG(Info, Generic, "Font lookup benchmark ({0} characters): map and linear kerning search {1} us, lookup "
+			"tables {2} us.", (UINT32)text.size(), noLookupUs, lookupUs);
+	}
+
+	void CoreTestSuite::testDynamicFontPacking()
+	{
+		// 64x64 pages fit three shelves of three padded 16x16 glyphs each
+		static constexpr UINT32 PAGE_SIZE = 64;
+		static constexpr UINT32 GLYPHS_PER_PAGE = 9;
+		static constexpr UINT32 NUM_PAGES = 3;
+
+		DYNAMIC_FONT_DESC desc;
+		desc.pageSize = PAGE_SIZE;
+		desc.maxPages = NUM_PAGES;
+
+		SPtr<TestGlyphRasterizer> rasterizer = bs_shared_ptr_new<TestGlyphRasterizer>();
+		SPtr<DynamicFontAtlas> atlas = bs_shared_ptr_new<DynamicFontAtlas>(rasterizer, desc);
+		SPtr<FontBitmap> bitmap = atlas->createBitmap(16);
+		BS_TEST_ASSERT(bitmap != nullptr);
+
+		const UINT32 numChars = GLYPHS_PER_PAGE * NUM_PAGES;
+		Vector<CharDesc> chars;
+		for(UINT32 i = 0; i < numChars; i++)
+		{
+			const CharDesc& charDesc = bitmap->getOrAddCharDesc('A' + i);
+			BS_TEST_ASSERT(&charDesc != &bitmap->missingGlyph);
+			BS_TEST_ASSERT(charDesc.charId == 'A' + i);
+			BS_TEST_ASSERT(charDesc.page == i / GLYPHS_PER_PAGE);
+
+			chars.push_back(charDesc);
+		}
+
+		BS_TEST_ASSERT(bitmap->texturePages.size() == NUM_PAGES);
+
+		// Glyphs must lie within their page and must not overlap any other glyph on the same page
+		for(UINT32 i = 0; i < numChars; i++)
+		{
+			const INT32 x = Math::roundToInt(chars[i].uvX * PAGE_SIZE);
+			const INT32 y = Math::roundToInt(chars[i].uvY * PAGE_SIZE);
+			const INT32 size = (INT32)TestGlyphRasterizer::GLYPH_SIZE;
+
+			BS_TEST_ASSERT(x >= 0 && x + size <= (INT32)PAGE_SIZE);
+			BS_TEST_ASSERT(y >= 0 && y + size <= (INT32)PAGE_SIZE);
+			BS_TEST_ASSERT(Math::approxEquals(chars[i].uvWidth * PAGE_SIZE, (float)size));
+
+			for(UINT32 j = i + 1; j < numChars; j++)
+			{
+				if(chars[j].page != chars[i].page)
+					continue;
+
+				const INT32 otherX = Math::roundToInt(chars[j].uvX * PAGE_SIZE);
+				const INT32 otherY = Math::roundToInt(chars[j].uvY * PAGE_SIZE);
+
+				const bool overlaps = x < otherX + size && otherX < x + size && y < otherY + size && otherY < y + size;
+				BS_TEST_ASSERT(!overlaps);
+			}
+		}
+
+		// Already added characters are found through the lookup, without being added again
+		for(UINT32 i = 0; i < numChars; i++)
+		{
+			const CharDesc& charDesc = bitmap->getCharDesc('A' + i);
+			BS_TEST_ASSERT(charDesc.page == chars[i].page);
+			BS_TEST_ASSERT(charDesc.uvX == chars[i].uvX && charDesc.uvY == chars[i].uvY);
+		}
+
+		// Characters that don't fit map to the missing glyph, without growing the atlas
+		BS_TEST_ASSERT(&bitmap->getOrAddCharDesc('A' + numChars) == &bitmap->missingGlyph);
+		BS_TEST_ASSERT(bitmap->texturePages.size() == NUM_PAGES);
+
+		// Kerning is queried from the rasterizer once per pair
+		const INT32 kerning = bitmap->getKerning(chars[0], chars[1]);
+		BS_TEST_ASSERT(kerning == -(INT32)((chars[0].charId + chars[1].charId) % 3));
+		BS_TEST_ASSERT(bitmap->getKerning(chars[0], chars[1]) == kerning);
+		BS_TEST_ASSERT(rasterizer->numKerningQueries == 1);
+	}
+
+	void CoreTestSuite::testDynamicFontEviction()
+	{
+		static constexpr UINT32 GLYPHS_PER_PAGE = 9;
+		static constexpr UINT32 NUM_PAGES = 3;
+
+		DYNAMIC_FONT_DESC desc;
+		desc.pageSize = 64;
+		desc.maxPages = NUM_PAGES;
+
+		SPtr<TestGlyphRasterizer> rasterizer = bs_shared_ptr_new<TestGlyphRasterizer>();
+		SPtr<DynamicFontAtlas> atlas = bs_shared_ptr_new<DynamicFontAtlas>(rasterizer, desc);
+		SPtr<FontBitmap> bitmap = atlas->createBitmap(16);
+		BS_TEST_ASSERT(bitmap != nullptr);
+
+		auto charOnPage = [](UINT32 page, UINT32 idx) { return (UINT32)'A' + page * GLYPHS_PER_PAGE + idx; };
+		auto isPresent = [&bitmap](UINT32 charId) { return &bitmap->getCharDesc(charId) != &bitmap->missingGlyph; };
+
+		// Frame 0: fill all pages. Nothing needs to be evicted.
+		for(UINT32 i = 0; i < GLYPHS_PER_PAGE * NUM_PAGES; i++)
+			bitmap->getOrAddCharDesc('A' + i);
+
+		BS_TEST_ASSERT(!atlas->_update(0));
+
+		// Frame 1: page 2 is in use and page 0 is referenced by a live sprite, so page 1 is the only candidate for eviction
+		// even though page 0 was used less recently
+		const UINT32 overflowChar = charOnPage(NUM_PAGES, 0);
+
+		bitmap->getCharDesc(charOnPage(2, 0));
+		bitmap->_pinPage(0);
+		BS_TEST_ASSERT(&bitmap->getOrAddCharDesc(overflowChar) == &bitmap->missingGlyph);
+		BS_TEST_ASSERT(atlas->_update(1));
+
+		for(UINT32 i = 0; i < GLYPHS_PER_PAGE; i++)
+		{
+			BS_TEST_ASSERT(isPresent(charOnPage(0, i)));
+			BS_TEST_ASSERT(!isPresent(charOnPage(1, i)));
+			BS_TEST_ASSERT(isPresent(charOnPage(2, i)));
+		}
+
+		// The character that didn't fit is no longer mapped to the missing glyph, and takes the space of the evicted page
+		const CharDesc& overflowDesc = bitmap->getOrAddCharDesc(overflowChar);
+		BS_TEST_ASSERT(&overflowDesc != &bitmap->missingGlyph);
+		BS_TEST_ASSERT(overflowDesc.page == 1);
+		BS_TEST_ASSERT(bitmap->texturePages.size() == NUM_PAGES);
+
+		bitmap->_unpinPage(0);
+		BS_TEST_ASSERT(!atlas->_update(2));
+
+		// Frame 3: with every page referenced nothing can be evicted, so the atlas grows instead
+		for(UINT32 i = 0; i < NUM_PAGES; i++)
+			bitmap->_pinPage(i);
+
+		for(UINT32 i = 1; i < GLYPHS_PER_PAGE; i++)
+			bitmap->getOrAddCharDesc(charOnPage(1, i));
+
+		BS_TEST_ASSERT(&bitmap->getOrAddCharDesc(charOnPage(NUM_PAGES, 1)) == &bitmap->missingGlyph);
+		BS_TEST_ASSERT(atlas->_update(3));
+		BS_TEST_ASSERT(bitmap->texturePages.size() == NUM_PAGES + 1);
+
+		for(UINT32 i = 0; i < GLYPHS_PER_PAGE; i++)
+		{
+			BS_TEST_ASSERT(isPresent(charOnPage(0, i)));
+			BS_TEST_ASSERT(isPresent(charOnPage(2, i)));
+		}
+
+		BS_TEST_ASSERT(bitmap->getOrAddCharDesc(charOnPage(NUM_PAGES, 1)).page == NUM_PAGES);
+
+		for(UINT32 i = 0; i < NUM_PAGES; i++)
+			bitmap->_unpinPage(i);
+	}
+	void CoreTestSuite::testSkeletonPose()
+	{
+		static constexpr UINT32 NUM_BONES = 255; // Not a multiple of four, to test the scalar tail of batch operations
+		static constexpr float TOLERANCE = 1e-3f;
+
+		MemStack::beginThread();
+
+		Random random(4321);
+
+		// Each bone is parented to a random bone before it
+		Vector<BONE_DESC> bones(NUM_BONES);
+		for(UINT32 i = 0; i < NUM_BONES; i++)
+		{
+			bones[i].name = "Bone" + toString(i);
+			bones[i].parent = i == 0 ? (UINT32)-1 : random.get() % i;
+
+			const Quaternion rotation(random.getUnitVector(), Radian(random.getUNorm() * Math::TWO_PI));
+			bones[i].localTfrm = Transform(random.getPointInSphere() * 2.0f, rotation,
+				Vector3::ONE + random.getPointInSphere() * 0.1f);
+
+			const Quaternion bindRotation(random.getUnitVector(), Radian(random.getUNorm() * Math::TWO_PI));
+			bones[i].invBindPose = Matrix4::TRS(random.getPointInSphere() * 2.0f, bindRotation, Vector3::ONE);
+		}
+
+		SPtr<Skeleton> skeleton = Skeleton::create(bones.data(), NUM_BONES);
+
+		// Without any animation layers the pose is the skeleton's default pose
+		Vector<Matrix4> pose(NUM_BONES);
+		LocalSkeletonPose localPose(NUM_BONES);
+		skeleton->getPose(pose.data(), localPose, SkeletonMask(NUM_BONES), nullptr, 0);
+
+		// Reference, computed one bone at a time using the scalar matrix products
+		Vector<Matrix4> globalPose(NUM_BONES);
+		for(UINT32 i = 0; i < NUM_BONES; i++)
+		{
+			const Transform& tfrm = bones[i].localTfrm;
+			const Matrix4 local = Matrix4::TRS(tfrm.getPosition(), tfrm.getRotation(), tfrm.getScale());
+
+			globalPose[i] = bones[i].parent == (UINT32)-1 ? local : globalPose[bones[i].parent] * local;
+		}
+
+		bool allEqual = true;
+		for(UINT32 i = 0; i < NUM_BONES; i++)
+		{
+			const Matrix4 expected = globalPose[i] * bones[i].invBindPose;
+			for(UINT32 j = 0; j < 4; j++)
+				allEqual &= Math::approxEquals(pose[i][j], expected[j], TOLERANCE);
+		}
+
+		BS_TEST_ASSERT(allEqual);
+
+		MemStack::endThread();
+	}
 }
 
 using namespace bs;
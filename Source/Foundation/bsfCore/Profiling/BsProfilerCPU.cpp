@@ -3,6 +3,7 @@
 #include "Profiling/BsProfilerCPU.h"
 #include "Debug/BsDebug.h"
 #include "Platform/BsPlatform.h"
+#include "Debug/BsProfilerTimeline.h"
 #include <chrono>
 
 #if BS_COMPILER == BS_COMPILER_MSVC
@@ -25,6 +26,22 @@ using namespace std::chrono;
 
 namespace bs
 {
+	/** Names and identifiers of all registered scoped samples. */
+	struct ScopedSampleRegistry
+	{
+		Mutex mutex;
+		UnorderedMap<UINT32, UINT32> hashToId;
+		Vector<const char*> names;
+		UINT32 timelineIds[ProfilerCPU::MAX_SCOPED_SAMPLES];
+	};
+
+	/** Returns the global scoped sample registry. Samples can register before the profiler module is started. */
+	static ScopedSampleRegistry& getScopedSampleRegistry()
+	{
+		static ScopedSampleRegistry registry;
+		return registry;
+	}
+
 	ProfilerCPU::Timer::Timer()
 	{
 		time = 0.0f;
@@ -162,7 +179,13 @@ namespace bs
 	ProfilerCPU::ThreadInfo::ThreadInfo()
 		:frameAlloc(1024 * 512)
 	{
+		scopedSamples = bs_newN<ScopedSampleData, ProfilerAlloc>(MAX_SCOPED_SAMPLES);
+		memset(scopedSamples, 0, sizeof(ScopedSampleData) * MAX_SCOPED_SAMPLES);
+	}
 
+	ProfilerCPU::ThreadInfo::~ThreadInfo()
+	{
+		bs_deleteN<ScopedSampleData, ProfilerAlloc>(scopedSamples, MAX_SCOPED_SAMPLES);
 	}
 	
 	void ProfilerCPU::ThreadInfo::begin(const char* _name)
@@ -233,6 +256,8 @@ namespace bs
 
 		rootBlock = nullptr;
 		frameAlloc.clear(); // Note: This never actually frees memory
+
+		memset(scopedSamples, 0, sizeof(ScopedSampleData) * MAX_SCOPED_SAMPLES);
 	}
 
 	ProfilerCPU::ProfiledBlock* ProfilerCPU::ThreadInfo::getBlock(const char* name)
@@ -307,6 +332,9 @@ namespace bs
 			}
 		}
 
+		if(ProfilerTimeline::isEnabled())
+			ProfilerTimeline::setThreadName(name);
+
 		thread->begin(name);
 	}
 
@@ -344,6 +372,7 @@ namespace bs
 		thread->activeBlock = ActiveBlock(ActiveSamplingType::Basic, block);
 		thread->activeBlocks->push(thread->activeBlock);
 
+		ProfilerTimeline::beginEvent(name);
 		block->basic.beginSample();
 	}
 
@@ -374,6 +403,7 @@ namespace bs
 #endif
 
 		block->basic.endSample();
+		ProfilerTimeline::endEvent(name);
 
 		thread->activeBlocks->pop();
 
@@ -411,6 +441,7 @@ namespace bs
 		thread->activeBlock = ActiveBlock(ActiveSamplingType::Precise, block);
 		thread->activeBlocks->push(thread->activeBlock);
 
+		ProfilerTimeline::beginEvent(name);
 		block->precise.beginSample();
 	}
 
@@ -441,6 +472,7 @@ namespace bs
 #endif
 
 		block->precise.endSample();
+		ProfilerTimeline::endEvent(name);
 
 		thread->activeBlocks->pop();
 
@@ -450,6 +482,86 @@ namespace bs
 			thread->activeBlock = ActiveBlock();
 	}
 
+	UINT32 ProfilerCPU::registerScopedSample(const char* name, UINT32 hash)
+	{
+		ScopedSampleRegistry& registry = getScopedSampleRegistry();
+		Lock lock(registry.mutex);
+
+		auto iterFind = registry.hashToId.find(hash);
+		if(iterFind != registry.hashToId.end())
+		{
+			const UINT32 id = iterFind->second;
+			if(strcmp(registry.names[id], name) == 0)
+				return id;
+
+			// Hash collision, fall through and register a separate sample that won't be found by hash
+		}
+
+		const UINT32 id = (UINT32)registry.names.size();
+		if(id >= MAX_SCOPED_SAMPLES)
+		{
+			BS_LOG(Warning, Profiler, "Maximum number of scoped samples reached. Sample \"{0}\" will be ignored.", name);
+			return MAX_SCOPED_SAMPLES;
+		}
+
+		registry.names.push_back(name);
+		registry.timelineIds[id] = ProfilerTimeline::getEventId(name);
+
+		if(iterFind == registry.hashToId.end())
+			registry.hashToId[hash] = id;
+
+		return id;
+	}
+
+	void ProfilerCPU::_beginScopedSample(UINT32 id)
+	{
+		if(id >= MAX_SCOPED_SAMPLES)
+			return;
+
+		ProfilerTimeline::beginEvent(getScopedSampleRegistry().timelineIds[id]);
+	}
+
+	void ProfilerCPU::_endScopedSample(UINT32 id, UINT64 startTime)
+	{
+		const UINT64 elapsed = _getScopedSampleTime() - startTime;
+
+		if(id >= MAX_SCOPED_SAMPLES)
+			return;
+
+		ThreadInfo* thread = ThreadInfo::activeThread;
+		if(thread == nullptr)
+		{
+			if(!isStarted())
+				return;
+
+			instance().beginThread("Unknown");
+			thread = ThreadInfo::activeThread;
+		}
+
+		ScopedSampleData& sample = thread->scopedSamples[id];
+		sample.numCalls++;
+		sample.totalTimeNs += elapsed;
+		sample.maxTimeNs = std::max(sample.maxTimeNs, elapsed);
+
+		if(ProfilerTimeline::isEnabled())
+			ProfilerTimeline::endEvent(getScopedSampleRegistry().timelineIds[id]);
+	}
+
+	void ProfilerCPU::setTimelineEnabled(bool enabled)
+	{
+		ProfilerTimeline::setEnabled(enabled);
+	}
+
+	bool ProfilerCPU::isTimelineEnabled() const
+	{
+		return ProfilerTimeline::isEnabled();
+	}
+
+	void ProfilerCPU::saveTimeline(const Path& path) const
+	{
+		ProfilerTimeline::saveChromeTrace(path);
+	}
+
 	void ProfilerCPU::reset()
 	{
 		ThreadInfo* thread = ThreadInfo::activeThread;
@@ -469,6 +581,28 @@ namespace bs
 		if(thread->isActive)
 			thread->end();
 
+		{
+			ScopedSampleRegistry& registry = getScopedSampleRegistry();
+			Lock lock(registry.mutex);
+
+			for(UINT32 i = 0; i < (UINT32)registry.names.size(); i++)
+			{
+				const ScopedSampleData& sample = thread->scopedSamples[i];
+				if(sample.numCalls == 0)
+					continue;
+
+				CPUProfilerScopedSamplingEntry entry;
+				entry.name = registry.names[i];
+				entry.numCalls = sample.numCalls;
+				entry.totalTimeMs = sample.totalTimeNs * 0.000001;
+				entry.maxTimeMs = sample.maxTimeNs * 0.000001;
+				entry.avgTimeMs = entry.totalTimeMs / sample.numCalls;
+				entry.estimatedOverheadMs = sample.numCalls * mScopedSamplingOverheadMs;
+
+				report.mScopedSamplingEntries.push_back(entry);
+			}
+		}
+
 		// We need to separate out basic and precise data and form two separate hierarchies
 		if(thread->rootBlock == nullptr)
 			return report;
@@ -995,6 +1129,36 @@ namespace bs
 			if (avgCyclesPrecise < mPreciseSamplingOverheadCycles)
 				mPreciseSamplingOverheadCycles = avgCyclesPrecise;
 		}
+
+		/************************************************************************/
+		/* 				AVERAGE TIME IN MS FOR SCOPED SAMPLING                  */
+		/************************************************************************/
+
+		const UINT32 overheadSampleId = registerScopedSample("ProfilerOverhead", hashSampleName("ProfilerOverhead"));
+		const UINT32 scopedReps = reps * 10;
+
+		mScopedSamplingOverheadMs = 1000000.0;
+		for (UINT32 tries = 0; tries < 3; tries++)
+		{
+			beginThread("Main");
+
+			Timer timerC;
+			timerC.start();
+
+			for (UINT32 i = 0; i < scopedReps; i++)
+			{
+				TProfilerScope<true> scope(overheadSampleId);
+			}
+
+			timerC.stop();
+
+			endThread();
+			reset();
+
+			double avgTimeScoped = timerC.time/double(scopedReps);
+			if (avgTimeScoped < mScopedSamplingOverheadMs)
+				mScopedSamplingOverheadMs = avgTimeScoped;
+		}
 	}
 
 	ProfilerCPU& gProfilerCPU()
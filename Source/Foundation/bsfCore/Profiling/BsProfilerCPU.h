@@ -4,6 +4,8 @@
 
 #include "BsCorePrerequisites.h"
 #include "Utility/BsModule.h"
+#include "Debug/BsProfilerTimeline.h"
+#include <chrono>
 
 namespace bs
 {
@@ -13,6 +15,28 @@ namespace bs
 
 	class CPUProfilerReport;
 
+	/** Categories that scoped profiler samples (see BS_PROFILE_SCOPE) can belong to. */
+	enum class ProfilerCategory : UINT32
+	{
+		General = 1 << 0,
+		Rendering = 1 << 1,
+		Animation = 1 << 2,
+		Physics = 1 << 3,
+		Audio = 1 << 4,
+		GUI = 1 << 5,
+		Resources = 1 << 6,
+		Scripting = 1 << 7,
+		Threading = 1 << 8
+	};
+
+/**
+ * Bitmask of ProfilerCategory values whose scoped samples are compiled in. Define it in the build to strip samples from
+ * specific categories completely.
+ */
+#ifndef BS_PROFILER_CATEGORIES
+#define BS_PROFILER_CATEGORIES 0xFFFFFFFF
+#endif
+
 	/**
 	 * Provides various performance measuring methods.
 	 * 			
@@ -199,10 +223,19 @@ namespace bs
 			ProfiledBlock* block;
 		};
 
+		/** Accumulated timing information for a single scoped sample, on a single thread. */
+		struct ScopedSampleData
+		{
+			UINT64 numCalls;
+			UINT64 totalTimeNs;
+			UINT64 maxTimeNs;
+		};
+
 		/** Contains data about an active profiling thread. */
 		struct ThreadInfo
 		{
 			ThreadInfo();
+			~ThreadInfo();
 
 			/**
 			 * Starts profiling on the thread. New primary profiling block is created with the given name.
@@ -230,6 +263,8 @@ namespace bs
 			static BS_THREADLOCAL ThreadInfo* activeThread;
 			bool isActive = false;
 
+			ScopedSampleData* scopedSamples = nullptr;
+
 			ProfiledBlock* rootBlock = nullptr;
 
 			FrameAlloc frameAlloc;
@@ -238,6 +273,9 @@ namespace bs
 		};
 
 	public:
+		/** Maximum number of unique scoped samples that can be registered. */
+		static constexpr UINT32 MAX_SCOPED_SAMPLES = 1024;
+
 		ProfilerCPU();
 		~ProfilerCPU();
 
@@ -293,9 +331,74 @@ namespace bs
 		 */
 		void endSamplePrecise(const char* name);
 
+		/**
+		 * Registers a scoped sample with the provided name and returns its identifier. Registering the same name again
+		 * returns the same identifier. Normally you don't need to call this directly and should use BS_PROFILE_SCOPE
+		 * instead, which calls this only once per call site.
+		 *
+		 * @param[in]	name	Name of the sample. Must remain valid for the lifetime of the application.
+		 * @param[in]	hash	Hash of the name, as calculated by hashSampleName().
+		 * @return				Identifier of the sample, or MAX_SCOPED_SAMPLES if there is no more room for new samples.
+		 */
+		static UINT32 registerScopedSample(const char* name, UINT32 hash);
+
+		/** Calculates a hash of a sample name. Can be evaluated at compile time. */
+		static constexpr UINT32 hashSampleName(const char* name)
+		{
+			// FNV-1a
+			UINT32 hash = 2166136261u;
+			for(const char* iter = name; *iter != '\0'; ++iter)
+			{
+				hash ^= (UINT32)(UINT8)*iter;
+				hash *= 16777619u;
+			}
+
+			return hash;
+		}
+
+		/**
+		 * Enables or disables timeline recording. When enabled every sample is additionally recorded as a timestamped
+		 * begin/end event, along with all TaskScheduler tasks and core thread command batches. Unlike the report the
+		 * timeline shows exactly when the work executed on each thread. See ProfilerTimeline.
+		 */
+		void setTimelineEnabled(bool enabled);
+
+		/** Checks is timeline recording enabled. */
+		bool isTimelineEnabled() const;
+
+		/**
+		 * Saves the recorded timeline in the Chrome trace-event JSON format, viewable in chrome://tracing or the Perfetto
+		 * UI.
+		 *
+		 * @param[in]	path	Absolute path to the output file.
+		 */
+		void saveTimeline(const Path& path) const;
+
 		/** Clears all sampling data, and ends any unfinished sampling blocks. */
 		void reset();
 
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Returns the current time in nanoseconds, as used for measuring scoped samples. */
+		static UINT64 _getScopedSampleTime()
+		{
+			using namespace std::chrono;
+			return (UINT64)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+		}
+
+		/** Records the start of a scoped sample on the timeline. Only needs to be called if the timeline is enabled. */
+		static void _beginScopedSample(UINT32 id);
+
+		/**
+		 * Ends a scoped sample started at @p startTime (as returned by _getScopedSampleTime()) and accumulates its time
+		 * into the calling thread's sample data.
+		 */
+		static void _endScopedSample(UINT32 id, UINT64 startTime);
+
+		/** @} */
+
 		/**
 		 * Generates a report from all previously sampled data.
 		 * 			
@@ -317,6 +420,7 @@ namespace bs
 
 		double mBasicSamplingOverheadMs = 0.0;
 		double mPreciseSamplingOverheadMs = 0.0;
+		double mScopedSamplingOverheadMs = 0.0;
 		UINT64 mBasicSamplingOverheadCycles = 0;
 		UINT64 mPreciseSamplingOverheadCycles = 0;
 
@@ -385,6 +489,22 @@ namespace bs
 		ProfilerVector<CPUProfilerPreciseSamplingEntry> childEntries;
 	};
 
+	/**
+	 * Profiling entry containing timing information about a single scoped sample (see BS_PROFILE_SCOPE). Scoped samples
+	 * are not part of the sample hierarchy, instead timing is accumulated over all calls regardless of their parent.
+	 */
+	struct BS_CORE_EXPORT CPUProfilerScopedSamplingEntry
+	{
+		String name; /**< Name of the sample. */
+		UINT64 numCalls = 0; /**< Number of times the sample was entered. */
+
+		double avgTimeMs = 0.0; /**< Average time it took to execute the sample, per call. In milliseconds. */
+		double maxTimeMs = 0.0; /**< Maximum time of a single call of the sample. In milliseconds. */
+		double totalTimeMs = 0.0; /**< Total time the sample took, across all calls. In milliseconds. */
+
+		double estimatedOverheadMs = 0.0; /**< Estimated overhead of profiling this sample, across all calls. In milliseconds. */
+	};
+
 	/** CPU profiling report containing all profiling information for a single profiling session. */
 	class BS_CORE_EXPORT CPUProfilerReport
 	{
@@ -403,11 +523,15 @@ namespace bs
 		 */
 		const CPUProfilerPreciseSamplingEntry& getPreciseSamplingData() const { return mPreciseSamplingRootEntry; }
 
+		/** Returns data for all scoped samples that were entered at least once. */
+		const ProfilerVector<CPUProfilerScopedSamplingEntry>& getScopedSamplingData() const { return mScopedSamplingEntries; }
+
 	private:
 		friend class ProfilerCPU;
 
 		CPUProfilerBasicSamplingEntry mBasicSamplingRootEntry;
 		CPUProfilerPreciseSamplingEntry mPreciseSamplingRootEntry;
+		ProfilerVector<CPUProfilerScopedSamplingEntry> mScopedSamplingEntries;
 	};
 
 	/** Provides global access to ProfilerCPU instance. */
@@ -421,5 +545,75 @@ namespace bs
 		bs::gProfilerCPU().endSample(name);			\
 	}
 
+	/**
+	 * Measures the time between its construction and destruction as a scoped sample. When @p ENABLED is false the scope
+	 * is empty and gets compiled out. Use BS_PROFILE_SCOPE instead of using this directly.
+	 */
+	template<bool ENABLED>
+	class TProfilerScope
+	{
+	public:
+		TProfilerScope(UINT32 id)
+			:mId(id)
+		{
+			if(ProfilerTimeline::isEnabled())
+				ProfilerCPU::_beginScopedSample(mId);
+
+			mStartTime = ProfilerCPU::_getScopedSampleTime();
+		}
+
+		~TProfilerScope()
+		{
+			ProfilerCPU::_endScopedSample(mId, mStartTime);
+		}
+
+		/** @copydoc ProfilerCPU::registerScopedSample */
+		static UINT32 registerSample(const char* name, UINT32 hash)
+		{
+			return ProfilerCPU::registerScopedSample(name, hash);
+		}
+
+	private:
+		UINT32 mId;
+		UINT64 mStartTime;
+	};
+
+	/** @copydoc TProfilerScope */
+	template<>
+	class TProfilerScope<false>
+	{
+	public:
+		constexpr TProfilerScope(UINT32 id) { }
+
+		static constexpr UINT32 registerSample(const char* name, UINT32 hash) { return 0; }
+	};
+
+#define BS_PROFILE_CONCAT_INNER(a, b) a##b
+#define BS_PROFILE_CONCAT(a, b) BS_PROFILE_CONCAT_INNER(a, b)
+
+/** Evaluates to true if scoped samples in the provided ProfilerCategory are compiled in. */
+#define BS_PROFILE_CATEGORY_ENABLED(category)											\
+	((BS_PROFILER_CATEGORIES & (bs::UINT32)bs::ProfilerCategory::category) != 0)
+
+#if BS_PROFILING_ENABLED
+/**
+ * Profiles the rest of the current scope as a scoped sample. The sample name must be a string literal, it is hashed
+ * at compile time and registered once per call site, so entering the scope performs no lookups. Timing is accumulated
+ * in a fixed size per-thread buffer and reported through CPUProfilerReport::getScopedSamplingData().
+ *
+ * @param[in]	category	ProfilerCategory the sample belongs to (e.g. Rendering). Samples in categories excluded
+ *							from BS_PROFILER_CATEGORIES are compiled out.
+ * @param[in]	name		Name of the sample, as a string literal.
+ */
+#define BS_PROFILE_SCOPE(category, name)												\
+	static const bs::UINT32 BS_PROFILE_CONCAT(bsProfileSampleId, __LINE__) =			\
+		bs::TProfilerScope<BS_PROFILE_CATEGORY_ENABLED(category)>::registerSample(name,	\
+			std::integral_constant<bs::UINT32, bs::ProfilerCPU::hashSampleName(name)>::value);	\
+	bs::TProfilerScope<BS_PROFILE_CATEGORY_ENABLED(category)>							\
+		BS_PROFILE_CONCAT(bsProfileScope, __LINE__)(BS_PROFILE_CONCAT(bsProfileSampleId, __LINE__))
+#else
+#define BS_PROFILE_SCOPE(category, name)
+#endif
+
 	/** @} */
 }
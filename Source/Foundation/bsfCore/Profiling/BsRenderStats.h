@@ -48,6 +48,15 @@ namespace bs
 
 		UINT64 numObjectsCreated;
 		UINT64 numObjectsDestroyed;
+
+		UINT64 numCullTests = 0;
+		UINT64 numCullCached = 0;
+
+		UINT64 numShadowCastersRendered = 0;
+		UINT64 numShadowCastersCached = 0;
+
+		UINT64 numParamBuffersCreated = 0;
+		UINT64 numBufferBytesWritten = 0;
 	};
 
 	/**
@@ -94,6 +103,30 @@ namespace bs
 		/** Increments index buffer change counter indicating how many times was a index buffer bound to the pipeline. */
 		void incNumIndexBufferBinds() { mData.numIndexBufferBinds++; }
 
+		/** Increments culling test counter indicating how many object bounds were tested against a view frustum. */
+		void addNumCullTests(UINT32 count) { mData.numCullTests += count; }
+
+		/**
+		 * Increments cached culling counter indicating how many objects had their visibility re-used from a previous
+		 * frame instead of being tested against a view frustum.
+		 */
+		void addNumCullCached(UINT32 count) { mData.numCullCached += count; }
+
+		/** Increments shadow caster counter indicating how many objects were drawn into shadow maps. */
+		void addNumShadowCastersRendered(UINT32 count) { mData.numShadowCastersRendered += count; }
+
+		/**
+		 * Increments cached shadow caster counter indicating how many static objects weren't drawn into shadow maps
+		 * because their depth was re-used from a previous frame.
+		 */
+		void addNumShadowCastersCached(UINT32 count) { mData.numShadowCastersCached += count; }
+
+		/** Increments GPU parameter block buffer counter indicating how many param block buffers were created. */
+		void incNumParamBuffersCreated() { mData.numParamBuffersCreated++; }
+
+		/** Increments buffer write counter indicating how many bytes were written to GPU buffers. */
+		void addNumBufferBytesWritten(UINT32 count) { mData.numBufferBytesWritten += count; }
+
 		/**
 		 * Increments created GPU resource counter.
 		 *
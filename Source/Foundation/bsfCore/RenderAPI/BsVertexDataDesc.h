@@ -78,6 +78,7 @@ namespace bs
 		friend class ct::Mesh;
 		friend class MeshHeap;
 		friend class ct::MeshHeap;
+		friend class MeshUtility;
 
 		/**	Returns the largest stream index of all the stored vertex elements. */
 		UINT32 getMaxStreamIdx() const;
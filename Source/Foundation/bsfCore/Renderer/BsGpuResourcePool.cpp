@@ -4,6 +4,7 @@
 #include "RenderAPI/BsRenderTexture.h"
 #include "Image/BsTexture.h"
 #include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsGpuParamBlockBuffer.h"
 
 namespace bs { namespace ct
 {
@@ -119,10 +120,64 @@ namespace bs { namespace ct
 		buffer = get(desc);
 	}
 
+	SPtr<GpuParamBlockBuffer> GpuResourcePool::getParamBlockBuffer(UINT32 size)
+	{
+		ParamBlockBucket& bucket = mParamBlockBuckets[size];
+		if(bucket.numUsed < (UINT32)bucket.entries.size())
+		{
+			ParamBlockBucket::Entry& entry = bucket.entries[bucket.numUsed++];
+			entry.lastUsedFrame = mCurrentFrame;
+
+			mParamBlockHits++;
+			return entry.buffer;
+		}
+
+		SPtr<GpuParamBlockBuffer> buffer = GpuParamBlockBuffer::create(size);
+		bucket.entries.push_back({ buffer, mCurrentFrame });
+		bucket.numUsed++;
+
+		mParamBlockMisses++;
+		return buffer;
+	}
+
+	SPtr<GpuParamBlockBuffer> GpuResourcePool::allocParamBlockBuffer(UINT32 size)
+	{
+		auto iterFind = mParamBlockBuckets.find(size);
+		if(iterFind != mParamBlockBuckets.end())
+		{
+			// Take the least recently used free buffer, so the ones at the front remain available for per-frame use
+			ParamBlockBucket& bucket = iterFind->second;
+			if(bucket.numUsed < (UINT32)bucket.entries.size())
+			{
+				SPtr<GpuParamBlockBuffer> buffer = bucket.entries.back().buffer;
+				bucket.entries.pop_back();
+
+				mParamBlockHits++;
+				return buffer;
+			}
+		}
+
+		mParamBlockMisses++;
+		return GpuParamBlockBuffer::create(size);
+	}
+
+	void GpuResourcePool::releaseParamBlockBuffer(const SPtr<GpuParamBlockBuffer>& buffer)
+	{
+		if(!buffer)
+			return;
+
+		// Insert as the most recently used free buffer, keeping the least recently used ones at the back for pruning
+		ParamBlockBucket& bucket = mParamBlockBuckets[buffer->getSize()];
+		bucket.entries.insert(bucket.entries.begin() + bucket.numUsed, { buffer, mCurrentFrame });
+	}
+
 	void GpuResourcePool::update()
 	{
 		mCurrentFrame++;
 
+		for(auto& entry : mParamBlockBuckets)
+			entry.second.numUsed = 0;
+
 		// Note: Should also force pruning when over some memory limit (in which case I can probably increase the
 		// age pruning limit higher)
 		prune(3);
@@ -165,6 +220,30 @@ namespace bs { namespace ct
 			else
 				++iter;
 		}
+
+		// Free buffers are ordered from most to least recently used, so the ones that haven't been needed recently are
+		// always at the back
+		for(auto iter = mParamBlockBuckets.begin(); iter != mParamBlockBuckets.end();)
+		{
+			ParamBlockBucket& bucket = iter->second;
+
+			UINT32 numEntries = (UINT32)bucket.entries.size();
+			while(numEntries > bucket.numUsed)
+			{
+				UINT32 entryAge = mCurrentFrame - bucket.entries[numEntries - 1].lastUsedFrame;
+				if(entryAge < age)
+					break;
+
+				numEntries--;
+			}
+
+			bucket.entries.resize(numEntries);
+
+			if(bucket.entries.empty())
+				iter = mParamBlockBuckets.erase(iter);
+			else
+				++iter;
+		}
 	}
 
 	bool GpuResourcePool::matches(const SPtr<Texture>& texture, const POOLED_RENDER_TEXTURE_DESC& desc)
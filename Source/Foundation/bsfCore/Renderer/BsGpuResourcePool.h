@@ -98,6 +98,38 @@ namespace bs { namespace ct
 		 */
 		void get(SPtr<PooledStorageBuffer>& buffer, const POOLED_STORAGE_BUFFER_DESC& desc);
 
+		/**
+		 * Returns a parameter block buffer of the specified size that may be used for the remainder of the current frame.
+		 * Buffers are handed out linearly and are all returned to the pool on the next call to update(), meaning the
+		 * same buffers get reused every frame instead of new ones being created for transient per-frame data. Caller must
+		 * not hold onto the returned buffer past the end of the frame.
+		 *
+		 * @param[in]	size	Size of the buffer, in bytes.
+		 */
+		SPtr<GpuParamBlockBuffer> getParamBlockBuffer(UINT32 size);
+
+		/**
+		 * Returns a parameter block buffer of the specified size that the caller may hold onto for as long as it needs.
+		 * The buffer is taken from the pool if an unused one of the same size is available, or created otherwise. Once
+		 * the caller is done with the buffer it should return it through releaseParamBlockBuffer() so it can be reused
+		 * by other objects.
+		 *
+		 * @param[in]	size	Size of the buffer, in bytes.
+		 */
+		SPtr<GpuParamBlockBuffer> allocParamBlockBuffer(UINT32 size);
+
+		/**
+		 * Returns a buffer previously retrieved from allocParamBlockBuffer() back to the pool. Caller must not use the
+		 * buffer after this call.
+		 */
+		void releaseParamBlockBuffer(const SPtr<GpuParamBlockBuffer>& buffer);
+
+		/** Returns the number of parameter block buffer requests that were satisfied by an existing buffer. */
+		UINT64 getParamBlockHits() const { return mParamBlockHits; }
+
+		/** Returns the number of parameter block buffer requests that required a new buffer to be created. */
+		UINT64 getParamBlockMisses() const { return mParamBlockMisses; }
+
 		/** Lets the pool know that another frame has passed. */
 		void update();
 
@@ -125,8 +157,28 @@ namespace bs { namespace ct
 		 */
 		static bool matches(const SPtr<GpuBuffer>& buffer, const POOLED_STORAGE_BUFFER_DESC& desc);
 
+		/**
+		 * Contains parameter block buffers of a specific size. Entries in range [0, numUsed) are handed out for the
+		 * current frame, while the rest are free, ordered from most to least recently used.
+		 */
+		struct ParamBlockBucket
+		{
+			/** Buffer in the bucket, along with the frame it was last handed out in. */
+			struct Entry
+			{
+				SPtr<GpuParamBlockBuffer> buffer;
+				UINT32 lastUsedFrame;
+			};
+
+			Vector<Entry> entries;
+			UINT32 numUsed = 0;
+		};
+
 		DynArray<SPtr<PooledRenderTexture>> mTextures;
 		DynArray<SPtr<PooledStorageBuffer>> mBuffers;
+		UnorderedMap<UINT32, ParamBlockBucket> mParamBlockBuckets;
+		UINT64 mParamBlockHits = 0;
+		UINT64 mParamBlockMisses = 0;
 
 		UINT32 mCurrentFrame = 0;
 	};
@@ -0,0 +1,330 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Renderer/BsOcclusionBuffer.h"
+#include "Mesh/BsMeshData.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "Math/BsAABox.h"
+#include "Math/BsSIMD.h"
+
+namespace bs
+{
+	OcclusionBuffer::OcclusionBuffer(UINT32 width, UINT32 height)
+		:mWidth(Math::divideAndRoundUp(std::max(width, 1U), 4U) * 4), mHeight(std::max(height, 1U))
+	{
+		mDepth.resize(mWidth * mHeight, std::numeric_limits<float>::infinity());
+
+		UINT32 levelWidth = mWidth;
+		UINT32 levelHeight = mHeight;
+		while(levelWidth > 1 || levelHeight > 1)
+		{
+			levelWidth = std::max(1U, Math::divideAndRoundUp(levelWidth, 2U));
+			levelHeight = std::max(1U, Math::divideAndRoundUp(levelHeight, 2U));
+
+			HierarchyLevel level;
+			level.width = levelWidth;
+			level.height = levelHeight;
+			level.depth.resize(levelWidth * levelHeight, std::numeric_limits<float>::infinity());
+
+			mHierarchy.push_back(std::move(level));
+		}
+	}
+
+	void OcclusionBuffer::clear(const Matrix4& viewProj, float minNDCZ)
+	{
+		mViewProj = viewProj;
+		mMinNDCZ = minNDCZ;
+
+		std::fill(mDepth.begin(), mDepth.end(), std::numeric_limits<float>::infinity());
+	}
+
+	void OcclusionBuffer::rasterize(const Matrix4& worldTfrm, const UINT8* positions, UINT32 stride, UINT32 numVertices,
+		const UINT32* indices, UINT32 numIndices)
+	{
+		transformVertices(worldTfrm, positions, stride, numVertices);
+		rasterizeTriangles(indices, numIndices);
+	}
+
+	void OcclusionBuffer::rasterize(const Matrix4& worldTfrm, const UINT8* positions, UINT32 stride, UINT32 numVertices,
+		const UINT16* indices, UINT32 numIndices)
+	{
+		transformVertices(worldTfrm, positions, stride, numVertices);
+		rasterizeTriangles(indices, numIndices);
+	}
+
+	void OcclusionBuffer::rasterize(const Matrix4& worldTfrm, const MeshData& meshData)
+	{
+		const SPtr<VertexDataDesc>& vertexDesc = meshData.getVertexDesc();
+
+		const VertexElement* positionElem = vertexDesc->getElement(VES_POSITION);
+		if(positionElem == nullptr || positionElem->getType() != VET_FLOAT3)
+			return;
+
+		const UINT32 streamIdx = positionElem->getStreamIdx();
+		const UINT8* positions = meshData.getElementData(VES_POSITION, 0, streamIdx);
+		const UINT32 stride = vertexDesc->getVertexStride(streamIdx);
+
+		if(meshData.getIndexType() == IT_32BIT)
+		{
+			rasterize(worldTfrm, positions, stride, meshData.getNumVertices(), meshData.getIndices32(),
+				meshData.getNumIndices());
+		}
+		else
+		{
+			rasterize(worldTfrm, positions, stride, meshData.getNumVertices(), meshData.getIndices16(),
+				meshData.getNumIndices());
+		}
+	}
+
+	void OcclusionBuffer::transformVertices(const Matrix4& worldTfrm, const UINT8* positions, UINT32 stride,
+		UINT32 numVertices)
+	{
+		const Matrix4 worldViewProj = mViewProj * worldTfrm;
+
+		mClipVertices.resize(numVertices);
+		for(UINT32 i = 0; i < numVertices; i++)
+		{
+			Vector3 position;
+			memcpy(&position, positions + i * stride, sizeof(position));
+
+			mClipVertices[i] = worldViewProj.multiply(Vector4(position, 1.0f));
+		}
+	}
+
+	template<class T>
+	void OcclusionBuffer::rasterizeTriangles(const T* indices, UINT32 numIndices)
+	{
+		const auto numVertices = (UINT32)mClipVertices.size();
+		const float halfWidth = mWidth * 0.5f;
+		const float halfHeight = mHeight * 0.5f;
+
+		for(UINT32 i = 0; i + 2 < numIndices; i += 3)
+		{
+			if(indices[i] >= numVertices || indices[i + 1] >= numVertices || indices[i + 2] >= numVertices)
+				continue;
+
+			const Vector4* clipVerts[3] = { &mClipVertices[indices[i]], &mClipVertices[indices[i + 1]],
+				&mClipVertices[indices[i + 2]] };
+
+			// Triangles crossing the near plane are skipped instead of clipped. This only reduces the amount of occlusion
+			// and such triangles are rare for the large and distant geometry that makes good occluders.
+			if(isBehindNearPlane(*clipVerts[0]) || isBehindNearPlane(*clipVerts[1]) || isBehindNearPlane(*clipVerts[2]))
+				continue;
+
+			Vector3 screenVerts[3];
+			for(UINT32 j = 0; j < 3; j++)
+			{
+				const float invW = 1.0f / clipVerts[j]->w;
+
+				screenVerts[j].x = (clipVerts[j]->x * invW + 1.0f) * halfWidth;
+				screenVerts[j].y = (clipVerts[j]->y * invW + 1.0f) * halfHeight;
+				screenVerts[j].z = clipVerts[j]->z * invW;
+			}
+
+			rasterizeTriangle(screenVerts[0], screenVerts[1], screenVerts[2]);
+		}
+	}
+
+	void OcclusionBuffer::rasterizeTriangle(const Vector3& v0, const Vector3& v1, const Vector3& v2)
+	{
+		using namespace simd;
+
+		// Both windings are rasterized, so make the triangle area positive
+		float area = (v1.x - v0.x) * (v2.y - v0.y) - (v1.y - v0.y) * (v2.x - v0.x);
+		if(std::abs(area) < 1e-8f)
+			return;
+
+		const Vector3& a = v0;
+		const Vector3& b = area > 0.0f ? v1 : v2;
+		const Vector3& c = area > 0.0f ? v2 : v1;
+		area = std::abs(area);
+
+		// Bounds of the triangle, in pixels, clipped to the buffer
+		const float minX = std::max(std::min(a.x, std::min(b.x, c.x)), 0.0f);
+		const float maxX = std::min(std::max(a.x, std::max(b.x, c.x)), (float)mWidth - 1.0f);
+		const float minY = std::max(std::min(a.y, std::min(b.y, c.y)), 0.0f);
+		const float maxY = std::min(std::max(a.y, std::max(b.y, c.y)), (float)mHeight - 1.0f);
+
+		if(minX > maxX || minY > maxY)
+			return;
+
+		const auto startX = (UINT32)minX & ~3U;
+		const auto endX = (UINT32)maxX;
+		const auto startY = (UINT32)minY;
+		const auto endY = (UINT32)maxY;
+
+		// Edge functions in the form of Ax + By + C, positive on the inside of the triangle. Each edge function is the
+		// barycentric weight of the vertex opposite to the edge, scaled by the triangle area.
+		const Vector3* edgeStart[3] = { &b, &c, &a };
+		const Vector3* edgeEnd[3] = { &c, &a, &b };
+
+		float edgeA[3], edgeB[3], edgeC[3];
+		for(UINT32 i = 0; i < 3; i++)
+		{
+			edgeA[i] = edgeStart[i]->y - edgeEnd[i]->y;
+			edgeB[i] = edgeEnd[i]->x - edgeStart[i]->x;
+			edgeC[i] = edgeStart[i]->x * edgeEnd[i]->y - edgeStart[i]->y * edgeEnd[i]->x;
+		}
+
+		// Depth is linear in screen space after the perspective divide
+		const float invArea = 1.0f / area;
+		const float depthA = (edgeA[0] * a.z + edgeA[1] * b.z + edgeA[2] * c.z) * invArea;
+		const float depthB = (edgeB[0] * a.z + edgeB[1] * b.z + edgeB[2] * c.z) * invArea;
+		const float depthC = (edgeC[0] * a.z + edgeC[1] * b.z + edgeC[2] * c.z) * invArea;
+
+		// Evaluate four horizontally adjacent pixels at once, sampling at pixel centers
+		const float startPixelX = (float)startX + 0.5f;
+		const float32x4 pixelOffsets = make_float(0.0f, 1.0f, 2.0f, 3.0f);
+		const float32x4 zero = make_float(0.0f);
+
+		float32x4 edgeStepX[3];
+		float32x4 edgeStep4[3];
+		for(UINT32 i = 0; i < 3; i++)
+		{
+			const float step4 = edgeA[i] * 4.0f;
+
+			edgeStepX[i] = load_splat<float32x4>(&edgeA[i]);
+			edgeStep4[i] = load_splat<float32x4>(&step4);
+		}
+
+		const float depthA4 = depthA * 4.0f;
+		const float32x4 depthStepX = load_splat<float32x4>(&depthA);
+		const float32x4 depthStep4 = load_splat<float32x4>(&depthA4);
+
+		for(UINT32 y = startY; y <= endY; y++)
+		{
+			const float pixelY = (float)y + 0.5f;
+			const float32x4 pixelX = add(load_splat<float32x4>(&startPixelX), pixelOffsets);
+
+			float32x4 edges[3];
+			for(UINT32 i = 0; i < 3; i++)
+			{
+				const float rowValue = edgeB[i] * pixelY + edgeC[i];
+				edges[i] = add(mul(edgeStepX[i], pixelX), load_splat<float32x4>(&rowValue));
+			}
+
+			const float rowDepth = depthB * pixelY + depthC;
+			float32x4 depth = add(mul(depthStepX, pixelX), load_splat<float32x4>(&rowDepth));
+
+			float* row = &mDepth[y * mWidth];
+			for(UINT32 x = startX; x <= endX; x += 4)
+			{
+				const mask_float32x4 inside = bit_and(bit_and(cmp_ge(edges[0], zero), cmp_ge(edges[1], zero)),
+					cmp_ge(edges[2], zero));
+
+				if(test_bits_any(bit_cast<uint32x4>(inside)))
+				{
+					const float32x4 existing = load_u<float32x4>(row + x);
+					const float32x4 result = blend(min(existing, depth), existing, inside);
+
+					store_u(row + x, result);
+				}
+
+				for(UINT32 i = 0; i < 3; i++)
+					edges[i] = add(edges[i], edgeStep4[i]);
+
+				depth = add(depth, depthStep4);
+			}
+		}
+	}
+
+	void OcclusionBuffer::buildHierarchy()
+	{
+		const float* srcDepth = mDepth.data();
+		UINT32 srcWidth = mWidth;
+		UINT32 srcHeight = mHeight;
+
+		// Each texel in a level contains the farthest depth of the 2x2 texels below it
+		for(auto& level : mHierarchy)
+		{
+			for(UINT32 y = 0; y < level.height; y++)
+			{
+				const UINT32 srcY0 = y * 2;
+				const UINT32 srcY1 = std::min(srcY0 + 1, srcHeight - 1);
+
+				for(UINT32 x = 0; x < level.width; x++)
+				{
+					const UINT32 srcX0 = x * 2;
+					const UINT32 srcX1 = std::min(srcX0 + 1, srcWidth - 1);
+
+					const float depth0 = std::max(srcDepth[srcY0 * srcWidth + srcX0], srcDepth[srcY0 * srcWidth + srcX1]);
+					const float depth1 = std::max(srcDepth[srcY1 * srcWidth + srcX0], srcDepth[srcY1 * srcWidth + srcX1]);
+
+					level.depth[y * level.width + x] = std::max(depth0, depth1);
+				}
+			}
+
+			srcDepth = level.depth.data();
+			srcWidth = level.width;
+			srcHeight = level.height;
+		}
+	}
+
+	bool OcclusionBuffer::isVisible(const AABox& bounds) const
+	{
+		const Vector3& min = bounds.getMin();
+		const Vector3& max = bounds.getMax();
+
+		float minX = std::numeric_limits<float>::max();
+		float minY = std::numeric_limits<float>::max();
+		float minZ = std::numeric_limits<float>::max();
+		float maxX = -std::numeric_limits<float>::max();
+		float maxY = -std::numeric_limits<float>::max();
+
+		for(UINT32 i = 0; i < 8; i++)
+		{
+			const Vector3 corner((i & 1) ? max.x : min.x, (i & 2) ? max.y : min.y, (i & 4) ? max.z : min.z);
+			const Vector4 clipPos = mViewProj.multiply(Vector4(corner, 1.0f));
+
+			// Bounds intersecting the near plane are always considered visible
+			if(isBehindNearPlane(clipPos))
+				return true;
+
+			const float invW = 1.0f / clipPos.w;
+			const float x = (clipPos.x * invW + 1.0f) * mWidth * 0.5f;
+			const float y = (clipPos.y * invW + 1.0f) * mHeight * 0.5f;
+
+			minX = std::min(minX, x);
+			minY = std::min(minY, y);
+			minZ = std::min(minZ, clipPos.z * invW);
+			maxX = std::max(maxX, x);
+			maxY = std::max(maxY, y);
+		}
+
+		// Bounds outside of the buffer are left for frustum culling to deal with
+		if(maxX < 0.0f || maxY < 0.0f || minX >= (float)mWidth || minY >= (float)mHeight)
+			return true;
+
+		auto pixelX0 = (UINT32)std::max(minX, 0.0f);
+		auto pixelY0 = (UINT32)std::max(minY, 0.0f);
+		auto pixelX1 = (UINT32)std::min(maxX, (float)mWidth - 1.0f);
+		auto pixelY1 = (UINT32)std::min(maxY, (float)mHeight - 1.0f);
+
+		// Find the finest level at which the bounds cover at most 2x2 texels
+		const float* depth = mDepth.data();
+		UINT32 levelWidth = mWidth;
+		for(auto& level : mHierarchy)
+		{
+			if((pixelX1 - pixelX0) <= 1 && (pixelY1 - pixelY0) <= 1)
+				break;
+
+			pixelX0 /= 2;
+			pixelY0 /= 2;
+			pixelX1 /= 2;
+			pixelY1 /= 2;
+
+			depth = level.depth.data();
+			levelWidth = level.width;
+		}
+
+		for(UINT32 y = pixelY0; y <= pixelY1; y++)
+		{
+			for(UINT32 x = pixelX0; x <= pixelX1; x++)
+			{
+				if(minZ <= depth[y * levelWidth + x])
+					return true;
+			}
+		}
+
+		return false;
+	}
+}
@@ -0,0 +1,130 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Math/BsMatrix4.h"
+#include "Math/BsVector4.h"
+
+namespace bs
+{
+	/** @addtogroup Renderer-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Low resolution depth buffer rendered on the CPU, used for occlusion culling. A small set of occluder meshes is
+	 * rasterized into the buffer, after which a hierarchical depth pyramid is built and used for quickly testing if
+	 * bounds of other objects are fully hidden behind the occluders.
+	 *
+	 * Depth is stored as post-projection Z divided by W, meaning the projection used must map larger depths further
+	 * away from the viewer. Testing is conservative with the exception of occluder edges, which are rasterized using
+	 * pixel centers.
+	 */
+	class BS_CORE_EXPORT OcclusionBuffer
+	{
+	public:
+		/** Default width of the buffer, in pixels. */
+		static constexpr UINT32 DEFAULT_WIDTH = 256;
+
+		/** Default height of the buffer, in pixels. */
+		static constexpr UINT32 DEFAULT_HEIGHT = 128;
+
+		/**
+		 * Constructs a new occlusion buffer.
+		 *
+		 * @param[in]	width	Width of the buffer in pixels. Rounded up to a multiple of four.
+		 * @param[in]	height	Height of the buffer in pixels.
+		 */
+		OcclusionBuffer(UINT32 width = DEFAULT_WIDTH, UINT32 height = DEFAULT_HEIGHT);
+
+		/**
+		 * Clears the buffer and prepares it for rasterizing occluders as seen using the provided transform.
+		 *
+		 * @param[in]	viewProj	Matrix that transforms from world space into clip space.
+		 * @param[in]	minNDCZ		Z value at the near plane, in normalized device coordinates. Geometry closer than this
+		 *							value is considered to be behind the viewer.
+		 */
+		void clear(const Matrix4& viewProj, float minNDCZ);
+
+		/**
+		 * Rasterizes an occluder into the depth buffer.
+		 *
+		 * @param[in]	worldTfrm		Transform from the occluder's local space into world space.
+		 * @param[in]	positions		Pointer to the first vertex position, with each position being a Vector3.
+		 * @param[in]	stride			Offset in bytes between two vertex positions.
+		 * @param[in]	numVertices		Number of vertices in the @p positions array.
+		 * @param[in]	indices			Indices forming a triangle list.
+		 * @param[in]	numIndices		Number of indices in the @p indices array.
+		 */
+		void rasterize(const Matrix4& worldTfrm, const UINT8* positions, UINT32 stride, UINT32 numVertices,
+			const UINT32* indices, UINT32 numIndices);
+
+		/** @copydoc rasterize(const Matrix4&, const UINT8*, UINT32, UINT32, const UINT32*, UINT32) */
+		void rasterize(const Matrix4& worldTfrm, const UINT8* positions, UINT32 stride, UINT32 numVertices,
+			const UINT16* indices, UINT32 numIndices);
+
+		/**
+		 * Rasterizes an occluder into the depth buffer, using the position and indices of the provided mesh data. Mesh
+		 * data is assumed to contain a triangle list.
+		 */
+		void rasterize(const Matrix4& worldTfrm, const MeshData& meshData);
+
+		/**
+		 * Builds the hierarchical depth pyramid from the rasterized occluders. Must be called after all occluders have
+		 * been rasterized and before calling isVisible().
+		 */
+		void buildHierarchy();
+
+		/**
+		 * Checks if the provided world space bounds are potentially visible. Returns false only if the bounds are fully
+		 * behind the rasterized occluders. Safe to call from multiple threads at once.
+		 */
+		bool isVisible(const AABox& bounds) const;
+
+		/** Returns the width of the buffer, in pixels. */
+		UINT32 getWidth() const { return mWidth; }
+
+		/** Returns the height of the buffer, in pixels. */
+		UINT32 getHeight() const { return mHeight; }
+
+		/** Returns the depth stored at the specified pixel. */
+		float getDepth(UINT32 x, UINT32 y) const { return mDepth[y * mWidth + x]; }
+
+	private:
+		/** Depth values of a single level of the hierarchical depth pyramid. */
+		struct HierarchyLevel
+		{
+			UINT32 width;
+			UINT32 height;
+			Vector<float> depth;
+		};
+
+		/** Transforms the occluder vertices into clip space, stored in @p mClipVertices. */
+		void transformVertices(const Matrix4& worldTfrm, const UINT8* positions, UINT32 stride, UINT32 numVertices);
+
+		/** Rasterizes a list of triangles using vertices from @p mClipVertices. */
+		template<class T>
+		void rasterizeTriangles(const T* indices, UINT32 numIndices);
+
+		/** Rasterizes a single triangle. Vertices are provided in screen space, with depth in the Z component. */
+		void rasterizeTriangle(const Vector3& v0, const Vector3& v1, const Vector3& v2);
+
+		/** Checks is the clip space vertex behind the near plane. */
+		bool isBehindNearPlane(const Vector4& clipPos) const
+		{
+			return clipPos.w <= 0.0f || clipPos.z < mMinNDCZ * clipPos.w;
+		}
+
+		UINT32 mWidth;
+		UINT32 mHeight;
+		Matrix4 mViewProj = Matrix4::IDENTITY;
+		float mMinNDCZ = 0.0f;
+
+		Vector<float> mDepth;
+		Vector<HierarchyLevel> mHierarchy;
+		Vector<Vector4> mClipVertices;
+	};
+
+	/** @} */
+}
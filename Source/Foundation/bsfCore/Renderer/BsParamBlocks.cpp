@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Renderer/BsParamBlocks.h"
 #include "RenderAPI/BsGpuParam.h"
+#include "Renderer/BsGpuResourcePool.h"
 
 namespace bs { namespace ct
 {
@@ -10,6 +11,26 @@ namespace bs { namespace ct
 		ParamBlockManager::unregisterBlock(this);
 	}
 
+	SPtr<GpuParamBlockBuffer> ParamBlock::allocBuffer(UINT32 size)
+	{
+		// Pool is owned by the renderer, so it might not be available to blocks used outside of it
+		if (!GpuResourcePool::isStarted())
+			return GpuParamBlockBuffer::create(size);
+
+		return gGpuResourcePool().allocParamBlockBuffer(size);
+	}
+
+	void ParamBlock::releaseBuffer(const SPtr<GpuParamBlockBuffer>& buffer)
+	{
+		if (GpuResourcePool::isStarted())
+			gGpuResourcePool().releaseParamBlockBuffer(buffer);
+	}
+
+	SPtr<GpuParamBlockBuffer> ParamBlock::getFrameBuffer(UINT32 size)
+	{
+		return gGpuResourcePool().getParamBlockBuffer(size);
+	}
+
 	Vector<ParamBlock*> ParamBlockManager::sToInitialize;
 
 	ParamBlockManager::ParamBlockManager()
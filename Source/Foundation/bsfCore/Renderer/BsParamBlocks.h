@@ -95,6 +95,21 @@ namespace bs { namespace ct
 	{
 		virtual ~ParamBlock();
 		virtual void initialize() = 0;
+
+		/**
+		 * Returns a pooled buffer of the specified size that the caller may hold onto until it returns it through
+		 * releaseBuffer(). See GpuResourcePool::allocParamBlockBuffer().
+		 */
+		static SPtr<GpuParamBlockBuffer> allocBuffer(UINT32 size);
+
+		/** Returns a buffer retrieved from allocBuffer() back to the pool. */
+		static void releaseBuffer(const SPtr<GpuParamBlockBuffer>& buffer);
+
+		/**
+		 * Returns a pooled buffer of the specified size usable until the end of the current frame. See
+		 * GpuResourcePool::getParamBlockBuffer().
+		 */
+		static SPtr<GpuParamBlockBuffer> getFrameBuffer(UINT32 size);
 	};
 
 	/**
@@ -130,6 +145,8 @@ namespace bs { namespace ct
 		}																													\
 																															\
 		SPtr<GpuParamBlockBuffer> createBuffer() const { return GpuParamBlockBuffer::create(mBlockSize); }					\
+		SPtr<GpuParamBlockBuffer> allocBuffer() const { return ParamBlock::allocBuffer(mBlockSize); }						\
+		SPtr<GpuParamBlockBuffer> getFrameBuffer() const { return ParamBlock::getFrameBuffer(mBlockSize); }					\
 																															\
 	private:																												\
 		friend class ParamBlockManager;																						\
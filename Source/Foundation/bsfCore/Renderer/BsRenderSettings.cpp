@@ -282,6 +282,7 @@ namespace bs
 		p(enableSkybox);
 		p(cullDistance);
 		p(motionBlur);
+		p(enableOcclusionCulling);
 	}
 
 	template struct TRenderSettings<false>;
@@ -1005,6 +1005,12 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		float cullDistance = FLT_MAX;
 
+		/**
+		 * Enables CPU occlusion culling, which culls objects hidden behind renderables marked as occluders. Has no effect
+		 * if there are no occluders in the scene. See Renderable::setOccluder().
+		 */
+		bool enableOcclusionCulling = true;
+
 	protected:
 		~RenderSettingsBase() = default;
 	};
@@ -3,6 +3,7 @@
 #include "Renderer/BsRenderable.h"
 #include "Private/RTTI/BsRenderableRTTI.h"
 #include "RTTI/BsMathRTTI.h"
+#include "RTTI/BsStdRTTI.h"
 #include "Scene/BsSceneObject.h"
 #include "Mesh/BsMesh.h"
 #include "Material/BsMaterial.h"
@@ -150,6 +151,34 @@ namespace bs
 		_markCoreDirty();
 	}
 
+	template<bool Core>
+	void TRenderable<Core>::setLODMeshes(const Vector<MeshType>& meshes)
+	{
+		mLODMeshes = meshes;
+
+		_markDependenciesDirty();
+		_markResourcesDirty();
+		_markCoreDirty();
+	}
+
+	template<bool Core>
+	void TRenderable<Core>::setLODScreenSizes(const Vector<float>& screenSizes)
+	{
+		mLODScreenSizes = screenSizes;
+
+		_markCoreDirty();
+	}
+
+	template<bool Core>
+	void TRenderable<Core>::setOccluder(bool enable)
+	{
+		if (mIsOccluder == enable)
+			return;
+
+		mIsOccluder = enable;
+		_markCoreDirty();
+	}
+
 	template class TRenderable < false >;
 	template class TRenderable < true >;
 
@@ -314,10 +343,12 @@ namespace bs
 
 		// The most common case if only the transform changed, so we sync only transform related options
 		UINT32 numMaterials = 0;
+		UINT32 numLODs = 0;
 		UINT64 animationId = 0;
 		if(dirtyFlags != (UINT32)ActorDirtyFlag::Transform)
 		{
 			numMaterials = (UINT32)mMaterials.size();
+			numLODs = (UINT32)mLODMeshes.size();
 
 			if (mAnimation != nullptr)
 				animationId = mAnimation->_getId();
@@ -332,8 +363,13 @@ namespace bs
 				rtti_size(animationId) +
 				rtti_size(mAnimType) +
 				rtti_size(mCullDistanceFactor) +
+				rtti_size(mLODScreenSizes) +
+				rtti_size(numLODs) +
+				rtti_size(mIsOccluder) +
 				sizeof(SPtr<ct::Mesh>) +
-				numMaterials * sizeof(SPtr<ct::Material>);
+				numMaterials * sizeof(SPtr<ct::Material>) +
+				numLODs * sizeof(SPtr<ct::Mesh>) +
+				sizeof(SPtr<MeshData>);
 		}
 
 
@@ -352,6 +388,9 @@ namespace bs
 			rtti_write(animationId, stream);
 			rtti_write(mAnimType, stream);
 			rtti_write(mCullDistanceFactor, stream);
+			rtti_write(mLODScreenSizes, stream);
+			rtti_write(numLODs, stream);
+			rtti_write(mIsOccluder, stream);
 
 			SPtr<ct::Mesh>* mesh = new (stream.cursor()) SPtr<ct::Mesh>();
 			if (mMesh.isLoaded())
@@ -367,6 +406,27 @@ namespace bs
 
 				stream.skipBytes(sizeof(SPtr<ct::Material>));
 			}
+
+			for (UINT32 i = 0; i < numLODs; i++)
+			{
+				SPtr<ct::Mesh>* lodMesh = new (stream.cursor()) SPtr<ct::Mesh>();
+				if (mLODMeshes[i].isLoaded())
+					*lodMesh = mLODMeshes[i]->getCore();
+
+				stream.skipBytes(sizeof(SPtr<ct::Mesh>));
+			}
+
+			SPtr<MeshData>* occluderData = new (stream.cursor()) SPtr<MeshData>();
+			if (mIsOccluder && mAnimType == RenderableAnimType::None)
+			{
+				if (!mLODMeshes.empty() && mLODMeshes.back().isLoaded())
+					*occluderData = mLODMeshes.back()->getCachedData();
+
+				if (*occluderData == nullptr && mMesh.isLoaded())
+					*occluderData = mMesh->getCachedData();
+			}
+
+			stream.skipBytes(sizeof(SPtr<MeshData>));
 		}
 
 		return CoreSyncData(data, size);
@@ -382,6 +442,12 @@ namespace bs
 			if (material.isLoaded())
 				dependencies.push_back(material.get());
 		}
+
+		for (auto& lodMesh : mLODMeshes)
+		{
+			if (lodMesh.isLoaded())
+				dependencies.push_back(lodMesh.get());
+		}
 	}
 
 	void Renderable::onDependencyDirty(CoreObject* dependency, UINT32 dirtyFlags)
@@ -392,6 +458,15 @@ namespace bs
 			return;
 		}
 
+		for (auto& lodMesh : mLODMeshes)
+		{
+			if (lodMesh.isLoaded(false) && lodMesh.get() == dependency)
+			{
+				CoreObject::onDependencyDirty(dependency, dirtyFlags);
+				return;
+			}
+		}
+
 		if(((UINT32)MaterialDirtyFlags::Shader & dirtyFlags) != 0)
 			CoreObject::onDependencyDirty(dependency, dirtyFlags);
 	}
@@ -406,6 +481,12 @@ namespace bs
 			if (material != nullptr)
 				resources.push_back(material);
 		}
+
+		for (auto& lodMesh : mLODMeshes)
+		{
+			if (lodMesh != nullptr)
+				resources.push_back(lodMesh);
+		}
 	}
 
 	void Renderable::notifyResourceLoaded(const HResource& resource)
@@ -616,6 +697,30 @@ namespace bs
 		}
 	}
 
+	UINT32 Renderable::selectLOD(float screenSize, const Vector<float>& screenSizes, UINT32 numLODs, UINT32 currentLOD)
+	{
+		// Relative distance past a threshold the screen size needs to move before switching to another level
+		static constexpr float HYSTERESIS = 0.1f;
+
+		// Level i is used once the screen size drops below the threshold at index i - 1
+		numLODs = std::max(1U, std::min(numLODs, (UINT32)screenSizes.size() + 1));
+		currentLOD = std::min(currentLOD, numLODs - 1);
+
+		UINT32 lod = 0;
+		while (lod + 1 < numLODs && screenSize < screenSizes[lod])
+			lod++;
+
+		// Moving to a coarser level, require the size to drop sufficiently below the threshold
+		while (lod > currentLOD && screenSize >= screenSizes[lod - 1] * (1.0f - HYSTERESIS))
+			lod--;
+
+		// Moving to a finer level, require the size to rise sufficiently above the threshold
+		while (lod < currentLOD && screenSize < screenSizes[lod] * (1.0f + HYSTERESIS))
+			lod++;
+
+		return lod;
+	}
+
 	void Renderable::syncToCore(const CoreSyncData& data)
 	{
 		Bitstream stream(data.getBuffer(), data.getBufferSize());
@@ -623,6 +728,7 @@ namespace bs
 		mMaterials.clear();
 
 		UINT32 numMaterials = 0;
+		UINT32 numLODs = 0;
 		UINT32 dirtyFlags = 0;
 		bool oldIsActive = mActive;
 
@@ -641,6 +747,11 @@ namespace bs
 			rtti_read(mAnimationId, stream);
 			rtti_read(mAnimType, stream);
 			rtti_read(mCullDistanceFactor, stream);
+			rtti_read(mLODScreenSizes, stream);
+			rtti_read(numLODs, stream);
+			rtti_read(mIsOccluder, stream);
+
+			mLODMeshes.clear();
 
 			SPtr<Mesh>* mesh = (SPtr<Mesh>*)stream.cursor();
 			mMesh = *mesh;
@@ -654,6 +765,19 @@ namespace bs
 				material->~SPtr<Material>();
 				stream.skipBytes(sizeof(SPtr<Material>));
 			}
+
+			for (UINT32 i = 0; i < numLODs; i++)
+			{
+				SPtr<Mesh>* lodMesh = (SPtr<Mesh>*)stream.cursor();
+				mLODMeshes.push_back(*lodMesh);
+				lodMesh->~SPtr<Mesh>();
+				stream.skipBytes(sizeof(SPtr<Mesh>));
+			}
+
+			SPtr<MeshData>* occluderData = (SPtr<MeshData>*)stream.cursor();
+			mOccluderData = *occluderData;
+			occluderData->~SPtr<MeshData>();
+			stream.skipBytes(sizeof(SPtr<MeshData>));
 		}
 
 		UINT32 updateEverythingFlag = (UINT32)ActorDirtyFlag::Everything
@@ -101,6 +101,39 @@ namespace bs
 		/** @copydoc setCullDistanceFactor() */
 		float getCullDistanceFactor() const { return mCullDistanceFactor; }
 
+		/**
+		 * Determines lower detail versions of the mesh, used when the renderable covers a small portion of the screen.
+		 * Entry at index i is used as LOD level i + 1, while level 0 is always the mesh set through setMesh(). LOD meshes
+		 * are rendered using the same materials as the primary mesh, and should therefore have the same sub-meshes.
+		 */
+		void setLODMeshes(const Vector<MeshType>& meshes);
+
+		/** @copydoc setLODMeshes() */
+		const Vector<MeshType>& getLODMeshes() const { return mLODMeshes; }
+
+		/**
+		 * Determines at which screen size each of the meshes provided to setLODMeshes() starts being used, in the same
+		 * order. Screen size is the diameter of the renderable's bounding sphere when projected onto the screen, relative
+		 * to the screen size, where 1 means the object covers the entire screen. Sizes are expected to decrease with each
+		 * level. Levels without a screen size will never be used.
+		 */
+		void setLODScreenSizes(const Vector<float>& screenSizes);
+
+		/** @copydoc setLODScreenSizes() */
+		const Vector<float>& getLODScreenSizes() const { return mLODScreenSizes; }
+
+		/**
+		 * Determines if the renderable should be used as an occluder during CPU occlusion culling. Occluders get rasterized
+		 * into a low resolution depth buffer, which is then used for culling objects hidden behind them. Meant for a small
+		 * number of large objects, like buildings or terrain. Requires the mesh to be created with the MU_CPUCACHED usage
+		 * flag. If the lowest detail LOD mesh is CPU cached it will be used instead of the primary mesh. Animated
+		 * renderables are never used as occluders.
+		 */
+		void setOccluder(bool enable);
+
+		/** @copydoc setOccluder() */
+		bool isOccluder() const { return mIsOccluder; }
+
 		/** @copydoc setLayer() */
 		UINT64 getLayer() const { return mLayer; }
 
@@ -139,6 +172,9 @@ namespace bs
 		AABox mOverrideBounds;
 		bool mUseOverrideBounds = false;
 		float mCullDistanceFactor = 1.0f;
+		Vector<MeshType> mLODMeshes;
+		Vector<float> mLODScreenSizes;
+		bool mIsOccluder = false;
 		Matrix4 mTfrmMatrix = BsIdentity;
 		Matrix4 mTfrmMatrixNoScale = BsIdentity;
 		RenderableAnimType mAnimType = RenderableAnimType::None;
@@ -273,6 +309,26 @@ namespace bs
 		/** Returns vertex declaration used for rendering meshes containing morph shape information. */
 		const SPtr<VertexDeclaration>& getMorphVertexDeclaration() const { return mMorphVertexDeclaration; }
 
+		/**
+		 * Returns CPU side mesh data used for rasterizing the renderable as an occluder. Only available if the renderable
+		 * is marked as an occluder and has a CPU cached mesh. See bs::Renderable::setOccluder().
+		 */
+		const SPtr<MeshData>& getOccluderData() const { return mOccluderData; }
+
+		/**
+		 * Selects the level of detail to render a renderable with, based on its projected size on the screen. To avoid
+		 * flickering between levels the switch happens only once the screen size moves a certain distance past the
+		 * threshold, relative to the currently used level.
+		 *
+		 * @param[in]	screenSize		Projected diameter of the renderable's bounding sphere, relative to the screen
+		 *								size. See setLODScreenSizes().
+		 * @param[in]	screenSizes		Screen size thresholds for each level beyond the first. See setLODScreenSizes().
+		 * @param[in]	numLODs			Number of available levels of detail.
+		 * @param[in]	currentLOD		Level of detail the renderable was rendered with last time.
+		 * @return						Index of the level of detail to use.
+		 */
+		static UINT32 selectLOD(float screenSize, const Vector<float>& screenSizes, UINT32 numLODs, UINT32 currentLOD);
+
 	protected:
 		friend class bs::Renderable;
 
@@ -294,6 +350,7 @@ namespace bs
 		SPtr<GpuBuffer> mBoneMatrixBuffer;
 		SPtr<VertexBuffer> mMorphShapeBuffer;
 		SPtr<VertexDeclaration> mMorphVertexDeclaration;
+		SPtr<MeshData> mOccluderData;
 	};
 	}
 
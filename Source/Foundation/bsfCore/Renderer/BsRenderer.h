@@ -47,6 +47,19 @@ namespace bs
 		return variation;
 	}
 
+	/** Returns the vertex input shader variation used for rendering multiple non-animated meshes using GPU instancing. */
+	static const ShaderVariation& getInstancedVertexInputVariation()
+	{
+		static ShaderVariation variation = ShaderVariation(
+		{
+			ShaderVariation::Param("SKINNED", false),
+			ShaderVariation::Param("MORPH", false),
+			ShaderVariation::Param("INSTANCED", true),
+		});
+
+		return variation;
+	}
+
 	/** Returns a specific forward rendering shader variation. */
 	template<bool skinned, bool morph, bool clustered>
 	static const ShaderVariation& getForwardRenderingVariation()
@@ -12,6 +12,16 @@ namespace bs
 	 *  @{
 	 */
 
+	/** Estimate of the amount of memory used by a resource. */
+	struct ResourceMemoryUsage
+	{
+		/** Amount of system memory used, in bytes. */
+		UINT64 cpu = 0;
+
+		/** Amount of GPU memory used, in bytes. */
+		UINT64 gpu = 0;
+	};
+
 	/**	Base class for all resources. */
 	class BS_CORE_EXPORT Resource : public IReflectable, public CoreObject
 	{
@@ -31,6 +41,12 @@ namespace bs
 		/**	Returns whether or not this resource is allowed to be asynchronously loaded. */
 		virtual bool allowAsyncLoading() const { return true; }
 
+		/**
+		 * Returns an estimate of the system and GPU memory used by the resource. Resources that don't provide an estimate
+		 * report zero usage.
+		 */
+		virtual ResourceMemoryUsage getMemoryUsage() const { return ResourceMemoryUsage(); }
+
 	protected:
 		friend class Resources;
 		friend class ResourceHandleBase;
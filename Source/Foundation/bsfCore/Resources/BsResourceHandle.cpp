@@ -12,6 +12,7 @@ namespace bs
 {
 	Signal ResourceHandleBase::mResourceCreatedCondition;
 	Mutex ResourceHandleBase::mResourceCreatedMutex;
+	std::atomic<std::uint64_t> ResourceHandleBase::sUsageFrame{0};
 
 	bool ResourceHandleBase::isLoaded(bool checkDependencies) const
 	{
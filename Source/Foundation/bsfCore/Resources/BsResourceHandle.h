@@ -18,6 +18,7 @@ namespace bs
 		UUID mUUID;
 		bool mIsCreated = false;
 		std::atomic<std::uint32_t> mRefCount{0};
+		std::atomic<std::uint64_t> mLastUsedFrame{0};
 	};
 
 	/**
@@ -63,6 +64,20 @@ namespace bs
 		/**	Gets the handle data. For internal use only. */
 		const SPtr<ResourceHandleData>& getHandleData() const { return mData; }
 
+		/**
+		 * Records that the resource was accessed during the current frame. Used by the resources system to find the least
+		 * recently used resources when enforcing its memory budget.
+		 */
+		void _markUsed() const
+		{
+			if(mData == nullptr)
+				return;
+
+			const std::uint64_t frame = sUsageFrame.load(std::memory_order_relaxed);
+			if(mData->mLastUsedFrame.load(std::memory_order_relaxed) != frame)
+				mData->mLastUsedFrame.store(frame, std::memory_order_relaxed);
+		}
+
 		/** @} */
 	protected:
 		/**	Destroys the resource the handle is pointing to. */
@@ -110,6 +125,9 @@ namespace bs
 		static Signal mResourceCreatedCondition;
 		static Mutex mResourceCreatedMutex;
 
+		/** Current frame as seen by _markUsed(). Advanced by Resources once per frame. */
+		static std::atomic<std::uint64_t> sUsageFrame;
+
 	protected:
 		void throwIfNotLoaded() const;
 	};
@@ -275,6 +293,7 @@ namespace bs
 		T* get() const
 		{
 			this->throwIfNotLoaded();
+			this->_markUsed();
 
 			return reinterpret_cast<T*>(this->mData->mPtr.get());
 		}
@@ -287,6 +306,7 @@ namespace bs
 		SPtr<T> getInternalPtr() const
 		{
 			this->throwIfNotLoaded();
+			this->_markUsed();
 
 			return std::static_pointer_cast<T>(this->mData->mPtr);
 		}
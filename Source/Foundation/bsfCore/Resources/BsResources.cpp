@@ -17,6 +17,7 @@
 #include "Serialization/BsBinarySerializer.h"
 #include "Reflection/BsRTTIType.h"
 #include "BsCoreApplication.h"
+#include "Allocators/BsMemoryTracker.h"
 
 namespace bs
 {
@@ -129,6 +130,8 @@ namespace bs
 				output.resource = resData.resource.lock();
 				output.state = LoadInfo::AlreadyLoaded;
 				output.size = resData.size;
+				resData.lastUsed = ++mUsageCounter;
+				resData.resource._markUsed();
 
 				// Increase ref. count
 				if (loadFlags.isSet(ResourceLoadFlag::KeepInternalRef))
@@ -387,16 +390,15 @@ namespace bs
 			// Synchronous or the resource doesn't support async, read the file immediately
 			if (synchronous)
 			{
-				loadCallback(filePath, output.resource, loadFlags.isSet(ResourceLoadFlag::KeepSourceData));
+				loadCallback(filePath, output.resource, loadFlags);
 			}
 			else // Asynchronous, read the file on a worker thread
 			{
 				String fileName = filePath.getFilename();
 				String taskName = "Resource load: " + fileName;
 
-				bool keepSourceData = loadFlags.isSet(ResourceLoadFlag::KeepSourceData);
 				SPtr<Task> task = Task::create(taskName,
-					std::bind(&Resources::loadCallback, this, filePath, output.resource, keepSourceData));
+					std::bind(&Resources::loadCallback, this, filePath, output.resource, loadFlags));
 
 				// Register the task
 				{
@@ -423,9 +425,12 @@ namespace bs
 		return output;
 	}
 
-	SPtr<Resource> Resources::loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData,
+	SPtr<Resource> Resources::loadFromDiskAndDeserialize(const Path& filePath, ResourceLoadFlags loadFlags,
 		std::atomic<float>& progress)
 	{
+		// Note: Objects decoded by parallel decode workers are not tagged, as the tag is assigned per thread
+		MemoryTagScope memoryTag(MemoryTag::Resources);
+
 		Lock fileLock = FileScheduler::getLock(filePath);
 
 		SPtr<DataStream> stream = FileSystem::openFile(filePath, true);
@@ -439,7 +444,7 @@ namespace bs
 		}
 
 		CoreSerializationContext serzContext;
-		serzContext.flags = loadWithSaveData ? SF_KeepResourceSourceData : 0;
+		serzContext.flags = loadFlags.isSet(ResourceLoadFlag::KeepSourceData) ? SF_KeepResourceSourceData : 0;
 
 		// Read meta-data
 		SPtr<SavedResourceData> metaData;
@@ -457,6 +462,16 @@ namespace bs
 		// Read resource data
 		SPtr<IReflectable> loadedData;
 		{
+			auto decode = [parallel = loadFlags.isSet(ResourceLoadFlag::ParallelDecode), &serzContext](
+				const SPtr<DataStream>& stream, UINT32 size, std::function<void(float)> reportProgress)
+			{
+				BinarySerializer bs;
+				if(parallel)
+					return bs.decodeParallel(stream, size, &serzContext, std::move(reportProgress));
+
+				return bs.decode(stream, size, &serzContext, std::move(reportProgress));
+			};
+
 			if(metaData && !stream->eof())
 			{
 				UINT32 objectSize = 0;
@@ -469,16 +484,14 @@ namespace bs
 						progress.exchange(val * 0.9f, std::memory_order_relaxed);
 					});
 
-					BinarySerializer bs;
-					loadedData = bs.decode(stream, objectSize, &serzContext, [&progress](float val)
+					loadedData = decode(stream, objectSize, [&progress](float val)
 					{
 						progress.exchange(0.9f + val * 0.1f, std::memory_order_relaxed);
 					});
 				}
 				else
 				{
-					BinarySerializer bs;
-					loadedData = bs.decode(stream, objectSize, &serzContext, [&progress](float val)
+					loadedData = decode(stream, objectSize, [&progress](float val)
 					{
 						progress.exchange(val, std::memory_order_relaxed);
 					});
@@ -582,6 +595,132 @@ namespace bs
 			destroy(loadedResourcePair.second.resource);
 	}
 
+	ResourceMemoryUsage Resources::getMemoryUsage()
+	{
+		ResourceMemoryUsage output;
+
+		Lock lock(mLoadedResourceMutex);
+		for (auto& entry : mLoadedResources)
+		{
+			const SPtr<Resource>& resource = entry.second.resource.mData->mPtr;
+			if (resource == nullptr)
+				continue;
+
+			const ResourceMemoryUsage usage = resource->getMemoryUsage();
+			output.cpu += usage.cpu;
+			output.gpu += usage.gpu;
+		}
+
+		return output;
+	}
+
+	Vector<ResourceResidency> Resources::getResidency()
+	{
+		UnorderedMap<UINT32, ResourceResidency> residencyPerType;
+
+		{
+			Lock lock(mLoadedResourceMutex);
+			for (auto& entry : mLoadedResources)
+			{
+				const SPtr<Resource>& resource = entry.second.resource.mData->mPtr;
+				if (resource == nullptr)
+					continue;
+
+				RTTITypeBase* rtti = resource->getRTTI();
+
+				ResourceResidency& residency = residencyPerType[rtti->getRTTIId()];
+				residency.typeId = rtti->getRTTIId();
+				residency.typeName = rtti->getRTTIName();
+				residency.numResources++;
+
+				const ResourceMemoryUsage usage = resource->getMemoryUsage();
+				residency.memory.cpu += usage.cpu;
+				residency.memory.gpu += usage.gpu;
+			}
+		}
+
+		Vector<ResourceResidency> output;
+		output.reserve(residencyPerType.size());
+
+		for (auto& entry : residencyPerType)
+			output.push_back(entry.second);
+
+		return output;
+	}
+
+	void Resources::_update()
+	{
+		// Resources accessed through their handles from now on are considered used during the next frame
+		ResourceHandleBase::sUsageFrame.fetch_add(1, std::memory_order_relaxed);
+
+		if (mMemoryBudget > 0)
+			enforceMemoryBudget();
+	}
+
+	void Resources::enforceMemoryBudget()
+	{
+		struct EvictionCandidate
+		{
+			HResource resource;
+			UINT32 numInternalRefs;
+			UINT64 lastUsedFrame;
+			UINT64 lastUsed;
+			UINT64 size;
+		};
+
+		Vector<EvictionCandidate> candidates;
+		UINT64 totalUsage = 0;
+
+		{
+			Lock lock(mLoadedResourceMutex);
+			for (auto& entry : mLoadedResources)
+			{
+				const LoadedResourceData& resData = entry.second;
+
+				const SPtr<Resource>& resource = resData.resource.mData->mPtr;
+				if (resource == nullptr)
+					continue;
+
+				const ResourceMemoryUsage usage = resource->getMemoryUsage();
+				const UINT64 size = usage.cpu + usage.gpu;
+				totalUsage += size;
+
+				// Only evict resources that are kept alive solely by the internal references
+				std::uint32_t refCount = resData.resource.mData->mRefCount.load(std::memory_order_relaxed);
+				if (size > 0 && resData.numInternalRefs > 0 && refCount == resData.numInternalRefs)
+				{
+					const UINT64 lastUsedFrame = resData.resource.mData->mLastUsedFrame.load(std::memory_order_relaxed);
+					candidates.push_back({ resData.resource.lock(), resData.numInternalRefs, lastUsedFrame,
+						resData.lastUsed, size });
+				}
+			}
+		}
+
+		if (totalUsage <= mMemoryBudget)
+			return;
+
+		std::sort(candidates.begin(), candidates.end(),
+			[](const EvictionCandidate& a, const EvictionCandidate& b)
+		{
+			if (a.lastUsedFrame != b.lastUsedFrame)
+				return a.lastUsedFrame < b.lastUsedFrame;
+
+			return a.lastUsed < b.lastUsed;
+		});
+
+		// Note: Resource will be destroyed once the last handle in the candidate list goes out of scope
+		for (auto& candidate : candidates)
+		{
+			if (totalUsage <= mMemoryBudget)
+				break;
+
+			for (UINT32 i = 0; i < candidate.numInternalRefs; i++)
+				release(candidate.resource);
+
+			totalUsage -= candidate.size;
+		}
+	}
+
 	void Resources::destroy(ResourceHandleBase& resource)
 	{
 		if (resource.mData == nullptr)
@@ -949,6 +1088,8 @@ namespace bs
 			{
 				LoadedResourceData& resData = mLoadedResources[UUID];
 				resData.resource = newHandle.getWeak();
+				resData.lastUsed = ++mUsageCounter;
+				newHandle._markUsed();
 			}
 
 			mHandles[UUID] = newHandle.getWeak();
@@ -1036,7 +1177,11 @@ namespace bs
 				{
 					Lock loadedLock(mLoadedResourceMutex);
 
-					mLoadedResources[uuid] = myLoadData->resData;
+					LoadedResourceData& resData = mLoadedResources[uuid];
+					resData = myLoadData->resData;
+					resData.lastUsed = ++mUsageCounter;
+					resource._markUsed();
+
 					resource.setHandleData(myLoadData->loadedData, uuid);
 				}
 
@@ -1068,7 +1213,7 @@ namespace bs
 		}
 	}
 
-	void Resources::loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData)
+	void Resources::loadCallback(const Path& filePath, HResource& resource, ResourceLoadFlags loadFlags)
 	{
 		ResourceLoadData* myLoadData;
 		{
@@ -1076,7 +1221,7 @@ namespace bs
 			myLoadData = mInProgressResources[resource.getUUID()];
 		}
 
-		SPtr<Resource> rawResource = loadFromDiskAndDeserialize(filePath, loadWithSaveData, myLoadData->progress);
+		SPtr<Resource> rawResource = loadFromDiskAndDeserialize(filePath, loadFlags, myLoadData->progress);
 
 		{
 			Lock lock(mInProgressResourcesMutex);
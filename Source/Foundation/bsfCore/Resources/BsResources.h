@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "Utility/BsModule.h"
+#include "Resources/BsResource.h"
 
 namespace bs
 {
@@ -32,6 +33,12 @@ namespace bs
 		 * use up extra memory. Normally you want to keep this enabled if you plan on saving the resource to disk.
 		 */
 		KeepSourceData = 1 << 2,
+		/**
+		 * If enabled, independent objects within the resource file are decoded in parallel on the task scheduler worker
+		 * threads. Only use this for resource types whose deserialization callbacks are safe to run concurrently. See
+		 * BinarySerializer::decodeParallel.
+		 */
+		ParallelDecode = 1 << 3,
 		/** Default set of flags used for resource loading. */
 		Default = LoadDependencies | KeepInternalRef
 	};
@@ -39,6 +46,22 @@ namespace bs
 	typedef Flags<ResourceLoadFlag> ResourceLoadFlags;
 	BS_FLAGS_OPERATORS(ResourceLoadFlag);
 
+	/** Information about memory used by all loaded resources of a specific type. */
+	struct ResourceResidency
+	{
+		/** RTTI type ID of the resources. */
+		UINT32 typeId = 0;
+
+		/** Name of the resource type. */
+		String typeName;
+
+		/** Number of loaded resources of this type. */
+		UINT32 numResources = 0;
+
+		/** Total estimated memory used by the resources of this type. */
+		ResourceMemoryUsage memory;
+	};
+
 	/**
 	 * Manager for dealing with all engine resources. It allows you to save new resources and load existing ones.
 	 *
@@ -57,6 +80,7 @@ namespace bs
 			WeakResourceHandle<Resource> resource;
 			UINT32 numInternalRefs = 0;
 			UINT32 size = 0;
+			UINT64 lastUsed = 0;
 		};
 
 		/** Information about a resource that's currently being loaded. */
@@ -189,6 +213,27 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		void unloadAll();
 
+		/**
+		 * Sets the maximum amount of memory (system and GPU combined) loaded resources should use, in bytes. When over
+		 * budget, resources that are kept loaded only through internal references (see ResourceLoadFlag::KeepInternalRef)
+		 * are unloaded, starting with the least recently used ones, until the usage is within the budget. A resource is
+		 * considered used on the frame it was loaded, or on the frame it was last accessed through one of its handles.
+		 * Resources referenced from outside of the resource system are never unloaded. Budget is enforced once per frame.
+		 * Set to zero to disable the budget (default).
+		 *
+		 * @see		Resource::getMemoryUsage()
+		 */
+		void setMemoryBudget(UINT64 budget) { mMemoryBudget = budget; }
+
+		/** @copydoc setMemoryBudget */
+		UINT64 getMemoryBudget() const { return mMemoryBudget; }
+
+		/** Returns an estimate of the memory used by all currently loaded resources. */
+		ResourceMemoryUsage getMemoryUsage();
+
+		/** Returns an estimate of the memory used by currently loaded resources, grouped by resource type. */
+		Vector<ResourceResidency> getResidency();
+
 		/**
 		 * Saves the resource at the specified location.
 		 *
@@ -354,6 +399,9 @@ namespace bs
 		/** Returns an existing handle for the specified UUID if one exists, or creates a new one. */
 		HResource _getResourceHandle(const UUID& uuid);
 
+		/** Called once per frame. Unloads unused resources if over the memory budget. */
+		void _update();
+
 		/**
 		 * Same as save() except it saves the resource without registering it in the default manifest, requiring a handle,
 		 * or checking for overwrite.
@@ -372,17 +420,24 @@ namespace bs
 		LoadInfo loadInternal(const UUID& UUID, const Path& filePath, bool synchronous, ResourceLoadFlags loadFlags);
 
 		/** Performs actually reading and deserializing of the resource file. Called from various worker threads. */
-		SPtr<Resource> loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData, std::atomic<float>& progress);
+		SPtr<Resource> loadFromDiskAndDeserialize(const Path& filePath, ResourceLoadFlags loadFlags,
+			std::atomic<float>& progress);
 
 		/**	Triggered when individual resource has finished loading. */
 		void loadComplete(HResource& resource, bool notifyProgress);
 
 		/**	Callback triggered when the task manager is ready to process the loading task. */
-		void loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData);
+		void loadCallback(const Path& filePath, HResource& resource, ResourceLoadFlags loadFlags);
 
 		/**	Destroys a resource, freeing its memory. */
 		void destroy(ResourceHandleBase& resource);
 
+		/**
+		 * Unloads resources only referenced by the resource system, least recently used ones first, until the memory
+		 * usage is within the memory budget.
+		 */
+		void enforceMemoryBudget();
+
 	private:
 		Vector<SPtr<ResourceManifest>> mResourceManifests;
 		SPtr<ResourceManifest> mDefaultResourceManifest;
@@ -396,6 +451,9 @@ namespace bs
 		UnorderedMap<UUID, LoadedResourceData> mLoadedResources;
 		UnorderedMap<UUID, ResourceLoadData*> mInProgressResources; // Resources that are being asynchronously loaded
 		UnorderedMap<UUID, Vector<ResourceLoadData*>> mDependantLoads; // Allows dependency to be notified when a dependant is loaded
+
+		UINT64 mMemoryBudget = 0;
+		UINT64 mUsageCounter = 0; // Incremented whenever a resource is loaded, orders resources last used on the same frame
 	};
 
 	/** Provides easier access to Resources manager. */
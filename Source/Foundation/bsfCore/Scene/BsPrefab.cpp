@@ -5,6 +5,10 @@
 #include "Resources/BsResources.h"
 #include "Scene/BsSceneObject.h"
 #include "Scene/BsPrefabUtility.h"
+#include "Scene/BsGameObjectManager.h"
+#include "Serialization/BsBinarySerializer.h"
+#include "FileSystem/BsDataStream.h"
+#include "Utility/BsUtility.h"
 #include "BsCoreApplication.h"
 
 namespace bs
@@ -75,6 +79,8 @@ namespace bs
 		if (mRoot != nullptr)
 			mRoot->destroy(true);
 
+		mInstanceTemplate = nullptr;
+
 		mRoot = sceneObject->clone(false, true);
 		mRoot->mParent = nullptr;
 		mRoot->mLinkId = -1;
@@ -140,6 +146,7 @@ namespace bs
 		{
 			// Update any child prefab instances in case their prefabs changed
 			_updateChildInstances();
+			mInstanceTemplate = nullptr;
 		}
 #endif
 
@@ -154,10 +161,46 @@ namespace bs
 		if (mRoot == nullptr)
 			return HSceneObject();
 
+		// Decode directly from the cached template, skipping the serialization of the source hierarchy that
+		// SceneObject::clone() would otherwise perform for every instance
+		const SPtr<MemoryDataStream>& instanceTemplate = getInstanceTemplate();
+		SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>(instanceTemplate->data(),
+			instanceTemplate->size());
+
+		int flags = GODM_RestoreExternal | GODM_UseNewIds;
+		if(!preserveUUIDs)
+			flags |= GODM_UseNewUUID;
+
+		CoreSerializationContext serzContext;
+		serzContext.goState = bs_shared_ptr_new<GameObjectDeserializationState>(flags);
+
+		BinarySerializer serializer;
+		SPtr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(
+			serializer.decode(stream, (UINT32)stream->size(), &serzContext));
+
+		return cloneObj->mThisHandle;
+	}
+
+	const SPtr<MemoryDataStream>& Prefab::getInstanceTemplate() const
+	{
+		if (mInstanceTemplate != nullptr)
+			return mInstanceTemplate;
+
 		mRoot->mPrefabHash = mHash;
 		mRoot->mLinkId = -1;
 
-		return mRoot->clone(false, preserveUUIDs);
+		const bool isInstantiated = !mRoot->hasFlag(SOF_DontInstantiate);
+		mRoot->_setFlags(SOF_DontInstantiate);
+
+		mInstanceTemplate = bs_shared_ptr_new<MemoryDataStream>();
+
+		BinarySerializer serializer;
+		serializer.encode(mRoot.get(), mInstanceTemplate);
+
+		if (isInstantiated)
+			mRoot->_unsetFlags(SOF_DontInstantiate);
+
+		return mInstanceTemplate;
 	}
 
 	RTTITypeBase* Prefab::getRTTIStatic()
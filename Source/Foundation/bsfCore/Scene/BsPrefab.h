@@ -108,11 +108,19 @@ namespace bs
 		/**	Creates an empty and uninitialized prefab. */
 		static SPtr<Prefab> createEmpty();
 
+		/**
+		 * Returns the serialized form of the internal prefab hierarchy, used as a template when cloning. The template is
+		 * built on first use and reused by all clones until the hierarchy changes.
+		 */
+		const SPtr<MemoryDataStream>& getInstanceTemplate() const;
+
 		HSceneObject mRoot;
 		UINT32 mHash = 0;
 		UUID mUUID;
 		bool mIsScene = true;
 
+		mutable SPtr<MemoryDataStream> mInstanceTemplate;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
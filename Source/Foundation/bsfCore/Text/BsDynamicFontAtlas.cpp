@@ -0,0 +1,437 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Text/BsDynamicFontAtlas.h"
+#include "Text/BsFont.h"
+#include "Text/BsFontManager.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelData.h"
+#include "Image/BsPixelUtil.h"
+#include "Managers/BsTextureManager.h"
+
+namespace bs
+{
+	/** Empty space left to the right and below each character, so characters don't bleed into each other when filtered. */
+	static constexpr UINT32 GLYPH_PADDING = 1;
+
+	DynamicFontAtlas::DynamicFontAtlas(const SPtr<GlyphRasterizer>& rasterizer, const DYNAMIC_FONT_DESC& desc)
+		:mRasterizer(rasterizer), mDesc(desc)
+	{
+		mDesc.pageSize = std::max(mDesc.pageSize, 64U);
+		mDesc.maxPages = std::max(mDesc.maxPages, 1U);
+
+		if(FontManager::isStarted())
+		{
+			FontManager::instance()._registerAtlas(this);
+			mFrameIdx = FontManager::instance()._getFrameIdx();
+		}
+	}
+
+	DynamicFontAtlas::~DynamicFontAtlas()
+	{
+		if(FontManager::isStarted())
+			FontManager::instance()._unregisterAtlas(this);
+
+		Lock lock(mMutex);
+
+		// Any bitmaps still referenced elsewhere keep the characters they have so far, but can no longer add new ones
+		for(auto& bitmap : mBitmaps)
+			bitmap->mLookup.atlas = nullptr;
+	}
+
+	SPtr<FontBitmap> DynamicFontAtlas::createBitmap(UINT32 size)
+	{
+		FontSizeMetrics metrics;
+		if(!mRasterizer->getSizeMetrics(size, metrics))
+			return nullptr;
+
+		Lock lock(mMutex);
+
+		if(mPages.empty())
+			addPage();
+
+		SPtr<FontBitmap> bitmap = bs_shared_ptr_new<FontBitmap>();
+		bitmap->size = size;
+		bitmap->baselineOffset = metrics.baselineOffset;
+		bitmap->lineHeight = metrics.lineHeight;
+		bitmap->spaceWidth = metrics.spaceWidth;
+		bitmap->missingGlyph = CharDesc();
+		bitmap->texturePages = mTextures;
+
+		RasterizedGlyph missingGlyph;
+		if(mRasterizer->rasterizeMissingGlyph(size, missingGlyph))
+		{
+			bitmap->missingGlyph = missingGlyph.desc;
+			insertMissingGlyph(missingGlyph, bitmap->missingGlyph);
+		}
+
+		bitmap->mLookup.atlas = this;
+		bitmap->_buildLookup();
+
+		mBitmaps.push_back(bitmap.get());
+		return bitmap;
+	}
+
+	const CharDesc& DynamicFontAtlas::getChar(const FontBitmap& bitmap, UINT32 charId)
+	{
+		Lock lock(mMutex);
+
+		const CharDesc* desc = bitmap.findCharDesc(charId);
+		if(desc == nullptr)
+			return bitmap.missingGlyph;
+
+		markUsed(*desc);
+		return *desc;
+	}
+
+	const CharDesc& DynamicFontAtlas::getOrAddChar(FontBitmap& bitmap, UINT32 charId)
+	{
+		Lock lock(mMutex);
+
+		const CharDesc* desc = bitmap.findCharDesc(charId);
+		if(desc == nullptr)
+			return addChar(bitmap, charId);
+
+		markUsed(*desc);
+		return *desc;
+	}
+
+	const CharDesc& DynamicFontAtlas::addChar(FontBitmap& bitmap, UINT32 charId)
+	{
+		// Characters that can't be added are mapped to the missing glyph, so they aren't attempted again every time they
+		// are looked up. If the atlas was full, the mapping is removed once space is made at the end of the frame.
+		markUsed(bitmap.missingGlyph);
+
+		RasterizedGlyph glyph;
+		if(!mRasterizer->rasterize(charId, bitmap.size, glyph))
+		{
+			bitmap.mLookup.add(charId, &bitmap.missingGlyph);
+			return bitmap.missingGlyph;
+		}
+
+		CharDesc desc = glyph.desc;
+		if(!insert(glyph, desc))
+		{
+			bitmap.mLookup.add(charId, &bitmap.missingGlyph);
+			return bitmap.missingGlyph;
+		}
+
+		CharDesc& output = bitmap.characters[charId];
+		output = desc;
+
+		bitmap.mLookup.add(charId, &output);
+		return output;
+	}
+
+	INT32 DynamicFontAtlas::getKerning(const FontBitmap& bitmap, const CharDesc& left, const CharDesc& right)
+	{
+		const UINT64 key = ((UINT64)left.charId << 32) | right.charId;
+
+		Lock lock(mMutex);
+
+		UnorderedMap<UINT64, INT32>& kerning = mKerning[bitmap.size];
+		auto iterFind = kerning.find(key);
+		if(iterFind != kerning.end())
+			return iterFind->second;
+
+		const INT32 amount = mRasterizer->getKerning(left.charId, right.charId, bitmap.size);
+		kerning[key] = amount;
+
+		return amount;
+	}
+
+	void DynamicFontAtlas::pinPage(UINT32 page)
+	{
+		Lock lock(mMutex);
+
+		if(page < (UINT32)mPages.size())
+			mPages[page].numPins++;
+	}
+
+	void DynamicFontAtlas::unpinPage(UINT32 page)
+	{
+		Lock lock(mMutex);
+
+		if(page < (UINT32)mPages.size() && mPages[page].numPins > 0)
+			mPages[page].numPins--;
+	}
+
+	bool DynamicFontAtlas::insert(const RasterizedGlyph& glyph, CharDesc& output)
+	{
+		output.page = 0;
+		output.uvX = 0.0f;
+		output.uvY = 0.0f;
+		output.uvWidth = 0.0f;
+		output.uvHeight = 0.0f;
+
+		const UINT32 width = glyph.desc.width;
+		const UINT32 height = glyph.desc.height;
+
+		// Whitespace and similar characters don't need any space in the atlas
+		if(width == 0 || height == 0)
+			return true;
+
+		const UINT32 paddedWidth = width + GLYPH_PADDING;
+		const UINT32 paddedHeight = height + GLYPH_PADDING;
+
+		if(paddedWidth > mDesc.pageSize || paddedHeight > mDesc.pageSize)
+		{
+			BS_LOG(Warning, Resources, "Character {0} doesn't fit in a dynamic font atlas page of size {1}.",
+				glyph.desc.charId, mDesc.pageSize);
+			return false;
+		}
+
+		if(glyph.pixels.size() < width * height)
+			return false;
+
+		UINT32 pageIdx = 0;
+		UINT32 x = 0;
+		UINT32 y = 0;
+
+		bool found = false;
+		for(; pageIdx < (UINT32)mPages.size(); pageIdx++)
+		{
+			if(allocate(mPages[pageIdx], paddedWidth, paddedHeight, x, y))
+			{
+				found = true;
+				break;
+			}
+		}
+
+		if(!found)
+		{
+			// Pages are only cleared at the end of the frame, as characters on them could still be referenced by text
+			// built during this frame
+			if((UINT32)mPages.size() >= mDesc.maxPages)
+			{
+				mIsFull = true;
+				return false;
+			}
+
+			addPage();
+
+			pageIdx = (UINT32)mPages.size() - 1;
+			if(!allocate(mPages[pageIdx], paddedWidth, paddedHeight, x, y))
+				return false;
+		}
+
+		Page& page = mPages[pageIdx];
+		for(UINT32 row = 0; row < height; row++)
+			memcpy(&page.pixels[(y + row) * mDesc.pageSize + x], &glyph.pixels[row * width], width);
+
+		page.lastUsedFrame = mFrameIdx;
+		page.isDirty = true;
+
+		const float invPageSize = 1.0f / mDesc.pageSize;
+
+		output.page = pageIdx;
+		output.uvX = x * invPageSize;
+		output.uvY = y * invPageSize;
+		output.uvWidth = width * invPageSize;
+		output.uvHeight = height * invPageSize;
+
+		return true;
+	}
+
+	void DynamicFontAtlas::insertMissingGlyph(const RasterizedGlyph& glyph, CharDesc& output)
+	{
+		// If there's no space the glyph is left invisible, but still advances the pen
+		if(!insert(glyph, output))
+		{
+			output.width = 0;
+			output.height = 0;
+		}
+	}
+
+	bool DynamicFontAtlas::allocate(Page& page, UINT32 width, UINT32 height, UINT32& x, UINT32& y)
+	{
+		// Prefer the shortest shelf the character fits in, as long as not too much of the shelf height is wasted
+		Shelf* bestShelf = nullptr;
+		for(auto& shelf : page.shelves)
+		{
+			if(shelf.height < height || shelf.height > height + height / 4 + 2)
+				continue;
+
+			if(shelf.nextX + width > mDesc.pageSize)
+				continue;
+
+			if(bestShelf == nullptr || shelf.height < bestShelf->height)
+				bestShelf = &shelf;
+		}
+
+		if(bestShelf == nullptr && page.nextShelfY + height <= mDesc.pageSize)
+		{
+			page.shelves.push_back({ page.nextShelfY, height, 0 });
+			page.nextShelfY += height;
+
+			bestShelf = &page.shelves.back();
+		}
+
+		// Out of vertical space, settle for any shelf the character fits in
+		if(bestShelf == nullptr)
+		{
+			for(auto& shelf : page.shelves)
+			{
+				if(shelf.height < height || shelf.nextX + width > mDesc.pageSize)
+					continue;
+
+				if(bestShelf == nullptr || shelf.height < bestShelf->height)
+					bestShelf = &shelf;
+			}
+		}
+
+		if(bestShelf == nullptr)
+			return false;
+
+		x = bestShelf->nextX;
+		y = bestShelf->y;
+		bestShelf->nextX += width;
+
+		return true;
+	}
+
+	void DynamicFontAtlas::addPage()
+	{
+		const UINT32 pageIdx = (UINT32)mPages.size();
+
+		mPages.push_back(Page());
+		Page& page = mPages.back();
+		page.pixels.resize(mDesc.pageSize * mDesc.pageSize, 0);
+		page.lastUsedFrame = mFrameIdx;
+		page.isDirty = true;
+
+		TEXTURE_DESC texDesc;
+		texDesc.width = mDesc.pageSize;
+		texDesc.height = mDesc.pageSize;
+		texDesc.format = PF_RG8;
+
+		// Pages are still packed without a render backend (e.g. when only laying out text), they just can't be drawn
+		HTexture texture;
+		if(TextureManager::isStarted())
+		{
+			texture = Texture::create(texDesc);
+			texture->setName(u8"DynamicFontPage" + toString(pageIdx));
+		}
+
+		mTextures.push_back(texture);
+		for(auto& bitmap : mBitmaps)
+			bitmap->texturePages.push_back(texture);
+	}
+
+	void DynamicFontAtlas::clearPage(UINT32 pageIdx)
+	{
+		Page& page = mPages[pageIdx];
+		page.shelves.clear();
+		page.nextShelfY = 0;
+		page.isDirty = true;
+		memset(page.pixels.data(), 0, page.pixels.size());
+
+		for(auto& bitmap : mBitmaps)
+		{
+			for(auto iter = bitmap->characters.begin(); iter != bitmap->characters.end();)
+			{
+				if(iter->second.page == pageIdx)
+					iter = bitmap->characters.erase(iter);
+				else
+					++iter;
+			}
+
+			// Missing glyph must always be available, so add it right back
+			if(bitmap->missingGlyph.page == pageIdx)
+			{
+				RasterizedGlyph missingGlyph;
+				if(mRasterizer->rasterizeMissingGlyph(bitmap->size, missingGlyph))
+					insertMissingGlyph(missingGlyph, bitmap->missingGlyph);
+			}
+		}
+	}
+
+	void DynamicFontAtlas::upload(UINT32 pageIdx)
+	{
+		Page& page = mPages[pageIdx];
+		page.isDirty = false;
+
+		const HTexture& texture = mTextures[pageIdx];
+		if(!texture.isLoaded(false))
+			return;
+
+		// Matches the format of pre-rendered font pages, coverage in both channels
+		SPtr<PixelData> pixelData = bs_shared_ptr_new<PixelData>(mDesc.pageSize, mDesc.pageSize, 1, PF_RG8);
+		pixelData->allocateInternalBuffer();
+
+		UINT8* dst = pixelData->getData();
+		for(auto& value : page.pixels)
+		{
+			dst[0] = value;
+			dst[1] = value;
+			dst += 2;
+		}
+
+		// It's possible the formats no longer match
+		if(texture->getProperties().getFormat() != pixelData->getFormat())
+		{
+			SPtr<PixelData> temp = texture->getProperties().allocBuffer(0, 0);
+			PixelUtil::bulkPixelConversion(*pixelData, *temp);
+
+			texture->writeData(temp, 0, 0, true);
+		}
+		else
+			texture->writeData(pixelData, 0, 0, true);
+	}
+
+	bool DynamicFontAtlas::_update(UINT64 frameIdx)
+	{
+		Lock lock(mMutex);
+
+		bool modified = false;
+		if(mIsFull)
+		{
+			mIsFull = false;
+
+			// Evict the least recently used page, unless all pages were used this frame or are referenced by geometry
+			// that is still in use
+			UINT32 evictIdx = (UINT32)-1;
+			UINT64 evictFrame = frameIdx;
+			for(UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+			{
+				if(mPages[i].numPins > 0)
+					continue;
+
+				if(mPages[i].lastUsedFrame < evictFrame)
+				{
+					evictIdx = i;
+					evictFrame = mPages[i].lastUsedFrame;
+				}
+			}
+
+			if(evictIdx != (UINT32)-1)
+				clearPage(evictIdx);
+			else
+			{
+				if(!mExceededMaxPages)
+				{
+					BS_LOG(Warning, Resources, "Text in use doesn't fit into {0} dynamic font atlas pages. Consider "
+						"increasing the maximum number of pages or the page size.", mDesc.maxPages);
+					mExceededMaxPages = true;
+				}
+
+				addPage();
+			}
+
+			// Removes evicted characters from the lookup tables, as well as characters that were mapped to the missing
+			// glyph because they didn't fit
+			for(auto& bitmap : mBitmaps)
+				bitmap->_buildLookup();
+
+			modified = true;
+		}
+
+		for(UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+		{
+			if(mPages[i].isDirty)
+				upload(i);
+		}
+
+		mFrameIdx = frameIdx + 1;
+		return modified;
+	}
+}
@@ -0,0 +1,150 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Text/BsGlyphRasterizer.h"
+
+namespace bs
+{
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Texture atlas that characters of a dynamic font are rasterized into when they are first used. The atlas is shared
+	 * between all sizes of the font. Characters are packed into horizontal shelves within a set of texture pages, and once
+	 * all pages are full the least recently used page is cleared to make room for new characters.
+	 *
+	 * Characters are rasterized into a CPU copy of the page, and all pages modified during a frame are uploaded to the GPU
+	 * once at the end of the frame, when FontManager calls _update(). Pages are only ever cleared during that call, so
+	 * character descriptors returned by the atlas remain valid at least until the end of the frame they were used in.
+	 * Pages that are pinned, because geometry built from their characters is still in use, are never cleared.
+	 *
+	 * Character lookups, pinning and the end of frame update are synchronized, as bitmaps can be accessed from any thread
+	 * that lays out text.
+	 */
+	class BS_CORE_EXPORT DynamicFontAtlas
+	{
+	public:
+		DynamicFontAtlas(const SPtr<GlyphRasterizer>& rasterizer, const DYNAMIC_FONT_DESC& desc);
+		~DynamicFontAtlas();
+
+		/**
+		 * Creates a new bitmap for the specified font size, in points. Characters of the bitmap are rasterized into the
+		 * atlas the first time they are looked up. Returns null if the rasterizer doesn't support the size.
+		 */
+		SPtr<FontBitmap> createBitmap(UINT32 size);
+
+		/**
+		 * Returns the descriptor of the character with the specified Unicode key, if it was already added to the bitmap.
+		 * Otherwise returns the bitmap's missing glyph.
+		 */
+		const CharDesc& getChar(const FontBitmap& bitmap, UINT32 charId);
+
+		/**
+		 * Returns the descriptor of the character with the specified Unicode key. If the character wasn't added to the
+		 * bitmap yet it is rasterized and added. Returns the bitmap's missing glyph if the font doesn't contain the
+		 * character or the atlas is full.
+		 */
+		const CharDesc& getOrAddChar(FontBitmap& bitmap, UINT32 charId);
+
+		/** Returns the kerning between two characters of the provided bitmap. See FontBitmap::getKerning(). */
+		INT32 getKerning(const FontBitmap& bitmap, const CharDesc& left, const CharDesc& right);
+
+		/** Prevents the page from being cleared until it is unpinned. Pins are reference counted. */
+		void pinPage(UINT32 page);
+
+		/** Releases a pin acquired with pinPage(). */
+		void unpinPage(UINT32 page);
+
+		/** Returns the textures of all the atlas pages. */
+		const Vector<HTexture>& getTextures() const { return mTextures; }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Frees up space in the atlas if it ran out of space during the frame and uploads all modified pages to the GPU.
+		 *
+		 * @param[in]	frameIdx	Index of the frame that is ending.
+		 * @return					True if characters previously returned by the atlas were evicted, or if characters
+		 *							that previously didn't fit can now be added.
+		 */
+		bool _update(UINT64 frameIdx);
+
+		/** @} */
+	private:
+		/** A row of characters of similar height within an atlas page. */
+		struct Shelf
+		{
+			UINT32 y;
+			UINT32 height;
+			UINT32 nextX;
+		};
+
+		/** A single atlas texture and its CPU copy. */
+		struct Page
+		{
+			Vector<UINT8> pixels;
+			Vector<Shelf> shelves;
+			UINT32 nextShelfY = 0;
+			UINT64 lastUsedFrame = 0;
+			UINT32 numPins = 0;
+			bool isDirty = false;
+		};
+
+		/** Rasterizes the character and adds it to the bitmap. Same as getOrAddChar() but without the lookup. */
+		const CharDesc& addChar(FontBitmap& bitmap, UINT32 charId);
+
+		/** Notifies the atlas that the page containing the character was used this frame. */
+		void markUsed(const CharDesc& desc)
+		{
+			// Characters without any visible pixels don't occupy any page
+			if(desc.width == 0 || desc.height == 0)
+				return;
+
+			if(desc.page < (UINT32)mPages.size())
+				mPages[desc.page].lastUsedFrame = mFrameIdx;
+		}
+
+		/**
+		 * Finds space for a character of the specified size and copies its pixels into the atlas. Populates the atlas
+		 * placement fields of @p output. Returns false if there is no space left.
+		 */
+		bool insert(const RasterizedGlyph& glyph, CharDesc& output);
+
+		/** Same as insert(), except the glyph is made invisible if there is no space left. */
+		void insertMissingGlyph(const RasterizedGlyph& glyph, CharDesc& output);
+
+		/** Attempts to find space for a rectangle of the specified size within a page, using the shelf packing method. */
+		bool allocate(Page& page, UINT32 width, UINT32 height, UINT32& x, UINT32& y);
+
+		/** Creates a new atlas page and adds it to all the bitmaps. */
+		void addPage();
+
+		/** Removes all characters from the page. */
+		void clearPage(UINT32 pageIdx);
+
+		/** Uploads the CPU copy of the page to its texture. */
+		void upload(UINT32 pageIdx);
+
+		SPtr<GlyphRasterizer> mRasterizer;
+		DYNAMIC_FONT_DESC mDesc;
+
+		Vector<Page> mPages;
+		Vector<HTexture> mTextures;
+		Vector<FontBitmap*> mBitmaps;
+
+		/** Kerning amounts per bitmap size, keyed the same as FontBitmapLookup::kerning. */
+		UnorderedMap<UINT32, UnorderedMap<UINT64, INT32>> mKerning;
+
+		Mutex mMutex;
+		UINT64 mFrameIdx = 0;
+		bool mIsFull = false;
+		bool mExceededMaxPages = false;
+	};
+
+	/** @} */
+}
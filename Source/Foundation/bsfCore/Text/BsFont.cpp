@@ -1,20 +1,153 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Text/BsFont.h"
+#include "Text/BsDynamicFontAtlas.h"
+#include "Text/BsFontManager.h"
 #include "Private/RTTI/BsFontRTTI.h"
 #include "Resources/BsResources.h"
+#include "FileSystem/BsDataStream.h"
 
 namespace bs
 {
+	/** Returns the key used for looking up kerning between two characters. */
+	static UINT64 getKerningKey(UINT32 leftCharId, UINT32 rightCharId)
+	{
+		return ((UINT64)leftCharId << 32) | rightCharId;
+	}
+
+	void FontBitmapLookup::clear()
+	{
+		direct.clear();
+		other.clear();
+		kerning.clear();
+		isBuilt = false;
+	}
+
+	void FontBitmapLookup::add(UINT32 charId, const CharDesc* desc)
+	{
+		if(charId < (UINT32)direct.size())
+			direct[charId] = desc;
+		else
+			other[charId] = desc;
+	}
+
 	const CharDesc& FontBitmap::getCharDesc(UINT32 charId) const
 	{
+		// Characters of dynamic fonts can be modified by the atlas, so they must be accessed through it
+		if(mLookup.atlas != nullptr)
+			return mLookup.atlas->getChar(*this, charId);
+
+		const CharDesc* desc = findCharDesc(charId);
+		return desc != nullptr ? *desc : missingGlyph;
+	}
+
+	const CharDesc& FontBitmap::getOrAddCharDesc(UINT32 charId)
+	{
+		if(mLookup.atlas != nullptr)
+			return mLookup.atlas->getOrAddChar(*this, charId);
+
+		const CharDesc* desc = findCharDesc(charId);
+		return desc != nullptr ? *desc : missingGlyph;
+	}
+
+	const CharDesc* FontBitmap::findCharDesc(UINT32 charId) const
+	{
+		if(mLookup.isBuilt)
+		{
+			if(charId < (UINT32)mLookup.direct.size())
+				return mLookup.direct[charId];
+
+			auto iterFind = mLookup.other.find(charId);
+			if(iterFind != mLookup.other.end())
+				return iterFind->second;
+
+			return nullptr;
+		}
+
 		auto iterFind = characters.find(charId);
 		if(iterFind != characters.end())
+			return &iterFind->second;
+
+		return nullptr;
+	}
+
+	INT32 FontBitmap::getKerning(const CharDesc& left, const CharDesc& right) const
+	{
+		// Dynamic fonts don't store kerning pairs, instead they are retrieved from the font as needed
+		if(mLookup.atlas != nullptr)
+			return mLookup.atlas->getKerning(*this, left, right);
+
+		// Most characters have no kerning pairs, so this avoids the lookup in most cases
+		if(left.kerningPairs.empty())
+			return 0;
+
+		// Missing glyph isn't a part of the lookup tables
+		if(mLookup.isBuilt && &left != &missingGlyph)
+		{
+			auto iterFind = mLookup.kerning.find(getKerningKey(left.charId, right.charId));
+			if(iterFind != mLookup.kerning.end())
+				return iterFind->second;
+
+			return 0;
+		}
+
+		for(auto& entry : left.kerningPairs)
 		{
-			return characters.at(charId);
+			if(entry.otherCharId == right.charId)
+				return entry.amount;
 		}
 
-		return missingGlyph;
+		return 0;
+	}
+
+	void FontBitmap::_buildLookup()
+	{
+		mLookup.clear();
+
+		// Dynamic bitmaps can have characters added later, so reserve the entire range
+		UINT32 directSize = 0;
+		if(mLookup.atlas != nullptr)
+			directSize = FontBitmapLookup::DIRECT_RANGE_END;
+		else
+		{
+			for(auto& entry : characters)
+			{
+				if(entry.first < FontBitmapLookup::DIRECT_RANGE_END)
+					directSize = std::max(directSize, entry.first + 1);
+			}
+		}
+
+		mLookup.direct.resize(directSize, nullptr);
+		for(auto& entry : characters)
+		{
+			const CharDesc& desc = entry.second;
+
+			if(entry.first < directSize)
+				mLookup.direct[entry.first] = &desc;
+			else
+				mLookup.other[entry.first] = &desc;
+
+			for(auto& kerningPair : desc.kerningPairs)
+			{
+				// Keep the first entry for duplicate pairs, same as a linear search would
+				mLookup.kerning.insert(std::make_pair(getKerningKey(desc.charId, kerningPair.otherCharId),
+					kerningPair.amount));
+			}
+		}
+
+		mLookup.isBuilt = true;
+	}
+
+	void FontBitmap::_pinPage(UINT32 page) const
+	{
+		if(mLookup.atlas != nullptr)
+			mLookup.atlas->pinPage(page);
+	}
+
+	void FontBitmap::_unpinPage(UINT32 page) const
+	{
+		if(mLookup.atlas != nullptr)
+			mLookup.atlas->unpinPage(page);
 	}
 
 	RTTITypeBase* FontBitmap::getRTTIStatic()
@@ -36,6 +169,7 @@ namespace bs
 		for(auto iter = fontData.begin(); iter != fontData.end(); ++iter)
 		{
 			mFontDataPerSize[(*iter)->size] = *iter;
+			(*iter)->_buildLookup();
 
 			for (auto& texture : (*iter)->texturePages)
 			{
@@ -47,18 +181,58 @@ namespace bs
 		Resource::initialize();
 	}
 
+	void Font::initialize(const SPtr<MemoryDataStream>& fontData, const DYNAMIC_FONT_DESC& desc)
+	{
+		// Atlas is created on first use, as fonts can be loaded on any thread while the atlas can only be used on the
+		// sim thread
+		mSourceData = fontData;
+		mDynamicDesc = desc;
+
+		Resource::initialize();
+	}
+
 	SPtr<FontBitmap> Font::getBitmap(UINT32 size) const
 	{
 		auto iterFind = mFontDataPerSize.find(size);
 
 		if(iterFind == mFontDataPerSize.end())
-			return nullptr;
+		{
+			if(!isDynamic() || mIsRasterizerMissing)
+				return nullptr;
+
+			if(mAtlas == nullptr)
+			{
+				SPtr<GlyphRasterizer> rasterizer;
+				if(FontManager::isStarted())
+					rasterizer = FontManager::instance().createRasterizer(mSourceData, mDynamicDesc);
+
+				if(rasterizer == nullptr)
+				{
+					BS_LOG(Error, Resources, "Unable to create a glyph rasterizer for dynamic font '{0}'. Make sure a "
+						"plugin supporting the font format (e.g. the font importer) is loaded.", getName());
+
+					mIsRasterizerMissing = true;
+					return nullptr;
+				}
+
+				mAtlas = bs_shared_ptr_new<DynamicFontAtlas>(rasterizer, mDynamicDesc);
+			}
+
+			SPtr<FontBitmap> bitmap = mAtlas->createBitmap(size);
+			if(bitmap != nullptr)
+				mFontDataPerSize[size] = bitmap;
+
+			return bitmap;
+		}
 
 		return iterFind->second;
 	}
 
 	INT32 Font::getClosestSize(UINT32 size) const
 	{
+		if(isDynamic())
+			return size;
+
 		UINT32 minDiff = std::numeric_limits<UINT32>::max();
 		UINT32 bestSize = size;
 
@@ -91,6 +265,18 @@ namespace bs
 
 	void Font::getCoreDependencies(Vector<CoreObject*>& dependencies)
 	{
+		// Bitmaps of dynamic fonts all share the atlas textures
+		if(mAtlas != nullptr)
+		{
+			for (auto& texture : mAtlas->getTextures())
+			{
+				if (texture.isLoaded())
+					dependencies.push_back(texture.get());
+			}
+
+			return;
+		}
+
 		for (auto& fontDataEntry : mFontDataPerSize)
 		{
 			for (auto& texture : fontDataEntry.second->texturePages)
@@ -117,6 +303,22 @@ namespace bs
 		return newFont;
 	}
 
+	HFont Font::createDynamic(const SPtr<DataStream>& fontData, const DYNAMIC_FONT_DESC& desc)
+	{
+		SPtr<Font> newFont = _createDynamicPtr(fontData, desc);
+
+		return static_resource_cast<Font>(gResources()._createResourceHandle(newFont));
+	}
+
+	SPtr<Font> Font::_createDynamicPtr(const SPtr<DataStream>& fontData, const DYNAMIC_FONT_DESC& desc)
+	{
+		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
+		newFont->_setThisPtr(newFont);
+		newFont->initialize(bs_shared_ptr_new<MemoryDataStream>(fontData), desc);
+
+		return newFont;
+	}
+
 	SPtr<Font> Font::_createEmpty()
 	{
 		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "Resources/BsResource.h"
 #include "Text/BsFontDesc.h"
+#include "Text/BsGlyphRasterizer.h"
 
 namespace bs
 {
@@ -12,13 +13,74 @@ namespace bs
 	 *  @{
 	 */
 
+	class DynamicFontAtlas;
+
+	/**
+	 * Lookup tables that allow character descriptors and kerning of a FontBitmap to be found without searching. Tables
+	 * reference the characters of the bitmap they were built for, and are therefore never copied along with the bitmap.
+	 */
+	struct FontBitmapLookup
+	{
+		FontBitmapLookup() = default;
+		FontBitmapLookup(const FontBitmapLookup& other) { }
+		FontBitmapLookup& operator=(const FontBitmapLookup& other) { clear(); atlas = nullptr; return *this; }
+
+		/** Removes all entries from the lookup tables. */
+		void clear();
+
+		/** Adds a new entry to the character tables. Tables must have already been built. */
+		void add(UINT32 charId, const CharDesc* desc);
+
+		/** Characters with IDs lower than DIRECT_RANGE_END, indexed directly by character ID. Null if missing. */
+		Vector<const CharDesc*> direct;
+
+		/** Characters with IDs outside of the direct range, keyed by character ID. */
+		UnorderedMap<UINT32, const CharDesc*> other;
+
+		/**
+		 * Kerning amounts keyed by the IDs of the left (upper 32 bits) and right (lower 32 bits) character. Not used by
+		 * dynamic fonts, which keep kerning in their atlas.
+		 */
+		UnorderedMap<UINT64, INT32> kerning;
+
+		/** True if the tables were built and can be used for lookups. */
+		bool isBuilt = false;
+
+		/**
+		 * Atlas that characters missing from the tables are rasterized into, for bitmaps belonging to dynamic fonts. Null
+		 * for pre-rendered fonts. A copy of the bitmap doesn't reference the atlas and cannot add new characters.
+		 */
+		DynamicFontAtlas* atlas = nullptr;
+
+		/**
+		 * Characters with IDs lower than this value are stored in the directly indexed table. This covers Latin, Greek,
+		 * Cyrillic, Armenian, Hebrew and Arabic scripts.
+		 */
+		static constexpr UINT32 DIRECT_RANGE_END = 0x800;
+	};
+
 	/**	Contains textures and data about every character for a bitmap font of a specific size. */
 	struct BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:GUI_Engine) FontBitmap : public IReflectable
 	{
-		/**	Returns a character description for the character with the specified Unicode key. */
+		/**
+		 * Returns a character description for the character with the specified Unicode key. If the bitmap belongs to a
+		 * dynamic font only characters that were already rasterized are returned, see getOrAddCharDesc().
+		 */
 		BS_SCRIPT_EXPORT()
 		const CharDesc& getCharDesc(UINT32 charId) const;
 
+		/**
+		 * Same as getCharDesc(), except that if the bitmap belongs to a dynamic font, characters that weren't rasterized
+		 * yet are rasterized into the font's atlas.
+		 */
+		const CharDesc& getOrAddCharDesc(UINT32 charId);
+
+		/**
+		 * Returns the offset to apply to the advance of the @p left character when it is followed by the @p right
+		 * character, in pixels. Both characters must belong to this bitmap.
+		 */
+		INT32 getKerning(const CharDesc& left, const CharDesc& right) const;
+
 		/** Font size for which the data is contained. */
 		BS_SCRIPT_EXPORT()
 		UINT32 size;
@@ -46,6 +108,36 @@ namespace bs
 		/** All characters in the font referenced by character ID. */
 		Map<UINT32, CharDesc> characters;
 
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Builds the tables used for quickly looking up characters and kerning pairs. Must be called again after
+		 * @p characters are modified. Called automatically when the bitmap is used to initialize a Font.
+		 */
+		void _buildLookup();
+
+		/**
+		 * Prevents the specified texture page from being evicted from the dynamic font atlas, until _unpinPage() is
+		 * called. Should be called by anything that keeps geometry referencing characters on the page. Does nothing for
+		 * bitmaps of pre-rendered fonts.
+		 */
+		void _pinPage(UINT32 page) const;
+
+		/** Releases a page pinned with _pinPage(). */
+		void _unpinPage(UINT32 page) const;
+
+		/** @} */
+
+	private:
+		friend class DynamicFontAtlas;
+
+		/** Looks up the descriptor of the character with the specified Unicode key. Returns null if not found. */
+		const CharDesc* findCharDesc(UINT32 charId) const;
+
+		FontBitmapLookup mLookup;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -58,6 +150,10 @@ namespace bs
 	/**
 	 * Font resource containing data about textual characters and how to render text. Contains one or multiple font
 	 * bitmaps, each for a specific size.
+	 *
+	 * Fonts are either pre-rendered, in which case all the bitmaps and their characters are created on import, or dynamic,
+	 * in which case the font keeps the original font file and renders characters into a shared texture atlas as they are
+	 * used, for any requested size.
 	 */
 	class BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:GUI_Engine) Font : public Resource
 	{
@@ -65,7 +161,7 @@ namespace bs
 		virtual ~Font() = default;
 
 		/**
-		 * Returns font bitmap for a specific font size.
+		 * Returns font bitmap for a specific font size. Dynamic fonts create the bitmap on the first request.
 		 *
 		 * @param[in]	size	Size of the bitmap in points.
 		 * @return				Bitmap object if it exists, false otherwise.
@@ -74,7 +170,7 @@ namespace bs
 		SPtr<FontBitmap> getBitmap(UINT32 size) const;
 
 		/**	
-		 * Finds the available font bitmap size closest to the provided size.
+		 * Finds the available font bitmap size closest to the provided size. Dynamic fonts support all sizes.
 		 *
 		 * @param[in]	size	Size of the bitmap in points.
 		 * @return				Nearest available bitmap size.
@@ -82,9 +178,22 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		INT32 getClosestSize(UINT32 size) const;
 
+		/** Checks if the font renders its characters on demand, rather than using pre-rendered bitmaps. */
+		BS_SCRIPT_EXPORT()
+		bool isDynamic() const { return mSourceData != nullptr; }
+
 		/**	Creates a new font from the provided per-size font data. */
 		static HFont create(const Vector<SPtr<FontBitmap>>& fontInitData);
 
+		/**
+		 * Creates a new dynamic font that renders its characters on demand. Requires a glyph rasterizer supporting the
+		 * font format to be registered with the FontManager (e.g. by the font importer plugin).
+		 *
+		 * @param[in]	fontData	Contents of the font file (e.g. .ttf or .otf).
+		 * @param[in]	desc		Settings that control how are the characters rendered and stored.
+		 */
+		static HFont createDynamic(const SPtr<DataStream>& fontData, const DYNAMIC_FONT_DESC& desc = DYNAMIC_FONT_DESC());
+
 	public: // ***** INTERNAL ******
 		using Resource::initialize;
 
@@ -99,9 +208,19 @@ namespace bs
 		 */
 		void initialize(const Vector<SPtr<FontBitmap>>& fontData);
 
+		/**
+		 * Initializes a dynamic font from the contents of a font file.
+		 *
+		 * @note	Internal method. Factory methods will call this automatically for you.
+		 */
+		void initialize(const SPtr<MemoryDataStream>& fontData, const DYNAMIC_FONT_DESC& desc);
+
 		/** Creates a new font as a pointer instead of a resource handle. */
 		static SPtr<Font> _createPtr(const Vector<SPtr<FontBitmap>>& fontInitData);
 
+		/** Creates a new dynamic font as a pointer instead of a resource handle. */
+		static SPtr<Font> _createDynamicPtr(const SPtr<DataStream>& fontData, const DYNAMIC_FONT_DESC& desc);
+
 		/** Creates a Font without initializing it. */
 		static SPtr<Font> _createEmpty();
 
@@ -116,7 +235,14 @@ namespace bs
 		void getCoreDependencies(Vector<CoreObject*>& dependencies) override;
 
 	private:
-		Map<UINT32, SPtr<FontBitmap>> mFontDataPerSize;
+		mutable Map<UINT32, SPtr<FontBitmap>> mFontDataPerSize;
+
+		SPtr<MemoryDataStream> mSourceData;
+		DYNAMIC_FONT_DESC mDynamicDesc;
+
+		// Must be destroyed before the bitmaps, as it references them
+		mutable SPtr<DynamicFontAtlas> mAtlas;
+		mutable bool mIsRasterizerMissing = false;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
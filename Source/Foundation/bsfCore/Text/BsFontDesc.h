@@ -11,6 +11,15 @@ namespace bs
 	 *  @{
 	 */
 
+	/**	Determines how is a font rendered into the bitmap texture. */
+	enum class BS_SCRIPT_EXPORT(m:Text,api:bsf,api:bed) FontRenderMode
+	{
+		Smooth, /*< Render antialiased fonts without hinting (slightly more blurry). */
+		Raster, /*< Render non-antialiased fonts without hinting (slightly more blurry). */
+		HintedSmooth, /*< Render antialiased fonts with hinting. */
+		HintedRaster /*< Render non-antialiased fonts with hinting. */
+	};
+
 	/**	Kerning pair representing larger or smaller offset between a specific pair of characters. */
 	struct BS_SCRIPT_EXPORT(pl:true,m:GUI_Engine) KerningPair
 	{
@@ -12,15 +12,6 @@ namespace bs
 	 *  @{
 	 */
 
-	/**	Determines how is a font rendered into the bitmap texture. */
-	enum class BS_SCRIPT_EXPORT(m:Text,api:bsf,api:bed) FontRenderMode
-	{
-		Smooth, /*< Render antialiased fonts without hinting (slightly more blurry). */
-		Raster, /*< Render non-antialiased fonts without hinting (slightly more blurry). */
-		HintedSmooth, /*< Render antialiased fonts with hinting. */
-		HintedRaster /*< Render non-antialiased fonts with hinting. */
-	};
-
 	/** Represents a range of character code. */
 	struct BS_SCRIPT_EXPORT(m:Text,pl:true,api:bsf,api:bed) CharRange
 	{
@@ -63,6 +54,14 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		bool italic = false;
 
+		/**
+		 * Determines whether the font should be imported as a dynamic font. Dynamic fonts keep the font file data and
+		 * rasterize characters at runtime, the first time they are used, in any size. When enabled the font sizes and
+		 * character ranges are ignored.
+		 */
+		BS_SCRIPT_EXPORT()
+		bool dynamic = false;
+
 		/** Creates a new import options object that allows you to customize how are fonts imported. */
 		BS_SCRIPT_EXPORT(ec:T)
 		static SPtr<FontImportOptions> create();
@@ -0,0 +1,59 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Text/BsFontManager.h"
+#include "Text/BsDynamicFontAtlas.h"
+
+namespace bs
+{
+	void FontManager::registerRasterizerFactory(const SPtr<GlyphRasterizerFactory>& factory)
+	{
+		if(factory == nullptr)
+			return;
+
+		mFactories.push_back(factory);
+	}
+
+	void FontManager::unregisterRasterizerFactory(const SPtr<GlyphRasterizerFactory>& factory)
+	{
+		auto iterFind = std::find(mFactories.begin(), mFactories.end(), factory);
+		if(iterFind != mFactories.end())
+			mFactories.erase(iterFind);
+	}
+
+	SPtr<GlyphRasterizer> FontManager::createRasterizer(const SPtr<MemoryDataStream>& fontData,
+		const DYNAMIC_FONT_DESC& desc) const
+	{
+		for(auto iter = mFactories.rbegin(); iter != mFactories.rend(); ++iter)
+		{
+			SPtr<GlyphRasterizer> rasterizer = (*iter)->create(fontData, desc);
+			if(rasterizer != nullptr)
+				return rasterizer;
+		}
+
+		return nullptr;
+	}
+
+	void FontManager::_registerAtlas(DynamicFontAtlas* atlas)
+	{
+		mAtlases.push_back(atlas);
+	}
+
+	void FontManager::_unregisterAtlas(DynamicFontAtlas* atlas)
+	{
+		auto iterFind = std::find(mAtlases.begin(), mAtlases.end(), atlas);
+		if(iterFind != mAtlases.end())
+			mAtlases.erase(iterFind);
+	}
+
+	void FontManager::_update()
+	{
+		bool evicted = false;
+		for(auto& atlas : mAtlases)
+			evicted |= atlas->_update(mFrameIdx);
+
+		if(evicted)
+			mGlyphEvictionCount++;
+
+		mFrameIdx++;
+	}
+}
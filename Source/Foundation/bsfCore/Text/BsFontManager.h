@@ -0,0 +1,75 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Text/BsGlyphRasterizer.h"
+
+namespace bs
+{
+	class DynamicFontAtlas;
+
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Keeps track of the glyph rasterizers available for dynamic fonts, and of the atlases of all dynamic fonts. Atlases
+	 * are updated once per frame, at which point any newly rasterized glyphs are uploaded to the GPU and pages are
+	 * evicted if the atlas ran out of space.
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_CORE_EXPORT FontManager : public Module<FontManager>
+	{
+	public:
+		/**
+		 * Registers a factory that will be used for creating glyph rasterizers for dynamic fonts. Factories registered
+		 * later take priority.
+		 */
+		void registerRasterizerFactory(const SPtr<GlyphRasterizerFactory>& factory);
+
+		/** Unregisters a factory previously registered with registerRasterizerFactory(). */
+		void unregisterRasterizerFactory(const SPtr<GlyphRasterizerFactory>& factory);
+
+		/**
+		 * Creates a rasterizer for the font contained in the provided font file data, using the registered factories.
+		 * Returns null if none of the factories support the font data.
+		 */
+		SPtr<GlyphRasterizer> createRasterizer(const SPtr<MemoryDataStream>& fontData, const DYNAMIC_FONT_DESC& desc) const;
+
+		/**
+		 * Returns a counter that is incremented every time glyphs are evicted from a dynamic font atlas. Only pages that
+		 * aren't pinned (see FontBitmap::_pinPage()) are evicted, so this only invalidates unpinned geometry, as well as
+		 * text laid out while the atlas was full, which should be rebuilt so characters that didn't fit can be added.
+		 */
+		UINT64 getGlyphEvictionCount() const { return mGlyphEvictionCount; }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Registers a new dynamic font atlas that is to be updated every frame. */
+		void _registerAtlas(DynamicFontAtlas* atlas);
+
+		/** Unregisters an atlas previously registered with _registerAtlas(). */
+		void _unregisterAtlas(DynamicFontAtlas* atlas);
+
+		/** Returns the index of the current frame, as counted by calls to _update(). */
+		UINT64 _getFrameIdx() const { return mFrameIdx; }
+
+		/** Uploads glyphs rasterized this frame and evicts glyphs from full atlases. Should be called once per frame. */
+		void _update();
+
+		/** @} */
+	private:
+		Vector<SPtr<GlyphRasterizerFactory>> mFactories;
+		Vector<DynamicFontAtlas*> mAtlases;
+
+		UINT64 mFrameIdx = 0;
+		UINT64 mGlyphEvictionCount = 0;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,99 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Text/BsFontDesc.h"
+
+namespace bs
+{
+	/** @addtogroup Text
+	 *  @{
+	 */
+
+	/** Settings that control how are glyphs of a dynamic font rasterized and stored. */
+	struct DYNAMIC_FONT_DESC
+	{
+		/** Determines the render mode used for rendering the characters into a bitmap. */
+		FontRenderMode renderMode = FontRenderMode::HintedSmooth;
+
+		/** Determines dots per inch scale that will be used when rendering the characters. */
+		UINT32 dpi = 96;
+
+		/** Width and height of a single atlas texture page, in pixels. */
+		UINT32 pageSize = 512;
+
+		/**
+		 * Maximum number of atlas texture pages. Once all pages are full the least recently used page is cleared in
+		 * order to make room for new glyphs.
+		 */
+		UINT32 maxPages = 4;
+	};
+
+	/** @} */
+
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/** Metrics that apply to all characters of a font of a specific size. */
+	struct FontSizeMetrics
+	{
+		INT32 baselineOffset = 0; /**< Y offset to the baseline on which the characters are placed, in pixels. */
+		UINT32 lineHeight = 0; /**< Height of a single line of the font, in pixels. */
+		UINT32 spaceWidth = 0; /**< Width of a space in pixels. */
+	};
+
+	/** Pixels and metrics of a single rasterized character. */
+	struct RasterizedGlyph
+	{
+		/**
+		 * Metrics of the character. Only the character ID, size, offset and advance fields are populated, the atlas
+		 * placement is up to the caller.
+		 */
+		CharDesc desc;
+
+		/** Coverage of each pixel of the character, one byte per pixel, rows ordered from top to bottom. */
+		Vector<UINT8> pixels;
+	};
+
+	/** Renders individual characters of a single font on demand. Used for populating atlases of dynamic fonts. */
+	class BS_CORE_EXPORT GlyphRasterizer
+	{
+	public:
+		virtual ~GlyphRasterizer() = default;
+
+		/** Retrieves metrics of the font at the specified size, in points. Returns false if the size is not supported. */
+		virtual bool getSizeMetrics(UINT32 size, FontSizeMetrics& output) = 0;
+
+		/**
+		 * Renders the character with the specified Unicode key at the specified size, in points. Returns false if the font
+		 * doesn't contain the character.
+		 */
+		virtual bool rasterize(UINT32 charId, UINT32 size, RasterizedGlyph& output) = 0;
+
+		/** Renders the glyph to display in place of characters missing from the font, at the specified size in points. */
+		virtual bool rasterizeMissingGlyph(UINT32 size, RasterizedGlyph& output) = 0;
+
+		/**
+		 * Returns the offset to apply to the advance of the @p left character when it is followed by the @p right
+		 * character, in pixels.
+		 */
+		virtual INT32 getKerning(UINT32 left, UINT32 right, UINT32 size) = 0;
+	};
+
+	/** Creates glyph rasterizers for fonts in a specific format. Registered with the FontManager by plugins. */
+	class BS_CORE_EXPORT GlyphRasterizerFactory
+	{
+	public:
+		virtual ~GlyphRasterizerFactory() = default;
+
+		/**
+		 * Creates a rasterizer for the font contained in the provided font file data. Returns null if the data isn't in
+		 * a format supported by this factory.
+		 */
+		virtual SPtr<GlyphRasterizer> create(const SPtr<MemoryDataStream>& fontData, const DYNAMIC_FONT_DESC& desc) = 0;
+	};
+
+	/** @} */
+}
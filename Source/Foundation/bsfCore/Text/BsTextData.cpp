@@ -21,9 +21,9 @@ namespace bs
 	}
 
 	// Assumes charIdx is an index right after last char in the list (if any). All chars need to be sequential.
-	UINT32 TextDataBase::TextWord::addChar(UINT32 charIdx, const CharDesc& desc)
+	UINT32 TextDataBase::TextWord::addChar(const FontBitmap& font, UINT32 charIdx, const CharDesc& desc)
 	{
-		UINT32 charWidth = calcCharWidth(mLastChar, desc);
+		UINT32 charWidth = calcCharWidth(font, mLastChar, desc);
 
 		mWidth += charWidth;
 		mHeight = std::max(mHeight, desc.height);
@@ -38,28 +38,16 @@ namespace bs
 		return charWidth;
 	}
 
-	UINT32 TextDataBase::TextWord::calcWidthWithChar(const CharDesc& desc)
+	UINT32 TextDataBase::TextWord::calcWidthWithChar(const FontBitmap& font, const CharDesc& desc)
 	{
-		return mWidth + calcCharWidth(mLastChar, desc);
+		return mWidth + calcCharWidth(font, mLastChar, desc);
 	}
 
-	UINT32 TextDataBase::TextWord::calcCharWidth(const CharDesc* prevDesc, const CharDesc& desc)
+	UINT32 TextDataBase::TextWord::calcCharWidth(const FontBitmap& font, const CharDesc* prevDesc, const CharDesc& desc)
 	{
 		UINT32 charWidth = desc.xAdvance;
 		if (prevDesc != nullptr)
-		{
-			UINT32 kerning = 0;
-			for (size_t j = 0; j < prevDesc->kerningPairs.size(); j++)
-			{
-				if (prevDesc->kerningPairs[j].otherCharId == desc.charId)
-				{
-					kerning = prevDesc->kerningPairs[j].amount;
-					break;
-				}
-			}
-
-			charWidth += kerning;
-		}
+			charWidth += font.getKerning(*prevDesc, desc);
 
 		return charWidth;
 	}
@@ -100,7 +88,7 @@ namespace bs
 		}
 
 		TextWord& lastWord = MemBuffer->WordBuffer[mWordsEnd];
-		charWidth = lastWord.addChar(charIdx, charDesc);
+		charWidth = lastWord.addChar(*mTextData->mFontData, charIdx, charDesc);
 
 		mWidth += charWidth;
 		mHeight = std::max(mHeight, lastWord.getHeight());
@@ -165,13 +153,13 @@ namespace bs
 		{
 			TextWord& lastWord = MemBuffer->WordBuffer[mWordsEnd];
 			if (lastWord.isSpacer())
-				charWidth = TextWord::calcCharWidth(nullptr, desc);
+				charWidth = TextWord::calcCharWidth(*mTextData->mFontData, nullptr, desc);
 			else
-				charWidth = lastWord.calcWidthWithChar(desc) - lastWord.getWidth();
+				charWidth = lastWord.calcWidthWithChar(*mTextData->mFontData, desc) - lastWord.getWidth();
 		}
 		else
 		{
-			charWidth = TextWord::calcCharWidth(nullptr, desc);
+			charWidth = TextWord::calcCharWidth(*mTextData->mFontData, nullptr, desc);
 		}
 
 		return mWidth + charWidth;
@@ -258,14 +246,7 @@ namespace bs
 					if((j + 1) <= word.getCharsEnd())
 					{
 						const CharDesc& nextChar = mTextData->getChar(j + 1);
-						for(size_t j = 0; j < curChar.kerningPairs.size(); j++)
-						{
-							if(curChar.kerningPairs[j].otherCharId == nextChar.charId)
-							{
-								kerning = curChar.kerningPairs[j].amount;
-								break;
-							}
-						}
+						kerning = mTextData->mFontData->getKerning(curChar, nextChar);
 					}
 
 					if(curChar.page != page)
@@ -381,7 +362,7 @@ namespace bs
 				break;
 
 			UINT32 charId = text[charIdx];
-			const CharDesc& charDesc = mFontData->getCharDesc(charId);
+			const CharDesc& charDesc = mFontData->getOrAddCharDesc(charId);
 
 			TextLine* curLine = &MemBuffer->LineBuffer[curLineIdx];
 
@@ -425,7 +406,7 @@ namespace bs
 						UINT32 lastWordIdx = curLine->removeLastWord();
 						TextWord& lastWord = MemBuffer->WordBuffer[lastWordIdx];
 
-						bool wordFits = lastWord.calcWidthWithChar(charDesc) <= width;
+						bool wordFits = lastWord.calcWidthWithChar(*mFontData, charDesc) <= width;
 						if (wordFits && !curLine->isEmpty())
 						{
 							curLine->finalize(false);
@@ -524,7 +505,7 @@ namespace bs
 		for (UINT32 i = 0; i < mNumChars; i++)
 		{
 			UINT32 charId = text[i];
-			const CharDesc& charDesc = mFontData->getCharDesc(charId);
+			const CharDesc& charDesc = mFontData->getOrAddCharDesc(charId);
 
 			mChars[i] = &charDesc;
 		}
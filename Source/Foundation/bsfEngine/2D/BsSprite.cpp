@@ -1,12 +1,19 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "2D/BsTextSprite.h"
+#include "2D/BsSpriteManager.h"
 #include "Math/BsVector2.h"
 #include "Math/BsPlane.h"
 #include "Mesh/BsMeshUtility.h"
 
 namespace bs
 {
+	Sprite::~Sprite()
+	{
+		if(mQueueIdx != (UINT32)-1 && SpriteManager::isStarted())
+			SpriteManager::instance()._cancelUpdate(*this);
+	}
+
 	Rect2I Sprite::getBounds(const Vector2I& offset, const Rect2I& clipRect) const
 	{
 		Rect2I bounds = mBounds;
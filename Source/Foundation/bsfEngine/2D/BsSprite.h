@@ -56,7 +56,7 @@ namespace bs
 	{
 	public:
 		Sprite() = default;
-		virtual ~Sprite() = default;
+		virtual ~Sprite();
 
 		/**
 		 * Returns clipped bounds of the sprite.
@@ -146,6 +146,8 @@ namespace bs
 		static void clipTrianglesToRect(UINT8* vertices, UINT8* uv, UINT32 numTris, UINT32 vertStride,
 			const Rect2I& clipRect, const std::function<void(Vector2*, Vector2*, UINT32)>& writeCallback);
 	protected:
+		friend class SpriteManager;
+
 		/**	Returns the offset needed to move the sprite in order for it to respect the provided anchor. */
 		static Vector2I getAnchorOffset(SpriteAnchor anchor, UINT32 width, UINT32 height);
 
@@ -154,6 +156,9 @@ namespace bs
 
 		mutable Rect2I mBounds;
 		mutable Vector<SpriteRenderElementData> mCachedRenderElements;
+
+		/** Index of the update queued in SpriteManager, or -1 if no update is queued. */
+		UINT32 mQueueIdx = (UINT32)-1;
 	};
 
 	inline void Sprite::getRenderElementInfo(UINT32 idx, SpriteRenderElement& info) const
@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "2D/BsSpriteManager.h"
 #include "2D/BsSpriteMaterials.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
@@ -36,4 +37,91 @@ namespace bs
 
 		return nullptr;
 	}
+
+	void SpriteManager::queueUpdate(ImageSprite* sprite, const IMAGE_SPRITE_DESC& desc, UINT64 groupId)
+	{
+		if(sprite->mQueueIdx != (UINT32)-1)
+			_cancelUpdate(*sprite);
+
+		sprite->mQueueIdx = (UINT32)mQueuedImageUpdates.size();
+		mQueuedImageUpdates.push_back({ sprite, desc, groupId });
+	}
+
+	void SpriteManager::queueUpdate(TextSprite* sprite, const TEXT_SPRITE_DESC& desc, UINT64 groupId)
+	{
+		if(sprite->mQueueIdx != (UINT32)-1)
+			_cancelUpdate(*sprite);
+
+		sprite->mQueueIdx = (UINT32)mQueuedTextUpdates.size();
+		mQueuedTextUpdates.push_back({ sprite, desc, groupId });
+	}
+
+	void SpriteManager::processQueuedUpdates()
+	{
+		if(mQueuedTextUpdates.empty() && mQueuedImageUpdates.empty())
+			return;
+
+		for(auto& entry : mQueuedTextUpdates)
+		{
+			if(entry.sprite == nullptr)
+				continue;
+
+			entry.sprite->mQueueIdx = (UINT32)-1;
+			entry.sprite->update(entry.desc, entry.groupId);
+		}
+
+		mQueuedTextUpdates.clear();
+
+		const UINT32 numImageUpdates = (UINT32)mQueuedImageUpdates.size();
+		const auto updateImages = [this](UINT32 start, UINT32 end)
+		{
+			for(UINT32 i = start; i < end; i++)
+			{
+				QueuedImageUpdate& entry = mQueuedImageUpdates[i];
+				if(entry.sprite == nullptr)
+					continue;
+
+				entry.sprite->mQueueIdx = (UINT32)-1;
+				entry.sprite->update(entry.desc, entry.groupId);
+			}
+		};
+
+		UINT32 numTasks = 1;
+		if(TaskScheduler::isStarted())
+		{
+			const UINT32 numWorkers = TaskScheduler::instance().getNumWorkers();
+			numTasks = std::min(numWorkers, numImageUpdates / MIN_IMAGE_UPDATES_PER_TASK);
+		}
+
+		if(numTasks > 1)
+		{
+			const UINT32 numUpdatesPerTask = Math::divideAndRoundUp(numImageUpdates, numTasks);
+			const auto worker = [&updateImages, numUpdatesPerTask, numImageUpdates](UINT32 idx)
+			{
+				const UINT32 start = idx * numUpdatesPerTask;
+				const UINT32 end = std::min(start + numUpdatesPerTask, numImageUpdates);
+
+				updateImages(start, end);
+			};
+
+			SPtr<TaskGroup> taskGroup = TaskGroup::create("SpriteUpdate", worker, numTasks);
+			TaskScheduler::instance().addTaskGroup(taskGroup);
+			taskGroup->wait();
+		}
+		else
+			updateImages(0, numImageUpdates);
+
+		mQueuedImageUpdates.clear();
+	}
+
+	void SpriteManager::_cancelUpdate(Sprite& sprite)
+	{
+		const UINT32 idx = sprite.mQueueIdx;
+		if(idx < (UINT32)mQueuedImageUpdates.size() && mQueuedImageUpdates[idx].sprite == &sprite)
+			mQueuedImageUpdates[idx].sprite = nullptr;
+		else if(idx < (UINT32)mQueuedTextUpdates.size() && mQueuedTextUpdates[idx].sprite == &sprite)
+			mQueuedTextUpdates[idx].sprite = nullptr;
+
+		sprite.mQueueIdx = (UINT32)-1;
+	}
 }
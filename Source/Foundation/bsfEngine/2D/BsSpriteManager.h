@@ -5,6 +5,8 @@
 #include "BsPrerequisites.h"
 #include "Utility/BsModule.h"
 #include "2D/BsSpriteMaterial.h"
+#include "2D/BsImageSprite.h"
+#include "2D/BsTextSprite.h"
 
 namespace bs
 {
@@ -12,7 +14,9 @@ namespace bs
 	 *  @{
 	 */
 
-	/** Contains materials used for sprite rendering. */
+	/**
+	 * Contains materials used for sprite rendering, and allows geometry of many sprites to be generated in a single batch.
+	 */
 	class BS_EXPORT SpriteManager : public Module<SpriteManager>
 	{
 		/** Types of sprite materials accessible by default. */
@@ -90,7 +94,62 @@ namespace bs
 			mMaterials[id] = newMaterial;
 			return newMaterial;
 		}
+
+		/**
+		 * Queues the geometry of the provided sprite to be rebuilt during the next call to processQueuedUpdates(). This is
+		 * equivalent to calling ImageSprite::update(), except that the update is deferred so that many sprites can be
+		 * processed together. If an update is already queued for the sprite it is replaced.
+		 *
+		 * @note	Sprite geometry must not be accessed until the queued update is processed.
+		 */
+		void queueUpdate(ImageSprite* sprite, const IMAGE_SPRITE_DESC& desc, UINT64 groupId);
+
+		/** @copydoc queueUpdate(ImageSprite*, const IMAGE_SPRITE_DESC&, UINT64) */
+		void queueUpdate(TextSprite* sprite, const TEXT_SPRITE_DESC& desc, UINT64 groupId);
+
+		/**
+		 * Rebuilds the geometry of all sprites queued with queueUpdate(). Text sprites are updated on the calling thread,
+		 * as font glyph lookup isn't thread safe, while large numbers of image sprites are split between worker threads.
+		 */
+		void processQueuedUpdates();
+
+		/**
+		 * Returns the number of updates queued since the last call to processQueuedUpdates(), including those cancelled
+		 * by sprite destruction.
+		 */
+		UINT32 getNumQueuedUpdates() const { return (UINT32)(mQueuedImageUpdates.size() + mQueuedTextUpdates.size()); }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Removes an update queued with queueUpdate(). Called when the sprite is destroyed. */
+		void _cancelUpdate(Sprite& sprite);
+
+		/** @} */
 	private:
+		/** Information about a queued image sprite update. */
+		struct QueuedImageUpdate
+		{
+			ImageSprite* sprite;
+			IMAGE_SPRITE_DESC desc;
+			UINT64 groupId;
+		};
+
+		/** Information about a queued text sprite update. */
+		struct QueuedTextUpdate
+		{
+			TextSprite* sprite;
+			TEXT_SPRITE_DESC desc;
+			UINT64 groupId;
+		};
+
+		/** Minimum number of image sprites to update on a single worker thread, so the scheduling overhead pays off. */
+		static constexpr UINT32 MIN_IMAGE_UPDATES_PER_TASK = 1024;
+
+		Vector<QueuedImageUpdate> mQueuedImageUpdates;
+		Vector<QueuedTextUpdate> mQueuedTextUpdates;
+
 		UnorderedMap<UINT32, SpriteMaterial*> mMaterials;
 		UINT32 builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Count];
 	};
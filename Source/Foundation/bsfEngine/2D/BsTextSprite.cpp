@@ -5,6 +5,8 @@
 #include "Math/BsVector2.h"
 #include "2D/BsSpriteManager.h"
 #include "String/BsUnicode.h"
+#include "Text/BsFont.h"
+#include "Text/BsFontManager.h"
 
 namespace bs
 {
@@ -15,6 +17,32 @@ namespace bs
 
 	void TextSprite::update(const TEXT_SPRITE_DESC& desc, UINT64 groupId)
 	{
+		// Laying out the text is the expensive part, so avoid it if only the material changed
+		if(isLayoutEqual(desc))
+		{
+			for (auto& cachedElem : mCachedRenderElements)
+			{
+				cachedElem.matInfo.groupId = groupId;
+				cachedElem.matInfo.tint = desc.color;
+			}
+
+			return;
+		}
+
+		mLayout.text = desc.text;
+		mLayout.fontUUID = desc.font.getUUID();
+		mLayout.font = desc.font.isLoaded() ? desc.font.get() : nullptr;
+		mLayout.fontSize = desc.fontSize;
+		mLayout.width = desc.width;
+		mLayout.height = desc.height;
+		mLayout.anchor = desc.anchor;
+		mLayout.horzAlign = desc.horzAlign;
+		mLayout.vertAlign = desc.vertAlign;
+		mLayout.wordWrap = desc.wordWrap;
+		mLayout.wordBreak = desc.wordBreak;
+		mLayoutGlyphEvictionCount = FontManager::isStarted() ? FontManager::instance().getGlyphEvictionCount() : 0;
+		mHasLayout = true;
+
 		bs_frame_mark();
 		{
 			const U32String utf32text = UTF8::toUTF32(desc.text);
@@ -69,6 +97,12 @@ namespace bs
 				genTextQuads(j, textData, desc.width, desc.height, desc.horzAlign, desc.vertAlign, desc.anchor,
 					renderElem.vertices, renderElem.uvs, renderElem.indexes, renderElem.numQuads);
 			}
+
+			SPtr<const FontBitmap> bitmap;
+			if(desc.font.isLoaded())
+				bitmap = desc.font->getBitmap(desc.font->getClosestSize(desc.fontSize));
+
+			pinPages(textData, bitmap);
 		}
 
 		bs_frame_clear();
@@ -196,8 +230,68 @@ namespace bs
 		}
 	}
 
+	bool TextSprite::isLayoutEqual(const TEXT_SPRITE_DESC& desc) const
+	{
+		if(!mHasLayout)
+			return false;
+
+		// Font resource could have been reloaded, or its glyphs moved within a dynamic font atlas
+		const Font* font = desc.font.isLoaded() ? desc.font.get() : nullptr;
+		if(desc.font.getUUID() != mLayout.fontUUID || font != mLayout.font)
+			return false;
+
+		if(FontManager::isStarted() && FontManager::instance().getGlyphEvictionCount() != mLayoutGlyphEvictionCount)
+			return false;
+
+		return desc.width == mLayout.width && desc.height == mLayout.height && desc.anchor == mLayout.anchor &&
+			desc.fontSize == mLayout.fontSize && desc.horzAlign == mLayout.horzAlign &&
+			desc.vertAlign == mLayout.vertAlign && desc.wordWrap == mLayout.wordWrap &&
+			desc.wordBreak == mLayout.wordBreak && desc.text == mLayout.text;
+	}
+
+	void TextSprite::pinPages(const TextDataBase& textData, const SPtr<const FontBitmap>& bitmap)
+	{
+		// Pin the new pages before releasing the old ones, as they are likely to be the same
+		if(bitmap != nullptr)
+		{
+			for(UINT32 i = 0; i < textData.getNumPages(); i++)
+			{
+				if(textData.getNumQuadsForPage(i) > 0)
+					bitmap->_pinPage(i);
+			}
+		}
+
+		unpinPages();
+
+		if(bitmap != nullptr)
+		{
+			for(UINT32 i = 0; i < textData.getNumPages(); i++)
+			{
+				if(textData.getNumQuadsForPage(i) > 0)
+					mPinnedPages.add(i);
+			}
+		}
+
+		mPinnedBitmap = bitmap;
+	}
+
+	void TextSprite::unpinPages()
+	{
+		if(mPinnedBitmap != nullptr)
+		{
+			for(auto& page : mPinnedPages)
+				mPinnedBitmap->_unpinPage(page);
+		}
+
+		mPinnedBitmap = nullptr;
+		mPinnedPages.clear();
+	}
+
 	void TextSprite::clearMesh()
 	{
+		mHasLayout = false;
+		unpinPages();
+
 		for (auto& renderElem : mCachedRenderElements)
 		{
 			if (renderElem.vertices != nullptr)
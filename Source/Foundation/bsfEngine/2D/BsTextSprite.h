@@ -58,7 +58,8 @@ namespace bs
 		~TextSprite();
 
 		/**
-		 * Recreates internal sprite data according the specified description structure.
+		 * Recreates internal sprite data according the specified description structure. If only the color changed since
+		 * the last update the existing geometry is kept.
 		 *
 		 * @param[in]	desc	Describes the geometry and material of the sprite.
 		 * @param[in]	groupId	Group identifier that forces different materials to be used for different groups (for
@@ -134,7 +135,42 @@ namespace bs
 		/**	Clears internal geometry buffers. */
 		void clearMesh();
 
+		/** Checks if the provided description would result in the same geometry as the one the sprite was built with. */
+		bool isLayoutEqual(const TEXT_SPRITE_DESC& desc) const;
+
+		/** Pins the font pages referenced by the sprite geometry, so dynamic fonts don't evict them while in use. */
+		void pinPages(const TextDataBase& textData, const SPtr<const FontBitmap>& bitmap);
+
+		/** Releases pages pinned by pinPages(). */
+		void unpinPages();
+
 		mutable StaticAlloc<STATIC_BUFFER_SIZE> mAlloc;
+
+		/**
+		 * Parameters the current geometry was laid out with. The font is identified by its UUID rather than a handle, so
+		 * the sprite doesn't keep it loaded.
+		 */
+		struct LayoutParams
+		{
+			String text;
+			UUID fontUUID;
+			const Font* font = nullptr; /**< Only compared against, to detect font reloads. Never dereferenced. */
+			UINT32 fontSize = 0;
+			UINT32 width = 0;
+			UINT32 height = 0;
+			SpriteAnchor anchor = SA_TopLeft;
+			TextHorzAlign horzAlign = THA_Left;
+			TextVertAlign vertAlign = TVA_Top;
+			bool wordWrap = false;
+			bool wordBreak = true;
+		};
+
+		LayoutParams mLayout;
+		UINT64 mLayoutGlyphEvictionCount = 0;
+		bool mHasLayout = false;
+
+		SPtr<const FontBitmap> mPinnedBitmap;
+		SmallVector<UINT32, 4> mPinnedPages;
 	};
 
 	/** @} */
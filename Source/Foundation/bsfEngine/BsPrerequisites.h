@@ -193,6 +193,8 @@ namespace bs
 	// 2D
 	class TextSprite;
 	class ImageSprite;
+	struct TEXT_SPRITE_DESC;
+	struct IMAGE_SPRITE_DESC;
 	class SpriteMaterial;
 	struct SpriteMaterialInfo;
 
@@ -63,8 +63,8 @@ namespace bs
 		return ((INT32)mActiveState & (INT32)GUIElementState::OnFlag) != 0;
 	}
 
-	void GUIButtonBase::updateRenderElementsInternal()
-	{		
+	void GUIButtonBase::updateSprites()
+	{
 		mImageDesc.width = mLayoutData.area.width;
 		mImageDesc.height = mLayoutData.area.height;
 
@@ -80,8 +80,8 @@ namespace bs
 		mImageDesc.borderBottom = _getStyle()->border.bottom;
 		mImageDesc.color = getTint();
 
-		mImageSprite->update(mImageDesc, (UINT64)_getParentWidget());
-		mTextSprite->update(getTextDesc(), (UINT64)_getParentWidget());
+		updateSprite(mImageSprite, mImageDesc);
+		updateSprite(mTextSprite, getTextDesc());
 
 		if(mContentImageSprite != nullptr)
 		{
@@ -115,9 +115,12 @@ namespace bs
 			contentImgDesc.color = getTint();
 			contentImgDesc.animationStartTime = mContentAnimationStartTime;
 
-			mContentImageSprite->update(contentImgDesc, (UINT64)_getParentWidget());
+			updateSprite(mContentImageSprite, contentImgDesc);
 		}
+	}
 
+	void GUIButtonBase::updateRenderElementsInternal()
+	{
 		// Populate GUI render elements from the sprites
 		{
 			using T = impl::GUIRenderElementHelper;
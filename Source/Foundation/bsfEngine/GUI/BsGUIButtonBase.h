@@ -73,6 +73,9 @@ namespace bs
 		/** @copydoc GUIElement::updateRenderElementsInternal */
 		void updateRenderElementsInternal() override;
 
+		/** @copydoc GUIElement::updateSprites */
+		void updateSprites() override;
+
 		/** @copydoc GUIElement::_mouseEvent */
 		bool _mouseEvent(const GUIMouseEvent& ev) override;
 
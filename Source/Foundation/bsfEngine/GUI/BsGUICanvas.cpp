@@ -219,6 +219,17 @@ namespace bs
 		mForceTriangleBuild = false;
 	}
 
+	void GUICanvas::updateSprites()
+	{
+		for(auto& element : mElements)
+		{
+			if(element.type == CanvasElementType::Image)
+				buildImageElement(element);
+			else if(element.type == CanvasElementType::Text)
+				buildTextElement(element);
+		}
+	}
+
 	void GUICanvas::updateRenderElementsInternal()
 	{
 		Vector2 offset((float)mLayoutData.area.x, (float)mLayoutData.area.y);
@@ -233,8 +244,6 @@ namespace bs
 			switch(element.type)
 			{
 			case CanvasElementType::Image:
-				buildImageElement(element);
-
 				for(UINT32 i = 0; i < element.imageSprite->getNumRenderElements(); i++)
 				{
 					mRenderElements.add(GUIRenderElement());
@@ -248,8 +257,6 @@ namespace bs
 				
 				break;
 			case CanvasElementType::Text:
-				buildTextElement(element);
-
 				for(UINT32 i = 0; i < element.textSprite->getNumRenderElements(); i++)
 				{
 					mRenderElements.add(GUIRenderElement());
@@ -445,7 +452,7 @@ namespace bs
 		Vector2I destSize(mLayoutData.area.width, mLayoutData.area.height);
 		desc.uvScale = ImageSprite::getTextureUVScale(textureSize, destSize, element.scaleMode);
 
-		element.imageSprite->update(desc, (UINT64)_getParentWidget());
+		updateSprite(element.imageSprite, desc);
 	}
 
 	void GUICanvas::buildTextElement(const CanvasElement& element)
@@ -460,7 +467,7 @@ namespace bs
 		desc.text = textData.string;
 		desc.color = element.color;
 
-		element.textSprite->update(desc, (UINT64)_getParentWidget());
+		updateSprite(element.textSprite, desc);
 	}
 
 	void GUICanvas::buildTriangleElement(const CanvasElement& element, const Vector2& offset, const Rect2I& clipRect) const
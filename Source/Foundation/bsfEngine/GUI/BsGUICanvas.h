@@ -214,10 +214,13 @@ namespace bs
 		/** @copydoc GUIElement::updateRenderElementsInternal */
 		void updateRenderElementsInternal() override;
 
-		/** Build an image sprite from the provided canvas element. */
+		/** @copydoc GUIElement::updateSprites */
+		void updateSprites() override;
+
+		/** Updates the image sprite of the provided canvas element. */
 		void buildImageElement(const CanvasElement& element);
 
-		/** Build a text sprite from the provided canvas element. */
+		/** Updates the text sprite of the provided canvas element. */
 		void buildTextElement(const CanvasElement& element);
 
 		/** Build a set of clipped triangles from the source triangles provided by the canvas element. */
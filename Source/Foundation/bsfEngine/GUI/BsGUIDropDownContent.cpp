@@ -402,12 +402,18 @@ namespace bs
 			yOffset += childData.area.height;
 
 			guiMainElement->_setLayoutData(childData);
+			guiMainElement->_markLayoutAsClean();
 
 			// Shortcut label
 			GUILabel* shortcutLabel = visElem.shortcutLabel;
 			if (shortcutLabel != nullptr)
+			{
 				shortcutLabel->_setLayoutData(childData);
+				shortcutLabel->_markLayoutAsClean();
+			}
 		}
+
+		_markLayoutAsClean();
 	}
 
 	const String& GUIDropDownContent::getGUITypeName()
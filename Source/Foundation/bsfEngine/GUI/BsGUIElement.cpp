@@ -5,6 +5,9 @@
 #include "GUI/BsGUISkin.h"
 #include "GUI/BsGUIManager.h"
 #include "BsGUINavGroup.h"
+#include "2D/BsImageSprite.h"
+#include "2D/BsSpriteManager.h"
+#include "2D/BsTextSprite.h"
 
 namespace bs
 {
@@ -27,9 +30,41 @@ namespace bs
 
 	void GUIElement::_updateRenderElements()
 	{
+		if(!mSpriteUpdatesQueued)
+			updateSprites();
+
+		mSpriteUpdatesQueued = false;
 		updateRenderElementsInternal();
 	}
 
+	void GUIElement::_queueRenderElementUpdates()
+	{
+		if(mSpriteUpdatesQueued)
+			return;
+
+		mQueueingSpriteUpdates = true;
+		updateSprites();
+		mQueueingSpriteUpdates = false;
+
+		mSpriteUpdatesQueued = true;
+	}
+
+	void GUIElement::updateSprite(ImageSprite* sprite, const IMAGE_SPRITE_DESC& desc)
+	{
+		if(mQueueingSpriteUpdates)
+			SpriteManager::instance().queueUpdate(sprite, desc, (UINT64)_getParentWidget());
+		else
+			sprite->update(desc, (UINT64)_getParentWidget());
+	}
+
+	void GUIElement::updateSprite(TextSprite* sprite, const TEXT_SPRITE_DESC& desc)
+	{
+		if(mQueueingSpriteUpdates)
+			SpriteManager::instance().queueUpdate(sprite, desc, (UINT64)_getParentWidget());
+		else
+			sprite->update(desc, (UINT64)_getParentWidget());
+	}
+
 	void GUIElement::updateRenderElementsInternal()
 	{
 		updateClippedBounds();
@@ -101,8 +136,17 @@ namespace bs
 		// Preserve element depth as that is not controlled by layout but is stored
 		// there only for convenience
 		UINT8 elemDepth = _getElementDepth();
+		GUILayoutData oldData = mLayoutData;
+
 		GUIElementBase::_setLayoutData(data);
-		_setElementDepth(elemDepth);
+		mLayoutData.depth = elemDepth | (mLayoutData.depth & 0xFFFFFF00);
+
+		// Only elements whose bounds actually changed need their contents rebuilt. Some elements cache absolute
+		// positions in their contents so a move needs a full rebuild as well.
+		if (mLayoutData.area != oldData.area || mLayoutData.clipRect != oldData.clipRect)
+			_markContentAsDirty();
+		else if (mLayoutData.depth != oldData.depth)
+			_markMeshAsDirty();
 
 		updateClippedBounds();
 	}
@@ -162,10 +162,17 @@ namespace bs
 
 		/**
 		 * Recreates the internal render elements. Must be called before fillBuffer if element is dirty. Marks the element
-		 * as non dirty.
+		 * as non dirty. Sprites are updated immediately, unless their updates were queued by _queueRenderElementUpdates().
 		 */
 		void _updateRenderElements();
 
+		/**
+		 * Queues the sprite geometry updates that _updateRenderElements() depends on with SpriteManager, so they can be
+		 * batched with other elements. GUIManager calls this for all elements with dirty contents and processes the queued
+		 * updates once, before any render elements are updated.
+		 */
+		void _queueRenderElementUpdates();
+
 		/** Gets internal element style representing the exact type of GUI element in this object. */
 		virtual ElementType _getElementType() const { return ElementType::Undefined; }
 
@@ -268,9 +275,24 @@ namespace bs
 		/** @} */
 
 	protected:
-		/**	Called whenever render elements are dirty and need to be rebuilt. */
+		/**	Called whenever render elements are dirty and need to be rebuilt. Sprites are up to date at this point. */
 		virtual void updateRenderElementsInternal();
 
+		/**
+		 * Called whenever render elements are dirty, before updateRenderElementsInternal(). Should build the descriptors
+		 * of all sprites used by the element and pass them to updateSprite().
+		 */
+		virtual void updateSprites() { }
+
+		/**
+		 * Updates the geometry of the provided sprite. If called while the element is queueing its updates the update is
+		 * instead queued with SpriteManager, and performed in a batch with other elements.
+		 */
+		void updateSprite(ImageSprite* sprite, const IMAGE_SPRITE_DESC& desc);
+
+		/** @copydoc updateSprite(ImageSprite*, const IMAGE_SPRITE_DESC&) */
+		void updateSprite(TextSprite* sprite, const TEXT_SPRITE_DESC& desc);
+
 		/**
 		 * Called whenever element clipped bounds need to be recalculated. (for example when width, height or clip 
 		 * rectangles changes).
@@ -320,6 +342,9 @@ namespace bs
 		SmallVector<GUIRenderElement, 4> mRenderElements;
 		
 	private:
+		bool mQueueingSpriteUpdates = false;
+		bool mSpriteUpdatesQueued = false;
+
 		static const Color DISABLED_COLOR;
 
 		const GUIElementStyle* mStyle;
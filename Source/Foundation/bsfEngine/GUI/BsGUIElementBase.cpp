@@ -205,8 +205,23 @@ namespace bs
 		mFlags &= ~GUIElem_Dirty;
 	}
 
+	void GUIElementBase::_markLayoutAsClean()
+	{
+		mFlags &= ~GUIElem_LayoutDirty;
+	}
+
 	void GUIElementBase::_markLayoutAsDirty()
 	{
+		// Invalidate cached layouts all the way to the root, so the next layout pass reaches this element even if layout
+		// data of the parents doesn't change. Note we can't stop at the first dirty parent, as layout containers that
+		// skip some of their children (e.g. virtualized layouts) can be clean while their children are not.
+		GUIElementBase* currentElement = this;
+		while(currentElement != nullptr)
+		{
+			currentElement->mFlags |= GUIElem_LayoutDirty;
+			currentElement = currentElement->mParentElement;
+		}
+
 		if(!_isVisible())
 			return;
 
@@ -214,6 +229,10 @@ namespace bs
 			mUpdateParent->mFlags |= GUIElem_Dirty;
 		else
 			mFlags |= GUIElem_Dirty;
+
+		// Layout updates only refresh contents of elements whose layout data changed, so make sure this one is updated
+		// even if its bounds end up the same
+		_markContentAsDirty();
 	}
 
 	void GUIElementBase::_markContentAsDirty()
@@ -407,7 +426,9 @@ namespace bs
 	{
 		for(auto& child : mChildren)
 		{
-			child->_updateOptimalLayoutSizes();
+			// Size ranges of clean children are still valid from the last update
+			if(child->_isLayoutDirty())
+				child->_updateOptimalLayoutSizes();
 		}
 	}
 
@@ -417,6 +438,14 @@ namespace bs
 		{
 			child->_updateLayoutInternal(data);
 		}
+
+		_markLayoutAsClean();
+	}
+
+	void GUIElementBase::markLayoutCached(const GUILayoutData& data)
+	{
+		mCachedLayoutData = data;
+		mFlags &= ~(GUIElem_LayoutDirty | GUIElem_Dirty);
 	}
 
 	LayoutSizeRange GUIElementBase::_calculateLayoutSizeRange() const
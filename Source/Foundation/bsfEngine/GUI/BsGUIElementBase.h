@@ -39,7 +39,8 @@ namespace bs
 			GUIElem_HiddenSelf = 0x08,
 			GUIElem_InactiveSelf = 0x10,
 			GUIElem_Disabled = 0x20,
-			GUIElem_DisabledSelf = 0x40
+			GUIElem_DisabledSelf = 0x40,
+			GUIElem_LayoutDirty = 0x80
 		};
 
 	public:
@@ -276,7 +277,10 @@ namespace bs
 		/**	Checks if element has been destroyed and is queued for deletion. */
 		virtual bool _isDestroyed() const { return false; }
 
-		/**	Marks the element's dimensions as dirty, triggering a layout rebuild. */
+		/**
+		 * Marks the element's dimensions as dirty, triggering a layout rebuild. Element contents are marked as dirty as
+		 * well.
+		 */
 		void _markLayoutAsDirty();
 
 		/**	Marks the element's contents as dirty, which causes the sprite meshes to be recreated from scratch. */
@@ -292,9 +296,21 @@ namespace bs
 		/**	Returns true if elements contents have changed since last update. */
 		bool _isDirty() const { return (mFlags & GUIElem_Dirty) != 0; }
 
+		/**
+		 * Returns true if the layout of this element or any of its children was marked as dirty since it was last
+		 * calculated. Elements whose layout isn't dirty can re-use their cached size ranges and layout results.
+		 */
+		bool _isLayoutDirty() const { return (mFlags & GUIElem_LayoutDirty) != 0; }
+
 		/**	Marks the element contents to be up to date (meaning it's processed by the GUI system). */
 		void _markAsClean();
 
+		/**
+		 * Marks the layout of the element as up to date. Should only be called once the layout of the element and all of
+		 * its children was calculated.
+		 */
+		void _markLayoutAsClean();
+
 		/** @} */
 
 	protected:
@@ -328,16 +344,32 @@ namespace bs
 		/** Unregisters and destroys all child elements. */
 		void destroyChildElements();
 
+		/**
+		 * Checks if the layout of the child elements was already calculated for the provided layout data, in which case
+		 * the layout update can be skipped.
+		 */
+		bool isLayoutCached(const GUILayoutData& data) const
+		{
+			return (mFlags & GUIElem_LayoutDirty) == 0 && mCachedLayoutData == data;
+		}
+
+		/**
+		 * Records the layout data the child element layout was calculated for, and marks the element as clean. Should be
+		 * called at the end of _updateLayoutInternal().
+		 */
+		void markLayoutCached(const GUILayoutData& data);
+
 		GUIWidget* mParentWidget = nullptr;
 		GUIPanel* mAnchorParent = nullptr;
 		GUIElementBase* mUpdateParent = nullptr;
 		GUIElementBase* mParentElement = nullptr;
 
 		Vector<GUIElementBase*> mChildren;
-		UINT8 mFlags = GUIElem_Dirty;
+		UINT8 mFlags = GUIElem_Dirty | GUIElem_LayoutDirty;
 
 		GUIDimensions mDimensions;
 		GUILayoutData mLayoutData;
+		GUILayoutData mCachedLayoutData;
 	};
 
 	/** @} */
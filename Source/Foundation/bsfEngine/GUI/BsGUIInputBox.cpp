@@ -103,8 +103,8 @@ namespace bs
 		}
 	}
 
-	void GUIInputBox::updateRenderElementsInternal()
-	{		
+	void GUIInputBox::updateSprites()
+	{
 		mImageDesc.width = mLayoutData.area.width;
 		mImageDesc.height = mLayoutData.area.height;
 		mImageDesc.borderLeft = _getStyle()->border.left;
@@ -117,10 +117,15 @@ namespace bs
 		if(SpriteTexture::checkIsLoaded(activeTex))
 			mImageDesc.texture = activeTex;
 
-		mImageSprite->update(mImageDesc, (UINT64)_getParentWidget());
+		updateSprite(mImageSprite, mImageDesc);
+		updateSprite(mTextSprite, getTextDesc());
+	}
 
-		TEXT_SPRITE_DESC textDesc = getTextDesc();
-		mTextSprite->update(textDesc, (UINT64)_getParentWidget());
+	void GUIInputBox::updateRenderElementsInternal()
+	{
+		// Caret and selection sprites are shared between all input boxes, and only shown for the focused one, so they
+		// are updated here rather than queued
+		const TEXT_SPRITE_DESC textDesc = getTextDesc();
 
 		ImageSprite* caretSprite = nullptr;
 		if(mCaretShown && gGUIManager().getCaretBlinkState())
@@ -28,8 +28,8 @@ namespace bs
 		return 2;
 	}
 
-	void GUILabel::updateRenderElementsInternal()
-	{		
+	void GUILabel::updateSprites()
+	{
 		const HSpriteTexture& activeTex = _getStyle()->normal.texture;
 		if (SpriteTexture::checkIsLoaded(activeTex))
 		{
@@ -60,7 +60,7 @@ namespace bs
 			mImageDesc.borderBottom = _getStyle()->border.bottom;
 			mImageDesc.color = getTint();
 
-			mImageSprite->update(mImageDesc, (UINT64)_getParentWidget());
+			updateSprite(mImageSprite, mImageDesc);
 		}
 
 		mDesc.font = _getStyle()->font;
@@ -73,8 +73,11 @@ namespace bs
 		mDesc.text = mContent.text;
 		mDesc.color = getTint() * _getStyle()->normal.textColor;;
 
-		mTextSprite->update(mDesc, (UINT64)_getParentWidget());
+		updateSprite(mTextSprite, mDesc);
+	}
 
+	void GUILabel::updateRenderElementsInternal()
+	{
 		// Populate GUI render elements from the sprites
 		{
 			using T = impl::GUIRenderElementHelper;
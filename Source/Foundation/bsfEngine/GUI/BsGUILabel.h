@@ -89,6 +89,9 @@ namespace bs
 		/** @copydoc GUIElement::updateRenderElementsInternal */
 		void updateRenderElementsInternal() override;
 
+		/** @copydoc GUIElement::updateSprites */
+		void updateSprites() override;
+
 	private:
 		GUILabel(const String& styleName, const GUIContent& content, const GUIDimensions& dimensions);
 
@@ -75,6 +75,30 @@ namespace bs
 		_markLayoutAsDirty();
 	}
 
+	void GUILayout::_setVirtualized(bool virtualized)
+	{
+		if (mVirtualized == virtualized)
+			return;
+
+		mVirtualized = virtualized;
+		_markLayoutAsDirty();
+	}
+
+	void GUILayout::updateChildLayout(GUIElementBase* child, const GUILayoutData& data)
+	{
+		if (mVirtualized && (data.clipRect.width == 0 || data.clipRect.height == 0))
+		{
+			// Child was fully clipped during the last update as well, so its (and its children's) clip rectangles are
+			// already empty and nothing it contains can be visible. Its layout will get updated once it's scrolled into view.
+			const Rect2I& lastClipRect = child->_getLayoutData().clipRect;
+			if (lastClipRect.width == 0 || lastClipRect.height == 0)
+				return;
+		}
+
+		child->_setLayoutData(data);
+		child->_updateLayoutInternal(data);
+	}
+
 	const RectOffset& GUILayout::_getPadding() const
 	{
 		static RectOffset padding;
@@ -88,11 +88,30 @@ namespace bs
 		/** @copydoc GUIElementBase::_getType */
 		Type _getType() const override { return GUIElementBase::Type::Layout; }
 
+		/**
+		 * Enables or disables virtualization. Virtualized layouts don't update the layout of child elements that are
+		 * completely outside of the clip rectangle, meaning bounds of such elements might be out of date. This is meant to
+		 * be used for layouts with a large number of children, only a few of which are visible at once (e.g. contents of
+		 * a scroll area).
+		 */
+		void _setVirtualized(bool virtualized);
+
+		/** Checks is the layout virtualized. See _setVirtualized(). */
+		bool _isVirtualized() const { return mVirtualized; }
+
 		/** @} */
 
 	protected:
+		/**
+		 * Assigns the provided layout data to a child element and updates its layout. If the layout is virtualized,
+		 * children that are outside of the clip rectangle, and were already outside of it during the last update, are
+		 * skipped.
+		 */
+		void updateChildLayout(GUIElementBase* child, const GUILayoutData& data);
+
 		Vector<LayoutSizeRange> mChildSizeRanges;
 		LayoutSizeRange mSizeRange;
+		bool mVirtualized = false;
 	};
 
 	/** @} */
@@ -60,6 +60,17 @@ namespace bs
 			return localClipRect;
 		}
 
+		bool operator== (const GUILayoutData& rhs) const
+		{
+			return area == rhs.area && clipRect == rhs.clipRect && depth == rhs.depth &&
+				depthRangeMin == rhs.depthRangeMin && depthRangeMax == rhs.depthRangeMax;
+		}
+
+		bool operator!= (const GUILayoutData& rhs) const
+		{
+			return !(*this == rhs);
+		}
+
 		Rect2I area;
 		Rect2I clipRect;
 		UINT32 depth = 0;
@@ -46,6 +46,10 @@ namespace bs
 
 	void GUILayoutX::_updateOptimalLayoutSizes()
 	{
+		// Cached size ranges are still valid if nothing in this layout changed
+		if (!_isLayoutDirty())
+			return;
+
 		// Update all children first, otherwise we can't determine our own optimal size
 		GUIElementBase::_updateOptimalLayoutSizes();
 
@@ -393,6 +397,9 @@ namespace bs
 
 	void GUILayoutX::_updateLayoutInternal(const GUILayoutData& data)
 	{
+		if (isLayoutCached(data))
+			return;
+
 		UINT32 numElements = (UINT32)mChildren.size();
 		Rect2I* elementAreas = nullptr;
 
@@ -413,8 +420,7 @@ namespace bs
 				childData.clipRect = childData.area;
 				childData.clipRect.clip(data.clipRect);
 
-				child->_setLayoutData(childData);
-				child->_updateLayoutInternal(childData);
+				updateChildLayout(child, childData);
 			}
 
 			childIdx++;
@@ -422,6 +428,8 @@ namespace bs
 
 		if(elementAreas != nullptr)
 			bs_stack_free(elementAreas);
+
+		markLayoutCached(data);
 	}
 
 	GUILayoutX* GUILayoutX::create()
@@ -46,6 +46,10 @@ namespace bs
 
 	void GUILayoutY::_updateOptimalLayoutSizes()
 	{
+		// Cached size ranges are still valid if nothing in this layout changed
+		if (!_isLayoutDirty())
+			return;
+
 		// Update all children first, otherwise we can't determine our own optimal size
 		GUIElementBase::_updateOptimalLayoutSizes();
 
@@ -394,6 +398,9 @@ namespace bs
 
 	void GUILayoutY::_updateLayoutInternal(const GUILayoutData& data)
 	{
+		if (isLayoutCached(data))
+			return;
+
 		UINT32 numElements = (UINT32)mChildren.size();
 		Rect2I* elementAreas = nullptr;
 		
@@ -414,8 +421,7 @@ namespace bs
 				childData.clipRect = childData.area;
 				childData.clipRect.clip(data.clipRect);
 
-				child->_setLayoutData(childData);
-				child->_updateLayoutInternal(childData);
+				updateChildLayout(child, childData);
 			}
 
 			childIdx++;
@@ -423,6 +429,8 @@ namespace bs
 
 		if (elementAreas != nullptr)
 			bs_stack_free(elementAreas);
+
+		markLayoutCached(data);
 	}
 
 	GUILayoutY* GUILayoutY::create()
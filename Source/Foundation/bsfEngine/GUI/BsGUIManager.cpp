@@ -5,10 +5,14 @@
 #include "GUI/BsGUIElement.h"
 #include "Image/BsSpriteTexture.h"
 #include "Utility/BsTime.h"
+#include "Allocators/BsMemoryTracker.h"
 #include "Scene/BsSceneObject.h"
 #include "Material/BsMaterial.h"
 #include "Mesh/BsMeshData.h"
 #include "RenderAPI/BsVertexDataDesc.h"
+#include "RenderAPI/BsVertexData.h"
+#include "RenderAPI/BsVertexBuffer.h"
+#include "RenderAPI/BsIndexBuffer.h"
 #include "Mesh/BsMesh.h"
 #include "Managers/BsRenderWindowManager.h"
 #include "Platform/BsPlatform.h"
@@ -37,6 +41,8 @@
 #include "RenderAPI/BsSamplerState.h"
 #include "Managers/BsRenderStateManager.h"
 #include "Resources/BsBuiltinResources.h"
+#include "Text/BsFontManager.h"
+#include "2D/BsSpriteManager.h"
 
 using namespace std::placeholders;
 
@@ -51,8 +57,13 @@ namespace bs
 			:element(_element), renderElement(_renderElement)
 		{ }
 
+		GUIGroupElement(GUIElement* _element, UINT32 _renderElement, const Rect2I& _bounds)
+			:element(_element), renderElement(_renderElement), bounds(_bounds)
+		{ }
+
 		GUIElement* element;
 		UINT32 renderElement;
+		Rect2I bounds;
 	};
 
 	struct GUIMaterialGroup
@@ -68,6 +79,142 @@ namespace bs
 		Vector<GUIGroupElement> elements;
 	};
 
+	/** Checks if the @p inner rectangle is fully contained within the @p outer rectangle. */
+	static bool containsRect(const Rect2I& outer, const Rect2I& inner)
+	{
+		return inner.x >= outer.x && inner.y >= outer.y &&
+			(INT64)inner.x + inner.width <= (INT64)outer.x + outer.width &&
+			(INT64)inner.y + inner.height <= (INT64)outer.y + outer.height;
+	}
+
+	/** Creates a new mesh data object with the same contents as the provided one. */
+	static SPtr<MeshData> copyMeshData(const SPtr<MeshData>& meshData)
+	{
+		SPtr<MeshData> copy = MeshData::create(meshData->getNumVertices(), meshData->getNumIndices(),
+			meshData->getVertexDesc());
+		memcpy(copy->getData(), meshData->getData(), meshData->getSize());
+
+		return copy;
+	}
+
+	/** Range of vertices and indices of a GUI mesh that was modified since the last upload. */
+	struct GUIMeshRange
+	{
+		UINT32 vertexOffset;
+		UINT32 numVertices;
+		UINT32 indexOffset;
+		UINT32 numIndices;
+	};
+
+	/** Copy of the modified ranges of a GUI mesh, to be written into the mesh buffers on the core thread. */
+	struct GUIMeshUpload
+	{
+		Vector<GUIMeshRange> ranges;
+		Vector<UINT8> vertices;
+		Vector<UINT8> indices;
+	};
+
+	/** Maximum number of separate buffer writes per mesh upload. Past that the ranges get uploaded as a single span. */
+	static constexpr UINT32 MAX_MESH_UPLOAD_RANGES = 32;
+
+	/**
+	 * Uploads the provided ranges of @p meshData into the same ranges of the GPU buffers of @p mesh, leaving the rest of
+	 * the buffers as is. GUI meshes only use a single vertex stream.
+	 */
+	static void uploadMeshRanges(const SPtr<Mesh>& mesh, const SPtr<MeshData>& meshData, FrameVector<GUIMeshRange>& ranges)
+	{
+		if(ranges.empty())
+			return;
+
+		// Vertices and indices of mesh elements are laid out in the same order, so sorting by one sorts by both
+		std::sort(ranges.begin(), ranges.end(), [](const GUIMeshRange& a, const GUIMeshRange& b)
+			{ return a.vertexOffset < b.vertexOffset; });
+
+		SPtr<GUIMeshUpload> upload = bs_shared_ptr_new<GUIMeshUpload>();
+		for(auto& range : ranges)
+		{
+			if(!upload->ranges.empty())
+			{
+				GUIMeshRange& prevRange = upload->ranges.back();
+				if(prevRange.vertexOffset + prevRange.numVertices == range.vertexOffset &&
+					prevRange.indexOffset + prevRange.numIndices == range.indexOffset)
+				{
+					prevRange.numVertices += range.numVertices;
+					prevRange.numIndices += range.numIndices;
+					continue;
+				}
+			}
+
+			upload->ranges.push_back(range);
+		}
+
+		// Many small writes cost more than re-uploading the unmodified data in between them
+		if(upload->ranges.size() > MAX_MESH_UPLOAD_RANGES)
+		{
+			const GUIMeshRange& first = upload->ranges.front();
+			const GUIMeshRange& last = upload->ranges.back();
+
+			GUIMeshRange span;
+			span.vertexOffset = first.vertexOffset;
+			span.numVertices = last.vertexOffset + last.numVertices - first.vertexOffset;
+			span.indexOffset = first.indexOffset;
+			span.numIndices = last.indexOffset + last.numIndices - first.indexOffset;
+
+			upload->ranges.clear();
+			upload->ranges.push_back(span);
+		}
+
+		const UINT32 vertexStride = meshData->getVertexDesc()->getVertexStride(0);
+		const UINT32 indexSize = meshData->getIndexElementSize();
+
+		UINT32 numVertices = 0;
+		UINT32 numIndices = 0;
+		for(auto& range : upload->ranges)
+		{
+			numVertices += range.numVertices;
+			numIndices += range.numIndices;
+		}
+
+		upload->vertices.resize(numVertices * vertexStride);
+		upload->indices.resize(numIndices * indexSize);
+
+		UINT8* vertexDst = upload->vertices.data();
+		UINT8* indexDst = upload->indices.data();
+		for(auto& range : upload->ranges)
+		{
+			memcpy(vertexDst, meshData->getStreamData(0) + range.vertexOffset * vertexStride,
+				range.numVertices * vertexStride);
+			memcpy(indexDst, meshData->getIndexData() + range.indexOffset * indexSize, range.numIndices * indexSize);
+
+			vertexDst += range.numVertices * vertexStride;
+			indexDst += range.numIndices * indexSize;
+		}
+
+		SPtr<ct::Mesh> meshCore = mesh->getCore();
+		gCoreThread().queueCommand([meshCore, upload, vertexStride, indexSize]()
+		{
+			SPtr<ct::VertexBuffer> vertexBuffer = meshCore->getVertexData()->getBuffer(0);
+			SPtr<ct::IndexBuffer> indexBuffer = meshCore->getIndexBuffer();
+
+			const UINT8* vertexSrc = upload->vertices.data();
+			const UINT8* indexSrc = upload->indices.data();
+			for(auto& range : upload->ranges)
+			{
+				if(range.numVertices > 0)
+				{
+					vertexBuffer->writeData(range.vertexOffset * vertexStride, range.numVertices * vertexStride,
+						vertexSrc);
+				}
+
+				if(range.numIndices > 0)
+					indexBuffer->writeData(range.indexOffset * indexSize, range.numIndices * indexSize, indexSrc);
+
+				vertexSrc += range.numVertices * vertexStride;
+				indexSrc += range.numIndices * indexSize;
+			}
+		});
+	}
+
 	const UINT32 GUIManager::DRAG_DISTANCE = 3;
 	const float GUIManager::TOOLTIP_HOVER_TIME = 1.0f;
 
@@ -226,6 +373,8 @@ namespace bs
 
 	void GUIManager::update()
 	{
+		MemoryTagScope memoryTag(MemoryTag::GUI);
+
 		DragAndDropManager::instance()._update();
 
 		// Show tooltip if needed
@@ -256,6 +405,20 @@ namespace bs
 			}
 		}
 
+		// Pages referenced by existing text are never evicted, but text laid out while an atlas was full uses the missing
+		// glyph for characters that didn't fit, so rebuild it once space was made
+		const UINT64 glyphEvictionCount = FontManager::instance().getGlyphEvictionCount();
+		if(glyphEvictionCount != mGlyphEvictionCount)
+		{
+			for(auto& widgetInfo : mWidgets)
+			{
+				for(auto& element : widgetInfo.widget->getElements())
+					element->_markContentAsDirty();
+			}
+
+			mGlyphEvictionCount = glyphEvictionCount;
+		}
+
 		// Update layouts
 		gProfilerCPU().beginSample("UpdateLayout");
 		for(auto& widgetInfo : mWidgets)
@@ -469,288 +632,491 @@ namespace bs
 
 	void GUIManager::updateMeshes()
 	{
+		// Sprite geometry of all dirty elements is built in a single batch, before any of the render elements are updated
+		for(auto& cachedMeshData : mCachedGUIData)
+		{
+			for(auto& widget : cachedMeshData.second.widgets)
+				widget->_queueRenderElementUpdates();
+		}
+
+		SpriteManager::instance().processQueuedUpdates();
+
 		for(auto& cachedMeshData : mCachedGUIData)
 		{
 			GUIRenderData& renderData = cachedMeshData.second;
 
 			// Check if anything is dirty. If nothing is we can skip the update
 			bool isDirty = renderData.isDirty;
+			bool rebuild = renderData.isDirty;
 			renderData.isDirty = false;
 
-			for(auto& widget : renderData.widgets)
+			bs_frame_mark();
 			{
-				if (widget->isDirty(true))
+				FrameVector<GUIElement*> dirtyElements;
+				for(auto& widget : renderData.widgets)
 				{
-					isDirty = true;
+					if (widget->isDirty(true))
+					{
+						isDirty = true;
+
+						bool rebuildWidget;
+						const Set<GUIElement*>& dirtyMeshes = widget->_getMeshUpdates(rebuildWidget);
+
+						rebuild |= rebuildWidget;
+						if(!rebuild)
+							dirtyElements.insert(dirtyElements.end(), dirtyMeshes.begin(), dirtyMeshes.end());
+
+						widget->_clearMeshUpdates();
+					}
 				}
-			}
 
-			if(!isDirty)
-				continue;
+				if(isDirty)
+				{
+					mCoreDirty = true;
 
-			mCoreDirty = true;
+					if(rebuild || !updateMeshesInPlace(renderData, dirtyElements))
+					{
+						rebuildMeshes(renderData);
+						mNumMeshRebuilds++;
+					}
+					else
+						mNumInPlaceMeshUpdates++;
+				}
+			}
+			bs_frame_clear();
+		}
+	}
 
-			bs_frame_mark();
+	void GUIManager::rebuildMeshes(GUIRenderData& renderData)
+	{
+		bs_frame_mark();
+		{
+			// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
+			auto elemComp = [](const GUIGroupElement& a, const GUIGroupElement& b)
 			{
-				// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
-				auto elemComp = [](const GUIGroupElement& a, const GUIGroupElement& b)
-				{
-					UINT32 aDepth = a.element->_getDepth() + a.element->getRenderElements()[a.renderElement].depth;
-					UINT32 bDepth = b.element->_getDepth() + b.element->getRenderElements()[b.renderElement].depth;
+				UINT32 aDepth = a.element->_getDepth() + a.element->getRenderElements()[a.renderElement].depth;
+				UINT32 bDepth = b.element->_getDepth() + b.element->getRenderElements()[b.renderElement].depth;
 
-					// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
-					// requires all elements to be unique
-					return (aDepth > bDepth) ||
-						(aDepth == bDepth && a.element > b.element) ||
-						(aDepth == bDepth && a.element == b.element && a.renderElement > b.renderElement);
-				};
+				// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
+				// requires all elements to be unique
+				return (aDepth > bDepth) ||
+					(aDepth == bDepth && a.element > b.element) ||
+					(aDepth == bDepth && a.element == b.element && a.renderElement > b.renderElement);
+			};
 
-				FrameSet<GUIGroupElement, std::function<bool(const GUIGroupElement&, const GUIGroupElement&)>> allElements(elemComp);
+			FrameSet<GUIGroupElement, std::function<bool(const GUIGroupElement&, const GUIGroupElement&)>> allElements(elemComp);
 
-				for (auto& widget : renderData.widgets)
+			for (auto& widget : renderData.widgets)
+			{
+				const Vector<GUIElement*>& elements = widget->getElements();
+
+				for (auto& element : elements)
 				{
-					const Vector<GUIElement*>& elements = widget->getElements();
+					if (!element->_isVisible())
+						continue;
 
-					for (auto& element : elements)
+					UINT32 numRenderElems = element->getRenderElements().size();
+					for (UINT32 i = 0; i < numRenderElems; i++)
 					{
-						if (!element->_isVisible())
-							continue;
-
-						UINT32 numRenderElems = element->getRenderElements().size();
-						for (UINT32 i = 0; i < numRenderElems; i++)
-						{
-							allElements.insert(GUIGroupElement(element, i));
-						}
+						allElements.insert(GUIGroupElement(element, i));
 					}
 				}
+			}
 
-				// Group the elements in such a way so that we end up with a smallest amount of
-				// meshes, without breaking back to front rendering order
-				FrameUnorderedMap<UINT64, FrameVector<GUIMaterialGroup>> materialGroups;
-				for (auto& elem : allElements)
+			// Group the elements in such a way so that we end up with a smallest amount of
+			// meshes, without breaking back to front rendering order
+			FrameUnorderedMap<UINT64, FrameVector<GUIMaterialGroup>> materialGroups;
+			for (auto& elem : allElements)
+			{
+				GUIElement* guiElem = elem.element;
+				UINT32 renderElemIdx = elem.renderElement;
+				const GUIRenderElement& renderElem = guiElem->getRenderElements()[renderElemIdx];
+				
+				UINT32 elemDepth = guiElem->_getDepth() + renderElem.depth;
+
+				Rect2I tfrmedBounds = guiElem->_getClippedBounds();
+				tfrmedBounds.transform(guiElem->_getParentWidget()->getWorldTfrm());
+
+				SpriteMaterial* spriteMaterial = renderElem.material;
+				const SpriteMaterialInfo& matInfo = *renderElem.matInfo;
+				assert(spriteMaterial != nullptr);
+
+				UINT64 hash = spriteMaterial->getMergeHash(matInfo);
+				FrameVector<GUIMaterialGroup>& groupsPerMaterial = materialGroups[hash];
+				
+				// Try to find a group this material will fit in:
+				//  - Group that has a depth value same or one below elements depth will always be a match
+				//  - Otherwise, we search higher depth values as well, but we only use them if no elements in between those depth values
+				//    overlap the current elements bounds.
+				GUIMaterialGroup* foundGroup = nullptr;
+
+				if(spriteMaterial->allowBatching())
 				{
-					GUIElement* guiElem = elem.element;
-					UINT32 renderElemIdx = elem.renderElement;
-					const GUIRenderElement& renderElem = guiElem->getRenderElements()[renderElemIdx];
-					
-					UINT32 elemDepth = guiElem->_getDepth() + renderElem.depth;
-
-					Rect2I tfrmedBounds = guiElem->_getClippedBounds();
-					tfrmedBounds.transform(guiElem->_getParentWidget()->getWorldTfrm());
-
-					SpriteMaterial* spriteMaterial = renderElem.material;
-					const SpriteMaterialInfo& matInfo = *renderElem.matInfo;
-					assert(spriteMaterial != nullptr);
-
-					UINT64 hash = spriteMaterial->getMergeHash(matInfo);
-					FrameVector<GUIMaterialGroup>& groupsPerMaterial = materialGroups[hash];
-					
-					// Try to find a group this material will fit in:
-					//  - Group that has a depth value same or one below elements depth will always be a match
-					//  - Otherwise, we search higher depth values as well, but we only use them if no elements in between those depth values
-					//    overlap the current elements bounds.
-					GUIMaterialGroup* foundGroup = nullptr;
-
-					if(spriteMaterial->allowBatching())
+					for (auto groupIter = groupsPerMaterial.rbegin(); groupIter != groupsPerMaterial.rend(); ++groupIter)
 					{
-						for (auto groupIter = groupsPerMaterial.rbegin(); groupIter != groupsPerMaterial.rend(); ++groupIter)
+						// If we separate meshes by widget, ignore any groups with widget parents other than mine
+						if (mSeparateMeshesByWidget)
 						{
-							// If we separate meshes by widget, ignore any groups with widget parents other than mine
-							if (mSeparateMeshesByWidget)
+							if (groupIter->elements.size() > 0)
 							{
-								if (groupIter->elements.size() > 0)
-								{
-									GUIElement* otherElem = groupIter->elements.begin()->element; // We only need to check the first element
-									if (otherElem->_getParentWidget() != guiElem->_getParentWidget())
-										continue;
-								}
+								GUIElement* otherElem = groupIter->elements.begin()->element; // We only need to check the first element
+								if (otherElem->_getParentWidget() != guiElem->_getParentWidget())
+									continue;
 							}
+						}
 
-							GUIMaterialGroup& group = *groupIter;
-							if (group.depth == elemDepth)
-							{
-								foundGroup = &group;
-								break;
-							}
-							else
-							{
-								UINT32 startDepth = elemDepth;
-								UINT32 endDepth = group.depth;
+						GUIMaterialGroup& group = *groupIter;
+						if (group.depth == elemDepth)
+						{
+							foundGroup = &group;
+							break;
+						}
+						else
+						{
+							UINT32 startDepth = elemDepth;
+							UINT32 endDepth = group.depth;
 
-								Rect2I potentialGroupBounds = group.bounds;
-								potentialGroupBounds.encapsulate(tfrmedBounds);
+							Rect2I potentialGroupBounds = group.bounds;
+							potentialGroupBounds.encapsulate(tfrmedBounds);
 
-								bool foundOverlap = false;
-								for (auto& material : materialGroups)
+							bool foundOverlap = false;
+							for (auto& material : materialGroups)
+							{
+								for (auto& matGroup : material.second)
 								{
-									for (auto& matGroup : material.second)
-									{
-										if (&matGroup == &group)
-											continue;
+									if (&matGroup == &group)
+										continue;
 
-										if ((matGroup.minDepth >= startDepth && matGroup.minDepth <= endDepth)
-											|| (matGroup.depth >= startDepth && matGroup.depth <= endDepth))
+									if ((matGroup.minDepth >= startDepth && matGroup.minDepth <= endDepth)
+										|| (matGroup.depth >= startDepth && matGroup.depth <= endDepth))
+									{
+										if (matGroup.bounds.overlaps(potentialGroupBounds))
 										{
-											if (matGroup.bounds.overlaps(potentialGroupBounds))
-											{
-												foundOverlap = true;
-												break;
-											}
+											foundOverlap = true;
+											break;
 										}
 									}
 								}
+							}
 
-								if (!foundOverlap)
-								{
-									foundGroup = &group;
-									break;
-								}
+							if (!foundOverlap)
+							{
+								foundGroup = &group;
+								break;
 							}
 						}
 					}
+				}
 
-					if (foundGroup == nullptr)
-					{
-						groupsPerMaterial.push_back(GUIMaterialGroup());
-						foundGroup = &groupsPerMaterial[groupsPerMaterial.size() - 1];
-
-						foundGroup->depth = elemDepth;
-						foundGroup->minDepth = elemDepth;
-						foundGroup->bounds = tfrmedBounds;
-						foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx));
-						foundGroup->matInfo = matInfo.clone();
-						foundGroup->material = spriteMaterial;
-						foundGroup->numVertices = renderElem.numVertices;
-						foundGroup->numIndices = renderElem.numIndices;
-						foundGroup->meshType = renderElem.type;
-					}
-					else
-					{
-						foundGroup->bounds.encapsulate(tfrmedBounds);
-						foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx));
-						foundGroup->minDepth = std::min(foundGroup->minDepth, elemDepth);
+				if (foundGroup == nullptr)
+				{
+					groupsPerMaterial.push_back(GUIMaterialGroup());
+					foundGroup = &groupsPerMaterial[groupsPerMaterial.size() - 1];
+
+					foundGroup->depth = elemDepth;
+					foundGroup->minDepth = elemDepth;
+					foundGroup->bounds = tfrmedBounds;
+					foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx, tfrmedBounds));
+					foundGroup->matInfo = matInfo.clone();
+					foundGroup->material = spriteMaterial;
+					foundGroup->numVertices = renderElem.numVertices;
+					foundGroup->numIndices = renderElem.numIndices;
+					foundGroup->meshType = renderElem.type;
+				}
+				else
+				{
+					foundGroup->bounds.encapsulate(tfrmedBounds);
+					foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx, tfrmedBounds));
+					foundGroup->minDepth = std::min(foundGroup->minDepth, elemDepth);
 
-						// It's expected that GUI element doesn't use same material for different mesh types so this should always be true
-						assert(renderElem.type == foundGroup->meshType); 
+					// It's expected that GUI element doesn't use same material for different mesh types so this should always be true
+					assert(renderElem.type == foundGroup->meshType); 
 
-						foundGroup->numVertices += renderElem.numVertices;
-						foundGroup->numIndices += renderElem.numIndices;
+					foundGroup->numVertices += renderElem.numVertices;
+					foundGroup->numIndices += renderElem.numIndices;
 
-						spriteMaterial->merge(foundGroup->matInfo, matInfo);
-					}
+					spriteMaterial->merge(foundGroup->matInfo, matInfo);
 				}
+			}
 
-				// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
-				auto groupComp = [](GUIMaterialGroup* a, GUIMaterialGroup* b)
+			// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
+			auto groupComp = [](GUIMaterialGroup* a, GUIMaterialGroup* b)
+			{
+				return (a->depth > b->depth) || (a->depth == b->depth && a > b);
+				// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
+				// requires all elements to be unique
+			};
+
+			UINT32 numMeshes = 0;
+			UINT32 numIndices[2] = { 0, 0 };
+			UINT32 numVertices[2] = { 0, 0 };
+
+			FrameSet<GUIMaterialGroup*, std::function<bool(GUIMaterialGroup*, GUIMaterialGroup*)>> sortedGroups(groupComp);
+			for(auto& material : materialGroups)
+			{
+				for(auto& group : material.second)
 				{
-					return (a->depth > b->depth) || (a->depth == b->depth && a > b);
-					// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
-					// requires all elements to be unique
-				};
+					sortedGroups.insert(&group);
+
+					UINT32 typeIdx = (UINT32)group.meshType;
+					numIndices[typeIdx] += group.numIndices;
+					numVertices[typeIdx] += group.numVertices;
+
+					numMeshes++;
+				}
+			}
 
-				UINT32 numMeshes = 0;
-				UINT32 numIndices[2] = { 0, 0 };
-				UINT32 numVertices[2] = { 0, 0 };
+			renderData.triangleMesh = nullptr;
+			renderData.lineMesh = nullptr;
 
-				FrameSet<GUIMaterialGroup*, std::function<bool(GUIMaterialGroup*, GUIMaterialGroup*)>> sortedGroups(groupComp);
-				for(auto& material : materialGroups)
+			renderData.cachedMeshes.resize(numMeshes);
+			renderData.meshElements.clear();
+			renderData.elementLookup.clear();
+
+			SPtr<VertexDataDesc> vertexDesc[2] = { mTriangleVertexDesc, mLineVertexDesc };
+
+			UINT8* vertices[2] = { nullptr, nullptr };
+			UINT32* indices[2] = { nullptr, nullptr };
+
+			for(UINT32 i = 0; i < 2; i++)
+			{
+				renderData.meshData[i] = nullptr;
+
+				if(numVertices[i] > 0 && numIndices[i] > 0)
 				{
-					for(auto& group : material.second)
-					{
-						sortedGroups.insert(&group);
+					renderData.meshData[i] = MeshData::create(numVertices[i], numIndices[i], vertexDesc[i]);
 
-						UINT32 typeIdx = (UINT32)group.meshType;
-						numIndices[typeIdx] += group.numIndices;
-						numVertices[typeIdx] += group.numVertices;
+					vertices[i] = renderData.meshData[i]->getElementData(VES_POSITION);
+					indices[i] = renderData.meshData[i]->getIndices32();
+				}
+			}
 
-						numMeshes++;
-					}
+			// Register all visible elements, even those without any render elements, so in-place updates can tell
+			// them apart from elements that were not visible during the last rebuild
+			for (auto& widget : renderData.widgets)
+			{
+				for (auto& element : widget->getElements())
+				{
+					if (element->_isVisible())
+						renderData.elementLookup[element].resize(element->getRenderElements().size());
 				}
+			}
+
+			// Fill buffers for each group and update their meshes
+			UINT32 meshIdx = 0;
+			UINT32 vertexOffset[2] = { 0, 0 };
+			UINT32 indexOffset[2] = { 0, 0 };
 
-				renderData.triangleMesh = nullptr;
-				renderData.lineMesh = nullptr;
+			for(auto& group : sortedGroups)
+			{
+				GUIWidget* widget;
 
-				renderData.cachedMeshes.resize(numMeshes);
+				if (group->elements.size() == 0)
+					widget = nullptr;
+				else
+				{
+					GUIElement* elem = group->elements.begin()->element;
+					widget = elem->_getParentWidget();
+				}
 
-				SPtr<MeshData> meshData[2];
-				SPtr<VertexDataDesc> vertexDesc[2] = { mTriangleVertexDesc, mLineVertexDesc };
+				GUIMeshData& guiMeshData = renderData.cachedMeshes[meshIdx];
+				guiMeshData.matInfo = group->matInfo;
+				guiMeshData.material = group->material;
+				guiMeshData.widget = widget;
+				guiMeshData.isLine = group->meshType == GUIMeshType::Line;
+				guiMeshData.firstElement = (UINT32)renderData.meshElements.size();
+				guiMeshData.numElements = (UINT32)group->elements.size();
 
-				UINT8* vertices[2] = { nullptr, nullptr };
-				UINT32* indices[2] = { nullptr, nullptr };
+				UINT32 typeIdx = (UINT32)group->meshType;
+				guiMeshData.indexOffset = indexOffset[typeIdx];
 
-				for(UINT32 i = 0; i < 2; i++)
+				UINT32 groupNumIndices = 0;
+				for(auto& matElement : group->elements)
 				{
-					if(numVertices[i] > 0 && numIndices[i] > 0)
-					{
-						meshData[i] = MeshData::create(numVertices[i], numIndices[i], vertexDesc[i]);
+					matElement.element->_fillBuffer(
+						vertices[typeIdx], indices[typeIdx],
+						vertexOffset[typeIdx], indexOffset[typeIdx],
+						numVertices[typeIdx], numIndices[typeIdx], matElement.renderElement);
 
-						vertices[i] = meshData[i]->getElementData(VES_POSITION);
-						indices[i] = meshData[i]->getIndices32();
-					}
+					const GUIRenderElement& renderElement = matElement.element->getRenderElements()[matElement.renderElement];
+					
+					UINT32 indexStart = indexOffset[typeIdx];
+					UINT32 indexEnd = indexStart + renderElement.numIndices;
+
+					for(UINT32 i = indexStart; i < indexEnd; i++)
+						indices[typeIdx][i] += vertexOffset[typeIdx];
+
+					GUIMeshElement meshElement;
+					meshElement.element = matElement.element;
+					meshElement.renderElement = matElement.renderElement;
+					meshElement.meshIdx = meshIdx;
+					meshElement.vertexOffset = vertexOffset[typeIdx];
+					meshElement.indexOffset = indexOffset[typeIdx];
+					meshElement.numVertices = renderElement.numVertices;
+					meshElement.numIndices = renderElement.numIndices;
+					meshElement.depth = matElement.element->_getDepth() + renderElement.depth;
+					meshElement.mergeHash = renderElement.material->getMergeHash(*renderElement.matInfo);
+					meshElement.material = renderElement.material;
+					meshElement.bounds = matElement.bounds;
+
+					renderData.elementLookup[matElement.element][matElement.renderElement] =
+						(UINT32)renderData.meshElements.size();
+					renderData.meshElements.push_back(meshElement);
+
+					indexOffset[typeIdx] += renderElement.numIndices;
+					vertexOffset[typeIdx] += renderElement.numVertices;
+
+					groupNumIndices += renderElement.numIndices;
 				}
 
-				// Fill buffers for each group and update their meshes
-				UINT32 meshIdx = 0;
-				UINT32 vertexOffset[2] = { 0, 0 };
-				UINT32 indexOffset[2] = { 0, 0 };
+				guiMeshData.indexCount = groupNumIndices;
 
-				for(auto& group : sortedGroups)
+				meshIdx++;
+			}
+
+			// Mesh data is kept around for in-place updates, so the meshes are given a copy. In-place updates only
+			// write the modified parts of the buffers, which dynamic buffers don't support (they must be discarded as a
+			// whole), so the meshes are created as static.
+			if(renderData.meshData[0])
+			{
+				renderData.triangleMesh = Mesh::_createPtr(copyMeshData(renderData.meshData[0]), MU_STATIC,
+					DOT_TRIANGLE_LIST);
+			}
+
+			if(renderData.meshData[1])
+			{
+				renderData.lineMesh = Mesh::_createPtr(copyMeshData(renderData.meshData[1]), MU_STATIC,
+					DOT_LINE_LIST);
+			}
+		}
+		bs_frame_clear();
+	}
+
+	bool GUIManager::updateMeshesInPlace(GUIRenderData& renderData, const FrameVector<GUIElement*>& dirtyElements)
+	{
+		// Make sure no changes affect the batches before modifying anything
+		for(auto& element : dirtyElements)
+		{
+			auto iterFind = renderData.elementLookup.find(element);
+			if(iterFind == renderData.elementLookup.end())
+			{
+				// Wasn't visible during the last rebuild, nothing to update unless it became visible
+				if(element->_isVisible())
+					return false;
+
+				continue;
+			}
+
+			const SmallVector<UINT32, 4>& meshElementIndices = iterFind->second;
+			const SmallVector<GUIRenderElement, 4>& renderElements = element->getRenderElements();
+
+			if(!element->_isVisible() || renderElements.size() != meshElementIndices.size())
+				return false;
+
+			if(renderElements.empty())
+				continue;
+
+			Rect2I tfrmedBounds = element->_getClippedBounds();
+			tfrmedBounds.transform(element->_getParentWidget()->getWorldTfrm());
+
+			for(UINT32 i = 0; i < (UINT32)renderElements.size(); i++)
+			{
+				const GUIRenderElement& renderElement = renderElements[i];
+				const GUIMeshElement& meshElement = renderData.meshElements[meshElementIndices[i]];
+				const GUIMeshData& meshData = renderData.cachedMeshes[meshElement.meshIdx];
+
+				if(renderElement.numVertices != meshElement.numVertices ||
+					renderElement.numIndices != meshElement.numIndices ||
+					renderElement.material != meshElement.material ||
+					(renderElement.type == GUIMeshType::Line) != meshData.isLine ||
+					element->_getDepth() + renderElement.depth != meshElement.depth)
 				{
-					GUIWidget* widget;
+					return false;
+				}
 
-					if (group->elements.size() == 0)
-						widget = nullptr;
-					else
-					{
-						GUIElement* elem = group->elements.begin()->element;
-						widget = elem->_getParentWidget();
-					}
+				if(renderElement.material->getMergeHash(*renderElement.matInfo) != meshElement.mergeHash)
+					return false;
+
+				// Batches were determined using the old bounds. As long as the element doesn't grow outside of them it
+				// can't start overlapping any elements it didn't overlap before.
+				if(!containsRect(meshElement.bounds, tfrmedBounds))
+					return false;
+			}
+		}
 
-					GUIMeshData& guiMeshData = renderData.cachedMeshes[meshIdx];
-					guiMeshData.matInfo = group->matInfo;
-					guiMeshData.material = group->material;
-					guiMeshData.widget = widget;
-					guiMeshData.isLine = group->meshType == GUIMeshType::Line;
+		bs_frame_mark();
+		{
+			FrameVector<GUIMeshRange> dirtyRanges[2];
+			FrameVector<bool> dirtyGroups(renderData.cachedMeshes.size(), false);
 
-					UINT32 typeIdx = (UINT32)group->meshType;
-					guiMeshData.indexOffset = indexOffset[typeIdx];
+			for(auto& element : dirtyElements)
+			{
+				auto iterFind = renderData.elementLookup.find(element);
+				if(iterFind == renderData.elementLookup.end())
+					continue;
 
-					UINT32 groupNumIndices = 0;
-					for(auto& matElement : group->elements)
-					{
-						matElement.element->_fillBuffer(
-							vertices[typeIdx], indices[typeIdx],
-							vertexOffset[typeIdx], indexOffset[typeIdx],
-							numVertices[typeIdx], numIndices[typeIdx], matElement.renderElement);
+				for(auto& meshElementIdx : iterFind->second)
+				{
+					const GUIMeshElement& meshElement = renderData.meshElements[meshElementIdx];
 
-						const GUIRenderElement& renderElement = matElement.element->getRenderElements()[matElement.renderElement];
-						
-						UINT32 indexStart = indexOffset[typeIdx];
-						UINT32 indexEnd = indexStart + renderElement.numIndices;
+					const UINT32 typeIdx = renderData.cachedMeshes[meshElement.meshIdx].isLine ? 1 : 0;
+					const SPtr<MeshData>& meshData = renderData.meshData[typeIdx];
 
-						for(UINT32 i = indexStart; i < indexEnd; i++)
-							indices[typeIdx][i] += vertexOffset[typeIdx];
+					UINT8* vertices = meshData->getElementData(VES_POSITION);
+					UINT32* indices = meshData->getIndices32();
 
-						indexOffset[typeIdx] += renderElement.numIndices;
-						vertexOffset[typeIdx] += renderElement.numVertices;
+					element->_fillBuffer(vertices, indices, meshElement.vertexOffset, meshElement.indexOffset,
+						meshData->getNumVertices(), meshData->getNumIndices(), meshElement.renderElement);
 
-						groupNumIndices += renderElement.numIndices;
-					}
+					UINT32 indexEnd = meshElement.indexOffset + meshElement.numIndices;
+					for(UINT32 i = meshElement.indexOffset; i < indexEnd; i++)
+						indices[i] += meshElement.vertexOffset;
 
-					guiMeshData.indexCount = groupNumIndices;
+					if(meshElement.numVertices > 0 || meshElement.numIndices > 0)
+					{
+						GUIMeshRange range;
+						range.vertexOffset = meshElement.vertexOffset;
+						range.numVertices = meshElement.numVertices;
+						range.indexOffset = meshElement.indexOffset;
+						range.numIndices = meshElement.numIndices;
 
-					meshIdx++;
+						dirtyRanges[typeIdx].push_back(range);
+					}
+
+					dirtyGroups[meshElement.meshIdx] = true;
 				}
+			}
+
+			// Material info of a group is merged from all of its elements, and the elements could have changed it
+			for(UINT32 i = 0; i < (UINT32)renderData.cachedMeshes.size(); i++)
+			{
+				if(!dirtyGroups[i])
+					continue;
 
-				if(meshData[0])
-					renderData.triangleMesh = Mesh::_createPtr(meshData[0], MU_STATIC, DOT_TRIANGLE_LIST);
+				GUIMeshData& guiMeshData = renderData.cachedMeshes[i];
+				for(UINT32 j = 0; j < guiMeshData.numElements; j++)
+				{
+					const GUIMeshElement& meshElement = renderData.meshElements[guiMeshData.firstElement + j];
+					const GUIRenderElement& renderElement =
+						meshElement.element->getRenderElements()[meshElement.renderElement];
 
-				if(meshData[1])
-					renderData.lineMesh = Mesh::_createPtr(meshData[1], MU_STATIC, DOT_LINE_LIST);
+					if(j == 0)
+						guiMeshData.matInfo = renderElement.matInfo->clone();
+					else
+						guiMeshData.material->merge(guiMeshData.matInfo, *renderElement.matInfo);
+				}
 			}
 
-			bs_frame_clear();
+			// Only the modified parts of the meshes get uploaded, rest of the GPU buffers remain as is
+			if(renderData.triangleMesh)
+				uploadMeshRanges(renderData.triangleMesh, renderData.meshData[0], dirtyRanges[0]);
+
+			if(renderData.lineMesh)
+				uploadMeshRanges(renderData.lineMesh, renderData.meshData[1], dirtyRanges[1]);
 		}
+		bs_frame_clear();
+
+		return true;
 	}
 
 	void GUIManager::updateCaretTexture()
@@ -1806,6 +2172,15 @@ namespace bs
 		return nullptr;
 	}
 
+	SPtr<MeshData> GUIManager::getMeshData(const Viewport* viewport, bool lines) const
+	{
+		auto iterFind = mCachedGUIData.find(viewport);
+		if(iterFind == mCachedGUIData.end())
+			return nullptr;
+
+		return iterFind->second.meshData[lines ? 1 : 0];
+	}
+
 	SPtr<RenderWindow> GUIManager::getBridgeWindow(const SPtr<RenderTexture>& target) const
 	{
 		if (target == nullptr)
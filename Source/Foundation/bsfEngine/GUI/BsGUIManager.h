@@ -58,6 +58,30 @@ namespace bs
 			SpriteMaterialInfo matInfo;
 			GUIWidget* widget;
 			bool isLine;
+
+			/** Range of entries in GUIRenderData::meshElements that were written into this mesh. */
+			UINT32 firstElement = 0;
+			UINT32 numElements = 0;
+		};
+
+		/**
+		 * Information about a single GUI render element written into one of the viewport meshes. Contains the state used
+		 * when grouping the element, so later changes can be checked against it to determine if the element can be
+		 * updated in place.
+		 */
+		struct GUIMeshElement
+		{
+			GUIElement* element;
+			UINT32 renderElement;
+			UINT32 meshIdx;
+			UINT32 vertexOffset;
+			UINT32 indexOffset;
+			UINT32 numVertices;
+			UINT32 numIndices;
+			UINT32 depth;
+			UINT64 mergeHash;
+			SpriteMaterial* material;
+			Rect2I bounds;
 		};
 
 		/**	GUI render data for a single viewport. */
@@ -72,6 +96,18 @@ namespace bs
 			Vector<GUIMeshData> cachedMeshes;
 			Vector<GUIWidget*> widgets;
 			bool isDirty;
+
+			/**
+			 * CPU copies of the triangle and line mesh contents. These are never handed over to the core thread, so they
+			 * can be modified when only some elements change, and then copied into the meshes.
+			 */
+			SPtr<MeshData> meshData[2];
+
+			/** Render elements written into the meshes, in the order they were written. */
+			Vector<GUIMeshElement> meshElements;
+
+			/** Maps GUI elements to their entries in @p meshElements, one entry per render element. */
+			UnorderedMap<GUIElement*, SmallVector<UINT32, 4>> elementLookup;
 		};
 
 		/**	Render data for a single GUI group used for notifying the core GUI renderer. */
@@ -240,12 +276,46 @@ namespace bs
 		/**	Returns the parent render window of the specified widget. */
 		const RenderWindow* getWidgetWindow(const GUIWidget& widget) const;
 
+		/** Returns the number of times the GUI meshes of a viewport were regrouped and rebuilt from scratch. */
+		UINT64 getNumMeshRebuilds() const { return mNumMeshRebuilds; }
+
+		/** Returns the number of times the GUI meshes of a viewport were updated in place, without regrouping. */
+		UINT64 getNumInPlaceMeshUpdates() const { return mNumInPlaceMeshUpdates; }
+
+		/**
+		 * Returns the CPU copy of the GUI mesh contents for the specified viewport, as last written into its meshes.
+		 *
+		 * @param[in]	viewport	Viewport whose GUI meshes to return the contents of.
+		 * @param[in]	lines		If true the contents of the line mesh are returned, triangle mesh otherwise.
+		 * @return					Mesh contents, or null if the viewport has no GUI geometry of the requested type.
+		 */
+		SPtr<MeshData> getMeshData(const Viewport* viewport, bool lines) const;
+
 	private:
 		friend class ct::GUIRenderer;
 
 		/**	Recreates all dirty GUI meshes and makes them ready for rendering. */
 		void updateMeshes();
 
+		/**
+		 * Regroups all GUI elements in the viewport into batches and regenerates the viewport meshes from scratch.
+		 *
+		 * @param[in]	renderData	Render data for the viewport to rebuild.
+		 */
+		void rebuildMeshes(GUIRenderData& renderData);
+
+		/**
+		 * Regenerates geometry of the provided elements in place, without regrouping the rest of the viewport. This is
+		 * only possible if the changes made to an element don't affect its batch, its position in the meshes, or the
+		 * batches of any other elements.
+		 *
+		 * @param[in]	renderData		Render data for the viewport to update.
+		 * @param[in]	dirtyElements	Elements whose render elements were modified.
+		 * @return						True if the meshes were updated. False if the changes require the meshes to be
+		 *								rebuilt, in which case nothing was modified.
+		 */
+		bool updateMeshesInPlace(GUIRenderData& renderData, const FrameVector<GUIElement*>& dirtyElements);
+
 		/**	Recreates the input caret texture. */
 		void updateCaretTexture();
 
@@ -403,6 +473,9 @@ namespace bs
 
 		bool mSeparateMeshesByWidget = true;
 		Vector2I mLastPointerScreenPos;
+		UINT64 mGlyphEvictionCount = 0;
+		UINT64 mNumMeshRebuilds = 0;
+		UINT64 mNumInPlaceMeshUpdates = 0;
 
 		DragState mDragState = DragState::NoDrag;
 		Vector2I mLastPointerClickPos;
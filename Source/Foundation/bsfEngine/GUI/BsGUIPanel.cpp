@@ -82,24 +82,65 @@ namespace bs
 
 	void GUIPanel::_updateOptimalLayoutSizes()
 	{
+		// Cached size ranges are still valid if nothing in this layout changed
+		if (!_isLayoutDirty())
+			return;
+
 		// Update all children first, otherwise we can't determine our own optimal size
 		GUIElementBase::_updateOptimalLayoutSizes();
 
 		if (mChildren.size() != mChildSizeRanges.size())
 			mChildSizeRanges.resize(mChildren.size());
 
+		UINT32 childIdx = 0;
+		for (auto& child : mChildren)
+		{
+			if (child->_isActive())
+				mChildSizeRanges[childIdx] = _getElementSizeRange(child);
+			else
+				mChildSizeRanges[childIdx] = LayoutSizeRange();
+
+			childIdx++;
+		}
+
+		updateSizeRange();
+	}
+
+	LayoutSizeRange GUIPanel::_updateElementSizeRange(GUIElementBase* element)
+	{
+		// Size ranges of the other children haven't been calculated yet, so calculate everything
+		if (mChildren.size() != mChildSizeRanges.size())
+		{
+			_updateOptimalLayoutSizes();
+			return _getElementSizeRange(element);
+		}
+
+		element->_updateOptimalLayoutSizes();
+		LayoutSizeRange sizeRange = _getElementSizeRange(element);
+
+		// Keep the cached ranges in sync, so they remain valid for full layout updates
+		auto iterFind = std::find(mChildren.begin(), mChildren.end(), element);
+		if (iterFind != mChildren.end())
+		{
+			mChildSizeRanges[iterFind - mChildren.begin()] = sizeRange;
+			updateSizeRange();
+		}
+
+		return sizeRange;
+	}
+
+	void GUIPanel::updateSizeRange()
+	{
 		Vector2I optimalSize;
 		Vector2I minSize;
 
 		UINT32 childIdx = 0;
 		for (auto& child : mChildren)
 		{
-			LayoutSizeRange& childSizeRange = mChildSizeRanges[childIdx];
+			const LayoutSizeRange& childSizeRange = mChildSizeRanges[childIdx];
 
 			if (child->_isActive())
 			{
-				childSizeRange = _getElementSizeRange(child);
-
 				UINT32 paddingX = child->_getPadding().left + child->_getPadding().right;
 				UINT32 paddingY = child->_getPadding().top + child->_getPadding().bottom;
 
@@ -116,8 +157,6 @@ namespace bs
 				minSize.x = std::max(minSize.x, childMax.x);
 				minSize.y = std::max(minSize.y, childMax.y);
 			}
-			else
-				childSizeRange = LayoutSizeRange();
 
 			childIdx++;
 		}
@@ -222,6 +261,9 @@ namespace bs
 
 	void GUIPanel::_updateLayoutInternal(const GUILayoutData& data)
 	{
+		if (isLayoutCached(data))
+			return;
+
 		GUILayoutData childData = data;
 		_updateDepthRange(childData);
 
@@ -249,6 +291,8 @@ namespace bs
 
 		if (elementAreas != nullptr)
 			bs_stack_free(elementAreas);
+
+		markLayoutCached(data);
 	}
 
 	void GUIPanel::_updateChildLayout(GUIElementBase* element, const GUILayoutData& data)
@@ -99,6 +99,15 @@ namespace bs
 		 */
 		LayoutSizeRange _getElementSizeRange(const GUIElementBase* element) const;
 
+		/**
+		 * Recalculates optimal sizes of the provided child element and updates the cached size ranges of the panel
+		 * accordingly, without touching the other children.
+		 *
+		 * @param[in]	element		Child element of the panel whose layout was marked as dirty.
+		 * @return					New size range of the element.
+		 */
+		LayoutSizeRange _updateElementSizeRange(GUIElementBase* element);
+
 		/** Assigns the specified layout information to a child element of a GUI panel. */
 		void _updateChildLayout(GUIElementBase* element, const GUILayoutData& data);
 
@@ -114,6 +123,9 @@ namespace bs
 		/** @} */
 
 	protected:
+		/** Calculates the size range of the panel from the cached size ranges of its children. */
+		void updateSizeRange();
+
 		INT16 mDepthOffset;
 		UINT16 mDepthRangeMin;
 		UINT16 mDepthRangeMax;
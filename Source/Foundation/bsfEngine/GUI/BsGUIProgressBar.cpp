@@ -63,6 +63,11 @@ namespace bs
 		barLayoutData.area.height = progressBarHeight;
 
 		mBar->_setLayoutData(barLayoutData);
+
+		// Child elements are positioned directly, without further layout of their own
+		mBackground->_markLayoutAsClean();
+		mBar->_markLayoutAsClean();
+		_markLayoutAsClean();
 	}
 
 	void GUIProgressBar::styleUpdated()
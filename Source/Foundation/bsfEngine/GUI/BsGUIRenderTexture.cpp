@@ -74,8 +74,8 @@ namespace bs
 		_markLayoutAsDirty();
 	}
 
-	void GUIRenderTexture::updateRenderElementsInternal()
-	{		
+	void GUIRenderTexture::updateSprites()
+	{
 		if(mActiveTexture != nullptr && mActiveTexture.isLoaded())
 			mDesc.texture = mActiveTexture;
 
@@ -84,8 +84,11 @@ namespace bs
 		mDesc.transparent = mTransparent;
 		mDesc.color = getTint();
 
-		mImageSprite->update(mDesc, (UINT64)_getParentWidget());
+		updateSprite(mImageSprite, mDesc);
+	}
 
+	void GUIRenderTexture::updateRenderElementsInternal()
+	{
 		// Populate GUI render elements from the sprites
 		{
 			using T = impl::GUIRenderElementHelper;
@@ -77,6 +77,9 @@ namespace bs
 		/** @copydoc GUIElement::updateRenderElementsInternal */
 		void updateRenderElementsInternal() override;
 
+		/** @copydoc GUIElement::updateSprites */
+		void updateSprites() override;
+
 		SPtr<RenderTexture> mSourceTexture;
 		bool mTransparent;
 	};
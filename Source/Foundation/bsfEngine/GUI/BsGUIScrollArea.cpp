@@ -72,6 +72,10 @@ namespace bs
 
 	void GUIScrollArea::_updateOptimalLayoutSizes()
 	{
+		// Cached size ranges are still valid if nothing in this layout changed
+		if (!_isLayoutDirty())
+			return;
+
 		// Update all children first, otherwise we can't determine our own optimal size
 		GUIElementBase::_updateOptimalLayoutSizes();
 
@@ -233,6 +237,9 @@ namespace bs
 
 	void GUIScrollArea::_updateLayoutInternal(const GUILayoutData& data)
 	{
+		if (isLayoutCached(data))
+			return;
+
 		UINT32 numElements = (UINT32)mChildren.size();
 		Rect2I* elementAreas = nullptr;
 
@@ -349,6 +356,8 @@ namespace bs
 
 		if (elementAreas != nullptr)
 			bs_stack_free(elementAreas);
+
+		markLayoutCached(data);
 	}
 
 	void GUIScrollArea::vertScrollUpdate(float scrollPos)
@@ -399,6 +408,16 @@ namespace bs
 		return 0.0f;
 	}
 
+	void GUIScrollArea::setVirtualized(bool virtualized)
+	{
+		mContentLayout->_setVirtualized(virtualized);
+	}
+
+	bool GUIScrollArea::isVirtualized() const
+	{
+		return mContentLayout->_isVirtualized();
+	}
+
 	Rect2I GUIScrollArea::getContentBounds()
 	{
 		Rect2I bounds = getBounds();
@@ -128,6 +128,17 @@ namespace bs
 		 */
 		Rect2I getContentBounds();
 
+		/**
+		 * Enables or disables virtualization of the scroll area contents. When enabled, layout of elements in the scroll
+		 * area layout that are scrolled out of view is not updated, making scrolling through a large number of elements
+		 * cheap. Note that bounds reported by elements that are out of view might be out of date when virtualization is
+		 * enabled. Disabled by default.
+		 */
+		void setVirtualized(bool virtualized);
+
+		/** Checks is scroll area content virtualization enabled. See setVirtualized(). */
+		bool isVirtualized() const;
+
 		/**
 		 * Number of pixels the scroll bar will occupy when active. This is width for vertical scrollbar, and height for
 		 * horizontal scrollbar.
@@ -89,7 +89,7 @@ namespace bs
 		GUIElement::destroy(mHandleBtn);
 	}
 
-	void GUIScrollBar::updateRenderElementsInternal()
+	void GUIScrollBar::updateSprites()
 	{
 		IMAGE_SPRITE_DESC desc;
 
@@ -100,8 +100,11 @@ namespace bs
 		desc.height = mLayoutData.area.height;
 		desc.color = getTint();
 
-		mImageSprite->update(desc, (UINT64)_getParentWidget());
+		updateSprite(mImageSprite, desc);
+	}
 
+	void GUIScrollBar::updateRenderElementsInternal()
+	{
 		// Populate GUI render elements from the sprites
 		{
 			using T = impl::GUIRenderElementHelper;
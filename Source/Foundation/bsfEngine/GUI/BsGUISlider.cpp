@@ -131,6 +131,12 @@ namespace bs
 
 			mFillBackground->_setLayoutData(childData);
 		}
+
+		// Child elements are positioned directly, without further layout of their own
+		mBackground->_markLayoutAsClean();
+		mSliderHandle->_markLayoutAsClean();
+		mFillBackground->_markLayoutAsClean();
+		_markLayoutAsClean();
 	}
 
 	void GUISlider::styleUpdated()
@@ -45,7 +45,12 @@ namespace bs
 
 	void GUISliderHandle::_setHandleSize(float pct)
 	{
-		mPctHandleSize = Math::clamp01(pct);
+		float newHandleSize = Math::clamp01(pct);
+		if (newHandleSize != mPctHandleSize)
+		{
+			mPctHandleSize = newHandleSize;
+			_markContentAsDirty();
+		}
 	}
 
 	void GUISliderHandle::_setHandlePos(float pct)
@@ -57,7 +62,12 @@ namespace bs
 			maxPct = Math::floor(1.0f / mStep) * mStep;
 		}
 
-		mPctHandlePos = Math::clamp(pct, 0.0f, maxPct);
+		float newHandlePos = Math::clamp(pct, 0.0f, maxPct);
+		if (newHandlePos != mPctHandlePos)
+		{
+			mPctHandlePos = newHandlePos;
+			_markContentAsDirty();
+		}
 	}
 
 	float GUISliderHandle::getHandlePos() const
@@ -80,8 +90,8 @@ namespace bs
 		return getMaxSize() - getHandleSize();
 	}
 
-	void GUISliderHandle::updateRenderElementsInternal()
-	{		
+	void GUISliderHandle::updateSprites()
+	{
 		IMAGE_SPRITE_DESC desc;
 
 		HSpriteTexture activeTex = getActiveTexture();
@@ -117,8 +127,11 @@ namespace bs
 		desc.borderTop = _getStyle()->border.top;
 		desc.borderBottom = _getStyle()->border.bottom;
 		desc.color = getTint();
-		mImageSprite->update(desc, (UINT64)_getParentWidget());
-		
+		updateSprite(mImageSprite, desc);
+	}
+
+	void GUISliderHandle::updateRenderElementsInternal()
+	{
 		// Populate GUI render elements from the sprites
 		{
 			using T = impl::GUIRenderElementHelper;
@@ -140,6 +140,9 @@ namespace bs
 		/** @copydoc GUIElement::updateRenderElementsInternal() */
 		void updateRenderElementsInternal() override;
 
+		/** @copydoc GUIElement::updateSprites() */
+		void updateSprites() override;
+
 		/** @copydoc GUIElement::updateClippedBounds() */
 		void updateClippedBounds() override;
 	private:
@@ -127,7 +127,7 @@ namespace bs
 			_markContentAsDirty();
 	}
 
-	void GUITexture::updateRenderElementsInternal()
+	void GUITexture::updateSprites()
 	{
 		Vector2I textureSize;
 		if (SpriteTexture::checkIsLoaded(mActiveTexture))
@@ -182,8 +182,11 @@ namespace bs
 		else
 			mDesc.uvScale = Vector2::ONE;
 		
-		mImageSprite->update(mDesc, (UINT64)_getParentWidget());
+		updateSprite(mImageSprite, mDesc);
+	}
 
+	void GUITexture::updateRenderElementsInternal()
+	{
 		// Populate GUI render elements from the sprites
 		{
 			using T = impl::GUIRenderElementHelper;
@@ -166,6 +166,9 @@ namespace bs
 		/** @copydoc GUIElement::updateRenderElementsInternal */
 		void updateRenderElementsInternal() override;
 
+		/** @copydoc GUIElement::updateSprites */
+		void updateSprites() override;
+
 		/** @copydoc GUIElement::styleUpdated */
 		void styleUpdated() override;
 
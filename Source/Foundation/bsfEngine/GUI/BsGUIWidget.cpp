@@ -11,6 +11,7 @@
 #include "RenderAPI/BsViewport.h"
 #include "Scene/BsSceneObject.h"
 #include "Resources/BsBuiltinResources.h"
+#include "2D/BsSpriteManager.h"
 
 namespace bs
 {
@@ -78,6 +79,7 @@ namespace bs
 
 		mElements.clear();
 		mDirtyContents.clear();
+		mDirtyMeshes.clear();
 	}
 
 	void GUIWidget::setDepth(UINT8 depth)
@@ -117,7 +119,7 @@ namespace bs
 					mWidgetIsDirty = true;
 				else
 				{
-					if(Math::approxEquals(mScale, scale))
+					if(!Math::approxEquals(mScale, scale, diffEpsilon))
 						mWidgetIsDirty = true;
 				}
 			}
@@ -188,6 +190,10 @@ namespace bs
 					_updateLayout(updateParent);
 				else // Must be root panel
 					_updateLayout(mPanel);
+
+				// Layout of the dirty element was updated along with its update parent, unless it got skipped (e.g. by
+				// a virtualized layout), in which case it will get updated once it is laid out again
+				currentElem->_markAsClean();
 			}
 			else
 			{
@@ -219,9 +225,7 @@ namespace bs
 			GUIPanel* panel = static_cast<GUIPanel*>(updateParent);
 
 			GUIElementBase* dirtyElement = elem;
-			dirtyElement->_updateOptimalLayoutSizes();
-
-			LayoutSizeRange elementSizeRange = panel->_getElementSizeRange(dirtyElement);
+			LayoutSizeRange elementSizeRange = panel->_updateElementSizeRange(dirtyElement);
 			Rect2I elementArea = panel->_getElementArea(panel->_getLayoutData().area, dirtyElement, elementSizeRange);
 
 			GUILayoutData childLayoutData = panel->_getLayoutData();
@@ -236,28 +240,26 @@ namespace bs
 			updateParent->_updateLayout(childLayoutData);
 		}
 		
-		// Mark dirty contents
-		bs_frame_mark();
+		// Note: No need to mark contents of child elements as dirty, elements whose bounds changed marked themselves
+		// during the layout update, and unchanged elements can keep their current contents
+		elem->_markAsClean();
+
+		// Layouts above the update parent don't depend on its contents, so their cached layouts are still valid once none
+		// of their children are waiting for a layout update
+		GUIElementBase* parentElem = elem->_getParent();
+		while (parentElem != nullptr && parentElem->_isLayoutDirty())
 		{
-			FrameStack<GUIElementBase*> todo;
-			todo.push(elem);
-
-			while (!todo.empty())
+			UINT32 numChildren = parentElem->_getNumChildren();
+			for (UINT32 i = 0; i < numChildren; i++)
 			{
-				GUIElementBase* currentElem = todo.top();
-				todo.pop();
-
-				if (currentElem->_getType() == GUIElementBase::Type::Element)
-					mDirtyContents.insert(static_cast<GUIElement*>(currentElem));
-
-				currentElem->_markAsClean();
-
-				UINT32 numChildren = currentElem->_getNumChildren();
-				for (UINT32 i = 0; i < numChildren; i++)
-					todo.push(currentElem->_getChild(i));
+				GUIElementBase* child = parentElem->_getChild(i);
+				if (child->_isActive() && child->_isLayoutDirty())
+					return;
 			}
+
+			parentElem->_markLayoutAsClean();
+			parentElem = parentElem->_getParent();
 		}
-		bs_frame_clear();
 	}
 
 	void GUIWidget::_registerElement(GUIElementBase* elem)
@@ -284,12 +286,24 @@ namespace bs
 		}
 
 		if (elem->_getType() == GUIElementBase::Type::Element)
+		{
 			mDirtyContents.erase(static_cast<GUIElement*>(elem));
+			mDirtyMeshes.erase(static_cast<GUIElement*>(elem));
+		}
 	}
 
 	void GUIWidget::_markMeshDirty(GUIElementBase* elem)
 	{
-		mWidgetIsDirty = true;
+		if (elem->_getType() == GUIElementBase::Type::Element)
+			mDirtyMeshes.insert(static_cast<GUIElement*>(elem));
+		else
+			mWidgetIsDirty = true;
+	}
+
+	void GUIWidget::_clearMeshUpdates()
+	{
+		mDirtyMeshes.clear();
+		mRebuildMeshes = false;
 	}
 
 	void GUIWidget::_markContentDirty(GUIElementBase* elem)
@@ -343,19 +357,35 @@ namespace bs
 		if (!mIsActive)
 			return false;
 
-		const bool dirty = mWidgetIsDirty || !mDirtyContents.empty();
+		const bool dirty = mWidgetIsDirty || mRebuildMeshes || !mDirtyContents.empty() || !mDirtyMeshes.empty();
 
 		if(cleanIfDirty && dirty)
 		{
+			mRebuildMeshes |= mWidgetIsDirty;
 			mWidgetIsDirty = false;
 
 			// Update render contents recursively because updates can cause child GUI elements to become dirty
+			bool firstPass = true;
 			while(!mDirtyContents.empty())
 			{
 				mDirtyContentsTemp.swap(mDirtyContents);
 
+				// Work for elements dirtied before this call was already queued and processed by GUIManager, this only
+				// handles elements dirtied by updates of other elements
+				if(!firstPass)
+				{
+					for (auto& dirtyElement : mDirtyContentsTemp)
+						dirtyElement->_queueRenderElementUpdates();
+
+					SpriteManager::instance().processQueuedUpdates();
+				}
+
+				firstPass = false;
 				for (auto& dirtyElement : mDirtyContentsTemp)
+				{
 					dirtyElement->_updateRenderElements();
+					mDirtyMeshes.insert(dirtyElement);
+				}
 
 				mDirtyContentsTemp.clear();
 			}
@@ -366,6 +396,15 @@ namespace bs
 		return dirty;
 	}
 
+	void GUIWidget::_queueRenderElementUpdates()
+	{
+		if (!mIsActive)
+			return;
+
+		for (auto& dirtyElement : mDirtyContents)
+			dirtyElement->_queueRenderElementUpdates();
+	}
+
 	bool GUIWidget::inBounds(const Vector2I& position) const
 	{
 		Viewport* target = getTarget();
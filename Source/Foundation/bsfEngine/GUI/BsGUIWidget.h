@@ -69,6 +69,12 @@ namespace bs
 		 */
 		bool isDirty(bool cleanIfDirty);
 
+		/**
+		 * Calls GUIElement::_queueRenderElementUpdates() on all elements whose contents are dirty. Queued work must be
+		 * processed before the elements are updated through isDirty().
+		 */
+		void _queueRenderElementUpdates();
+
 		/**	Returns the viewport that this widget will be rendered on. */
 		Viewport* getTarget() const;
 
@@ -123,16 +129,32 @@ namespace bs
 		SPtr<GUINavGroup> _getDefaultNavGroup() const { return mDefaultNavGroup; }
 
 		/**
-		 * Marks the widget mesh dirty requiring a mesh rebuild. Provided element is the one that requested the mesh update.
+		 * Marks the widget mesh dirty requiring a mesh update. Provided element is the one that requested the mesh update.
+		 * If the element is a GUIElement only its own geometry is queued for an update, otherwise the entire widget mesh
+		 * will be rebuilt.
 		 */
 		void _markMeshDirty(GUIElementBase* elem);
 
 		/**
-		 * Marks the elements content as dirty, meaning its internal mesh will need to be rebuilt (this implies the entire
-		 * widget mesh will be rebuilt as well).
+		 * Marks the elements content as dirty, meaning its internal mesh will need to be rebuilt (this implies the widget
+		 * mesh needs to be updated as well).
 		 */
 		void _markContentDirty(GUIElementBase* elem);
 
+		/**
+		 * Returns elements whose meshes were modified since the last call to _clearMeshUpdates(). Elements whose contents
+		 * are dirty are only reported after they have been updated through isDirty().
+		 *
+		 * @param[out]	rebuild		Set to true if the widget changed as a whole (e.g. elements were added or removed, or
+		 *							the widget moved), in which case all of its meshes need to be rebuilt, regardless of
+		 *							the returned elements.
+		 * @return					Elements whose meshes changed.
+		 */
+		const Set<GUIElement*>& _getMeshUpdates(bool& rebuild) const { rebuild = mRebuildMeshes; return mDirtyMeshes; }
+
+		/** Clears the information reported by _getMeshUpdates(). */
+		void _clearMeshUpdates();
+
 		/**	Updates the layout of all child elements, repositioning and resizing them as needed. */
 		void _updateLayout();
 
@@ -196,9 +218,11 @@ namespace bs
 
 		Set<GUIElement*> mDirtyContents;
 		Set<GUIElement*> mDirtyContentsTemp;
+		Set<GUIElement*> mDirtyMeshes;
 
 		mutable UINT64 mCachedRTId;
 		mutable bool mWidgetIsDirty;
+		bool mRebuildMeshes = false;
 		mutable Rect2I mBounds;
 
 		HGUISkin mSkin;
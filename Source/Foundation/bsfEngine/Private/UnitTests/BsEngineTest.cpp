@@ -0,0 +1,1477 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Testing/BsConsoleTestOutput.h"
+#include "Testing/BsTestSuite.h"
+#include "Renderer/BsGpuResourcePool.h"
+#include "Renderer/BsParamBlocks.h"
+#include "Renderer/BsRenderQueue.h"
+#include "Math/BsRandom.h"
+#include "Utility/BsTimer.h"
+#include "BsApplication.h"
+#include "BsEngineConfig.h"
+#include "Components/BsCCamera.h"
+#include "Components/BsCLight.h"
+#include "Components/BsCRenderable.h"
+#include "2D/BsImageSprite.h"
+#include "2D/BsSpriteManager.h"
+#include "2D/BsTextSprite.h"
+#include "CoreThread/BsCoreThread.h"
+#include "GUI/BsCGUIWidget.h"
+#include "GUI/BsGUIButton.h"
+#include "GUI/BsGUIInputBox.h"
+#include "GUI/BsGUILabel.h"
+#include "GUI/BsGUILayoutX.h"
+#include "GUI/BsGUILayoutY.h"
+#include "GUI/BsGUIManager.h"
+#include "GUI/BsGUIPanel.h"
+#include "GUI/BsGUISpace.h"
+#include "GUI/BsGUITexture.h"
+#include "Image/BsTexture.h"
+#include "Material/BsGpuParamsSet.h"
+#include "Material/BsMaterial.h"
+#include "Material/BsPass.h"
+#include "Material/BsShader.h"
+#include "Material/BsTechnique.h"
+#include "Mesh/BsMeshData.h"
+#include "Profiling/BsRenderStats.h"
+#include "RenderAPI/BsGpuParamBlockBuffer.h"
+#include "RenderAPI/BsGpuParamDesc.h"
+#include "RenderAPI/BsGpuParams.h"
+#include "RenderAPI/BsGpuProgram.h"
+#include "RenderAPI/BsRenderWindow.h"
+#include "RenderAPI/BsViewport.h"
+#include "Resources/BsBuiltinResources.h"
+#include "Scene/BsPrefab.h"
+#include "Resources/BsResources.h"
+#include "Scene/BsSceneObject.h"
+#include "Threading/BsTaskScheduler.h"
+
+namespace bs
+{
+	/** Render queue that allows sort criteria to be provided directly, without requiring materials. */
+	class TestRenderQueue : public ct::RenderQueue
+	{
+	public:
+		TestRenderQueue(ct::StateReduction mode)
+			:RenderQueue(mode)
+		{ }
+
+		/** Adds a new sortable element with the provided sort criteria. */
+		void addSortable(INT32 priority, float distFromCamera, UINT32 shaderId, UINT32 techniqueIdx, UINT32 passIdx,
+			UINT32 batchId = 0)
+		{
+			SortableElement elem;
+			elem.seqIdx = (UINT32)mSortableElements.size();
+			elem.priority = priority;
+			elem.distFromCamera = distFromCamera;
+			elem.shaderId = shaderId;
+			elem.techniqueIdx = techniqueIdx;
+			elem.passIdx = passIdx;
+			elem.batchId = batchId;
+
+			mSortableElements.push_back(elem);
+			mSortableElementIdx.push_back(elem.seqIdx);
+		}
+
+		/** Sorts the element indices using either the sort keys or the comparison callbacks. */
+		const Vector<UINT32>& sortIndices(bool useKeys)
+		{
+			for(UINT32 i = 0; i < (UINT32)mSortableElementIdx.size(); i++)
+				mSortableElementIdx[i] = i;
+
+			if(!useKeys || !sortIndicesByKey())
+				sortIndicesByComparison();
+
+			return mSortableElementIdx;
+		}
+	};
+
+	/** Fixed space that counts how many times its layout was updated. */
+	class TestGUIFixedSpace : public GUIFixedSpace
+	{
+	public:
+		TestGUIFixedSpace(UINT32 size)
+			:GUIFixedSpace(size)
+		{ }
+
+		void _updateLayoutInternal(const GUILayoutData& data) override
+		{
+			numLayoutUpdates++;
+			GUIFixedSpace::_updateLayoutInternal(data);
+		}
+
+		UINT32 numLayoutUpdates = 0;
+	};
+
+	/** Text sprite that exposes its geometry, so tests can check whether it was rebuilt. */
+	class TestTextSprite : public TextSprite
+	{
+	public:
+		/** Returns the first vertex of the first render element, or null if the sprite has no geometry. */
+		Vector2* getFirstVertex() const
+		{
+			if(mCachedRenderElements.empty() || mCachedRenderElements[0].numQuads == 0)
+				return nullptr;
+
+			return mCachedRenderElements[0].vertices;
+		}
+
+		/** Returns the total number of quads in all render elements. */
+		UINT32 getNumQuads() const
+		{
+			UINT32 numQuads = 0;
+			for(auto& renderElement : mCachedRenderElements)
+				numQuads += renderElement.numQuads;
+
+			return numQuads;
+		}
+	};
+
+	namespace ct
+	{
+		/** Per-object constants, laid out like the ones the renderer prepares for every renderable each frame. */
+		BS_PARAM_BLOCK_BEGIN(TestPerObjectParamDef)
+			BS_PARAM_BLOCK_ENTRY(Matrix4, gMatWorld)
+			BS_PARAM_BLOCK_ENTRY(Matrix4, gMatInvWorld)
+			BS_PARAM_BLOCK_ENTRY(Matrix4, gMatPrevWorld)
+			BS_PARAM_BLOCK_ENTRY(float, gWorldDeterminantSign)
+			BS_PARAM_BLOCK_ENTRY(INT32, gLayer)
+		BS_PARAM_BLOCK_END
+
+		TestPerObjectParamDef gTestPerObjectParamDef;
+	}
+
+	/**
+	 * Creates a shader with a single pass, whose vertex program exposes the requested number of float parameters named
+	 * gParam0, gParam1, ... in a single parameter block, one parameter per 16 bytes. The layout is provided through the
+	 * program bytecode, which the null render API reports as-is.
+	 */
+	HShader createTestParamShader(UINT32 numParams)
+	{
+		SPtr<GpuParamDesc> paramDesc = bs_shared_ptr_new<GpuParamDesc>();
+
+		GpuParamBlockDesc& blockDesc = paramDesc->paramBlocks["Params"];
+		blockDesc.name = "Params";
+		blockDesc.slot = 0;
+		blockDesc.set = 0;
+		blockDesc.blockSize = numParams * 4;
+		blockDesc.isShareable = true;
+
+		SHADER_DESC shaderDesc;
+		for(UINT32 i = 0; i < numParams; i++)
+		{
+			const String name = "gParam" + toString(i);
+
+			GpuParamDataDesc& dataDesc = paramDesc->params[name];
+			dataDesc.name = name;
+			dataDesc.elementSize = 1;
+			dataDesc.arraySize = 1;
+			dataDesc.arrayElementStride = 1;
+			dataDesc.type = GPDT_FLOAT1;
+			dataDesc.paramBlockSlot = 0;
+			dataDesc.paramBlockSet = 0;
+			dataDesc.gpuMemOffset = i * 4;
+			dataDesc.cpuMemOffset = i * 4;
+
+			shaderDesc.addParameter(SHADER_DATA_PARAM_DESC(name, name, GPDT_FLOAT1));
+		}
+
+		PASS_DESC passDesc;
+		passDesc.vertexProgramDesc.source = "void main() { }";
+		passDesc.vertexProgramDesc.language = "hlsl";
+		passDesc.vertexProgramDesc.entryPoint = "main";
+		passDesc.vertexProgramDesc.type = GPT_VERTEX_PROGRAM;
+		passDesc.vertexProgramDesc.bytecode = bs_shared_ptr_new<GpuProgramBytecode>();
+		passDesc.vertexProgramDesc.bytecode->paramDesc = paramDesc;
+
+		SPtr<Technique> technique = Technique::create("hlsl", { Pass::create(passDesc) });
+		technique->compile();
+
+		shaderDesc.techniques.push_back(technique);
+		return Shader::create("ParamsTestShader", shaderDesc);
+	}
+
+	/**
+	 * Starts the application using the null render API with a small hidden primary window, unless already started.
+	 * Modules cannot be restarted, so the application stays running until all tests finish.
+	 */
+	void startUpTestApplication()
+	{
+		if(Application::isStarted())
+			return;
+
+		START_UP_DESC desc;
+		desc.renderAPI = "bsfNullRenderAPI";
+		desc.renderer = BS_RENDERER_MODULE;
+		desc.audio = BS_AUDIO_MODULE;
+		desc.physics = BS_PHYSICS_MODULE;
+
+		desc.primaryWindowDesc.videoMode = VideoMode(64, 64);
+		desc.primaryWindowDesc.fullscreen = false;
+		desc.primaryWindowDesc.title = "EngineTest";
+		desc.primaryWindowDesc.hidden = true;
+
+		Application::startUp(desc);
+	}
+
+	class EngineTestSuite : public TestSuite
+	{
+	public:
+		EngineTestSuite();
+
+	private:
+		void testRenderQueueSort();
+		void testRenderQueueBatching();
+		void testInstancedDrawCalls();
+		void testStaticCullCache();
+		void testStaticShadowCasters();
+		void testParallelRenderQueues();
+		void testMaterialParamsUpdate();
+		void testParamBlockPool();
+		void testPerObjectConstants();
+		void testGUIMeshUpdate();
+		void testGUILayoutCache();
+		void testSpriteUpdateQueue();
+		void testPrefabInstantiation();
+		void testResourceMemoryBudget();
+	};
+
+	EngineTestSuite::EngineTestSuite()
+	{
+		BS_ADD_TEST(EngineTestSuite::testRenderQueueSort);
+		BS_ADD_TEST(EngineTestSuite::testRenderQueueBatching);
+		BS_ADD_TEST(EngineTestSuite::testInstancedDrawCalls);
+		BS_ADD_TEST(EngineTestSuite::testStaticCullCache);
+		BS_ADD_TEST(EngineTestSuite::testStaticShadowCasters);
+		BS_ADD_TEST(EngineTestSuite::testParallelRenderQueues);
+		BS_ADD_TEST(EngineTestSuite::testMaterialParamsUpdate);
+		BS_ADD_TEST(EngineTestSuite::testParamBlockPool);
+		BS_ADD_TEST(EngineTestSuite::testPerObjectConstants);
+		BS_ADD_TEST(EngineTestSuite::testGUIMeshUpdate);
+		BS_ADD_TEST(EngineTestSuite::testGUILayoutCache);
+		BS_ADD_TEST(EngineTestSuite::testSpriteUpdateQueue);
+		BS_ADD_TEST(EngineTestSuite::testPrefabInstantiation);
+		BS_ADD_TEST(EngineTestSuite::testResourceMemoryBudget);
+	}
+
+	void EngineTestSuite::testRenderQueueSort()
+	{
+		static constexpr UINT32 NUM_ITERATIONS = 10;
+
+		const UINT32 elementCounts[] = { 10000, 50000, 100000, 200000 };
+		const ct::StateReduction modes[] =
+			{ ct::StateReduction::None, ct::StateReduction::Material, ct::StateReduction::Distance };
+
+		for(auto& numElements : elementCounts)
+		{
+			for(auto& mode : modes)
+			{
+				Random random(1234);
+				TestRenderQueue queue(mode);
+
+				// Few priorities and shaders, and a subset of elements at the same distance, to test ties are stable
+				for(UINT32 i = 0; i < numElements; i++)
+				{
+					const float distance = (i % 8) == 0 ? 10.0f : random.getUNorm() * 1100.0f - 100.0f;
+					queue.addSortable(random.getRange(-2, 2) * 100, distance, random.getRange(0, 200),
+						random.getRange(0, 1), random.getRange(0, 3));
+				}
+
+				const Vector<UINT32> keySorted = queue.sortIndices(true);
+				const Vector<UINT32> comparisonSorted = queue.sortIndices(false);
+				BS_TEST_ASSERT(keySorted == comparisonSorted);
+
+				Timer timer;
+				for(UINT32 i = 0; i < NUM_ITERATIONS; i++)
+					queue.sortIndices(false);
+				const UINT64 comparisonUs = timer.getMicroseconds();
+
+				timer.reset();
+				for(UINT32 i = 0; i < NUM_ITERATIONS; i++)
+					queue.sortIndices(true);
+				const UINT64 keyUs = timer.getMicroseconds();
+
+				BS_LOG(Info, Generic, "Render queue sort benchmark ({0} elements x {1} iterations, state reduction "
+					"{2}): comparison sort {3} us, radix key sort {4} us.", numElements, NUM_ITERATIONS, (UINT32)mode,
+					comparisonUs, keyUs);
+			}
+		}
+	}
+
+	void EngineTestSuite::testRenderQueueBatching()
+	{
+		static constexpr UINT32 NUM_ELEMENTS = 10000;
+		static constexpr UINT32 NUM_BATCHES = 4;
+
+		const ct::StateReduction modes[] =
+			{ ct::StateReduction::None, ct::StateReduction::Material, ct::StateReduction::Distance };
+
+		for(auto& mode : modes)
+		{
+			Random random(1234);
+			TestRenderQueue queue(mode);
+
+			// Interleave batchable and non-batchable elements at random distances, using the same shader so the batches
+			// can only be kept apart by their batch ID
+			Vector<UINT32> batchIds(NUM_ELEMENTS);
+			for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+			{
+				batchIds[i] = (i % 3) == 0 ? 0 : random.getRange(1, NUM_BATCHES);
+				queue.addSortable(0, random.getUNorm() * 1000.0f, 0, 0, 0, batchIds[i]);
+			}
+
+			const Vector<UINT32> keySorted = queue.sortIndices(true);
+			const Vector<UINT32> comparisonSorted = queue.sortIndices(false);
+			BS_TEST_ASSERT(keySorted == comparisonSorted);
+
+			// Non-batchable elements come first, followed by each batch in a single contiguous run
+			UINT32 numRuns = 0;
+			UINT32 prevBatchId = 0;
+			for(auto& idx : keySorted)
+			{
+				BS_TEST_ASSERT(batchIds[idx] >= prevBatchId);
+
+				if(batchIds[idx] != prevBatchId)
+					numRuns++;
+
+				prevBatchId = batchIds[idx];
+			}
+
+			BS_TEST_ASSERT(numRuns == NUM_BATCHES);
+		}
+	}
+
+	void EngineTestSuite::testInstancedDrawCalls()
+	{
+		static constexpr UINT32 NUM_OBJECTS = 256;
+
+		startUpTestApplication();
+
+		HSceneObject cameraSO = SceneObject::create("Camera");
+		HCamera camera = cameraSO->addComponent<CCamera>();
+		camera->getViewport()->setTarget(gApplication().getPrimaryWindow());
+		camera->setMain(true);
+
+		// Alternate between two meshes at increasing distances, so that sorting purely by distance would place every
+		// element next to one using a different mesh
+		HMaterial material = Material::create(gBuiltinResources().getBuiltinShader(BuiltinShader::Standard));
+		const HMesh meshes[] = { gBuiltinResources().getMesh(BuiltinMesh::Box),
+			gBuiltinResources().getMesh(BuiltinMesh::Sphere) };
+
+		HSceneObject objectsSO = SceneObject::create("Objects");
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			HSceneObject objectSO = SceneObject::create("Object");
+			objectSO->setParent(objectsSO);
+			objectSO->setPosition(Vector3((float)(i % 16) * 2.0f - 16.0f, 0.0f, -5.0f - (float)i));
+
+			HRenderable renderable = objectSO->addComponent<CRenderable>();
+			renderable->setMesh(meshes[i % 2]);
+			renderable->setMaterial(material);
+		}
+
+		// Returns the number of draw calls issued by a single frame
+		auto getFrameDrawCalls = []()
+		{
+			UINT64 numDrawCalls[2];
+			for(auto& entry : numDrawCalls)
+			{
+				gApplication().runMainLoopFrame();
+				gApplication().waitUntilFrameFinished();
+				gCoreThread().submitAll(true);
+
+				gCoreThread().queueCommand([&entry]()
+					{ entry = RenderStats::instance().getData().numDrawCalls; },
+					CTQF_InternalQueue | CTQF_BlockUntilComplete);
+			}
+
+			return numDrawCalls[1] - numDrawCalls[0];
+		};
+
+		gApplication().beginMainLoop();
+
+		objectsSO->setActive(false);
+		const UINT64 emptyDrawCalls = getFrameDrawCalls();
+
+		objectsSO->setActive(true);
+		const UINT64 objectDrawCalls = getFrameDrawCalls() - emptyDrawCalls;
+
+		gApplication().endMainLoop();
+
+		BS_LOG(Info, Generic, "Instanced draw calls ({0} objects, 2 meshes): {1} draw calls without objects, {2} draw "
+			"calls for objects.", NUM_OBJECTS, emptyDrawCalls, objectDrawCalls);
+
+		// Each mesh should be rendered using only a few instanced draw calls
+		BS_TEST_ASSERT(objectDrawCalls > 0);
+		BS_TEST_ASSERT(objectDrawCalls <= 16);
+
+		material = nullptr;
+		objectsSO->destroy();
+		cameraSO->destroy();
+	}
+
+	void EngineTestSuite::testStaticCullCache()
+	{
+		static constexpr UINT32 NUM_OBJECTS = 64;
+		static constexpr UINT32 NUM_FRAMES = 4;
+
+		startUpTestApplication();
+
+		HSceneObject cameraSO = SceneObject::create("Camera");
+		HCamera camera = cameraSO->addComponent<CCamera>();
+		camera->getViewport()->setTarget(gApplication().getPrimaryWindow());
+		camera->setMain(true);
+
+		HMaterial material = Material::create(gBuiltinResources().getBuiltinShader(BuiltinShader::Standard));
+		HMesh mesh = gBuiltinResources().getMesh(BuiltinMesh::Box);
+
+		// Static objects placed well within the view frustum, so their visibility can be cached while the camera is
+		// not moving
+		HSceneObject objectsSO = SceneObject::create("Objects");
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			HSceneObject objectSO = SceneObject::create("Object");
+			objectSO->setParent(objectsSO);
+			objectSO->setPosition(Vector3((float)(i % 8) - 4.0f, (float)(i / 8) - 4.0f, -30.0f));
+			objectSO->setMobility(ObjectMobility::Static);
+
+			HRenderable renderable = objectSO->addComponent<CRenderable>();
+			renderable->setMesh(mesh);
+			renderable->setMaterial(material);
+		}
+
+		gApplication().beginMainLoop();
+
+		RenderStatsData stats[2];
+		for(UINT32 i = 0; i < NUM_FRAMES; i++)
+		{
+			gApplication().runMainLoopFrame();
+			gApplication().waitUntilFrameFinished();
+			gCoreThread().submitAll(true);
+
+			RenderStatsData& entry = stats[i < NUM_FRAMES - 1 ? 0 : 1];
+			gCoreThread().queueCommand([&entry]()
+				{ entry = RenderStats::instance().getData(); },
+				CTQF_InternalQueue | CTQF_BlockUntilComplete);
+		}
+
+		gApplication().endMainLoop();
+
+		const UINT64 numTested = stats[1].numCullTests - stats[0].numCullTests;
+		const UINT64 numCached = stats[1].numCullCached - stats[0].numCullCached;
+
+		BS_LOG(Info, Generic, "Static culling ({0} objects): {1} tested, {2} cached in the last frame.", NUM_OBJECTS,
+			numTested, numCached);
+
+		// Every object should be accounted for, and most of them shouldn't need testing once the cache is built
+		BS_TEST_ASSERT(numTested + numCached >= NUM_OBJECTS);
+		BS_TEST_ASSERT(numCached >= NUM_OBJECTS / 2);
+
+		material = nullptr;
+		objectsSO->destroy();
+		cameraSO->destroy();
+	}
+
+	void EngineTestSuite::testStaticShadowCasters()
+	{
+		static constexpr UINT32 NUM_OBJECTS = 16;
+
+		startUpTestApplication();
+
+		HSceneObject cameraSO = SceneObject::create("Camera");
+		HCamera camera = cameraSO->addComponent<CCamera>();
+		camera->getViewport()->setTarget(gApplication().getPrimaryWindow());
+		camera->setMain(true);
+
+		HSceneObject lightSO = SceneObject::create("Light");
+		lightSO->setPosition(Vector3(0.0f, 5.0f, 0.0f));
+		lightSO->lookAt(Vector3(0.0f, 0.0f, -10.0f));
+		lightSO->setMobility(ObjectMobility::Static);
+
+		HLight light = lightSO->addComponent<CLight>();
+		light->setType(LightType::Spot);
+		light->setSpotAngle(Degree(90.0f));
+		light->setAttenuationRadius(50.0f);
+		light->setCastsShadow(true);
+
+		HMaterial material = Material::create(gBuiltinResources().getBuiltinShader(BuiltinShader::Standard));
+		HMesh mesh = gBuiltinResources().getMesh(BuiltinMesh::Box);
+
+		HSceneObject objectsSO = SceneObject::create("Objects");
+		Vector<HSceneObject> objects;
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			HSceneObject objectSO = SceneObject::create("Object");
+			objectSO->setParent(objectsSO);
+			objectSO->setPosition(Vector3((float)(i % 4) * 2.0f - 3.0f, 0.0f, -8.0f - (float)(i / 4) * 2.0f));
+			objectSO->setMobility(ObjectMobility::Static);
+
+			HRenderable renderable = objectSO->addComponent<CRenderable>();
+			renderable->setMesh(mesh);
+			renderable->setMaterial(material);
+
+			objects.push_back(objectSO);
+		}
+
+		// Returns the render statistics of a single frame
+		auto getFrameStats = []()
+		{
+			RenderStatsData stats[2];
+			for(auto& entry : stats)
+			{
+				gApplication().runMainLoopFrame();
+				gApplication().waitUntilFrameFinished();
+				gCoreThread().submitAll(true);
+
+				gCoreThread().queueCommand([&entry]()
+					{ entry = RenderStats::instance().getData(); },
+					CTQF_InternalQueue | CTQF_BlockUntilComplete);
+			}
+
+			RenderStatsData output;
+			output.numShadowCastersRendered = stats[1].numShadowCastersRendered - stats[0].numShadowCastersRendered;
+			output.numShadowCastersCached = stats[1].numShadowCastersCached - stats[0].numShadowCastersCached;
+
+			return output;
+		};
+
+		gApplication().beginMainLoop();
+
+		// Give the static layer a chance to be rendered, after which the static casters should be skipped
+		for(UINT32 i = 0; i < 2; i++)
+			getFrameStats();
+
+		const RenderStatsData cachedStats = getFrameStats();
+
+		// Moving a single static caster should invalidate the static layer
+		objects[0]->move(Vector3(0.0f, 0.5f, 0.0f));
+		gApplication().runMainLoopFrame();
+		gApplication().waitUntilFrameFinished();
+		gCoreThread().submitAll(true);
+
+		const RenderStatsData movedStats = getFrameStats();
+
+		gApplication().endMainLoop();
+
+		BS_LOG(Info, Generic, "Static shadow casters ({0} objects): {1} rendered and {2} cached while static, {3} "
+			"rendered and {4} cached after a move.", NUM_OBJECTS, cachedStats.numShadowCastersRendered,
+			cachedStats.numShadowCastersCached, movedStats.numShadowCastersRendered, movedStats.numShadowCastersCached);
+
+		BS_TEST_ASSERT(cachedStats.numShadowCastersCached > 0);
+		BS_TEST_ASSERT(cachedStats.numShadowCastersRendered == 0);
+		BS_TEST_ASSERT(movedStats.numShadowCastersRendered > 0);
+
+		material = nullptr;
+		objectsSO->destroy();
+		lightSO->destroy();
+		cameraSO->destroy();
+	}
+
+	void EngineTestSuite::testParallelRenderQueues()
+	{
+		static constexpr UINT32 NUM_OBJECTS = 8192;
+		static constexpr UINT32 NUM_FRAMES = 8;
+
+		startUpTestApplication();
+
+		// Two views, so the view queues can be built in parallel as well as the shadow caster queues
+		HSceneObject camerasSO = SceneObject::create("Cameras");
+		for(UINT32 i = 0; i < 2; i++)
+		{
+			HSceneObject cameraSO = SceneObject::create("Camera");
+			cameraSO->setParent(camerasSO);
+			cameraSO->setPosition(Vector3((float)i, 0.0f, 0.0f));
+
+			HCamera camera = cameraSO->addComponent<CCamera>();
+			camera->getViewport()->setTarget(gApplication().getPrimaryWindow());
+			camera->setMain(i == 0);
+		}
+
+		HSceneObject lightSO = SceneObject::create("Light");
+		lightSO->setPosition(Vector3(0.0f, 40.0f, -40.0f));
+		lightSO->lookAt(Vector3(0.0f, 0.0f, -40.0f));
+
+		HLight light = lightSO->addComponent<CLight>();
+		light->setType(LightType::Spot);
+		light->setSpotAngle(Degree(120.0f));
+		light->setAttenuationRadius(200.0f);
+		light->setCastsShadow(true);
+
+		HMaterial material = Material::create(gBuiltinResources().getBuiltinShader(BuiltinShader::Standard));
+		HMesh meshes[] = { gBuiltinResources().getMesh(BuiltinMesh::Box), gBuiltinResources().getMesh(BuiltinMesh::Sphere) };
+
+		// Movable casters, so the shadow map is re-rendered every frame
+		HSceneObject objectsSO = SceneObject::create("Objects");
+		for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			HSceneObject objectSO = SceneObject::create("Object");
+			objectSO->setParent(objectsSO);
+			objectSO->setPosition(Vector3((float)(i % 128) * 0.5f - 32.0f, -2.0f, -10.0f - (float)(i / 128) * 0.5f));
+
+			HRenderable renderable = objectSO->addComponent<CRenderable>();
+			renderable->setMesh(meshes[i % 2]);
+			renderable->setMaterial(material);
+		}
+
+		// Returns the render statistics of the last of NUM_FRAMES frames, and the average time per frame
+		auto runFrames = [](RenderStatsData& output)
+		{
+			RenderStatsData stats[2];
+
+			Timer timer;
+			for(UINT32 i = 0; i < NUM_FRAMES; i++)
+			{
+				gApplication().runMainLoopFrame();
+				gApplication().waitUntilFrameFinished();
+				gCoreThread().submitAll(true);
+
+				if(i < NUM_FRAMES - 2)
+					continue;
+
+				RenderStatsData& entry = stats[i < NUM_FRAMES - 1 ? 0 : 1];
+				gCoreThread().queueCommand([&entry]()
+					{ entry = RenderStats::instance().getData(); },
+					CTQF_InternalQueue | CTQF_BlockUntilComplete);
+			}
+			const UINT64 frameUs = timer.getMicroseconds() / NUM_FRAMES;
+
+			output.numDrawCalls = stats[1].numDrawCalls - stats[0].numDrawCalls;
+			output.numShadowCastersRendered = stats[1].numShadowCastersRendered - stats[0].numShadowCastersRendered;
+
+			return frameUs;
+		};
+
+		TaskScheduler& scheduler = TaskScheduler::instance();
+		const UINT32 originalNumWorkers = scheduler.getNumWorkers();
+
+		// Changes the number of tasks the scheduler runs in parallel
+		auto setNumWorkers = [&scheduler](UINT32 count)
+		{
+			while(scheduler.getNumWorkers() < count)
+				scheduler.addWorker();
+
+			while(scheduler.getNumWorkers() > count)
+				scheduler.removeWorker();
+		};
+
+		gApplication().beginMainLoop();
+
+		const UINT32 workerCounts[] = { 1, 2, 4, 8 };
+		RenderStatsData stats[bs_size(workerCounts)];
+		UINT64 frameUs[bs_size(workerCounts)];
+		for(UINT32 i = 0; i < bs_size(workerCounts); i++)
+		{
+			setNumWorkers(workerCounts[i]);
+			frameUs[i] = runFrames(stats[i]);
+
+			BS_LOG(Info, Generic, "Parallel render queues ({0} shadow casters, 2 views, {1} workers): {2} us per frame, "
+				"{3} casters rendered, {4} draw calls.", NUM_OBJECTS, workerCounts[i], frameUs[i],
+				stats[i].numShadowCastersRendered, stats[i].numDrawCalls);
+		}
+
+		setNumWorkers(originalNumWorkers);
+		gApplication().endMainLoop();
+
+		// Splitting the work between workers must not change what gets rendered
+		BS_TEST_ASSERT(stats[0].numShadowCastersRendered >= NUM_OBJECTS / 2);
+		for(UINT32 i = 1; i < bs_size(workerCounts); i++)
+		{
+			BS_TEST_ASSERT(stats[i].numShadowCastersRendered == stats[0].numShadowCastersRendered);
+			BS_TEST_ASSERT(stats[i].numDrawCalls == stats[0].numDrawCalls);
+		}
+
+		material = nullptr;
+		objectsSO->destroy();
+		lightSO->destroy();
+		camerasSO->destroy();
+	}
+
+	void EngineTestSuite::testMaterialParamsUpdate()
+	{
+		static constexpr UINT32 NUM_MATERIALS = 10000;
+		static constexpr UINT32 NUM_PARAMS = 100;
+
+		startUpTestApplication();
+
+		HShader shader = createTestParamShader(NUM_PARAMS);
+		SPtr<ct::Shader> coreShader = shader->getCore();
+
+		UINT64 unchangedUs = 0;
+		UINT64 oneModifiedUs = 0;
+		UINT64 fullUs = 0;
+		float updatedValue = 0.0f;
+		gCoreThread().queueCommand([&]()
+		{
+			Vector<SPtr<ct::Material>> materials(NUM_MATERIALS);
+			Vector<SPtr<ct::GpuParamsSet>> paramsSets(NUM_MATERIALS);
+			for(UINT32 i = 0; i < NUM_MATERIALS; i++)
+			{
+				materials[i] = ct::Material::create(coreShader);
+				paramsSets[i] = materials[i]->createParamsSet();
+				materials[i]->updateParamsSet(paramsSets[i], 0.0f, true);
+			}
+
+			// Most materials don't change between frames, and should cost next to nothing
+			Timer timer;
+			for(UINT32 i = 0; i < NUM_MATERIALS; i++)
+				materials[i]->updateParamsSet(paramsSets[i]);
+			unchangedUs = timer.getMicroseconds();
+
+			timer.reset();
+			for(UINT32 i = 0; i < NUM_MATERIALS; i++)
+			{
+				materials[i]->setFloat("gParam" + toString(i % NUM_PARAMS), (float)i);
+				materials[i]->updateParamsSet(paramsSets[i]);
+			}
+			oneModifiedUs = timer.getMicroseconds();
+
+			// Parameters are laid out one per 16 bytes, see createTestParamShader()
+			const UINT32 checkIdx = NUM_MATERIALS - 1;
+			SPtr<ct::GpuParamBlockBuffer> buffer = paramsSets[checkIdx]->getGpuParams()->getParamBlockBuffer(0, 0);
+			buffer->read((checkIdx % NUM_PARAMS) * 4 * sizeof(float), &updatedValue, sizeof(float));
+
+			timer.reset();
+			for(UINT32 i = 0; i < NUM_MATERIALS; i++)
+				materials[i]->updateParamsSet(paramsSets[i], 0.0f, true);
+			fullUs = timer.getMicroseconds();
+		}, CTQF_InternalQueue | CTQF_BlockUntilComplete);
+
+		// Parameters must actually be bound and written, or the benchmark would measure empty parameter sets
+		BS_TEST_ASSERT(updatedValue == (float)(NUM_MATERIALS - 1));
+		BS_TEST_ASSERT(unchangedUs < fullUs);
+
+		BS_LOG(Info, Generic, "Material params update benchmark ({0} materials, {1} parameters each): unchanged "
+			"materials {2} us, one modified parameter per material {3} us, full update {4} us.", NUM_MATERIALS, NUM_PARAMS,
+			unchangedUs, oneModifiedUs, fullUs);
+	}
+
+	void EngineTestSuite::testParamBlockPool()
+	{
+		static constexpr UINT32 NUM_BUFFERS = 1000;
+		static constexpr UINT32 BUFFER_SIZE = 272;
+
+		startUpTestApplication();
+
+		UINT64 numHits = 0;
+		UINT64 numMisses = 0;
+		UINT64 numPooledCreated = 0;
+		UINT64 numCreated = 0;
+		UINT64 createUs = 0;
+		UINT64 pooledUs = 0;
+		gCoreThread().queueCommand([&]()
+		{
+			ct::GpuResourcePool& pool = ct::gGpuResourcePool();
+			Vector<SPtr<ct::GpuParamBlockBuffer>> buffers(NUM_BUFFERS);
+
+			// Fill the pool, then release everything back into it
+			for(UINT32 i = 0; i < NUM_BUFFERS; i++)
+				buffers[i] = pool.allocParamBlockBuffer(BUFFER_SIZE);
+
+			for(auto& entry : buffers)
+				pool.releaseParamBlockBuffer(entry);
+
+			// Every subsequent allocation should be satisfied by a released buffer
+			const UINT64 hitsBefore = pool.getParamBlockHits();
+			const UINT64 missesBefore = pool.getParamBlockMisses();
+			const UINT64 createdBefore = RenderStats::instance().getData().numParamBuffersCreated;
+
+			Timer timer;
+			for(UINT32 i = 0; i < NUM_BUFFERS; i++)
+				buffers[i] = pool.allocParamBlockBuffer(BUFFER_SIZE);
+
+			for(auto& entry : buffers)
+				pool.releaseParamBlockBuffer(entry);
+			pooledUs = timer.getMicroseconds();
+
+			numHits = pool.getParamBlockHits() - hitsBefore;
+			numMisses = pool.getParamBlockMisses() - missesBefore;
+
+			const UINT64 pooledCreated = RenderStats::instance().getData().numParamBuffersCreated;
+			numPooledCreated = pooledCreated - createdBefore;
+
+			timer.reset();
+			for(UINT32 i = 0; i < NUM_BUFFERS; i++)
+				buffers[i] = ct::GpuParamBlockBuffer::create(BUFFER_SIZE);
+
+			buffers.clear();
+			createUs = timer.getMicroseconds();
+
+			numCreated = RenderStats::instance().getData().numParamBuffersCreated - pooledCreated;
+		}, CTQF_InternalQueue | CTQF_BlockUntilComplete);
+
+		BS_TEST_ASSERT(numHits == NUM_BUFFERS);
+		BS_TEST_ASSERT(numMisses == 0);
+
+		// The render API must not see any buffer creations while the pool is warm
+		BS_TEST_ASSERT(numPooledCreated == 0);
+		BS_TEST_ASSERT(numCreated == NUM_BUFFERS);
+
+		BS_LOG(Info, Generic, "Param block pool benchmark ({0} buffers): pooled alloc/release {1} us, "
+			"create/destroy {2} us.", NUM_BUFFERS, pooledUs, createUs);
+	}
+
+	void EngineTestSuite::testPerObjectConstants()
+	{
+		static constexpr UINT32 NUM_OBJECTS = 50000;
+		static constexpr UINT32 NUM_FRAMES = 4;
+		static constexpr UINT32 NUM_RENDERABLES = 64;
+
+		startUpTestApplication();
+
+		UINT32 blockSize = 0;
+		UINT64 persistentUs = 0;
+		UINT64 recreateUs = 0;
+		RenderStatsData persistentStats;
+		RenderStatsData recreateStats;
+		gCoreThread().queueCommand([&]()
+		{
+			Random random(1234);
+			Vector<Matrix4> transforms(NUM_OBJECTS);
+			for(auto& entry : transforms)
+			{
+				const Vector3 position(random.getSNorm() * 100.0f, random.getSNorm() * 100.0f, random.getSNorm() * 100.0f);
+				const Quaternion rotation(Degree(random.getUNorm() * 360.0f), Degree(0.0f), Degree(0.0f));
+
+				entry = Matrix4::TRS(position, rotation, Vector3::ONE);
+			}
+
+			const ct::TestPerObjectParamDef& paramDef = ct::gTestPerObjectParamDef;
+
+			// Prepares the constants of every object and uploads them, as the renderer does once per frame
+			auto writeFrame = [&transforms, &paramDef](Vector<SPtr<ct::GpuParamBlockBuffer>>& buffers, bool recreate)
+			{
+				for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+				{
+					if(recreate)
+						buffers[i] = paramDef.createBuffer();
+
+					const Matrix4& transform = transforms[i];
+					paramDef.gMatWorld.set(buffers[i], transform);
+					paramDef.gMatInvWorld.set(buffers[i], transform.inverseAffine());
+					paramDef.gMatPrevWorld.set(buffers[i], transform);
+					paramDef.gWorldDeterminantSign.set(buffers[i], transform.determinant3x3() >= 0.0f ? 1.0f : -1.0f);
+					paramDef.gLayer.set(buffers[i], (INT32)(i % 32));
+
+					buffers[i]->flushToGPU();
+				}
+			};
+
+			// Buffers held by the objects for their lifetime, created once and rewritten every frame
+			Vector<SPtr<ct::GpuParamBlockBuffer>> buffers(NUM_OBJECTS);
+			for(auto& entry : buffers)
+				entry = paramDef.allocBuffer();
+
+			blockSize = buffers[0]->getSize();
+			writeFrame(buffers, false);
+
+			RenderStatsData before = RenderStats::instance().getData();
+			Timer timer;
+			for(UINT32 i = 0; i < NUM_FRAMES; i++)
+				writeFrame(buffers, false);
+			persistentUs = timer.getMicroseconds() / NUM_FRAMES;
+
+			RenderStatsData after = RenderStats::instance().getData();
+			persistentStats.numParamBuffersCreated = after.numParamBuffersCreated - before.numParamBuffersCreated;
+			persistentStats.numBufferBytesWritten = after.numBufferBytesWritten - before.numBufferBytesWritten;
+
+			for(auto& entry : buffers)
+				ct::ParamBlock::releaseBuffer(entry);
+
+			// Buffers created anew every frame, which is what the persistent buffers avoid
+			before = RenderStats::instance().getData();
+			timer.reset();
+			for(UINT32 i = 0; i < NUM_FRAMES; i++)
+				writeFrame(buffers, true);
+			recreateUs = timer.getMicroseconds() / NUM_FRAMES;
+
+			after = RenderStats::instance().getData();
+			recreateStats.numParamBuffersCreated = after.numParamBuffersCreated - before.numParamBuffersCreated;
+			recreateStats.numBufferBytesWritten = after.numBufferBytesWritten - before.numBufferBytesWritten;
+		}, CTQF_InternalQueue | CTQF_BlockUntilComplete);
+
+		BS_LOG(Info, Generic, "Per-object constants benchmark ({0} objects, {1} bytes each): persistent buffers {2} us "
+			"per frame, buffers created every frame {3} us per frame.", NUM_OBJECTS, blockSize, persistentUs, recreateUs);
+
+		// Every object's constants reach the render API each frame, but no buffers are created in the steady state
+		BS_TEST_ASSERT(blockSize > 0);
+		BS_TEST_ASSERT(persistentStats.numParamBuffersCreated == 0);
+		BS_TEST_ASSERT(persistentStats.numBufferBytesWritten == (UINT64)NUM_OBJECTS * blockSize * NUM_FRAMES);
+		BS_TEST_ASSERT(recreateStats.numParamBuffersCreated == (UINT64)NUM_OBJECTS * NUM_FRAMES);
+		BS_TEST_ASSERT(recreateStats.numBufferBytesWritten == (UINT64)NUM_OBJECTS * blockSize * NUM_FRAMES);
+
+		// The same must hold for the renderer itself, once a scene has been rendered a few times
+		HSceneObject cameraSO = SceneObject::create("Camera");
+		HCamera camera = cameraSO->addComponent<CCamera>();
+		camera->getViewport()->setTarget(gApplication().getPrimaryWindow());
+		camera->setMain(true);
+
+		HMaterial material = Material::create(gBuiltinResources().getBuiltinShader(BuiltinShader::Standard));
+		HMesh mesh = gBuiltinResources().getMesh(BuiltinMesh::Box);
+
+		HSceneObject objectsSO = SceneObject::create("Objects");
+		for(UINT32 i = 0; i < NUM_RENDERABLES; i++)
+		{
+			HSceneObject objectSO = SceneObject::create("Object");
+			objectSO->setParent(objectsSO);
+			objectSO->setPosition(Vector3((float)(i % 8) - 4.0f, (float)(i / 8) - 4.0f, -30.0f));
+
+			HRenderable renderable = objectSO->addComponent<CRenderable>();
+			renderable->setMesh(mesh);
+			renderable->setMaterial(material);
+		}
+
+		gApplication().beginMainLoop();
+
+		RenderStatsData stats[2];
+		for(UINT32 i = 0; i < NUM_FRAMES; i++)
+		{
+			gApplication().runMainLoopFrame();
+			gApplication().waitUntilFrameFinished();
+			gCoreThread().submitAll(true);
+
+			RenderStatsData& entry = stats[i < NUM_FRAMES - 1 ? 0 : 1];
+			gCoreThread().queueCommand([&entry]()
+				{ entry = RenderStats::instance().getData(); },
+				CTQF_InternalQueue | CTQF_BlockUntilComplete);
+		}
+
+		gApplication().endMainLoop();
+
+		const UINT64 numCreated = stats[1].numParamBuffersCreated - stats[0].numParamBuffersCreated;
+		const UINT64 numBytesWritten = stats[1].numBufferBytesWritten - stats[0].numBufferBytesWritten;
+		const UINT64 numBinds = stats[1].numGpuParamBinds - stats[0].numGpuParamBinds;
+
+		BS_LOG(Info, Generic, "Renderer steady state ({0} objects): {1} param buffers created, {2} bytes written, {3} "
+			"parameter binds in the last frame.", NUM_RENDERABLES, numCreated, numBytesWritten, numBinds);
+
+		BS_TEST_ASSERT(numCreated == 0);
+		BS_TEST_ASSERT(numBytesWritten > 0);
+		BS_TEST_ASSERT(numBinds > 0);
+
+		material = nullptr;
+		objectsSO->destroy();
+		cameraSO->destroy();
+	}
+
+	void EngineTestSuite::testGUIMeshUpdate()
+	{
+		static constexpr UINT32 NUM_ELEMENTS = 10000;
+		static constexpr UINT32 NUM_FRAMES = 20;
+
+		startUpTestApplication();
+
+		HSceneObject cameraSO = SceneObject::create("Camera");
+		HCamera camera = cameraSO->addComponent<CCamera>();
+		camera->getViewport()->setTarget(gApplication().getPrimaryWindow());
+
+		HSceneObject guiSO = SceneObject::create("GUI");
+		HGUIWidget widget = guiSO->addComponent<CGUIWidget>(camera);
+		widget->setSkin(gBuiltinResources().getGUISkin());
+
+		// Fixed size labels, so changing their text doesn't change their bounds
+		Vector<GUILabel*> labels(NUM_ELEMENTS);
+		for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+		{
+			labels[i] = widget->getPanel()->addNewElement<GUILabel>(HString("A000"));
+			labels[i]->setPosition((INT32)(i % 8) * 8, (INT32)((i / 8) % 8) * 8);
+			labels[i]->setSize(8, 8);
+		}
+
+		gApplication().beginMainLoop();
+
+		auto runFrame = []()
+		{
+			gApplication().runMainLoopFrame();
+			gApplication().waitUntilFrameFinished();
+			gCoreThread().submitAll(true);
+		};
+
+		// Build the initial meshes
+		runFrame();
+
+		GUIManager& guiManager = gGUIManager();
+		const Viewport* viewport = camera->getViewport().get();
+
+		// Same number of characters, allowing the meshes to be updated in place and only the modified label uploaded
+		UINT64 numRebuilds = guiManager.getNumMeshRebuilds();
+		UINT64 numInPlaceUpdates = guiManager.getNumInPlaceMeshUpdates();
+
+		Timer timer;
+		for(UINT32 i = 0; i < NUM_FRAMES; i++)
+		{
+			labels[i]->setContent(GUIContent(HString("B000")));
+			runFrame();
+		}
+		const UINT64 partialUs = timer.getMicroseconds();
+
+		BS_TEST_ASSERT(guiManager.getNumMeshRebuilds() == numRebuilds);
+		BS_TEST_ASSERT(guiManager.getNumInPlaceMeshUpdates() == numInPlaceUpdates + NUM_FRAMES);
+
+		// Changing the depth to the same value forces a full rebuild of the unchanged GUI, whose output must match
+		// the in-place updated meshes exactly
+		SPtr<MeshData> inPlaceData = guiManager.getMeshData(viewport, false);
+
+		widget->setDepth(widget->getDepth());
+		runFrame();
+
+		BS_TEST_ASSERT(guiManager.getNumMeshRebuilds() == numRebuilds + 1);
+
+		SPtr<MeshData> rebuiltData = guiManager.getMeshData(viewport, false);
+		BS_TEST_ASSERT(inPlaceData != nullptr && rebuiltData != nullptr && inPlaceData != rebuiltData);
+		if(inPlaceData != nullptr && rebuiltData != nullptr)
+		{
+			BS_TEST_ASSERT(inPlaceData->getSize() == rebuiltData->getSize() &&
+				memcmp(inPlaceData->getData(), rebuiltData->getData(), inPlaceData->getSize()) == 0);
+		}
+
+		// Different number of characters, requiring the meshes to be rebuilt and uploaded in full
+		numRebuilds = guiManager.getNumMeshRebuilds();
+		numInPlaceUpdates = guiManager.getNumInPlaceMeshUpdates();
+
+		timer.reset();
+		for(UINT32 i = 0; i < NUM_FRAMES; i++)
+		{
+			labels[i]->setContent(GUIContent(HString("C0")));
+			runFrame();
+		}
+		const UINT64 rebuildUs = timer.getMicroseconds();
+
+		BS_TEST_ASSERT(guiManager.getNumMeshRebuilds() == numRebuilds + NUM_FRAMES);
+		BS_TEST_ASSERT(guiManager.getNumInPlaceMeshUpdates() == numInPlaceUpdates);
+
+		gApplication().endMainLoop();
+
+		BS_LOG(Info, Generic, "GUI mesh update benchmark ({0} elements, one modified per frame, {1} frames): "
+			"in-place partial upload {2} us, full rebuild {3} us.", NUM_ELEMENTS, NUM_FRAMES, partialUs, rebuildUs);
+
+		guiSO->destroy();
+		cameraSO->destroy();
+	}
+
+	void EngineTestSuite::testGUILayoutCache()
+	{
+		startUpTestApplication();
+
+		HSceneObject cameraSO = SceneObject::create("Camera");
+		HCamera camera = cameraSO->addComponent<CCamera>();
+		camera->getViewport()->setTarget(gApplication().getPrimaryWindow());
+
+		HSceneObject guiSO = SceneObject::create("GUI");
+		HGUIWidget widget = guiSO->addComponent<CGUIWidget>(camera);
+		widget->setSkin(gBuiltinResources().getGUISkin());
+
+		// Two rows sharing a parent layout, each with a label followed by a space
+		GUILayoutY* rows = widget->getPanel()->addNewElement<GUILayoutY>();
+		GUILayoutX* rowA = rows->addNewElement<GUILayoutX>();
+		GUILayoutX* rowB = rows->addNewElement<GUILayoutX>();
+
+		GUILabel* labelA = rowA->addNewElement<GUILabel>(HString("A"));
+		TestGUIFixedSpace* spaceA = bs_new<TestGUIFixedSpace>(4);
+		rowA->addElement(spaceA);
+
+		rowB->addNewElement<GUILabel>(HString("B"));
+		TestGUIFixedSpace* spaceB = bs_new<TestGUIFixedSpace>(4);
+		rowB->addElement(spaceB);
+
+		auto runFrame = []()
+		{
+			gApplication().runMainLoopFrame();
+			gApplication().waitUntilFrameFinished();
+			gCoreThread().submitAll(true);
+		};
+
+		gApplication().beginMainLoop();
+
+		runFrame();
+		BS_TEST_ASSERT(spaceA->numLayoutUpdates > 0);
+		BS_TEST_ASSERT(spaceB->numLayoutUpdates > 0);
+
+		// Widening the first label moves the first space, while the second row stays the same and should be skipped
+		spaceA->numLayoutUpdates = 0;
+		spaceB->numLayoutUpdates = 0;
+
+		labelA->setContent(GUIContent(HString("AAAAAAAA")));
+		runFrame();
+
+		BS_TEST_ASSERT(spaceA->numLayoutUpdates == 1);
+		BS_TEST_ASSERT(spaceB->numLayoutUpdates == 0);
+
+		// Nothing should remain marked for a layout update, or the next update couldn't skip anything
+		BS_TEST_ASSERT(!widget->getPanel()->_isLayoutDirty());
+		BS_TEST_ASSERT(!rows->_isLayoutDirty());
+		BS_TEST_ASSERT(!rowA->_isLayoutDirty());
+		BS_TEST_ASSERT(!labelA->_isLayoutDirty());
+		BS_TEST_ASSERT(!spaceA->_isLayoutDirty());
+
+		// Without any changes, no layout should be updated at all
+		spaceA->numLayoutUpdates = 0;
+		runFrame();
+
+		BS_TEST_ASSERT(spaceA->numLayoutUpdates == 0);
+		BS_TEST_ASSERT(spaceB->numLayoutUpdates == 0);
+
+		gApplication().endMainLoop();
+
+		guiSO->destroy();
+		cameraSO->destroy();
+	}
+
+	void EngineTestSuite::testSpriteUpdateQueue()
+	{
+		static constexpr UINT32 NUM_SPRITES = 50000;
+		static constexpr UINT32 NUM_LABELS = 5000;
+
+		startUpTestApplication();
+
+		SpriteManager& spriteManager = SpriteManager::instance();
+
+		TEXT_SPRITE_DESC desc;
+		desc.font = gBuiltinResources().getDefaultFont();
+		desc.fontSize = 8;
+		desc.width = 200;
+		desc.height = 20;
+		desc.text = "Queued";
+
+		// Geometry is only built once the queued updates are processed
+		TestTextSprite sprite;
+		spriteManager.queueUpdate(&sprite, desc, 0);
+		BS_TEST_ASSERT(sprite.getNumRenderElements() == 0);
+
+		spriteManager.processQueuedUpdates();
+		BS_TEST_ASSERT(sprite.getNumQuads() == 6);
+
+		// Queuing a sprite again replaces its previously queued update
+		desc.text = "A";
+		spriteManager.queueUpdate(&sprite, desc, 0);
+		desc.text = "AB";
+		spriteManager.queueUpdate(&sprite, desc, 0);
+
+		spriteManager.processQueuedUpdates();
+		BS_TEST_ASSERT(sprite.getNumQuads() == 2);
+
+		// Updates of destroyed sprites are cancelled, without affecting other queued updates
+		TextSprite* destroyedSprite = bs_new<TextSprite>();
+		spriteManager.queueUpdate(destroyedSprite, desc, 0);
+
+		desc.text = "ABC";
+		spriteManager.queueUpdate(&sprite, desc, 0);
+
+		bs_delete(destroyedSprite);
+		spriteManager.processQueuedUpdates();
+		BS_TEST_ASSERT(sprite.getNumQuads() == 3);
+
+		// Changing only the material keeps the existing layout, so a marker written into the geometry must survive
+		const Vector2 marker(-12345.0f, -12345.0f);
+		Vector2* vertex = sprite.getFirstVertex();
+		BS_TEST_ASSERT(vertex != nullptr);
+		*vertex = marker;
+
+		desc.color = Color::Red;
+		spriteManager.queueUpdate(&sprite, desc, 1);
+		spriteManager.processQueuedUpdates();
+
+		SpriteRenderElement renderElem;
+		sprite.getRenderElementInfo(0, renderElem);
+		BS_TEST_ASSERT(renderElem.matInfo->tint == Color::Red);
+		BS_TEST_ASSERT(renderElem.matInfo->groupId == 1);
+		BS_TEST_ASSERT(sprite.getFirstVertex() == vertex && *vertex == marker);
+
+		// Any change that affects the layout rebuilds the geometry
+		desc.width = 100;
+		spriteManager.queueUpdate(&sprite, desc, 1);
+		spriteManager.processQueuedUpdates();
+
+		vertex = sprite.getFirstVertex();
+		BS_TEST_ASSERT(vertex != nullptr && *vertex != marker);
+
+		// GUI elements queue their sprite updates with the sprite manager, instead of updating them one by one
+		HSceneObject cameraSO = SceneObject::create("Camera");
+		HCamera camera = cameraSO->addComponent<CCamera>();
+		camera->getViewport()->setTarget(gApplication().getPrimaryWindow());
+
+		HSceneObject guiSO = SceneObject::create("GUI");
+		HGUIWidget widget = guiSO->addComponent<CGUIWidget>(camera);
+		widget->setSkin(gBuiltinResources().getGUISkin());
+
+		GUIPanel* panel = widget->getPanel();
+		GUILabel* label = panel->addNewElement<GUILabel>(HString("Label"));
+		GUIButton* button = panel->addNewElement<GUIButton>(HString("Button"));
+		GUITexture* texture = panel->addNewElement<GUITexture>(gBuiltinResources().getWhiteSpriteTexture());
+		GUIInputBox* inputBox = panel->addNewElement<GUIInputBox>();
+		inputBox->setText("Input");
+
+		auto runFrame = []()
+		{
+			gApplication().runMainLoopFrame();
+			gApplication().waitUntilFrameFinished();
+			gCoreThread().submitAll(true);
+		};
+
+		gApplication().beginMainLoop();
+		runFrame();
+
+		GUIElement* elements[] = { label, button, texture, inputBox };
+		for(auto& element : elements)
+		{
+			const UINT32 numQueuedBefore = spriteManager.getNumQueuedUpdates();
+			element->_queueRenderElementUpdates();
+			BS_TEST_ASSERT(spriteManager.getNumQueuedUpdates() > numQueuedBefore);
+
+			// Queuing twice before the element is updated doesn't queue anything new
+			const UINT32 numQueued = spriteManager.getNumQueuedUpdates();
+			element->_queueRenderElementUpdates();
+			BS_TEST_ASSERT(spriteManager.getNumQueuedUpdates() == numQueued);
+		}
+
+		spriteManager.processQueuedUpdates();
+		BS_TEST_ASSERT(spriteManager.getNumQueuedUpdates() == 0);
+
+		for(auto& element : elements)
+		{
+			element->_updateRenderElements();
+			BS_TEST_ASSERT(!element->getRenderElements().empty());
+		}
+
+		// Benchmark a GUI update with many modified labels, whose text sprites are all updated in a single batch
+		Vector<GUILabel*> labels(NUM_LABELS);
+		for(UINT32 i = 0; i < NUM_LABELS; i++)
+		{
+			labels[i] = panel->addNewElement<GUILabel>(HString("Label"));
+			labels[i]->setPosition((INT32)(i % 8) * 8, (INT32)((i / 8) % 8) * 8);
+			labels[i]->setSize(32, 8);
+		}
+
+		runFrame();
+
+		for(UINT32 i = 0; i < NUM_LABELS; i++)
+			labels[i]->setContent(GUIContent(HString("Lbl" + toString(i % 10))));
+
+		Timer timer;
+		runFrame();
+		const UINT64 labelFrameUs = timer.getMicroseconds();
+
+		BS_TEST_ASSERT(spriteManager.getNumQueuedUpdates() == 0);
+		for(auto& entry : labels)
+			BS_TEST_ASSERT(!entry->getRenderElements().empty());
+
+		gApplication().endMainLoop();
+
+		guiSO->destroy();
+		cameraSO->destroy();
+
+		// Benchmark laying out many text sprites against reusing their layout, and updating many image sprites one by one
+		// against a single batch
+		Vector<TextSprite> textSprites(NUM_LABELS);
+		desc.text = "Benchmark";
+		desc.color = Color::White;
+
+		timer.reset();
+		for(auto& entry : textSprites)
+			spriteManager.queueUpdate(&entry, desc, 0);
+
+		spriteManager.processQueuedUpdates();
+		const UINT64 textLayoutUs = timer.getMicroseconds();
+
+		timer.reset();
+		desc.color = Color::Blue;
+		for(auto& entry : textSprites)
+			spriteManager.queueUpdate(&entry, desc, 0);
+
+		spriteManager.processQueuedUpdates();
+		const UINT64 textReuseUs = timer.getMicroseconds();
+
+		Vector<ImageSprite> imageSprites(NUM_SPRITES);
+		IMAGE_SPRITE_DESC imageDesc;
+		imageDesc.texture = gBuiltinResources().getWhiteSpriteTexture();
+		imageDesc.width = 16;
+		imageDesc.height = 16;
+
+		// Warm up both paths, so neither measures the initial geometry allocation or the first task scheduling
+		for(auto& entry : imageSprites)
+			entry.update(imageDesc, 0);
+
+		for(auto& entry : imageSprites)
+			spriteManager.queueUpdate(&entry, imageDesc, 0);
+
+		spriteManager.processQueuedUpdates();
+
+		imageDesc.width = 32;
+
+		timer.reset();
+		for(auto& entry : imageSprites)
+			entry.update(imageDesc, 0);
+		const UINT64 imageImmediateUs = timer.getMicroseconds();
+
+		imageDesc.width = 48;
+
+		timer.reset();
+		for(auto& entry : imageSprites)
+			spriteManager.queueUpdate(&entry, imageDesc, 0);
+
+		spriteManager.processQueuedUpdates();
+		const UINT64 imageQueuedUs = timer.getMicroseconds();
+
+		// Batched updates must produce the same geometry as updating directly
+		ImageSprite referenceSprite;
+		referenceSprite.update(imageDesc, 0);
+
+		const Rect2I referenceBounds = referenceSprite.getBounds(Vector2I(), Rect2I());
+		BS_TEST_ASSERT(imageSprites.front().getBounds(Vector2I(), Rect2I()) == referenceBounds);
+		BS_TEST_ASSERT(imageSprites.back().getBounds(Vector2I(), Rect2I()) == referenceBounds);
+
+		BS_LOG(Info, Generic, "Sprite update benchmark ({0} image sprites, {1} labels): GUI update of modified labels {2} "
+			"us, text layout {3} us, text layout reuse {4} us, image updates one by one {5} us, image updates in a batch "
+			"{6} us.", NUM_SPRITES, NUM_LABELS, labelFrameUs, textLayoutUs, textReuseUs, imageImmediateUs, imageQueuedUs);
+	}
+
+	void EngineTestSuite::testPrefabInstantiation()
+	{
+		static constexpr UINT32 NUM_CHILDREN = 50;
+		static constexpr UINT32 NUM_GRANDCHILDREN = 20;
+		static constexpr UINT32 NUM_INSTANCES = 20;
+
+		// Instantiation registers the new scene objects with the scene manager
+		startUpTestApplication();
+
+		HSceneObject root = SceneObject::create("Root", SOF_DontInstantiate);
+		for(UINT32 i = 0; i < NUM_CHILDREN; i++)
+		{
+			HSceneObject child = SceneObject::create("Child" + toString(i), SOF_DontInstantiate);
+			child->setParent(root);
+
+			for(UINT32 j = 0; j < NUM_GRANDCHILDREN; j++)
+			{
+				HSceneObject grandchild = SceneObject::create("Grandchild" + toString(j), SOF_DontInstantiate);
+				grandchild->setParent(child);
+			}
+		}
+
+		HPrefab prefab = Prefab::create(root);
+
+		auto isValidCopy = [](const HSceneObject& copy)
+		{
+			if(copy == nullptr || copy->getName() != "Root" || copy->getNumChildren() != NUM_CHILDREN)
+				return false;
+
+			for(UINT32 i = 0; i < NUM_CHILDREN; i++)
+			{
+				HSceneObject child = copy->getChild(i);
+				if(child->getName() != "Child" + toString(i) || child->getNumChildren() != NUM_GRANDCHILDREN)
+					return false;
+			}
+
+			return true;
+		};
+
+		Vector<HSceneObject> copies;
+
+		// Instantiate the way prefabs did before the serialized template was cached, re-serializing the internal
+		// hierarchy for every instance
+		Timer timer;
+		for(UINT32 i = 0; i < NUM_INSTANCES; i++)
+		{
+			HSceneObject copy = prefab->_getRoot()->clone(false);
+			copy->_instantiate();
+
+			copies.push_back(copy);
+		}
+		const UINT64 uncachedUs = timer.getMicroseconds();
+
+		timer.reset();
+		for(UINT32 i = 0; i < NUM_INSTANCES; i++)
+			copies.push_back(prefab->_instantiate());
+		const UINT64 cachedUs = timer.getMicroseconds();
+
+		bool allValid = true;
+		for(auto& copy : copies)
+			allValid &= isValidCopy(copy) && !copy->hasFlag(SOF_DontInstantiate);
+
+		BS_TEST_ASSERT(allValid);
+
+		// Updating the prefab must invalidate the cached template
+		HSceneObject extraChild = SceneObject::create("Extra", SOF_DontInstantiate);
+		extraChild->setParent(root);
+		prefab->update(root);
+
+		HSceneObject updatedCopy = prefab->_instantiate();
+		BS_TEST_ASSERT(updatedCopy->getNumChildren() == NUM_CHILDREN + 1);
+		copies.push_back(updatedCopy);
+
+		for(auto& copy : copies)
+			copy->destroy(true);
+
+		BS_LOG(Info, Generic, "Prefab instantiation benchmark ({0} instances of {1} scene objects): uncached {2} us, "
+			"cached template {3} us.", NUM_INSTANCES, 1 + NUM_CHILDREN * (1 + NUM_GRANDCHILDREN), uncachedUs, cachedUs);
+
+		root->destroy(true);
+	}
+
+	void EngineTestSuite::testResourceMemoryBudget()
+	{
+		startUpTestApplication();
+
+		TEXTURE_DESC desc;
+		desc.width = 64;
+		desc.height = 64;
+		desc.format = PF_RGBA8;
+
+		// Held by both the resource system and by the user, must never be evicted even though it is the oldest
+		HTexture external = Texture::create(desc);
+		gResources().load(external.getWeak(), ResourceLoadFlag::KeepInternalRef);
+
+		// Held only by the resource system, loaded in order A, B, C
+		WeakResourceHandle<Texture> internal[3];
+		for(UINT32 i = 0; i < 3; i++)
+		{
+			HTexture texture = Texture::create(desc);
+			gResources().load(texture.getWeak(), ResourceLoadFlag::KeepInternalRef);
+
+			internal[i] = texture.getWeak();
+		}
+
+		for(auto& entry : internal)
+			BS_TEST_ASSERT(entry.isLoaded(false));
+
+		// Next frame, use A only. Even though A was loaded first, B is now the least recently used one.
+		gResources()._update();
+		BS_TEST_ASSERT(internal[0]->getProperties().getWidth() == desc.width);
+
+		const ResourceMemoryUsage usage = gResources().getMemoryUsage();
+		gResources().setMemoryBudget(usage.cpu + usage.gpu - 1);
+		gResources()._update();
+
+		BS_TEST_ASSERT(internal[0].isLoaded(false));
+		BS_TEST_ASSERT(!internal[1].isLoaded(false));
+		BS_TEST_ASSERT(internal[2].isLoaded(false));
+		BS_TEST_ASSERT(external.isLoaded(false));
+
+		const ResourceMemoryUsage usageAfter = gResources().getMemoryUsage();
+		BS_TEST_ASSERT(usageAfter.cpu + usageAfter.gpu <= gResources().getMemoryBudget());
+
+		// Budget smaller than the externally referenced resource, everything else goes but it must stay loaded
+		gResources().setMemoryBudget(1);
+		gResources()._update();
+
+		BS_TEST_ASSERT(!internal[0].isLoaded(false));
+		BS_TEST_ASSERT(!internal[2].isLoaded(false));
+		BS_TEST_ASSERT(external.isLoaded(false));
+
+		gResources().setMemoryBudget(0);
+		gResources().release(external);
+	}
+}
+
+using namespace bs;
+
+int main()
+{
+	SPtr<TestSuite> tests = EngineTestSuite::create<EngineTestSuite>();
+
+	ConsoleTestOutput testOutput;
+	tests->run(testOutput);
+
+	if(Application::isStarted())
+		Application::shutDown();
+
+	return 0;
+}
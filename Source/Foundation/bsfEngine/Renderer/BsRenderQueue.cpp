@@ -6,11 +6,45 @@
 #include "Mesh/BsMesh.h"
 #include "Material/BsMaterial.h"
 #include "Renderer/BsRenderElement.h"
-
-using namespace std::placeholders;
+#include "Utility/BsBitwise.h"
 
 namespace bs { namespace ct
 {
+	/** Returns the number of bits required to store the provided value. */
+	static UINT32 getNumBits(UINT32 value)
+	{
+		return value == 0 ? 0 : Bitwise::mostSignificantBit(value) + 1;
+	}
+
+	/** Maps a floating point value to an unsigned integer that preserves the floating point ordering. */
+	static UINT32 getOrderedBits(float value)
+	{
+		// Make sure negative zero sorts the same as positive zero
+		value += 0.0f;
+
+		UINT32 bits;
+		memcpy(&bits, &value, sizeof(bits));
+
+		return (bits & 0x80000000) != 0 ? ~bits : bits | 0x80000000;
+	}
+
+	size_t RenderQueue::BatchKey::HashFunction::operator()(const BatchKey& key) const
+	{
+		size_t hash = 0;
+		bs_hash_combine(hash, key.material);
+		bs_hash_combine(hash, key.mesh);
+		bs_hash_combine(hash, key.indexOffset);
+		bs_hash_combine(hash, key.indexCount);
+
+		return hash;
+	}
+
+	bool RenderQueue::BatchKey::EqualFunction::operator()(const BatchKey& lhs, const BatchKey& rhs) const
+	{
+		return lhs.material == rhs.material && lhs.mesh == rhs.mesh && lhs.indexOffset == rhs.indexOffset &&
+			lhs.indexCount == rhs.indexCount;
+	}
+
 	RenderQueue::RenderQueue(StateReduction mode)
 		:mStateReductionMode(mode)
 	{
@@ -21,12 +55,14 @@ namespace bs { namespace ct
 	{
 		mSortableElements.clear();
 		mSortableElementIdx.clear();
+		mSortKeys.clear();
 		mElements.clear();
+		mBatchIds.clear();
 
 		mSortedRenderElements.clear();
 	}
 
-	void RenderQueue::add(const RenderElement* element, float distFromCamera, UINT32 techniqueIdx)
+	void RenderQueue::add(const RenderElement* element, float distFromCamera, UINT32 techniqueIdx, bool batchable)
 	{
 		SPtr<Material> material = element->material;
 		SPtr<Shader> shader = material->getShader();
@@ -52,6 +88,23 @@ namespace bs { namespace ct
 		if (!separablePasses)
 			numPasses = std::min(1U, numPasses);
 
+		// Assign dense IDs to unique material & mesh combinations, so they can be packed in the sort key
+		UINT32 batchId = 0;
+		if (batchable)
+		{
+			const BatchKey batchKey = { material.get(), element->mesh.get(), element->subMesh.indexOffset,
+				element->subMesh.indexCount };
+
+			auto iterFind = mBatchIds.find(batchKey);
+			if (iterFind != mBatchIds.end())
+				batchId = iterFind->second;
+			else
+			{
+				batchId = (UINT32)mBatchIds.size() + 1;
+				mBatchIds[batchKey] = batchId;
+			}
+		}
+
 		for (UINT32 i = 0; i < numPasses; i++)
 		{
 			UINT32 idx = (UINT32)mSortableElementIdx.size();
@@ -66,6 +119,7 @@ namespace bs { namespace ct
 			sortableElem.techniqueIdx = techniqueIdx;
 			sortableElem.passIdx = i;
 			sortableElem.distFromCamera = distFromCamera;
+			sortableElem.batchId = batchId;
 
 			mElements.push_back(element);
 		}
@@ -73,23 +127,9 @@ namespace bs { namespace ct
 
 	void RenderQueue::sort()
 	{
-		std::function<bool(UINT32, UINT32, const Vector<SortableElement>&)> sortMethod;
-
-		switch (mStateReductionMode)
-		{
-		case StateReduction::None:
-			sortMethod = &elementSorterNoGroup;
-			break;
-		case StateReduction::Material:
-			sortMethod = &elementSorterPreferGroup;
-			break;
-		case StateReduction::Distance:
-			sortMethod = &elementSorterPreferDistance;
-			break;
-		}
-
 		// Sort only indices since we generate an entirely new data set anyway, it doesn't make sense to move sortable elements
-		std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(), std::bind(sortMethod, _1, _2, mSortableElements));
+		if (!sortIndicesByKey())
+			sortIndicesByComparison();
 
 		UINT32 prevShaderId = (UINT32)-1;
 		UINT32 prevTechniqueIdx = (UINT32)-1;
@@ -147,6 +187,192 @@ namespace bs { namespace ct
 		}
 	}
 
+	bool RenderQueue::sortIndicesByKey()
+	{
+		UINT32 numKeyBits = 0;
+		if (!generateSortKeys(numKeyBits))
+			return false;
+
+		radixSortKeys(numKeyBits);
+
+		for (UINT32 i = 0; i < (UINT32)mSortKeys.size(); i++)
+			mSortableElementIdx[i] = mSortKeys[i].idx;
+
+		return true;
+	}
+
+	void RenderQueue::sortIndicesByComparison()
+	{
+		bool (*sortMethod)(UINT32, UINT32, const Vector<SortableElement>&) = nullptr;
+
+		switch (mStateReductionMode)
+		{
+		default:
+		case StateReduction::None:
+			sortMethod = &elementSorterNoGroup;
+			break;
+		case StateReduction::Material:
+			sortMethod = &elementSorterPreferGroup;
+			break;
+		case StateReduction::Distance:
+			sortMethod = &elementSorterPreferDistance;
+			break;
+		}
+
+		std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(),
+			[this, sortMethod](UINT32 a, UINT32 b)
+		{
+			const SortableElement& elemA = mSortableElements[a];
+			const SortableElement& elemB = mSortableElements[b];
+
+			// Within the same priority, batchable elements are output after all non-batchable ones
+			const bool isBatchA = elemA.batchId != 0;
+			const bool isBatchB = elemB.batchId != 0;
+			if (elemA.priority == elemB.priority && isBatchA != isBatchB)
+				return isBatchB;
+
+			if (isBatchA && isBatchB)
+				return elementSorterBatch(a, b, mSortableElements);
+
+			return sortMethod(a, b, mSortableElements);
+		});
+	}
+
+	bool RenderQueue::generateSortKeys(UINT32& numBits)
+	{
+		const auto numElements = (UINT32)mSortableElements.size();
+		mSortKeys.resize(numElements);
+
+		if (numElements == 0)
+		{
+			numBits = 0;
+			return true;
+		}
+
+		// Find the range of each field, so the key uses as few bits as possible
+		INT32 minPriority = std::numeric_limits<INT32>::max();
+		INT32 maxPriority = std::numeric_limits<INT32>::min();
+		UINT32 maxShaderId = 0;
+		UINT32 maxTechniqueIdx = 0;
+		UINT32 maxPassIdx = 0;
+		UINT32 maxBatchId = 0;
+
+		for (auto& elem : mSortableElements)
+		{
+			minPriority = std::min(minPriority, elem.priority);
+			maxPriority = std::max(maxPriority, elem.priority);
+			maxShaderId = std::max(maxShaderId, elem.shaderId);
+			maxTechniqueIdx = std::max(maxTechniqueIdx, elem.techniqueIdx);
+			maxPassIdx = std::max(maxPassIdx, elem.passIdx);
+			maxBatchId = std::max(maxBatchId, elem.batchId);
+		}
+
+		const UINT32 priorityBits = getNumBits((UINT32)((INT64)maxPriority - minPriority));
+		const UINT32 shaderBits = getNumBits(maxShaderId);
+		const UINT32 techniqueBits = getNumBits(maxTechniqueIdx);
+		const UINT32 passBits = getNumBits(maxPassIdx);
+		const UINT32 distanceBits = 32;
+
+		UINT32 materialBits = 0;
+		if (mStateReductionMode != StateReduction::None)
+			materialBits = shaderBits + techniqueBits + passBits;
+
+		// Batchable elements use a different layout (material, batch, distance), so if any are present an extra bit is
+		// used to separate the two layouts, and both are padded to the same size
+		const UINT32 defaultLayoutBits = distanceBits + materialBits;
+		UINT32 batchBits = 0;
+		UINT32 layoutBits = defaultLayoutBits;
+		if (maxBatchId > 0)
+		{
+			batchBits = getNumBits(maxBatchId);
+			layoutBits = std::max(defaultLayoutBits, shaderBits + techniqueBits + passBits + batchBits + distanceBits);
+		}
+
+		const UINT32 layoutSelectBits = maxBatchId > 0 ? 1 : 0;
+		numBits = priorityBits + layoutSelectBits + layoutBits;
+		if (numBits > 64)
+			return false;
+
+		// Keys are sorted in ascending order, so higher priorities are mapped to lower values
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const SortableElement& elem = mSortableElements[i];
+
+			const UINT64 priority = (UINT64)((INT64)maxPriority - elem.priority);
+			const UINT64 distance = getOrderedBits(elem.distFromCamera);
+			UINT64 material = elem.shaderId;
+			material = (material << techniqueBits) | elem.techniqueIdx;
+			material = (material << passBits) | elem.passIdx;
+
+			UINT64 layout = 0;
+			if (elem.batchId != 0)
+			{
+				layout = (material << batchBits) | elem.batchId;
+				layout = (layout << distanceBits) | distance;
+			}
+			else
+			{
+				switch (mStateReductionMode)
+				{
+				default:
+				case StateReduction::None:
+					layout = distance;
+					break;
+				case StateReduction::Material:
+					layout = (material << distanceBits) | distance;
+					break;
+				case StateReduction::Distance:
+					layout = (distance << materialBits) | material;
+					break;
+				}
+			}
+
+			UINT64 key = (priority << layoutSelectBits) | (elem.batchId != 0 ? 1 : 0);
+			key = layoutBits < 64 ? (key << layoutBits) | layout : layout;
+
+			mSortKeys[i].key = key;
+			mSortKeys[i].idx = i;
+		}
+
+		return true;
+	}
+
+	void RenderQueue::radixSortKeys(UINT32 numBits)
+	{
+		static constexpr UINT32 RADIX_BITS = 8;
+		static constexpr UINT32 RADIX_SIZE = 1 << RADIX_BITS;
+
+		const auto numElements = (UINT32)mSortKeys.size();
+		mSortKeysTemp.resize(numElements);
+
+		// Elements start out in the order they were added in, and each pass is stable, so elements with equal keys
+		// remain in the order they were added in
+		for (UINT32 shift = 0; shift < numBits; shift += RADIX_BITS)
+		{
+			UINT32 offsets[RADIX_SIZE] = { };
+			for (auto& entry : mSortKeys)
+				offsets[(entry.key >> shift) & (RADIX_SIZE - 1)]++;
+
+			// Skip passes where all keys share the same digit
+			const UINT32 firstDigit = (mSortKeys[0].key >> shift) & (RADIX_SIZE - 1);
+			if (offsets[firstDigit] == numElements)
+				continue;
+
+			UINT32 total = 0;
+			for (auto& offset : offsets)
+			{
+				const UINT32 count = offset;
+				offset = total;
+				total += count;
+			}
+
+			for (auto& entry : mSortKeys)
+				mSortKeysTemp[offsets[(entry.key >> shift) & (RADIX_SIZE - 1)]++] = entry;
+
+			std::swap(mSortKeys, mSortKeysTemp);
+		}
+	}
+
 	bool RenderQueue::elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
 	{
 		const SortableElement& a = lookup[aIdx];
@@ -207,6 +433,30 @@ namespace bs { namespace ct
 		return isHigher > isLower;
 	}
 
+	bool RenderQueue::elementSorterBatch(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
+	{
+		const SortableElement& a = lookup[aIdx];
+		const SortableElement& b = lookup[bIdx];
+
+		UINT8 isHigher = (a.priority > b.priority) << 6 |
+			(a.shaderId < b.shaderId) << 5 |
+			(a.techniqueIdx < b.techniqueIdx) << 4 |
+			(a.passIdx < b.passIdx) << 3 |
+			(a.batchId < b.batchId) << 2 |
+			(a.distFromCamera < b.distFromCamera) << 1 |
+			(a.seqIdx < b.seqIdx);
+
+		UINT8 isLower = (a.priority < b.priority) << 6 |
+			(a.shaderId > b.shaderId) << 5 |
+			(a.techniqueIdx > b.techniqueIdx) << 4 |
+			(a.passIdx > b.passIdx) << 3 |
+			(a.batchId > b.batchId) << 2 |
+			(a.distFromCamera > b.distFromCamera) << 1 |
+			(a.seqIdx > b.seqIdx);
+
+		return isHigher > isLower;
+	}
+
 	const Vector<RenderQueueElement>& RenderQueue::getSortedElements() const
 	{
 		return mSortedRenderElements;
@@ -38,6 +38,7 @@ namespace bs { namespace ct
 	 */
 	class BS_EXPORT RenderQueue
 	{
+	protected:
 		/**	Data used for renderable element sorting. Represents a single pass for a single mesh. */
 		struct SortableElement
 		{
@@ -47,6 +48,35 @@ namespace bs { namespace ct
 			UINT32 shaderId;
 			UINT32 techniqueIdx;
 			UINT32 passIdx;
+			UINT32 batchId; /**< Non-zero if the element is to be grouped with others sharing the same material and mesh. */
+		};
+
+		/** Identifies the material and mesh combination shared by elements that can be batched together. */
+		struct BatchKey
+		{
+			class HashFunction
+			{
+			public:
+				size_t operator()(const BatchKey& key) const;
+			};
+
+			class EqualFunction
+			{
+			public:
+				bool operator()(const BatchKey& lhs, const BatchKey& rhs) const;
+			};
+
+			const Material* material;
+			const Mesh* mesh;
+			UINT32 indexOffset;
+			UINT32 indexCount;
+		};
+
+		/** Packed key encoding the sort order of a single sortable element. */
+		struct SortKey
+		{
+			UINT64 key;
+			UINT32 idx;
 		};
 
 	public:
@@ -60,8 +90,12 @@ namespace bs { namespace ct
 		 * @param[in]	distFromCamera	Distance of this object from the camera. Used for distance sorting.
 		 * @param[in]	techniqueIdx	Index of the technique within @p element's material that's to be used to render the
 		 *								element with.
+		 * @param[in]	batchable		If true the element will be grouped with other batchable elements sharing the
+		 *								same material and mesh, ahead of distance sorting, so that the group can be
+		 *								rendered using a single instanced draw call. Batchable elements are output after
+		 *								all non-batchable elements of the same priority.
 		 */
-		void add(const RenderElement* element, float distFromCamera, UINT32 techniqueIdx);
+		void add(const RenderElement* element, float distFromCamera, UINT32 techniqueIdx, bool batchable = false);
 
 		/**	Clears all render operations from the queue. */
 		void clear();
@@ -88,9 +122,43 @@ namespace bs { namespace ct
 		/**	Callback used for sorting elements with material grouping after sorting. */
 		static bool elementSorterPreferDistance(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
 
+		/**	Callback used for sorting batchable elements, grouping them by material and batch first, by distance second. */
+		static bool elementSorterBatch(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
+
+		/**
+		 * Sorts the indices in @p mSortableElementIdx by packing the sort criteria into keys and radix sorting them.
+		 * Returns false and leaves the indices unmodified if the sort criteria don't fit in a key.
+		 */
+		bool sortIndicesByKey();
+
+		/**
+		 * Sorts the indices in @p mSortableElementIdx using the comparison callback for the current state reduction
+		 * mode. Slower than sortIndicesByKey() but supports sort criteria of any range.
+		 */
+		void sortIndicesByComparison();
+
+		/**
+		 * Packs the sort criteria of every sortable element into a single 64-bit key, with the field order determined by
+		 * the state reduction mode. Keys are output in @p mSortKeys.
+		 *
+		 * @param[out]	numBits		Number of low bits used by the keys.
+		 * @return					False if the sort criteria don't fit in 64 bits, in which case keys cannot be used.
+		 */
+		bool generateSortKeys(UINT32& numBits);
+
+		/**
+		 * Sorts the keys in @p mSortKeys using a stable LSD radix sort.
+		 *
+		 * @param[in]	numBits		Number of low bits used by the keys. Higher bits are assumed to be zero.
+		 */
+		void radixSortKeys(UINT32 numBits);
+
 		Vector<SortableElement> mSortableElements;
 		Vector<UINT32> mSortableElementIdx;
+		Vector<SortKey> mSortKeys;
+		Vector<SortKey> mSortKeysTemp;
 		Vector<const RenderElement*> mElements;
+		UnorderedMap<BatchKey, UINT32, BatchKey::HashFunction, BatchKey::EqualFunction> mBatchIds;
 
 		Vector<RenderQueueElement> mSortedRenderElements;
 		StateReduction mStateReductionMode;
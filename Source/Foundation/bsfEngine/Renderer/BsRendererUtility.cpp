@@ -433,7 +433,9 @@ namespace bs { namespace ct
 		}
 		else
 		{
-			if(isFiltered)
+			if(!isColor)
+				return get(getVariation<1, 2>());
+			else if(isFiltered)
 				return get(getVariation<1, 1>());
 			else
 				return get(getVariation<1, 0>());
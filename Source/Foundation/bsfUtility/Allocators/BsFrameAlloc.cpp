@@ -304,11 +304,21 @@ namespace bs
 
 	BS_UTILITY_EXPORT UINT8* bs_frame_alloc(UINT32 numBytes)
 	{
+#if BS_PROFILING_ENABLED
+		if(MemoryTrackerHooks::isEnabled())
+			MemoryTrackerHooks::onFrameAlloc(numBytes);
+#endif
+
 		return gFrameAlloc().alloc(numBytes);
 	}
 
 	BS_UTILITY_EXPORT UINT8* bs_frame_alloc_aligned(UINT32 count, UINT32 align)
 	{
+#if BS_PROFILING_ENABLED
+		if(MemoryTrackerHooks::isEnabled())
+			MemoryTrackerHooks::onFrameAlloc(count);
+#endif
+
 		return gFrameAlloc().allocAligned(count, align);
 	}
 
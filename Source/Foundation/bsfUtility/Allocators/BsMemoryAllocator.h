@@ -8,6 +8,7 @@
 #include <limits>
 #include <cstdint>
 #include <utility>
+#include <atomic>
 
 #if BS_PLATFORM == BS_PLATFORM_LINUX
 #  include <malloc.h>
@@ -124,12 +125,51 @@ namespace bs
 		static BS_THREADLOCAL uint64_t Frees;
 	};
 
+	/**
+	 * Entry points through which allocators report individual allocations to the MemoryTracker. Reporting only happens
+	 * while tracking is enabled, see MemoryTracker::setEnabled().
+	 */
+	class BS_UTILITY_EXPORT MemoryTrackerHooks
+	{
+	public:
+		/** Checks should allocations be reported. */
+		static bool isEnabled() { return Enabled.load(std::memory_order_relaxed); }
+
+		/** Reports a new heap allocation of @p bytes bytes at @p ptr. */
+		static void onAlloc(void* ptr, size_t bytes);
+
+		/** Reports that a heap allocation at @p ptr has been freed. */
+		static void onFree(void* ptr);
+
+		/** Reports a new frame allocation of @p bytes bytes. Frame allocations are released in bulk so they aren't live. */
+		static void onFrameAlloc(size_t bytes);
+
+	private:
+		friend class MemoryTracker;
+
+		static std::atomic<bool> Enabled;
+	};
+
 	/** Base class all memory allocators need to inherit. Provides allocation and free counting. */
 	class MemoryAllocatorBase
 	{
 	protected:
 		static void incAllocCount() { MemoryCounter::incAllocCount(); }
 		static void incFreeCount() { MemoryCounter::incFreeCount(); }
+
+		/** Reports an allocation to the memory tracker, if enabled. */
+		static void trackAlloc(void* ptr, size_t bytes)
+		{
+			if(MemoryTrackerHooks::isEnabled())
+				MemoryTrackerHooks::onAlloc(ptr, bytes);
+		}
+
+		/** Reports a free to the memory tracker, if enabled. */
+		static void trackFree(void* ptr)
+		{
+			if(MemoryTrackerHooks::isEnabled())
+				MemoryTrackerHooks::onFree(ptr);
+		}
 	};
 
 	/**
@@ -145,11 +185,14 @@ namespace bs
 		/** Allocates @p bytes bytes. */
 		static void* allocate(size_t bytes)
 		{
+			void* ptr = malloc(bytes);
+
 #if BS_PROFILING_ENABLED
 			incAllocCount();
+			trackAlloc(ptr, bytes);
 #endif
 
-			return malloc(bytes);
+			return ptr;
 		}
 
 		/**
@@ -158,21 +201,27 @@ namespace bs
 		 */
 		static void* allocateAligned(size_t bytes, size_t alignment)
 		{
+			void* ptr = platformAlignedAlloc(bytes, alignment);
+
 #if BS_PROFILING_ENABLED
 			incAllocCount();
+			trackAlloc(ptr, bytes);
 #endif
 
-			return platformAlignedAlloc(bytes, alignment);
+			return ptr;
 		}
 
 		/** Allocates @p bytes and aligns them to a 16 byte boundary. */
 		static void* allocateAligned16(size_t bytes)
 		{
+			void* ptr = platformAlignedAlloc16(bytes);
+
 #if BS_PROFILING_ENABLED
 			incAllocCount();
+			trackAlloc(ptr, bytes);
 #endif
 
-			return platformAlignedAlloc16(bytes);
+			return ptr;
 		}
 
 		/** Frees the memory at the specified location. */
@@ -180,6 +229,7 @@ namespace bs
 		{
 #if BS_PROFILING_ENABLED
 			incFreeCount();
+			trackFree(ptr);
 #endif
 
 			::free(ptr);
@@ -190,6 +240,7 @@ namespace bs
 		{
 #if BS_PROFILING_ENABLED
 			incFreeCount();
+			trackFree(ptr);
 #endif
 
 			platformAlignedFree(ptr);
@@ -200,6 +251,7 @@ namespace bs
 		{
 #if BS_PROFILING_ENABLED
 			incFreeCount();
+			trackFree(ptr);
 #endif
 
 			platformAlignedFree16(ptr);
@@ -0,0 +1,606 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Allocators/BsMemoryTracker.h"
+#include "Error/BsCrashHandler.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+
+namespace bs
+{
+	/** Number of innermost call stack entries used for identifying an allocation site. */
+	static constexpr UINT32 SITE_STACK_DEPTH = 12;
+
+	/**
+	 * Maximum number of allocation machinery entries (e.g. bs_new, container internals) at the top of the call stack,
+	 * that are skipped before the entries identifying the allocation site.
+	 */
+	static constexpr UINT32 MAX_ALLOCATOR_DEPTH = 16;
+
+	/** Maximum number of call stack entries captured for sampled allocations. */
+	static constexpr UINT32 MAX_STACK_DEPTH = 48;
+
+	/**
+	 * Functions whose names contain one of these are considered part of the allocation machinery, and are skipped when
+	 * looking for the function responsible for an allocation.
+	 */
+	static const char* ALLOCATOR_FUNCTIONS[] =
+	{
+		"MemoryTracker", "MemoryAllocator", "StdAlloc", "FrameAlloc", "bs_alloc", "bs_new", "bs_shared_ptr",
+		"bs_frame_alloc", "std::", "__gnu_cxx", "operator new"
+	};
+
+	// Tracker uses the profiler allocator for its own data so it doesn't end up tracking itself
+	template<class T>
+	using TrackerVector = std::vector<T, StdAlloc<T, ProfilerAlloc>>;
+
+	template<class K, class V>
+	using TrackerMap = std::unordered_map<K, V, std::hash<K>, std::equal_to<K>, StdAlloc<std::pair<const K, V>, ProfilerAlloc>>;
+
+	/** Statistics about allocations performed from a single call site. */
+	struct TrackedSite
+	{
+		void* frames[SITE_STACK_DEPTH];
+		UINT32 numFrames = 0;
+		bool isFrameAlloc = false;
+
+		UINT64 numAllocs = 0;
+		UINT64 allocatedBytes = 0;
+		UINT64 numLiveAllocs = 0;
+		UINT64 liveBytes = 0;
+		UINT64 sizeHistogram[MEMORY_TRACKER_NUM_SIZE_BUCKETS] = { };
+	};
+
+	/** Call stack captured for one or multiple sampled allocations. */
+	struct TrackedStack
+	{
+		void* frames[MAX_STACK_DEPTH];
+		UINT32 numFrames = 0;
+		UINT64 sampledBytes = 0;
+	};
+
+	/** Information about an allocation that hasn't been freed yet. */
+	struct LiveAllocation
+	{
+		UINT64 size;
+		UINT32 site;
+		MemoryTag tag;
+	};
+
+	/** Global state of the memory tracker. */
+	struct MemoryTrackerState
+	{
+		Mutex mutex;
+		std::atomic<UINT32> stackSamplingPeriod { 16 };
+		std::atomic<UINT64> allocCounter { 0 };
+
+		TrackerMap<UINT64, UINT32> siteLookup;
+		TrackerVector<TrackedSite> sites;
+
+		TrackerMap<UINT64, UINT32> stackLookup;
+		TrackerVector<TrackedStack> stacks;
+
+		TrackerMap<void*, LiveAllocation> liveAllocations;
+
+		/** Determines if the function at a call stack address is part of the allocation machinery. */
+		TrackerMap<void*, bool> allocatorFrames;
+
+		MemoryTagStats tags[(UINT32)MemoryTag::Count];
+		UINT64 sizeHistogram[MEMORY_TRACKER_NUM_SIZE_BUCKETS] = { };
+	};
+
+	std::atomic<bool> MemoryTrackerHooks::Enabled { false };
+
+	static BS_THREADLOCAL MemoryTag gThreadTag = MemoryTag::Untagged;
+	static BS_THREADLOCAL bool gInsideTracker = false;
+
+	/** Returns the global tracker state. Intentionally never freed, as allocations can happen during static destruction. */
+	static MemoryTrackerState& getState()
+	{
+		static MemoryTrackerState* state = new (MemoryAllocator<ProfilerAlloc>::allocate(sizeof(MemoryTrackerState)))
+			MemoryTrackerState();
+
+		return *state;
+	}
+
+	/** Returns the histogram bucket for an allocation of the provided size. */
+	static UINT32 getSizeBucket(UINT64 size)
+	{
+		UINT32 bucket = 0;
+		while(size > 0 && bucket < MEMORY_TRACKER_NUM_SIZE_BUCKETS - 1)
+		{
+			size >>= 1;
+			bucket++;
+		}
+
+		return bucket;
+	}
+
+	/** Calculates a hash of call stack addresses. */
+	static UINT64 hashFrames(void* const* frames, UINT32 numFrames, UINT64 seed)
+	{
+		UINT64 hash = 14695981039346656037ULL ^ seed;
+		for(UINT32 i = 0; i < numFrames; i++)
+		{
+			hash ^= (UINT64)(size_t)frames[i];
+			hash *= 1099511628211ULL;
+		}
+
+		return hash;
+	}
+
+	/** Checks do two call stacks match. */
+	static bool framesEqual(void* const* a, UINT32 numA, void* const* b, UINT32 numB)
+	{
+		return numA == numB && memcmp(a, b, numA * sizeof(void*)) == 0;
+	}
+
+	/** Checks does the function name belong to the allocation machinery, rather than its user. */
+	static bool isAllocatorFunction(const String& name)
+	{
+		for(auto& entry : ALLOCATOR_FUNCTIONS)
+		{
+			if(name.find(entry) != String::npos)
+				return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * Returns the number of allocation machinery entries at the top of the call stack, resolving the names of any
+	 * addresses not encountered before. Tracker mutex must be held.
+	 */
+	static UINT32 countAllocatorFrames(MemoryTrackerState& state, void* const* frames, UINT32 numFrames)
+	{
+		const UINT32 maxFrames = std::min(numFrames, MAX_ALLOCATOR_DEPTH);
+
+		UINT32 count = 0;
+		for(; count < maxFrames; count++)
+		{
+			void* address = frames[count];
+
+			bool isAllocator;
+			auto iterFind = state.allocatorFrames.find(address);
+			if(iterFind != state.allocatorFrames.end())
+				isAllocator = iterFind->second;
+			else
+			{
+				isAllocator = isAllocatorFunction(CrashHandler::getSymbolName(address));
+				state.allocatorFrames[address] = isAllocator;
+			}
+
+			if(!isAllocator)
+				break;
+		}
+
+		return count;
+	}
+
+	/** Finds an existing site with the provided call stack, or registers a new one. Tracker mutex must be held. */
+	static UINT32 findOrAddSite(MemoryTrackerState& state, void* const* frames, UINT32 numFrames, bool isFrameAlloc)
+	{
+		UINT64 hash = hashFrames(frames, numFrames, isFrameAlloc ? 1 : 0);
+
+		// Linear probing in case of hash collisions
+		while(true)
+		{
+			auto iterFind = state.siteLookup.find(hash);
+			if(iterFind == state.siteLookup.end())
+				break;
+
+			const TrackedSite& site = state.sites[iterFind->second];
+			if(site.isFrameAlloc == isFrameAlloc && framesEqual(site.frames, site.numFrames, frames, numFrames))
+				return iterFind->second;
+
+			hash++;
+		}
+
+		const UINT32 siteIdx = (UINT32)state.sites.size();
+		state.siteLookup[hash] = siteIdx;
+
+		state.sites.emplace_back();
+		TrackedSite& site = state.sites.back();
+		memcpy(site.frames, frames, numFrames * sizeof(void*));
+		site.numFrames = numFrames;
+		site.isFrameAlloc = isFrameAlloc;
+
+		return siteIdx;
+	}
+
+	/** Adds a sampled call stack, merging it with an identical existing one. Tracker mutex must be held. */
+	static void addSampledStack(MemoryTrackerState& state, void* const* frames, UINT32 numFrames, UINT64 bytes)
+	{
+		UINT64 hash = hashFrames(frames, numFrames, 0);
+
+		while(true)
+		{
+			auto iterFind = state.stackLookup.find(hash);
+			if(iterFind == state.stackLookup.end())
+				break;
+
+			TrackedStack& stack = state.stacks[iterFind->second];
+			if(framesEqual(stack.frames, stack.numFrames, frames, numFrames))
+			{
+				stack.sampledBytes += bytes;
+				return;
+			}
+
+			hash++;
+		}
+
+		state.stackLookup[hash] = (UINT32)state.stacks.size();
+
+		state.stacks.emplace_back();
+		TrackedStack& stack = state.stacks.back();
+		memcpy(stack.frames, frames, numFrames * sizeof(void*));
+		stack.numFrames = numFrames;
+		stack.sampledBytes = bytes;
+	}
+
+	/** Records a new allocation. @p ptr is null for frame allocations, which aren't live tracked. */
+	static void trackAllocation(void* ptr, size_t bytes, bool isFrameAlloc)
+	{
+		if(gInsideTracker)
+			return;
+
+		gInsideTracker = true;
+
+		MemoryTrackerState& state = getState();
+
+		const UINT32 samplingPeriod = state.stackSamplingPeriod.load(std::memory_order_relaxed);
+		const UINT64 allocIdx = state.allocCounter.fetch_add(1, std::memory_order_relaxed);
+		const bool sampleStack = samplingPeriod > 0 && (allocIdx % samplingPeriod) == 0;
+
+		// Capture the stack outside of the lock, as it is the expensive part. Only this function is skipped, as it might
+		// have been inlined into the calling MemoryTrackerHooks method. The remaining allocator functions are skipped
+		// when identifying the site, since their number varies depending on how the allocation was made.
+		static_assert(SITE_STACK_DEPTH + MAX_ALLOCATOR_DEPTH <= MAX_STACK_DEPTH, "Sampled stacks must contain the site.");
+
+		void* frames[MAX_STACK_DEPTH];
+		const UINT32 numFrames = CrashHandler::getRawStackTrace(frames,
+			sampleStack ? MAX_STACK_DEPTH : SITE_STACK_DEPTH + MAX_ALLOCATOR_DEPTH, 1);
+
+		const UINT32 bucket = getSizeBucket(bytes);
+		const MemoryTag tag = gThreadTag;
+
+		{
+			Lock lock(state.mutex);
+
+			const UINT32 numAllocatorFrames = countAllocatorFrames(state, frames, numFrames);
+			const UINT32 numSiteFrames = std::min(numFrames - numAllocatorFrames, SITE_STACK_DEPTH);
+
+			const UINT32 siteIdx = findOrAddSite(state, frames + numAllocatorFrames, numSiteFrames, isFrameAlloc);
+			TrackedSite& site = state.sites[siteIdx];
+			site.numAllocs++;
+			site.allocatedBytes += bytes;
+			site.sizeHistogram[bucket]++;
+
+			MemoryTagStats& tagStats = state.tags[(UINT32)tag];
+			tagStats.numAllocs++;
+			tagStats.allocatedBytes += bytes;
+
+			state.sizeHistogram[bucket]++;
+
+			if(!isFrameAlloc)
+			{
+				site.numLiveAllocs++;
+				site.liveBytes += bytes;
+
+				tagStats.liveBytes += bytes;
+				tagStats.peakLiveBytes = std::max(tagStats.peakLiveBytes, tagStats.liveBytes);
+
+				state.liveAllocations[ptr] = { bytes, siteIdx, tag };
+			}
+
+			if(sampleStack)
+				addSampledStack(state, frames, numFrames, bytes);
+		}
+
+		gInsideTracker = false;
+	}
+
+	void MemoryTrackerHooks::onAlloc(void* ptr, size_t bytes)
+	{
+		if(ptr != nullptr)
+			trackAllocation(ptr, bytes, false);
+	}
+
+	void MemoryTrackerHooks::onFrameAlloc(size_t bytes)
+	{
+		trackAllocation(nullptr, bytes, true);
+	}
+
+	void MemoryTrackerHooks::onFree(void* ptr)
+	{
+		if(ptr == nullptr || gInsideTracker)
+			return;
+
+		MemoryTrackerState& state = getState();
+		Lock lock(state.mutex);
+
+		auto iterFind = state.liveAllocations.find(ptr);
+		if(iterFind == state.liveAllocations.end())
+			return;
+
+		const LiveAllocation& allocation = iterFind->second;
+
+		TrackedSite& site = state.sites[allocation.site];
+		site.numLiveAllocs--;
+		site.liveBytes -= allocation.size;
+
+		state.tags[(UINT32)allocation.tag].liveBytes -= allocation.size;
+
+		state.liveAllocations.erase(iterFind);
+	}
+
+	void MemoryTracker::setEnabled(bool enabled)
+	{
+		MemoryTrackerState& state = getState();
+		Lock lock(state.mutex);
+
+		if(!enabled && MemoryTrackerHooks::Enabled)
+		{
+			// Frees will no longer be reported, so we can't keep track of live allocations
+			state.liveAllocations.clear();
+
+			for(auto& site : state.sites)
+			{
+				site.numLiveAllocs = 0;
+				site.liveBytes = 0;
+			}
+
+			for(auto& tag : state.tags)
+				tag.liveBytes = 0;
+		}
+
+		MemoryTrackerHooks::Enabled = enabled;
+	}
+
+	bool MemoryTracker::isEnabled()
+	{
+		return MemoryTrackerHooks::isEnabled();
+	}
+
+	void MemoryTracker::setStackSamplingPeriod(UINT32 period)
+	{
+		getState().stackSamplingPeriod.store(period, std::memory_order_relaxed);
+	}
+
+	MemoryTag MemoryTracker::setThreadTag(MemoryTag tag)
+	{
+		const MemoryTag previous = gThreadTag;
+		gThreadTag = tag;
+
+		return previous;
+	}
+
+	MemoryTag MemoryTracker::getThreadTag()
+	{
+		return gThreadTag;
+	}
+
+	void MemoryTracker::clear()
+	{
+		MemoryTrackerState& state = getState();
+		Lock lock(state.mutex);
+
+		// Sites of live allocations need to remain, so only reset their counters
+		for(auto& site : state.sites)
+		{
+			site.numAllocs = 0;
+			site.allocatedBytes = 0;
+			memset(site.sizeHistogram, 0, sizeof(site.sizeHistogram));
+		}
+
+		for(auto& tag : state.tags)
+		{
+			tag.numAllocs = 0;
+			tag.allocatedBytes = 0;
+			tag.peakLiveBytes = tag.liveBytes;
+		}
+
+		memset(state.sizeHistogram, 0, sizeof(state.sizeHistogram));
+
+		state.stacks.clear();
+		state.stackLookup.clear();
+	}
+
+	/** Resolves names of call stack addresses, caching the results. */
+	class SymbolResolver
+	{
+	public:
+		/** Returns the name of the function at the provided address. */
+		const String& getName(void* address)
+		{
+			auto iterFind = mNames.find(address);
+			if(iterFind != mNames.end())
+				return iterFind->second;
+
+			return mNames[address] = CrashHandler::getSymbolName(address);
+		}
+
+		/** Checks is the function at the provided address part of the allocation machinery, rather than its user. */
+		bool isAllocatorFunction(void* address)
+		{
+			return bs::isAllocatorFunction(getName(address));
+		}
+
+	private:
+		UnorderedMap<void*, String> mNames;
+	};
+
+	MemoryTrackerReport MemoryTracker::generateReport()
+	{
+		MemoryTrackerState& state = getState();
+
+		// Copy the data first, as resolving names allocates memory which would otherwise deadlock
+		TrackerVector<TrackedSite> sites;
+		MemoryTrackerReport report;
+		{
+			Lock lock(state.mutex);
+
+			sites = state.sites;
+			for(UINT32 i = 0; i < (UINT32)MemoryTag::Count; i++)
+				report.tags[i] = state.tags[i];
+
+			memcpy(report.sizeHistogram, state.sizeHistogram, sizeof(report.sizeHistogram));
+		}
+
+		SymbolResolver resolver;
+
+		// Multiple call stacks can resolve to the same allocating function, so merge those
+		UnorderedMap<String, UINT32> siteLookup;
+		for(auto& site : sites)
+		{
+			if(site.numAllocs == 0 && site.numLiveAllocs == 0)
+				continue;
+
+			String name = "Unknown";
+			for(UINT32 i = 0; i < site.numFrames; i++)
+			{
+				if(!resolver.isAllocatorFunction(site.frames[i]))
+				{
+					name = resolver.getName(site.frames[i]);
+					break;
+				}
+			}
+
+			const String key = site.isFrameAlloc ? "[Frame] " + name : name;
+
+			UINT32 reportIdx;
+			auto iterFind = siteLookup.find(key);
+			if(iterFind != siteLookup.end())
+				reportIdx = iterFind->second;
+			else
+			{
+				reportIdx = (UINT32)report.sites.size();
+				siteLookup[key] = reportIdx;
+
+				report.sites.emplace_back();
+				report.sites.back().name = name;
+				report.sites.back().isFrameAlloc = site.isFrameAlloc;
+			}
+
+			MemoryAllocationSite& output = report.sites[reportIdx];
+			output.numAllocs += site.numAllocs;
+			output.allocatedBytes += site.allocatedBytes;
+			output.numLiveAllocs += site.numLiveAllocs;
+			output.liveBytes += site.liveBytes;
+
+			for(UINT32 i = 0; i < MEMORY_TRACKER_NUM_SIZE_BUCKETS; i++)
+				output.sizeHistogram[i] += site.sizeHistogram[i];
+		}
+
+		std::sort(report.sites.begin(), report.sites.end(),
+			[](const MemoryAllocationSite& a, const MemoryAllocationSite& b)
+			{
+				return a.allocatedBytes > b.allocatedBytes;
+			});
+
+		return report;
+	}
+
+	String MemoryTracker::exportReport(UINT32 maxSites)
+	{
+		static const char* TAG_NAMES[] =
+			{ "Untagged", "Renderer", "Animation", "Resources", "GUI", "Physics", "Audio", "Scripting" };
+		static_assert(sizeof(TAG_NAMES) / sizeof(TAG_NAMES[0]) == (UINT32)MemoryTag::Count, "Missing tag names.");
+
+		MemoryTrackerReport report = generateReport();
+
+		auto writeHistogram = [](StringStream& output, const UINT64 (&histogram)[MEMORY_TRACKER_NUM_SIZE_BUCKETS])
+		{
+			for(UINT32 i = 0; i < MEMORY_TRACKER_NUM_SIZE_BUCKETS; i++)
+			{
+				if(histogram[i] == 0)
+					continue;
+
+				const UINT64 rangeStart = i > 0 ? (1ULL << (i - 1)) : 0;
+				output << " [" << rangeStart << "+]: " << histogram[i];
+			}
+		};
+
+		StringStream output;
+		output << "Memory tags:\n";
+		for(UINT32 i = 0; i < (UINT32)MemoryTag::Count; i++)
+		{
+			const MemoryTagStats& tag = report.tags[i];
+			output << "  " << TAG_NAMES[i] << ": " << tag.numAllocs << " allocations, " << tag.allocatedBytes <<
+				" bytes allocated, " << tag.liveBytes << " bytes live, " << tag.peakLiveBytes << " bytes peak\n";
+		}
+
+		output << "\nAllocation sizes (bytes):";
+		writeHistogram(output, report.sizeHistogram);
+		output << "\n";
+
+		output << "\nAllocation sites:\n";
+		const UINT32 numSites = std::min(maxSites, (UINT32)report.sites.size());
+		for(UINT32 i = 0; i < numSites; i++)
+		{
+			const MemoryAllocationSite& site = report.sites[i];
+			output << "  " << (site.isFrameAlloc ? "[Frame] " : "") << site.name << "\n";
+			output << "    " << site.numAllocs << " allocations, " << site.allocatedBytes << " bytes allocated, " <<
+				site.numLiveAllocs << " live allocations, " << site.liveBytes << " bytes live\n";
+			output << "    Sizes (bytes):";
+			writeHistogram(output, site.sizeHistogram);
+			output << "\n";
+		}
+
+		return output.str();
+	}
+
+	String MemoryTracker::exportFoldedStacks()
+	{
+		MemoryTrackerState& state = getState();
+
+		TrackerVector<TrackedStack> stacks;
+		UINT32 samplingPeriod;
+		{
+			Lock lock(state.mutex);
+
+			stacks = state.stacks;
+			samplingPeriod = std::max(state.stackSamplingPeriod.load(std::memory_order_relaxed), 1U);
+		}
+
+		SymbolResolver resolver;
+
+		StringStream output;
+		for(auto& stack : stacks)
+		{
+			// Outermost function goes first, and tracker's own functions are left out
+			bool first = true;
+			for(INT32 i = (INT32)stack.numFrames - 1; i >= 0; i--)
+			{
+				String name = resolver.getName(stack.frames[i]);
+				if(name.find("MemoryTracker") != String::npos)
+					continue;
+
+				std::replace(name.begin(), name.end(), ';', ':');
+
+				if(!first)
+					output << ";";
+
+				output << name;
+				first = false;
+			}
+
+			output << " " << stack.sampledBytes * samplingPeriod << "\n";
+		}
+
+		return output.str();
+	}
+
+	void MemoryTracker::saveReport(const Path& path, UINT32 maxSites)
+	{
+		SPtr<DataStream> fileStream = FileSystem::createAndOpenFile(path);
+		fileStream->writeString(exportReport(maxSites));
+		fileStream->close();
+	}
+
+	void MemoryTracker::saveFoldedStacks(const Path& path)
+	{
+		SPtr<DataStream> fileStream = FileSystem::createAndOpenFile(path);
+		fileStream->writeString(exportFoldedStacks());
+		fileStream->close();
+	}
+}
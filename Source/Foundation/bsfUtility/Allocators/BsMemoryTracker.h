@@ -0,0 +1,145 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup Memory
+	 *  @{
+	 */
+
+	/** Tags that can be assigned to allocations in order to track memory usage per system. */
+	enum class MemoryTag : UINT8
+	{
+		Untagged,
+		Renderer,
+		Animation,
+		Resources,
+		GUI,
+		Physics,
+		Audio,
+		Scripting,
+		Count // Keep at end
+	};
+
+	/** Number of buckets in allocation size histograms. Bucket N contains allocations in the [2^(N-1), 2^N) range. */
+	static constexpr UINT32 MEMORY_TRACKER_NUM_SIZE_BUCKETS = 32;
+
+	/** Allocation statistics for a single allocation site. */
+	struct BS_UTILITY_EXPORT MemoryAllocationSite
+	{
+		String name; /**< Name of the function performing the allocation. */
+		bool isFrameAlloc = false; /**< True if the allocations were made through the frame allocator. */
+
+		UINT64 numAllocs = 0; /**< Number of allocations performed. */
+		UINT64 allocatedBytes = 0; /**< Total number of bytes allocated. */
+		UINT64 numLiveAllocs = 0; /**< Number of allocations not yet freed. */
+		UINT64 liveBytes = 0; /**< Number of bytes not yet freed. */
+
+		UINT64 sizeHistogram[MEMORY_TRACKER_NUM_SIZE_BUCKETS] = { }; /**< Number of allocations per size bucket. */
+	};
+
+	/** Allocation statistics for all allocations made with a specific MemoryTag. */
+	struct BS_UTILITY_EXPORT MemoryTagStats
+	{
+		UINT64 numAllocs = 0; /**< Number of allocations performed. */
+		UINT64 allocatedBytes = 0; /**< Total number of bytes allocated. */
+		UINT64 liveBytes = 0; /**< Number of bytes not yet freed. */
+		UINT64 peakLiveBytes = 0; /**< Highest value of liveBytes since tracking started. */
+	};
+
+	/** Report containing all the information gathered by the MemoryTracker. */
+	struct BS_UTILITY_EXPORT MemoryTrackerReport
+	{
+		/** Allocation sites, sorted by the number of bytes allocated, largest first. */
+		Vector<MemoryAllocationSite> sites;
+
+		/** Statistics per tag, indexed by MemoryTag. */
+		MemoryTagStats tags[(UINT32)MemoryTag::Count];
+
+		/** Number of allocations per size bucket, for all allocations. */
+		UINT64 sizeHistogram[MEMORY_TRACKER_NUM_SIZE_BUCKETS] = { };
+	};
+
+	/**
+	 * Tracks individual allocations made through MemoryAllocator<GenAlloc> (e.g. bs_alloc, bs_new, standard containers)
+	 * and the global frame allocator (bs_frame_alloc). Allocations are grouped into sites identified by a short call
+	 * stack, each with its own size histogram. Full call stacks are captured for a subset of allocations and can be
+	 * exported in the folded stack format used by flame graph tools.
+	 *
+	 * Tracking is disabled by default and is significantly slower than regular allocation, so it should only be enabled
+	 * while investigating memory usage. Only allocations made while tracking is enabled are tracked.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_UTILITY_EXPORT MemoryTracker
+	{
+	public:
+		/**
+		 * Enables or disables allocation tracking. Disabling tracking forgets about all allocations that are still live,
+		 * as their frees will no longer be reported.
+		 */
+		static void setEnabled(bool enabled);
+
+		/** Checks is allocation tracking enabled. */
+		static bool isEnabled();
+
+		/**
+		 * Determines how often to capture a full call stack. Every Nth allocation will have its call stack captured.
+		 * Zero disables call stack capture. Default is 16.
+		 */
+		static void setStackSamplingPeriod(UINT32 period);
+
+		/**
+		 * Assigns a tag to all allocations made by the calling thread from this point on. Returns the previously assigned
+		 * tag. See MemoryTagScope.
+		 */
+		static MemoryTag setThreadTag(MemoryTag tag);
+
+		/** Returns the tag assigned to allocations made by the calling thread. */
+		static MemoryTag getThreadTag();
+
+		/** Clears all allocation statistics and captured call stacks. Live allocations remain tracked. */
+		static void clear();
+
+		/** Returns all statistics gathered since tracking was enabled, or since the last call to clear(). */
+		static MemoryTrackerReport generateReport();
+
+		/** Outputs the results of generateReport() as readable text. */
+		static String exportReport(UINT32 maxSites = 100);
+
+		/**
+		 * Outputs the captured call stacks in the folded stack format (one "outer;...;inner bytes" entry per line), as
+		 * expected by flamegraph.pl, speedscope and similar tools. Each stack is weighted by an estimate of the number
+		 * of bytes it allocated.
+		 */
+		static String exportFoldedStacks();
+
+		/** Saves the output of exportReport() into a file at the specified path. */
+		static void saveReport(const Path& path, UINT32 maxSites = 100);
+
+		/** Saves the output of exportFoldedStacks() into a file at the specified path. */
+		static void saveFoldedStacks(const Path& path);
+	};
+
+	/** Assigns a MemoryTag to allocations made by the calling thread for the duration of its lifetime. */
+	class MemoryTagScope
+	{
+	public:
+		MemoryTagScope(MemoryTag tag)
+			:mPrevious(MemoryTracker::setThreadTag(tag))
+		{ }
+
+		~MemoryTagScope()
+		{
+			MemoryTracker::setThreadTag(mPrevious);
+		}
+
+	private:
+		MemoryTag mPrevious;
+	};
+
+	/** @} */
+}
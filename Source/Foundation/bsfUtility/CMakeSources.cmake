@@ -57,6 +57,7 @@ set(BS_UTILITY_INC_DEBUG
 	"bsfUtility/Debug/BsBitmapWriter.h"
 	"bsfUtility/Debug/BsDebug.h"
 	"bsfUtility/Debug/BsLog.h"
+	"bsfUtility/Debug/BsProfilerTimeline.h"
 )
 
 set(BS_UTILITY_INC_FILESYSTEM
@@ -113,6 +114,7 @@ set(BS_UTILITY_SRC_ALLOCATORS
 	"bsfUtility/Allocators/BsFrameAlloc.cpp"
 	"bsfUtility/Allocators/BsStackAlloc.cpp"
 	"bsfUtility/Allocators/BsMemoryAllocator.cpp"
+	"bsfUtility/Allocators/BsMemoryTracker.cpp"
 )
 
 set(BS_UTILITY_SRC_REFLECTION
@@ -126,6 +128,7 @@ set(BS_UTILITY_SRC_DEBUG
 	"bsfUtility/Debug/BsBitmapWriter.cpp"
 	"bsfUtility/Debug/BsLog.cpp"
 	"bsfUtility/Debug/BsDebug.cpp"
+	"bsfUtility/Debug/BsProfilerTimeline.cpp"
 )
 
 set(BS_UTILITY_INC_RTTI
@@ -149,6 +152,7 @@ set(BS_UTILITY_INC_ALLOCATORS
 	"bsfUtility/Allocators/BsFrameAlloc.h"
 	"bsfUtility/Allocators/BsMemAllocProfiler.h"
 	"bsfUtility/Allocators/BsMemoryAllocator.h"
+	"bsfUtility/Allocators/BsMemoryTracker.h"
 	"bsfUtility/Allocators/BsStackAlloc.h"
 	"bsfUtility/Allocators/BsStaticAlloc.h"
 	"bsfUtility/Allocators/BsGroupAlloc.h"
@@ -7,6 +7,7 @@
 #include "FileSystem/BsFileSystem.h"
 #include "FileSystem/BsDataStream.h"
 #include "Utility/BsTime.h"
+#include <chrono>
 
 #if BS_IS_BANSHEE3D
 #include "BsEngineConfig.h"
@@ -37,6 +38,8 @@ void logToIDEConsole(const bs::String& message, const char* channel)
 }
 #endif
 
+using namespace std::chrono;
+
 namespace bs
 {
 	BS_LOG_CATEGORY_IMPL(Uncategorized)
@@ -45,7 +48,231 @@ namespace bs
 	BS_LOG_CATEGORY_IMPL(Generic)
 	BS_LOG_CATEGORY_IMPL(Platform)
 
+	/** Number of entries in each thread's deferred log queue. Must be a power of two. */
+	static constexpr UINT32 DEFERRED_LOG_QUEUE_SIZE = 256;
+
+	/** Time after which the log consumer thread checks for new entries, even if it wasn't woken up. */
+	static constexpr UINT32 LOG_CONSUMER_WAIT_MS = 10;
+
+	static_assert((DEFERRED_LOG_QUEUE_SIZE & (DEFERRED_LOG_QUEUE_SIZE - 1)) == 0,
+		"Deferred log queue size must be a power of two.");
+
+	/**
+	 * Queue of log entries recorded by a single producer thread, read by a single consumer. Entries are written in place
+	 * so their storage (e.g. string capacity) gets re-used once the queue wraps around.
+	 */
+	struct DeferredLogQueue
+	{
+		DeferredLogEntry entries[DEFERRED_LOG_QUEUE_SIZE];
+		std::atomic<UINT32> head { 0 }; // Next entry to read, only written by the consumer
+		std::atomic<UINT32> tail { 0 }; // Next entry to write, only written by the producer
+		std::atomic<bool> orphaned { false }; // Set once the producer thread exits, after its last write
+	};
+
+	/** Reference to a single entry in a deferred log queue, used for ordering entries from different threads. */
+	struct DeferredLogEntryRef
+	{
+		UINT64 timestamp;
+		DeferredLogEntry* entry;
+	};
+
+	/** Global state of the asynchronous logging system. */
+	struct AsyncLogState
+	{
+		Mutex queueMutex;
+		Vector<DeferredLogQueue*> queues;
+
+		Mutex drainMutex;
+		Vector<DeferredLogEntryRef> drainEntries;
+
+		std::atomic<bool> active { false };
+		std::atomic<UINT32> numProducers { 0 }; // Threads between a successful active check and publishing their entry
+		std::atomic<bool> consumerSleeping { false };
+		Mutex wakeMutex;
+		Signal wakeSignal;
+		Thread consumerThread;
+	};
+
+	/**
+	 * Returns the asynchronous logging state. Note that the state is intentionally never freed, as threads could still be
+	 * logging while the application shuts down.
+	 */
+	static AsyncLogState& getAsyncLogState()
+	{
+		static AsyncLogState* state = bs_new<AsyncLogState>();
+		return *state;
+	}
+
+	static BS_THREADLOCAL DeferredLogQueue* gLogQueue = nullptr;
+	static BS_THREADLOCAL bool gIsLogConsumer = false;
+
+	/** Wakes up the log consumer thread, if it is waiting for new entries. */
+	static void wakeLogConsumer()
+	{
+		AsyncLogState& state = getAsyncLogState();
+		if(state.consumerSleeping.load(std::memory_order_relaxed))
+			state.wakeSignal.notify_one();
+	}
+
+	/** Removes the queue from the list of active queues and frees it. Caller must hold the drain mutex. */
+	static void freeLogQueue(AsyncLogState& state, DeferredLogQueue* queue)
+	{
+		{
+			Lock lock(state.queueMutex);
+
+			auto iterFind = std::find(state.queues.begin(), state.queues.end(), queue);
+			if(iterFind != state.queues.end())
+				state.queues.erase(iterFind);
+		}
+
+		bs_delete(queue);
+	}
+
+	/**
+	 * Releases the deferred log queue of a thread when the thread exits. If asynchronous logging is active the queue
+	 * might still contain entries, in which case it is only marked as orphaned and freed by the consumer once drained.
+	 */
+	struct DeferredLogQueueOwner
+	{
+		~DeferredLogQueueOwner()
+		{
+			if(queue == nullptr)
+				return;
+
+			gLogQueue = nullptr;
+
+			AsyncLogState& state = getAsyncLogState();
+			Lock drainLock(state.drainMutex);
+
+			if(state.active.load(std::memory_order_relaxed))
+			{
+				queue->orphaned.store(true, std::memory_order_release);
+				wakeLogConsumer();
+			}
+			else
+				freeLogQueue(state, queue);
+		}
+
+		DeferredLogQueue* queue = nullptr;
+	};
+
+	// Note: Not using BS_THREADLOCAL, as it doesn't support types with destructors
+	static thread_local DeferredLogQueueOwner gLogQueueOwner;
+
+	/** Returns the deferred log queue for the calling thread, creating it if needed. */
+	static DeferredLogQueue* getLogQueue()
+	{
+		DeferredLogQueue* queue = gLogQueue;
+		if(queue != nullptr)
+			return queue;
+
+		queue = bs_new<DeferredLogQueue>();
+
+		{
+			AsyncLogState& state = getAsyncLogState();
+			Lock lock(state.queueMutex);
+
+			state.queues.push_back(queue);
+		}
+
+		gLogQueue = queue;
+		gLogQueueOwner.queue = queue;
+		return queue;
+	}
+
+	/**
+	 * Formats and logs all entries currently in the deferred log queues, ordered by the time they were recorded. Returns
+	 * false if there were no entries to log.
+	 */
+	static bool drainLogQueues(Debug& debug)
+	{
+		AsyncLogState& state = getAsyncLogState();
+		Lock drainLock(state.drainMutex);
+
+		Vector<DeferredLogQueue*> queues;
+		{
+			Lock lock(state.queueMutex);
+			queues = state.queues;
+		}
+
+		// Snapshot the available entries first, so entries recorded during the drain don't starve it. Orphaned queues
+		// will receive no more entries, so they can be freed once the snapshot is drained.
+		Vector<UINT32> tails(queues.size());
+		Vector<bool> orphaned(queues.size());
+		state.drainEntries.clear();
+		for(UINT32 i = 0; i < (UINT32)queues.size(); i++)
+		{
+			DeferredLogQueue* queue = queues[i];
+			orphaned[i] = queue->orphaned.load(std::memory_order_acquire);
+
+			const UINT32 head = queue->head.load(std::memory_order_relaxed);
+			tails[i] = queue->tail.load(std::memory_order_acquire);
+
+			for(UINT32 j = head; j != tails[i]; j++)
+			{
+				DeferredLogEntry& entry = queue->entries[j & (DEFERRED_LOG_QUEUE_SIZE - 1)];
+				state.drainEntries.push_back({ entry.timestamp, &entry });
+			}
+		}
+
+		auto freeOrphanedQueues = [&state, &queues, &orphaned]()
+		{
+			for(UINT32 i = 0; i < (UINT32)queues.size(); i++)
+			{
+				if(orphaned[i])
+					freeLogQueue(state, queues[i]);
+			}
+		};
+
+		if(state.drainEntries.empty())
+		{
+			freeOrphanedQueues();
+			return false;
+		}
+
+		std::stable_sort(state.drainEntries.begin(), state.drainEntries.end(),
+			[](const DeferredLogEntryRef& a, const DeferredLogEntryRef& b)
+			{
+				return a.timestamp < b.timestamp;
+			});
+
+		const bool wasConsumer = gIsLogConsumer;
+		gIsLogConsumer = true;
+
+		for(auto& entryRef : state.drainEntries)
+		{
+			DeferredLogEntry& entry = *entryRef.entry;
+			debug._logDeferredEntry(entry);
+
+			entry.formatStorage.clear();
+			for(UINT32 i = 0; i < entry.numArguments; i++)
+				entry.arguments[i].reset();
+		}
+
+		gIsLogConsumer = wasConsumer;
+
+		// Release the entries back to the producers
+		for(UINT32 i = 0; i < (UINT32)queues.size(); i++)
+			queues[i]->head.store(tails[i], std::memory_order_release);
+
+		freeOrphanedQueues();
+		return true;
+	}
+
+	/** Appends a single log entry to the stream, in the format used by the textual log. */
+	static void writeTextLogEntry(StringStream& stream, const LogEntry& entry);
+
+	Debug::~Debug()
+	{
+		stopAsyncLogging();
+	}
+
 	void Debug::log(const String& message, LogVerbosity verbosity, UINT32 category)
+	{
+		logInternal(message, verbosity, category, std::time(nullptr));
+	}
+
+	void Debug::logInternal(const String& message, LogVerbosity verbosity, UINT32 category, std::time_t localTime)
 	{
 		if(mCustomLogCallback)
 		{
@@ -54,7 +281,19 @@ namespace bs
 				return;
 		}
 
-		mLog.logMsg(message, verbosity, category);
+		mLog.logMsg(message, verbosity, category, localTime);
+
+		{
+			Lock lock(mLogFileMutex);
+			if(mLogFile != nullptr)
+			{
+				StringStream stream;
+				writeTextLogEntry(stream, LogEntry(message, verbosity, category, localTime));
+
+				const String entry = stream.str();
+				mLogFile->write(entry.data(), entry.size());
+			}
+		}
 
 		if(verbosity != LogVerbosity::Log)
 		{
@@ -83,6 +322,179 @@ namespace bs
 		}
 	}
 
+	void Debug::startAsyncLogging()
+	{
+		AsyncLogState& state = getAsyncLogState();
+		if(state.active.exchange(true))
+			return;
+
+		state.consumerThread = Thread([this, &state]()
+		{
+			gIsLogConsumer = true;
+
+			while(state.active.load(std::memory_order_acquire))
+			{
+				if(drainLogQueues(*this))
+					continue;
+
+				Lock lock(state.wakeMutex);
+				state.consumerSleeping.store(true);
+
+				// Producers don't take the mutex when waking the consumer, so a wake up can be missed. In that case the
+				// entries will be picked up once the wait times out.
+				state.wakeSignal.wait_for(lock, milliseconds(LOG_CONSUMER_WAIT_MS));
+				state.consumerSleeping.store(false);
+			}
+		});
+	}
+
+	void Debug::stopAsyncLogging()
+	{
+		AsyncLogState& state = getAsyncLogState();
+		if(!state.active.exchange(false))
+			return;
+
+		state.wakeSignal.notify_one();
+		state.consumerThread.join();
+
+		// Producers that saw the logging as active might still be publishing their entries
+		while(state.numProducers.load() > 0)
+			std::this_thread::yield();
+
+		drainLogQueues(*this);
+	}
+
+	bool Debug::isAsyncLoggingActive() const
+	{
+		return getAsyncLogState().active.load(std::memory_order_relaxed);
+	}
+
+	void Debug::flushLog()
+	{
+		if(gIsLogConsumer)
+			return;
+
+		drainLogQueues(*this);
+	}
+
+	void Debug::setLogFile(const Path& path)
+	{
+		SPtr<DataStream> logFile;
+		if(!path.isEmpty())
+			logFile = FileSystem::createAndOpenFile(path);
+
+		Lock lock(mLogFileMutex);
+		if(mLogFile != nullptr)
+			mLogFile->close();
+
+		mLogFile = logFile;
+	}
+
+	bool Debug::_checkRateLimit(LogCallSite& site, LogVerbosity verbosity, UINT32& numSuppressed)
+	{
+		const UINT32 rateLimit = mLogRateLimit.load(std::memory_order_relaxed);
+		if(rateLimit == 0 || verbosity == LogVerbosity::Fatal || verbosity == LogVerbosity::Error)
+			return true;
+
+		const UINT64 now = (UINT64)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+
+		UINT64 windowStart = site.windowStart.load(std::memory_order_relaxed);
+		if(now - windowStart >= 1000)
+		{
+			// Only one thread gets to start the new window
+			if(site.windowStart.compare_exchange_strong(windowStart, now, std::memory_order_relaxed))
+				site.numInWindow.store(0, std::memory_order_relaxed);
+		}
+
+		if(site.numInWindow.fetch_add(1, std::memory_order_relaxed) >= rateLimit)
+		{
+			site.numSuppressed.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		if(site.numSuppressed.load(std::memory_order_relaxed) > 0)
+			numSuppressed = site.numSuppressed.exchange(0, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	DeferredLogEntry* Debug::_beginDeferredLog()
+	{
+		AsyncLogState& state = getAsyncLogState();
+		if(gIsLogConsumer)
+			return nullptr;
+
+		// Register as a producer before checking the state, so stopAsyncLogging() either waits for the entry to be
+		// published, or this thread sees logging as inactive and logs immediately
+		state.numProducers.fetch_add(1);
+		if(!state.active.load())
+		{
+			state.numProducers.fetch_sub(1);
+			return nullptr;
+		}
+
+		DeferredLogQueue* queue = getLogQueue();
+		const UINT32 tail = queue->tail.load(std::memory_order_relaxed);
+
+		// Queue is full, wait for the consumer to catch up
+		while(tail - queue->head.load(std::memory_order_acquire) >= DEFERRED_LOG_QUEUE_SIZE)
+		{
+			// Consumer thread has stopped, and the final drain won't happen until this thread stops producing
+			if(!state.active.load(std::memory_order_relaxed))
+			{
+				state.numProducers.fetch_sub(1);
+				return nullptr;
+			}
+
+			wakeLogConsumer();
+			std::this_thread::yield();
+		}
+
+		DeferredLogEntry* entry = &queue->entries[tail & (DEFERRED_LOG_QUEUE_SIZE - 1)];
+		entry->timestamp = (UINT64)steady_clock::now().time_since_epoch().count();
+		entry->localTime = std::time(nullptr);
+
+		return entry;
+	}
+
+	void Debug::_endDeferredLog()
+	{
+		DeferredLogQueue* queue = gLogQueue;
+		queue->tail.store(queue->tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+		getAsyncLogState().numProducers.fetch_sub(1, std::memory_order_release);
+		wakeLogConsumer();
+	}
+
+	void Debug::_logImmediate(const String& message, LogVerbosity verbosity, UINT32 category, const char* function,
+		const char* file, UINT32 line, UINT32 numSuppressed)
+	{
+		// Make sure queued up messages get logged before errors (and before a potential crash), so the output is ordered
+		if(verbosity == LogVerbosity::Fatal || verbosity == LogVerbosity::Error)
+			flushLog();
+
+		String fullMessage = message;
+		if(numSuppressed > 0)
+			fullMessage += " (" + toString(numSuppressed) + " similar messages were suppressed)";
+
+		fullMessage += String("\n\t\t in ") + function + " [" + file + ":" + toString(line) + "]\n";
+		log(fullMessage, verbosity, category);
+	}
+
+	void Debug::_logDeferredEntry(const DeferredLogEntry& entry)
+	{
+		String arguments[LOG_MAX_DEFERRED_ARGUMENTS];
+		for(UINT32 i = 0; i < entry.numArguments; i++)
+			arguments[i] = entry.arguments[i].toString();
+
+		String message = StringFormat::formatParams(entry.format, arguments, entry.numArguments);
+		if(entry.numSuppressed > 0)
+			message += " (" + toString(entry.numSuppressed) + " similar messages were suppressed)";
+
+		message += String("\n\t\t in ") + entry.function + " [" + entry.file + ":" + toString(entry.line) + "]\n";
+		logInternal(message, entry.verbosity, entry.category, entry.localTime);
+	}
+
 	void Debug::writeAsBMP(UINT8* rawPixels, UINT32 bytesPerPixel, UINT32 width, UINT32 height, const Path& filePath,
 		bool overwrite) const
 	{
@@ -139,6 +551,10 @@ namespace bs
 	
 	void Debug::saveHtmlLog(const Path& path) const
 	{
+		// Make sure any queued up messages are included
+		if(!gIsLogConsumer)
+			drainLogQueues(const_cast<Debug&>(*this));
+
 		static const char* style =
 			R"(html {
   font-family: sans-serif;
@@ -370,8 +786,57 @@ table td
 		return tmp;
 	}
 
+	static void writeTextLogEntry(StringStream& stream, const LogEntry& entry)
+	{
+		String builtMsg;
+		builtMsg.append(toString(entry.getLocalTime(), false, true, TimeToStringConversionType::Full));
+		builtMsg.append(" ");
+		
+		switch(entry.getVerbosity())
+		{
+		case LogVerbosity::Fatal:
+			builtMsg.append("[FATAL]");
+			break;
+		case LogVerbosity::Error:
+			builtMsg.append("[ERROR]");
+			break;
+		case LogVerbosity::Warning:
+			builtMsg.append("[WARNING]");
+			break;
+		case LogVerbosity::Info:
+			builtMsg.append("[INFO]");
+			break;
+		case LogVerbosity::Log:
+			builtMsg.append("[LOG]");
+			break;
+		case LogVerbosity::Verbose:
+			builtMsg.append("[VERBOSE]");
+			break;
+		case LogVerbosity::VeryVerbose:
+			builtMsg.append("[VERY_VERBOSE]");
+			break;
+		}
+		
+		String categoryName;
+		Log::getCategoryName(entry.getCategory(), categoryName);
+		builtMsg.append(" <" + categoryName + ">");
+
+		builtMsg.append(" | ");
+		
+		String tmpSpaces = _getSpacesIndentation(builtMsg.length());
+		
+		String parsedMessage = StringUtil::replaceAll(entry.getMessage(), "\n\t\t", "\n" + tmpSpaces);
+		builtMsg.append(parsedMessage);
+		
+		stream << builtMsg << "\n";
+	}
+
 	void Debug::saveTextLog(const Path& path) const
 	{
+		// Make sure any queued up messages are included
+		if(!gIsLogConsumer)
+			drainLogQueues(const_cast<Debug&>(*this));
+
 		#if BS_IS_BANSHEE3D
 		static const char* engineHeader = "This is Banshee Engine ";
 		static const char* bsfBasedHeader = "Based on bs::framework ";
@@ -419,49 +884,7 @@ table td
 		
 		Vector<LogEntry> entries = mLog.getAllEntries();
 		for (auto& entry : entries)
-		{
-			String builtMsg;
-			builtMsg.append(toString(entry.getLocalTime(), false, true, TimeToStringConversionType::Full));
-			builtMsg.append(" ");
-			
-			switch(entry.getVerbosity())
-			{
-			case LogVerbosity::Fatal:
-				builtMsg.append("[FATAL]");
-				break;
-			case LogVerbosity::Error:
-				builtMsg.append("[ERROR]");
-				break;
-			case LogVerbosity::Warning:
-				builtMsg.append("[WARNING]");
-				break;
-			case LogVerbosity::Info:
-				builtMsg.append("[INFO]");
-				break;
-			case LogVerbosity::Log:
-				builtMsg.append("[LOG]");
-				break;
-			case LogVerbosity::Verbose:
-				builtMsg.append("[VERBOSE]");
-				break;
-			case LogVerbosity::VeryVerbose:
-				builtMsg.append("[VERY_VERBOSE]");
-				break;
-			}
-			
-			String categoryName;
-			mLog.getCategoryName(entry.getCategory(), categoryName);
-			builtMsg.append(" <" + categoryName + ">");
-
-			builtMsg.append(" | ");
-			
-			String tmpSpaces = _getSpacesIndentation(builtMsg.length());
-			
-			String parsedMessage = StringUtil::replaceAll(entry.getMessage(), "\n\t\t", "\n" + tmpSpaces);
-			builtMsg.append(parsedMessage);
-			
-			stream << builtMsg << "\n";
-		}
+			writeTextLogEntry(stream, entry);
 		
 		SPtr<DataStream> fileStream = FileSystem::createAndOpenFile(path);
 		fileStream->writeString(stream.str());
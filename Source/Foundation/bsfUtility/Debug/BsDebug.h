@@ -29,6 +29,7 @@ namespace bs
 	{
 	public:
 		Debug() = default;
+		~Debug();
 
 		/**
 		 * Logs a new message.
@@ -39,6 +40,95 @@ namespace bs
 		 */
 		void log(const String& message, LogVerbosity verbosity, UINT32 category = 0);
 
+		/**
+		 * Logs a new message built from a format string and a set of arguments (see StringUtil::format). If asynchronous
+		 * logging is active the message is recorded into a lock-free queue owned by the calling thread, and formatted and
+		 * logged later on the log consumer thread. Otherwise the message is logged immediately. Fatal and error messages,
+		 * and messages with more than LOG_MAX_DEFERRED_ARGUMENTS arguments, are always logged immediately.
+		 *
+		 * Normally called through BS_LOG.
+		 *
+		 * @param[in]	site		Call site the message originates from, used for rate limiting.
+		 * @param[in]	verbosity	Verbosity of the message, determining its importance.
+		 * @param[in]	category	Category of the message, determining which system is it relevant to.
+		 * @param[in]	function	Name of the function the message originates from. Must be a string literal.
+		 * @param[in]	file		Name of the file the message originates from. Must be a string literal.
+		 * @param[in]	line		Line the message originates from.
+		 * @param[in]	message		Message format string. Copied into storage owned by the queue entry, which is re-used
+		 *							once the queue wraps around.
+		 * @param[in]	args		Arguments to insert into the format string.
+		 */
+		template<class M, class... Args>
+		void logDeferred(LogCallSite& site, LogVerbosity verbosity, UINT32 category, const char* function,
+			const char* file, UINT32 line, M&& message, Args&&... args)
+		{
+			UINT32 numSuppressed = 0;
+			if(!_checkRateLimit(site, verbosity, numSuppressed))
+				return;
+
+			DeferredLogEntry* entry = nullptr;
+			if(sizeof...(Args) <= LOG_MAX_DEFERRED_ARGUMENTS && verbosity != LogVerbosity::Fatal &&
+				verbosity != LogVerbosity::Error)
+			{
+				entry = _beginDeferredLog();
+			}
+
+			if(entry == nullptr)
+			{
+				_logImmediate(StringUtil::format(message, std::forward<Args>(args)...), verbosity, category, function, file,
+					line, numSuppressed);
+				return;
+			}
+
+			setDeferredFormat(*entry, message);
+			entry->function = function;
+			entry->file = file;
+			entry->line = line;
+			entry->verbosity = verbosity;
+			entry->category = category;
+			entry->numSuppressed = numSuppressed;
+			entry->numArguments = 0;
+			setDeferredArguments(*entry, std::forward<Args>(args)...);
+
+			_endDeferredLog();
+		}
+
+		/**
+		 * Starts a background thread that formats and logs messages recorded through logDeferred(), moving the cost of
+		 * formatting and dispatching messages off the threads doing the logging. Must be paired with
+		 * stopAsyncLogging().
+		 *
+		 * @note	While active, deferred messages reach the log callback (see setLogCallback()) from the background
+		 *			thread, or from whichever thread calls flushLog().
+		 */
+		void startAsyncLogging();
+
+		/** Stops the background logging thread started by startAsyncLogging(), after logging any queued messages. */
+		void stopAsyncLogging();
+
+		/** Checks is the background logging thread running. */
+		bool isAsyncLoggingActive() const;
+
+		/**
+		 * Formats and logs all messages queued through logDeferred() on the calling thread, blocking until done. Does
+		 * nothing if called from within the background logging thread.
+		 */
+		void flushLog();
+
+		/**
+		 * Limits how many messages per second a single BS_LOG call site can log. Messages over the limit are dropped
+		 * and their count is reported alongside the next message logged from the same call site. Since the limit
+		 * applies to the call site regardless of the message contents, enable it only to guard against call sites
+		 * spamming the log. Fatal and error messages are never dropped. Zero disables the limit. Default is zero.
+		 */
+		void setLogRateLimit(UINT32 maxMessagesPerSecond) { mLogRateLimit.store(maxMessagesPerSecond); }
+
+		/**
+		 * Starts writing all messages logged from this point on into a text file at the specified path, replacing any
+		 * existing file. Provide an empty path to close the file.
+		 */
+		void setLogFile(const Path& path);
+
 		/** Retrieves the Log used by the Debug instance. */
 		Log& getLog() { return mLog; }
 
@@ -82,7 +172,14 @@ namespace bs
 		 */
 		Event<void()> onLogModified;
 
-		/** This allows setting a log callback that can override the default action in log */
+		/**
+		 * This allows setting a log callback that can override the default action in log.
+		 *
+		 * @note
+		 * The callback is called from the thread that logged the message, except for messages deferred while
+		 * asynchronous logging is active (see startAsyncLogging()), which are delivered from the log consumer thread.
+		 * Fatal and error messages are never deferred. The callback must be thread safe if asynchronous logging is used.
+		 */
 		void setLogCallback(
 			std::function<bool(const String& message, LogVerbosity verbosity, UINT32 category)> callback)
 		{
@@ -101,11 +198,72 @@ namespace bs
 		 */
 		void _triggerCallbacks();
 
+		/**
+		 * Applies the rate limit to a message logged from the specified call site. Returns false if the message should
+		 * be dropped. Otherwise returns true and outputs the number of messages dropped at the call site since the last
+		 * logged message.
+		 */
+		bool _checkRateLimit(LogCallSite& site, LogVerbosity verbosity, UINT32& numSuppressed);
+
+		/**
+		 * Reserves a new entry in the calling thread's deferred log queue. Returns null if asynchronous logging is not
+		 * active. Must be followed by a call to _endDeferredLog() if an entry is returned.
+		 */
+		DeferredLogEntry* _beginDeferredLog();
+
+		/** Makes the entry returned by the last call to _beginDeferredLog() visible to the log consumer thread. */
+		void _endDeferredLog();
+
+		/** Logs an already formatted message with the source location appended, in the same form as deferred messages. */
+		void _logImmediate(const String& message, LogVerbosity verbosity, UINT32 category, const char* function,
+			const char* file, UINT32 line, UINT32 numSuppressed);
+
+		/** Formats a deferred log entry and logs it. */
+		void _logDeferredEntry(const DeferredLogEntry& entry);
+
 		/** @} */
 	private:
+		/**
+		 * Copies the format string of a deferred entry, as the caller's string might not outlive the entry. Character
+		 * arrays aren't referenced even if constant, since they aren't guaranteed to be string literals.
+		 */
+		static void setDeferredFormat(DeferredLogEntry& entry, const char* message)
+		{
+			entry.formatStorage.assign(message);
+			entry.format = entry.formatStorage.c_str();
+		}
+
+		/** @copydoc setDeferredFormat(DeferredLogEntry&, const char*) */
+		static void setDeferredFormat(DeferredLogEntry& entry, const String& message)
+		{
+			entry.formatStorage = message;
+			entry.format = entry.formatStorage.c_str();
+		}
+
+		/** Stores the arguments of a deferred entry. */
+		template<class T, class... Args>
+		static void setDeferredArguments(DeferredLogEntry& entry, T&& arg, Args&&... args)
+		{
+			if(entry.numArguments >= LOG_MAX_DEFERRED_ARGUMENTS)
+				return;
+
+			entry.arguments[entry.numArguments++].set(arg);
+			setDeferredArguments(entry, std::forward<Args>(args)...);
+		}
+
+		/** Stops the argument recursion of setDeferredArguments(). */
+		static void setDeferredArguments(DeferredLogEntry& entry) { }
+
+		/** Same as log(), except with an explicitly provided time at which the message was recorded. */
+		void logInternal(const String& message, LogVerbosity verbosity, UINT32 category, std::time_t localTime);
+
 		UINT64 mLogHash = 0;
 		Log mLog;
 		std::function<bool(const String& message, LogVerbosity verbosity, UINT32 category)> mCustomLogCallback;
+		std::atomic<UINT32> mLogRateLimit { 0 };
+
+		SPtr<DataStream> mLogFile;
+		Mutex mLogFileMutex;
 	};
 
 	/** A simpler way of accessing the Debug module. */
@@ -131,15 +289,21 @@ namespace bs
 /** Get the ID of the log category based on its name. */
 #define BS_LOG_GET_CATEGORY_ID(category) LogCategory##category::_id
 
+/**
+ * Logs a message with the specified verbosity and category. The message is a format string with "{0}", "{1}", etc.
+ * identifiers replaced by the additional arguments (see StringUtil::format). Messages above BS_LOG_VERBOSITY are
+ * removed at compile time. Formatting is deferred to the log consumer thread if asynchronous logging is active, see
+ * Debug::startAsyncLogging().
+ */
 #define BS_LOG(verbosity, category, message, ...)													\
   do																								\
   {																									\
 	using namespace ::bs;																			\
 	if ((INT32)LogVerbosity::verbosity <= (INT32)BS_LOG_VERBOSITY)									\
 	{																								\
-	  gDebug().log(StringUtil::format(message, ##__VA_ARGS__) + String("\n\t\t in ") +				\
-					   __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n",	\
-				   LogVerbosity::verbosity, LogCategory##category::_id);							\
+	  static LogCallSite _bsLogCallSite;															\
+	  gDebug().logDeferred(_bsLogCallSite, LogVerbosity::verbosity, LogCategory##category::_id,		\
+		  __PRETTY_FUNCTION__, __FILE__, __LINE__, message, ##__VA_ARGS__);							\
 	}																								\
   } while (0)
 
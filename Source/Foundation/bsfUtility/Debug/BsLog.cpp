@@ -19,6 +19,13 @@ namespace bs
 		mUnreadEntries.push(LogEntry(message, verbosity, category));
 	}
 
+	void Log::logMsg(const String& message, LogVerbosity verbosity, UINT32 category, std::time_t localTime)
+	{
+		RecursiveLock lock(mMutex);
+
+		mUnreadEntries.push(LogEntry(message, verbosity, category, localTime));
+	}
+
 	void Log::clear()
 	{
 		RecursiveLock lock(mMutex);
@@ -95,6 +102,30 @@ namespace bs
 		return mEntries;
 	}
 	
+	String LogArgument::toString() const
+	{
+		switch(mType)
+		{
+		case Type::Int:
+			return bs::toString((int)mInt);
+		case Type::UInt:
+			return bs::toString((unsigned int)mUInt);
+		case Type::Int64:
+			return bs::toString(mInt, 0, ' '); // std::time_t can also be a 64-bit int, explicit arguments avoid ambiguity
+		case Type::UInt64:
+			return bs::toString(mUInt);
+		case Type::Float:
+			return bs::toString(mFloat);
+		case Type::Double:
+			return bs::toString(mDouble);
+		case Type::Bool:
+			return bs::toString(mBool);
+		default:
+		case Type::String:
+			return mString;
+		}
+	}
+
 	bool Log::_registerCategory(UINT32 id, const char* name)
 	{
 		if (!categoryExists(id))
@@ -4,6 +4,7 @@
 
 #include "Prerequisites/BsPrerequisitesUtil.h"
 #include "Utility/BsTime.h"
+#include <atomic>
 
 namespace bs
 {
@@ -44,6 +45,10 @@ namespace bs
 			:mMsg(std::move(msg)), mVerbosity(verbosity), mCategory(category), mLocalTime(std::time(nullptr))
 		{ }
 
+		LogEntry(String msg, LogVerbosity verbosity, UINT32 category, std::time_t localTime)
+			:mMsg(std::move(msg)), mVerbosity(verbosity), mCategory(category), mLocalTime(localTime)
+		{ }
+
 		/** Determines how important is the message and when should it be displayed. */
 		LogVerbosity getVerbosity() const { return mVerbosity; }
 
@@ -63,6 +68,82 @@ namespace bs
 		std::time_t mLocalTime;
 	};
 
+	/** Maximum number of arguments a deferred log message can hold. Messages with more arguments are formatted immediately. */
+	static constexpr UINT32 LOG_MAX_DEFERRED_ARGUMENTS = 8;
+
+	/**
+	 * Holds a single argument of a log message until the message is formatted. Arithmetic values are stored as-is and
+	 * converted to a string only when formatted, while all other types are converted to a string immediately.
+	 */
+	class BS_UTILITY_EXPORT LogArgument
+	{
+	public:
+		void set(int value) { mType = Type::Int; mInt = value; }
+		void set(unsigned int value) { mType = Type::UInt; mUInt = value; }
+		void set(INT64 value) { mType = Type::Int64; mInt = value; }
+		void set(UINT64 value) { mType = Type::UInt64; mUInt = value; }
+		void set(float value) { mType = Type::Float; mFloat = value; }
+		void set(double value) { mType = Type::Double; mDouble = value; }
+		void set(bool value) { mType = Type::Bool; mBool = value; }
+		void set(const String& value) { mType = Type::String; mString = value; }
+		void set(const char* value) { mType = Type::String; if(value) mString = value; else mString.clear(); }
+		void set(char* value) { set((const char*)value); }
+
+		template<class T>
+		void set(const T& value) { mType = Type::String; mString = bs::toString(value); }
+
+		/** Converts the stored value into a string, the same way StringUtil::format() would. */
+		String toString() const;
+
+		/** Releases any memory held by the argument, while keeping string capacity for re-use. */
+		void reset() { mType = Type::String; mString.clear(); }
+
+	private:
+		enum class Type : UINT8 { Int, UInt, Int64, UInt64, Float, Double, Bool, String };
+
+		Type mType = Type::String;
+		union
+		{
+			INT64 mInt;
+			UINT64 mUInt;
+			float mFloat;
+			double mDouble;
+			bool mBool;
+		};
+		String mString;
+	};
+
+	/**
+	 * State kept by each BS_LOG call site, used for rate limiting repeated messages. Must have static storage duration.
+	 */
+	struct LogCallSite
+	{
+		std::atomic<UINT64> windowStart { 0 };
+		std::atomic<UINT32> numInWindow { 0 };
+		std::atomic<UINT32> numSuppressed { 0 };
+	};
+
+	/**
+	 * Log message recorded on a producer thread whose formatting has been deferred to the log consumer thread. See
+	 * Debug::startAsyncLogging().
+	 */
+	struct DeferredLogEntry
+	{
+		const char* format = nullptr; /**< Points to formatStorage. */
+		String formatStorage;
+		const char* function = nullptr;
+		const char* file = nullptr;
+		UINT32 line = 0;
+		LogVerbosity verbosity = LogVerbosity::Log;
+		UINT32 category = 0;
+		UINT32 numSuppressed = 0;
+		UINT64 timestamp = 0;
+		std::time_t localTime = 0;
+
+		UINT32 numArguments = 0;
+		LogArgument arguments[LOG_MAX_DEFERRED_ARGUMENTS];
+	};
+
 	/**
 	 * Used for logging messages. Messages can be categorized and filtered by verbosity, the log can be saved to a file
 	 * and send out callbacks when a new message is added.
@@ -84,6 +165,16 @@ namespace bs
 		 */
 		void logMsg(const String& message, LogVerbosity verbosity, UINT32 category);
 
+		/**
+		 * Logs a new message, with an explicitly provided time.
+		 *
+		 * @param[in]	message		The message describing the log entry.
+		 * @param[in]	verbosity	Verbosity of the message, determining its importance.
+		 * @param[in]	category	Category of the message, determining which system is it relevant to.
+		 * @param[in]	localTime	Time at which the message was recorded.
+		 */
+		void logMsg(const String& message, LogVerbosity verbosity, UINT32 category, std::time_t localTime);
+
 		/** Removes all log entries. */
 		void clear();
 
@@ -0,0 +1,327 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Debug/BsProfilerTimeline.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include <chrono>
+#include <iomanip>
+
+using namespace std::chrono;
+
+namespace bs
+{
+	static_assert((ProfilerTimeline::EVENTS_PER_THREAD & (ProfilerTimeline::EVENTS_PER_THREAD - 1)) == 0,
+		"Number of timeline events per thread must be a power of two.");
+
+	/** A single recorded timeline event. */
+	struct TimelineEvent
+	{
+		UINT64 timestamp;
+		UINT32 id;
+		UINT32 type;
+	};
+
+	/** Event name cached by the recording thread, keyed by the address of the name string. */
+	struct TimelineCachedName
+	{
+		UINT32 id;
+		const char* name;
+	};
+
+	/** Event ring buffer and other information about a single thread that recorded timeline events. */
+	struct TimelineThread
+	{
+		UINT32 index = 0;
+		String name;
+
+		std::atomic<TimelineEvent*> events { nullptr };
+		std::atomic<UINT64> writeIdx { 0 };
+		std::atomic<UINT64> readStartIdx { 0 };
+
+		UnorderedMap<const char*, TimelineCachedName> nameCache; // Only accessed by the owning thread
+	};
+
+	/** Global state shared between all threads recording the timeline. */
+	struct TimelineRegistry
+	{
+		Mutex mutex;
+		Vector<TimelineThread*> threads;
+		Vector<char*> eventNames;
+		UnorderedMap<String, UINT32> eventLookup;
+		steady_clock::time_point epoch = steady_clock::now();
+	};
+
+	/**
+	 * Returns the global timeline state. Note that threads and their ring buffers are intentionally never freed, as
+	 * threads could still be recording while the application shuts down.
+	 */
+	static TimelineRegistry& getRegistry()
+	{
+		static TimelineRegistry* registry = bs_new<TimelineRegistry>();
+		return *registry;
+	}
+
+	static BS_THREADLOCAL TimelineThread* gActiveThread = nullptr;
+
+	/** Returns the timeline data for the calling thread, creating it if needed. */
+	static TimelineThread* getThread()
+	{
+		TimelineThread* thread = gActiveThread;
+		if(thread != nullptr)
+			return thread;
+
+		thread = bs_new<TimelineThread>();
+
+		{
+			TimelineRegistry& registry = getRegistry();
+			Lock lock(registry.mutex);
+
+			thread->index = (UINT32)registry.threads.size();
+			registry.threads.push_back(thread);
+		}
+
+		gActiveThread = thread;
+		return thread;
+	}
+
+	/** Appends the string to the stream, escaping any characters not allowed in a JSON string. */
+	static void writeJSONString(StringStream& stream, const char* str)
+	{
+		stream << '"';
+		for(const char* iter = str; *iter != '\0'; ++iter)
+		{
+			const char ch = *iter;
+			if(ch == '"' || ch == '\\')
+				stream << '\\' << ch;
+			else if((UINT8)ch < 0x20)
+				stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (UINT32)ch << std::dec;
+			else
+				stream << ch;
+		}
+		stream << '"';
+	}
+
+	/** Appends a nanosecond timestamp to the stream, in microseconds as expected by the trace format. */
+	static void writeTimestamp(StringStream& stream, UINT64 timestampNs)
+	{
+		stream << (timestampNs / 1000) << '.' << std::setw(3) << std::setfill('0') << (timestampNs % 1000);
+	}
+
+	std::atomic<bool> ProfilerTimeline::sEnabled { false };
+
+	void ProfilerTimeline::setEnabled(bool enabled)
+	{
+		sEnabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	UINT32 ProfilerTimeline::getEventId(const char* name)
+	{
+		if(name == nullptr)
+			return INVALID_EVENT_ID;
+
+		TimelineRegistry& registry = getRegistry();
+		Lock lock(registry.mutex);
+
+		String key(name);
+		auto iterFind = registry.eventLookup.find(key);
+		if(iterFind != registry.eventLookup.end())
+			return iterFind->second;
+
+		const size_t length = key.size() + 1;
+		char* nameCopy = (char*)bs_alloc(length);
+		memcpy(nameCopy, name, length);
+
+		const UINT32 id = (UINT32)registry.eventNames.size();
+		registry.eventNames.push_back(nameCopy);
+		registry.eventLookup[key] = id;
+
+		return id;
+	}
+
+	UINT32 ProfilerTimeline::getEventId(const String& name)
+	{
+		return getEventId(name.c_str());
+	}
+
+	const char* ProfilerTimeline::getEventName(UINT32 id)
+	{
+		TimelineRegistry& registry = getRegistry();
+		Lock lock(registry.mutex);
+
+		if(id >= registry.eventNames.size())
+			return "";
+
+		return registry.eventNames[id];
+	}
+
+	void ProfilerTimeline::setThreadName(const char* name)
+	{
+		TimelineThread* thread = getThread();
+
+		TimelineRegistry& registry = getRegistry();
+		Lock lock(registry.mutex);
+
+		thread->name = name;
+	}
+
+	void ProfilerTimeline::clear()
+	{
+		TimelineRegistry& registry = getRegistry();
+		Lock lock(registry.mutex);
+
+		for(auto& thread : registry.threads)
+			thread->readStartIdx.store(thread->writeIdx.load(std::memory_order_acquire), std::memory_order_relaxed);
+	}
+
+	UINT32 ProfilerTimeline::getEventIdCached(const char* name)
+	{
+		TimelineThread* thread = getThread();
+
+		// Addresses can be re-used by different strings (e.g. stack buffers), so make sure the contents still match
+		auto iterFind = thread->nameCache.find(name);
+		if(iterFind != thread->nameCache.end() && strcmp(iterFind->second.name, name) == 0)
+			return iterFind->second.id;
+
+		const UINT32 id = getEventId(name);
+		if(id == INVALID_EVENT_ID)
+			return id;
+
+		thread->nameCache[name] = { id, getEventName(id) };
+		return id;
+	}
+
+	void ProfilerTimeline::record(UINT32 id, EventType type)
+	{
+		if(id == INVALID_EVENT_ID)
+			return;
+
+		TimelineThread* thread = getThread();
+
+		TimelineEvent* events = thread->events.load(std::memory_order_relaxed);
+		if(events == nullptr)
+		{
+			events = bs_newN<TimelineEvent>(EVENTS_PER_THREAD);
+			thread->events.store(events, std::memory_order_release);
+		}
+
+		const nanoseconds elapsed = steady_clock::now() - getRegistry().epoch;
+		const UINT64 writeIdx = thread->writeIdx.load(std::memory_order_relaxed);
+
+		TimelineEvent& event = events[writeIdx & (EVENTS_PER_THREAD - 1)];
+		event.timestamp = (UINT64)elapsed.count();
+		event.id = id;
+		event.type = (UINT32)type;
+
+		thread->writeIdx.store(writeIdx + 1, std::memory_order_release);
+	}
+
+	String ProfilerTimeline::exportChromeTrace()
+	{
+		TimelineRegistry& registry = getRegistry();
+
+		Vector<TimelineThread*> threads;
+		Vector<String> threadNames;
+		Vector<char*> eventNames;
+		{
+			Lock lock(registry.mutex);
+
+			threads = registry.threads;
+			for(auto& thread : threads)
+				threadNames.push_back(thread->name);
+
+			eventNames = registry.eventNames;
+		}
+
+		StringStream output;
+		output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+		bool first = true;
+		auto beginEntry = [&output, &first]()
+		{
+			if(!first)
+				output << ",";
+
+			output << "\n";
+			first = false;
+		};
+
+		Vector<TimelineEvent> events;
+		events.reserve(EVENTS_PER_THREAD);
+
+		for(UINT32 i = 0; i < (UINT32)threads.size(); i++)
+		{
+			TimelineThread* thread = threads[i];
+			const UINT32 tid = thread->index + 1;
+
+			String threadName = threadNames[i];
+			if(threadName.empty())
+				threadName = "Thread " + toString(tid);
+
+			beginEntry();
+			output << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid << ",\"args\":{\"name\":";
+			writeJSONString(output, threadName.c_str());
+			output << "}}";
+
+			const TimelineEvent* threadEvents = thread->events.load(std::memory_order_acquire);
+			if(threadEvents == nullptr)
+				continue;
+
+			// The owning thread keeps writing while we read, so copy everything out first and then discard any events
+			// that might have been overwritten during the copy
+			const UINT64 end = thread->writeIdx.load(std::memory_order_acquire);
+			UINT64 start = thread->readStartIdx.load(std::memory_order_relaxed);
+			if(end > EVENTS_PER_THREAD)
+				start = std::max(start, end - EVENTS_PER_THREAD);
+
+			events.clear();
+			for(UINT64 j = start; j < end; j++)
+				events.push_back(threadEvents[j & (EVENTS_PER_THREAD - 1)]);
+
+			// Slot currently being written by the owner thread could also be overwritten, hence the + 1
+			const UINT64 endAfterCopy = thread->writeIdx.load(std::memory_order_acquire);
+			UINT64 firstValid = start;
+			if(endAfterCopy + 1 > EVENTS_PER_THREAD)
+				firstValid = std::max(firstValid, endAfterCopy + 1 - EVENTS_PER_THREAD);
+
+			const UINT64 numDiscarded = std::min(firstValid - start, (UINT64)events.size());
+
+			// Skip end events whose begin event was discarded, as the viewers don't handle them well
+			UINT32 depth = 0;
+			for(UINT64 j = numDiscarded; j < (UINT64)events.size(); j++)
+			{
+				const TimelineEvent& event = events[(size_t)j];
+				if(event.id >= (UINT32)eventNames.size())
+					continue;
+
+				const bool isBegin = event.type == (UINT32)EventType::Begin;
+
+				if(isBegin)
+					depth++;
+				else
+				{
+					if(depth == 0)
+						continue;
+
+					depth--;
+				}
+
+				beginEntry();
+				output << "{\"name\":";
+				writeJSONString(output, eventNames[event.id]);
+				output << ",\"cat\":\"bsf\",\"ph\":\"" << (isBegin ? "B" : "E") << "\",\"ts\":";
+				writeTimestamp(output, event.timestamp);
+				output << ",\"pid\":1,\"tid\":" << tid << "}";
+			}
+		}
+
+		output << "\n]}\n";
+		return output.str();
+	}
+
+	void ProfilerTimeline::saveChromeTrace(const Path& path)
+	{
+		SPtr<DataStream> fileStream = FileSystem::createAndOpenFile(path);
+		fileStream->writeString(exportChromeTrace());
+		fileStream->close();
+	}
+}
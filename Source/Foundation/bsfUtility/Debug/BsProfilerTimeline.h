@@ -0,0 +1,138 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include <atomic>
+
+namespace bs
+{
+	/** @addtogroup Debug
+	 *  @{
+	 */
+
+	/**
+	 * Records a timeline of begin/end events for every thread, allowing you to see when some work executed and how it
+	 * overlapped with work on other threads. Unlike ProfilerCPU this performs no aggregation: every event is written as a
+	 * (timestamp, event id, begin/end) record into a fixed size ring buffer owned by the recording thread, so recording
+	 * requires no locks. Once the ring buffer fills up the oldest events are overwritten.
+	 *
+	 * Recording is disabled by default, in which case beginEvent() and endEvent() reduce to a single flag check.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_UTILITY_EXPORT ProfilerTimeline
+	{
+	public:
+		/** Maximum number of events stored per thread. Must be a power of two. */
+		static constexpr UINT32 EVENTS_PER_THREAD = 32768;
+
+		/** Identifier returned by getEventId() when the event couldn't be registered. */
+		static constexpr UINT32 INVALID_EVENT_ID = (UINT32)-1;
+
+		/**
+		 * Enables or disables timeline recording. Events already recorded are kept, use clear() to remove them. Enabling
+		 * the recording allocates the per-thread ring buffers as threads record their first event.
+		 */
+		static void setEnabled(bool enabled);
+
+		/** Checks is timeline recording currently enabled. */
+		static bool isEnabled() { return sEnabled.load(std::memory_order_relaxed); }
+
+		/**
+		 * Returns a unique identifier for an event with the specified name, registering the name if needed. Identifiers
+		 * are never released so the same name always maps to the same identifier.
+		 */
+		static UINT32 getEventId(const char* name);
+
+		/** @copydoc getEventId(const char*) */
+		static UINT32 getEventId(const String& name);
+
+		/** Returns the name of an event previously registered through getEventId(). */
+		static const char* getEventName(UINT32 id);
+
+		/** Assigns a name to the calling thread, to be displayed in the exported timeline. */
+		static void setThreadName(const char* name);
+
+		/** Records the start of an event with the provided identifier on the calling thread. */
+		static void beginEvent(UINT32 id)
+		{
+			if(isEnabled())
+				record(id, EventType::Begin);
+		}
+
+		/** Records the end of an event with the provided identifier on the calling thread. */
+		static void endEvent(UINT32 id)
+		{
+			if(isEnabled())
+				record(id, EventType::End);
+		}
+
+		/**
+		 * Records the start of an event with the provided name on the calling thread. The name lookup is cached per thread
+		 * so string literals can be passed directly without a significant cost.
+		 */
+		static void beginEvent(const char* name)
+		{
+			if(isEnabled())
+				record(getEventIdCached(name), EventType::Begin);
+		}
+
+		/** Records the end of an event with the provided name on the calling thread. */
+		static void endEvent(const char* name)
+		{
+			if(isEnabled())
+				record(getEventIdCached(name), EventType::End);
+		}
+
+		/** Removes all events recorded so far, on all threads. */
+		static void clear();
+
+		/**
+		 * Outputs all the recorded events in the Chrome trace-event JSON format. The output can be viewed in
+		 * chrome://tracing or imported into the Perfetto UI. Recording doesn't need to be disabled during export, although
+		 * events recorded while the export is in progress might not be included.
+		 */
+		static String exportChromeTrace();
+
+		/** Saves the output of exportChromeTrace() into a file at the specified path. */
+		static void saveChromeTrace(const Path& path);
+
+	private:
+		/** Type of a single timeline event. */
+		enum class EventType : UINT32
+		{
+			Begin,
+			End
+		};
+
+		/** Writes a new event to the calling thread's ring buffer. */
+		static void record(UINT32 id, EventType type);
+
+		/** Same as getEventId(const char*) except it first checks a per-thread cache keyed by the string address. */
+		static UINT32 getEventIdCached(const char* name);
+
+		static std::atomic<bool> sEnabled;
+	};
+
+	/** Helper that records a timeline event for the duration of its lifetime. */
+	class ProfilerTimelineScope
+	{
+	public:
+		ProfilerTimelineScope(UINT32 id)
+			:mId(id)
+		{
+			ProfilerTimeline::beginEvent(mId);
+		}
+
+		~ProfilerTimelineScope()
+		{
+			ProfilerTimeline::endEvent(mId);
+		}
+
+	private:
+		UINT32 mId;
+	};
+
+	/** @} */
+}
@@ -104,6 +104,23 @@ namespace bs
 		 * @return	String containing the call stack with each function on its own line.
 		 */
 		static String getStackTrace();
+
+		/**
+		 * Captures return addresses of the functions on the current call stack, without resolving their names. Much
+		 * cheaper than getStackTrace().
+		 *
+		 * @param[out]	frames		Array to write the addresses to, starting with the innermost function.
+		 * @param[in]	maxFrames	Size of the @p frames array.
+		 * @param[in]	skip		Number of innermost functions to skip, not counting this method.
+		 * @return					Number of addresses written to @p frames.
+		 */
+		static UINT32 getRawStackTrace(void** frames, UINT32 maxFrames, UINT32 skip = 0);
+
+		/**
+		 * Returns a readable name of the function containing the provided address, as returned by getRawStackTrace(). If
+		 * the function cannot be found in the symbol table the address is returned instead.
+		 */
+		static String getSymbolName(void* address);
 	private:
 		/** Does what it says. Internal utility function used by reportCrash(). */
 		void logErrorAndStackTrace(const String& message, const String& stackTrace) const;
@@ -5,6 +5,7 @@
 #include "Math/BsPlane.h"
 #include "Math/BsSphere.h"
 #include "Math/BsMath.h"
+#include "Math/BsSIMD.h"
 
 namespace bs
 {
@@ -191,6 +192,48 @@ namespace bs
 		setExtents(min, max);
 	}
 
+	void AABox::transformAffine(const Matrix4& m, const AABox* input, AABox* output, UINT32 count)
+	{
+		using namespace simd;
+
+		float32x4 column0 = loadRow(m, 0);
+		float32x4 column1 = loadRow(m, 1);
+		float32x4 column2 = loadRow(m, 2);
+		float32x4 translation = loadRow(m, 3);
+		transpose4(column0, column1, column2, translation);
+
+		SIMDPP_ALIGN(16) float min[4];
+		SIMDPP_ALIGN(16) float max[4];
+		for(UINT32 i = 0; i < count; i++)
+		{
+			const Vector3& boxMin = input[i].mMinimum;
+			const Vector3& boxMax = input[i].mMaximum;
+
+			float32x4 newMin = translation;
+			float32x4 newMax = translation;
+
+			float32x4 e = mul(column0, splat<float32x4>(boxMin.x));
+			float32x4 f = mul(column0, splat<float32x4>(boxMax.x));
+			newMin = add(newMin, simd::min(e, f));
+			newMax = add(newMax, simd::max(e, f));
+
+			e = mul(column1, splat<float32x4>(boxMin.y));
+			f = mul(column1, splat<float32x4>(boxMax.y));
+			newMin = add(newMin, simd::min(e, f));
+			newMax = add(newMax, simd::max(e, f));
+
+			e = mul(column2, splat<float32x4>(boxMin.z));
+			f = mul(column2, splat<float32x4>(boxMax.z));
+			newMin = add(newMin, simd::min(e, f));
+			newMax = add(newMax, simd::max(e, f));
+
+			store(min, newMin);
+			store(max, newMax);
+
+			output[i].setExtents(Vector3(min[0], min[1], min[2]), Vector3(max[0], max[1], max[2]));
+		}
+	}
+
 	bool AABox::intersects(const AABox& b2) const
 	{
 		// Use up to 6 separating planes
@@ -95,6 +95,13 @@ namespace bs
 		 */
 		void transformAffine(const Matrix4& matrix);
 
+		/**
+		 * Transforms @p count bounding boxes from the @p input array by the provided affine matrix and writes them into
+		 * the @p output array. Produces the same results as calling transformAffine() on each box, but processes the boxes
+		 * using SIMD instructions. Output array may be the same as the input array.
+		 */
+		static void transformAffine(const Matrix4& matrix, const AABox* input, AABox* output, UINT32 count);
+
 		/** Returns true if this and the provided box intersect. */
 		bool intersects(const AABox& b2) const;
 
@@ -5,12 +5,73 @@
 #include "Math/BsVector3.h"
 #include "Math/BsMatrix3.h"
 #include "Math/BsQuaternion.h"
+#include "Math/BsSIMD.h"
 
 namespace bs
 {
 	const Matrix4 Matrix4::ZERO{BS_ZERO()};
 	const Matrix4 Matrix4::IDENTITY{BS_IDENTITY()};
 
+	static_assert(sizeof(Vector3) == sizeof(float) * 3, "Batch transforms expect tightly packed Vector3 arrays.");
+
+	/**
+	 * Transforms an array of 3D vectors by the 3x4 part of the matrix, four vectors at a time. Translation is only applied
+	 * if @p Translate is true. Returns the number of vectors transformed, any remaining vectors need to be transformed
+	 * by the caller. Produces the same results as the scalar transform.
+	 */
+	template<bool Translate>
+	static UINT32 transformVector3Array(const Matrix4& matrix, const Vector3* input, Vector3* output, UINT32 count)
+	{
+		using namespace simd;
+
+		const float32x4 m00 = splat<float32x4>(matrix[0][0]);
+		const float32x4 m01 = splat<float32x4>(matrix[0][1]);
+		const float32x4 m02 = splat<float32x4>(matrix[0][2]);
+		const float32x4 m03 = splat<float32x4>(matrix[0][3]);
+		const float32x4 m10 = splat<float32x4>(matrix[1][0]);
+		const float32x4 m11 = splat<float32x4>(matrix[1][1]);
+		const float32x4 m12 = splat<float32x4>(matrix[1][2]);
+		const float32x4 m13 = splat<float32x4>(matrix[1][3]);
+		const float32x4 m20 = splat<float32x4>(matrix[2][0]);
+		const float32x4 m21 = splat<float32x4>(matrix[2][1]);
+		const float32x4 m22 = splat<float32x4>(matrix[2][2]);
+		const float32x4 m23 = splat<float32x4>(matrix[2][3]);
+
+		const UINT32 numSIMD = count & ~3U;
+		for(UINT32 i = 0; i < numSIMD; i += 4)
+		{
+			// Four packed vectors: (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3)
+			const float* src = &input[i].x;
+			const float32x4 a = load_u<float32x4>(src + 0);
+			const float32x4 b = load_u<float32x4>(src + 4);
+			const float32x4 c = load_u<float32x4>(src + 8);
+
+			// Convert to (x0 x1 x2 x3) (y0 y1 y2 y3) (z0 z1 z2 z3)
+			const float32x4 x = shuffle2<0, 1, 0, 2>(shuffle2<0, 3, 2, 3>(a, b), shuffle2<2, 2, 1, 1>(b, c));
+			const float32x4 y = shuffle2<0, 2, 0, 2>(shuffle2<1, 1, 0, 0>(a, b), shuffle2<3, 3, 2, 2>(b, c));
+			const float32x4 z = shuffle2<0, 2, 0, 3>(shuffle2<2, 2, 1, 1>(a, b), c);
+
+			float32x4 outX = add(add(mul(m00, x), mul(m01, y)), mul(m02, z));
+			float32x4 outY = add(add(mul(m10, x), mul(m11, y)), mul(m12, z));
+			float32x4 outZ = add(add(mul(m20, x), mul(m21, y)), mul(m22, z));
+
+			if(Translate)
+			{
+				outX = add(outX, m03);
+				outY = add(outY, m13);
+				outZ = add(outZ, m23);
+			}
+
+			// Convert back to packed vectors
+			float* dst = &output[i].x;
+			store_u(dst + 0, shuffle2<0, 2, 0, 2>(shuffle2<0, 0, 0, 0>(outX, outY), shuffle2<0, 0, 1, 1>(outZ, outX)));
+			store_u(dst + 4, shuffle2<0, 2, 0, 2>(shuffle2<1, 1, 1, 1>(outY, outZ), shuffle2<2, 2, 2, 2>(outX, outY)));
+			store_u(dst + 8, shuffle2<0, 2, 0, 2>(shuffle2<2, 2, 3, 3>(outZ, outX), shuffle2<3, 3, 3, 3>(outY, outZ)));
+		}
+
+		return numSIMD;
+	}
+
 	static float MINOR(const Matrix4& m, const UINT32 r0, const UINT32 r1, const UINT32 r2,
 								const UINT32 c0, const UINT32 c1, const UINT32 c2)
 	{
@@ -123,6 +184,60 @@ namespace bs
 			d30, d31, d32, d33);
 	}
 
+	void Matrix4::multiplyAffine(const Vector3* input, Vector3* output, UINT32 count) const
+	{
+		for(UINT32 i = transformVector3Array<true>(*this, input, output, count); i < count; i++)
+			output[i] = multiplyAffine(input[i]);
+	}
+
+	void Matrix4::multiplyDirection(const Vector3* input, Vector3* output, UINT32 count) const
+	{
+		for(UINT32 i = transformVector3Array<false>(*this, input, output, count); i < count; i++)
+			output[i] = multiplyDirection(input[i]);
+	}
+
+	void Matrix4::multiply(const Vector4* input, Vector4* output, UINT32 count) const
+	{
+		using namespace simd;
+
+		// Transposed, so the result is a sum of columns weighted by the vector components
+		float32x4 column0 = simd::loadRow(*this, 0);
+		float32x4 column1 = simd::loadRow(*this, 1);
+		float32x4 column2 = simd::loadRow(*this, 2);
+		float32x4 column3 = simd::loadRow(*this, 3);
+		transpose4(column0, column1, column2, column3);
+
+		for(UINT32 i = 0; i < count; i++)
+		{
+			const float* src = &input[i].x;
+
+			float32x4 result = mul(column0, load_splat<float32x4>(src + 0));
+			result = add(result, mul(column1, load_splat<float32x4>(src + 1)));
+			result = add(result, mul(column2, load_splat<float32x4>(src + 2)));
+			result = add(result, mul(column3, load_splat<float32x4>(src + 3)));
+
+			store_u(&output[i], result);
+		}
+	}
+
+	void Matrix4::multiply(const Matrix4* input, Matrix4* output, UINT32 count) const
+	{
+		for(UINT32 i = 0; i < count; i++)
+			simd::multiply(*this, input[i], output[i]);
+	}
+
+	void Matrix4::multiply(const Matrix4* lhs, const Matrix4* rhs, Matrix4* output, UINT32 count)
+	{
+		for(UINT32 i = 0; i < count; i++)
+			simd::multiply(lhs[i], rhs[i], output[i]);
+	}
+
+	void Matrix4::multiplyAffine(const Matrix4* lhs, const Matrix4* rhs, Matrix4* output, UINT32 count)
+	{
+		for(UINT32 i = 0; i < count; i++)
+			simd::multiplyAffine(lhs[i], rhs[i], output[i]);
+	}
+
 	Matrix4 Matrix4::inverseAffine() const
 	{
 		float m10 = m[1][0], m11 = m[1][1], m12 = m[1][2];
@@ -167,12 +282,23 @@ namespace bs
 
 	void Matrix4::setTRS(const Vector3& translation, const Quaternion& rotation, const Vector3& scale)
 	{
-		Matrix3 rot3x3;
-		rotation.toRotationMatrix(rot3x3);
-
-		m[0][0] = scale.x * rot3x3[0][0]; m[0][1] = scale.y * rot3x3[0][1]; m[0][2] = scale.z * rot3x3[0][2]; m[0][3] = translation.x;
-		m[1][0] = scale.x * rot3x3[1][0]; m[1][1] = scale.y * rot3x3[1][1]; m[1][2] = scale.z * rot3x3[1][2]; m[1][3] = translation.y;
-		m[2][0] = scale.x * rot3x3[2][0]; m[2][1] = scale.y * rot3x3[2][1]; m[2][2] = scale.z * rot3x3[2][2]; m[2][3] = translation.z;
+		// Same as Quaternion::toRotationMatrix(), but written directly into the matrix
+		const float tx = rotation.x + rotation.x;
+		const float ty = rotation.y + rotation.y;
+		const float tz = rotation.z + rotation.z;
+		const float twx = tx * rotation.w;
+		const float twy = ty * rotation.w;
+		const float twz = tz * rotation.w;
+		const float txx = tx * rotation.x;
+		const float txy = ty * rotation.x;
+		const float txz = tz * rotation.x;
+		const float tyy = ty * rotation.y;
+		const float tyz = tz * rotation.y;
+		const float tzz = tz * rotation.z;
+
+		m[0][0] = scale.x * (1.0f - (tyy + tzz)); m[0][1] = scale.y * (txy - twz); m[0][2] = scale.z * (txz + twy); m[0][3] = translation.x;
+		m[1][0] = scale.x * (txy + twz); m[1][1] = scale.y * (1.0f - (txx + tzz)); m[1][2] = scale.z * (tyz - twx); m[1][3] = translation.y;
+		m[2][0] = scale.x * (txz - twy); m[2][1] = scale.y * (tyz + twx); m[2][2] = scale.z * (1.0f - (txx + tyy)); m[2][3] = translation.z;
 
 		// No projection term
 		m[3][0] = 0; m[3][1] = 0; m[3][2] = 0; m[3][3] = 1;
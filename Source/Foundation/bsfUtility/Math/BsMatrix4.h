@@ -435,6 +435,37 @@ namespace bs
 			);
 		}
 
+		/**
+		 * Transforms an array of 3D points by this matrix. @p output is allowed to be the same array as @p input.
+		 *
+		 * @note	Matrix must be affine, if it is not use multiply() method.
+		 */
+		void multiplyAffine(const Vector3* input, Vector3* output, UINT32 count) const;
+
+		/** Transforms an array of 3D directions by this matrix. @p output is allowed to be the same array as @p input. */
+		void multiplyDirection(const Vector3* input, Vector3* output, UINT32 count) const;
+
+		/** Transforms an array of 4D vectors by this matrix. @p output is allowed to be the same array as @p input. */
+		void multiply(const Vector4* input, Vector4* output, UINT32 count) const;
+
+		/**
+		 * Multiplies this matrix with each matrix in the @p input array, storing the results in @p output. Equivalent to
+		 * output[i] = *this * input[i]. @p output is allowed to be the same array as @p input.
+		 */
+		void multiply(const Matrix4* input, Matrix4* output, UINT32 count) const;
+
+		/**
+		 * Multiplies pairs of matrices from the two arrays, storing the results in @p output. Equivalent to
+		 * output[i] = lhs[i] * rhs[i]. @p output is allowed to be the same array as one of the inputs.
+		 */
+		static void multiply(const Matrix4* lhs, const Matrix4* rhs, Matrix4* output, UINT32 count);
+
+		/**
+		 * Same as multiply(const Matrix4*, const Matrix4*, Matrix4*, UINT32) except all matrices are assumed to be
+		 * affine. Equivalent to output[i] = lhs[i].concatenateAffine(rhs[i]).
+		 */
+		static void multiplyAffine(const Matrix4* lhs, const Matrix4* rhs, Matrix4* output, UINT32 count);
+
 		/** Creates a view matrix and applies optional reflection. */
 		void makeView(const Vector3& position, const Quaternion& orientation);
 
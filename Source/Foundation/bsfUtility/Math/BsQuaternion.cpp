@@ -5,6 +5,7 @@
 #include "Math/BsMath.h"
 #include "Math/BsMatrix3.h"
 #include "Math/BsVector3.h"
+#include "Math/BsSIMD.h"
 
 namespace bs
 {
@@ -319,6 +320,19 @@ namespace bs
 		*this = Quaternion(x, y, -forward);
 	}
 
+	void Quaternion::multiply(const Quaternion* lhs, const Quaternion* rhs, Quaternion* output, UINT32 count)
+	{
+		using namespace simd;
+
+		for(UINT32 i = 0; i < count; i++)
+		{
+			const float32x4 a = load_u<float32x4>(&lhs[i].x);
+			const float32x4 b = load_u<float32x4>(&rhs[i].x);
+
+			store_u(&output[i].x, multiplyQuaternion(a, b));
+		}
+	}
+
 	Quaternion Quaternion::slerp(float t, const Quaternion& p, const Quaternion& q, bool shortestPath)
 	{
 		float cos = p.dot(q);
@@ -348,6 +348,13 @@ namespace bs
 			return q;
 		}
 
+		/**
+		 * Multiplies @p count pairs of quaternions from the @p lhs and @p rhs arrays, and writes the results into the
+		 * @p output array. Produces the same results as operator*, but processes the quaternions using SIMD instructions.
+		 * Output array may be the same as one of the input arrays.
+		 */
+		static void multiply(const Quaternion* lhs, const Quaternion* rhs, Quaternion* output, UINT32 count);
+
 		/**
 		 * Performs spherical interpolation between two quaternions. Spherical interpolation neatly interpolates between
 		 * two rotations without modifying the size of the vector it is applied to (unlike linear interpolation).
@@ -7,8 +7,18 @@
 #include "Math/BsAABox.h"
 #include "Math/BsSphere.h"
 #include "Math/BsRect2.h"
+#include "Math/BsMatrix4.h"
+#include "Math/BsQuaternion.h"
 
-#define SIMDPP_ARCH_X86_SSE4_1
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#	define SIMDPP_ARCH_ARM_NEON_FLT_SP
+#else
+#	define SIMDPP_ARCH_X86_SSE4_1
+
+#	if defined(__AVX__)
+#		define SIMDPP_ARCH_X86_AVX
+#	endif
+#endif
 
 #if BS_COMPILER == BS_COMPILER_MSVC
 #pragma warning(disable: 4244)
@@ -128,6 +138,83 @@ namespace bs
 			}
 		};
 
+		/** Loads a row of the matrix. */
+		inline float32x4 loadRow(const Matrix4& matrix, UINT32 row)
+		{
+			return load_u<float32x4>(&matrix[row]);
+		}
+
+		/**
+		 * Multiplies two matrices and writes the result in @p output, which is allowed to reference one of the inputs.
+		 * Produces the same results as the scalar Matrix4 multiplication.
+		 */
+		inline void multiply(const Matrix4& lhs, const Matrix4& rhs, Matrix4& output)
+		{
+			const float32x4 rhsRow0 = loadRow(rhs, 0);
+			const float32x4 rhsRow1 = loadRow(rhs, 1);
+			const float32x4 rhsRow2 = loadRow(rhs, 2);
+			const float32x4 rhsRow3 = loadRow(rhs, 3);
+
+			// Each output row is a combination of the right hand side rows, weighted by the left hand side row
+			for(UINT32 i = 0; i < 4; i++)
+			{
+				const float* lhsRow = &lhs[i].x;
+
+				float32x4 result = mul(load_splat<float32x4>(&lhsRow[0]), rhsRow0);
+				result = add(result, mul(load_splat<float32x4>(&lhsRow[1]), rhsRow1));
+				result = add(result, mul(load_splat<float32x4>(&lhsRow[2]), rhsRow2));
+				result = add(result, mul(load_splat<float32x4>(&lhsRow[3]), rhsRow3));
+
+				store_u(&output[i], result);
+			}
+		}
+
+		/**
+		 * Same as multiply(), except both matrices are assumed to be affine, avoiding some computation. Produces the same
+		 * results as Matrix4::concatenateAffine().
+		 */
+		inline void multiplyAffine(const Matrix4& lhs, const Matrix4& rhs, Matrix4& output)
+		{
+			const float32x4 rhsRow0 = loadRow(rhs, 0);
+			const float32x4 rhsRow1 = loadRow(rhs, 1);
+			const float32x4 rhsRow2 = loadRow(rhs, 2);
+
+			for(UINT32 i = 0; i < 3; i++)
+			{
+				const float* lhsRow = &lhs[i].x;
+
+				float32x4 result = mul(load_splat<float32x4>(&lhsRow[0]), rhsRow0);
+				result = add(result, mul(load_splat<float32x4>(&lhsRow[1]), rhsRow1));
+				result = add(result, mul(load_splat<float32x4>(&lhsRow[2]), rhsRow2));
+				const float32x4 translation = make_float(0.0f, 0.0f, 0.0f, lhsRow[3]);
+				result = add(result, translation);
+
+				store_u(&output[i], result);
+			}
+
+			output[3] = Vector4(0.0f, 0.0f, 0.0f, 1.0f);
+		}
+
+		/** Multiplies two quaternions, stored in x, y, z, w order. Produces the same results as the scalar version. */
+		inline float32x4 multiplyQuaternion(const float32x4& lhs, const float32x4& rhs)
+		{
+			const float32x4 negateW = make_float(1.0f, 1.0f, 1.0f, -1.0f);
+
+			// (w1 * x2, w1 * y2, w1 * z2, w1 * w2)
+			float32x4 result = mul(permute4<3, 3, 3, 3>(lhs), rhs);
+
+			// (x1 * w2, y1 * w2, z1 * w2, -x1 * x2)
+			result = add(result, mul(mul(permute4<0, 1, 2, 0>(lhs), negateW), permute4<3, 3, 3, 0>(rhs)));
+
+			// (y1 * z2, z1 * x2, x1 * y2, -y1 * y2)
+			result = add(result, mul(mul(permute4<1, 2, 0, 1>(lhs), negateW), permute4<2, 0, 1, 1>(rhs)));
+
+			// (z1 * y2, x1 * z2, y1 * x2, z1 * z2)
+			result = sub(result, mul(permute4<2, 0, 1, 2>(lhs), permute4<1, 2, 0, 2>(rhs)));
+
+			return result;
+		}
+
 		/** @} */
 	}
 }
@@ -10,6 +10,20 @@
 #include "Utility/BsQuadtree.h"
 #include "Utility/BsBitstream.h"
 #include "Utility/BsUSPtr.h"
+#include "Utility/BsTimer.h"
+#include "Debug/BsDebug.h"
+#include "Math/BsRandom.h"
+#include "Math/BsAABox.h"
+#include "Reflection/BsRTTIType.h"
+#include "RTTI/BsStringRTTI.h"
+#include "Serialization/BsBinarySerializer.h"
+#include "Serialization/BsBinaryDiff.h"
+#include "Serialization/BsSerializedObject.h"
+#include "FileSystem/BsDataStream.h"
+#include "Threading/BsThreadPool.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Debug/BsProfilerTimeline.h"
+#include "Allocators/BsMemoryTracker.h"
 
 namespace bs
 {
@@ -78,6 +92,209 @@ namespace bs
 	};
 
 	typedef Quadtree<UINT32, DebugQuadtreeOptions> DebugQuadtree;
+
+	enum TestTypeIds
+	{
+		TID_TestSerializable = 90000,
+		TID_TestSerializableAccessor = 90001
+	};
+
+	/** Reflectable type used for testing serialization. Registers its fields as direct member fields. */
+	class TestSerializable : public IReflectable
+	{
+	public:
+		UINT32 intValue = 0;
+		UINT64 longValue = 0;
+		float floatValue = 0.0f;
+		String name;
+		Vector<float> samples;
+		Vector<SPtr<TestSerializable>> children;
+
+		friend class TestSerializableRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	class TestSerializableRTTI : public RTTIType<TestSerializable, IReflectable, TestSerializableRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(intValue, 0)
+			BS_RTTI_MEMBER_PLAIN(longValue, 1)
+			BS_RTTI_MEMBER_PLAIN(floatValue, 2)
+			BS_RTTI_MEMBER_PLAIN(name, 3)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(samples, 4)
+			BS_RTTI_MEMBER_REFLPTR_ARRAY(children, 5)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "TestSerializable";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_TestSerializable;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<TestSerializable>();
+		}
+	};
+
+	RTTITypeBase* TestSerializable::getRTTIStatic()
+	{
+		return TestSerializableRTTI::instance();
+	}
+
+	RTTITypeBase* TestSerializable::getRTTI() const
+	{
+		return getRTTIStatic();
+	}
+
+	/**
+	 * Same as TestSerializable, except the fields are registered through getter/setter methods, so they cannot be
+	 * accessed directly by the serializer.
+	 */
+	class TestSerializableAccessor : public IReflectable
+	{
+	public:
+		UINT32 intValue = 0;
+		UINT64 longValue = 0;
+		float floatValue = 0.0f;
+		String name;
+		Vector<float> samples;
+		Vector<SPtr<TestSerializableAccessor>> children;
+
+		friend class TestSerializableAccessorRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	class TestSerializableAccessorRTTI : public RTTIType<TestSerializableAccessor, IReflectable,
+		TestSerializableAccessorRTTI>
+	{
+	private:
+		UINT32& getIntValue(TestSerializableAccessor* obj) { return obj->intValue; }
+		void setIntValue(TestSerializableAccessor* obj, UINT32& val) { obj->intValue = val; }
+
+		UINT64& getLongValue(TestSerializableAccessor* obj) { return obj->longValue; }
+		void setLongValue(TestSerializableAccessor* obj, UINT64& val) { obj->longValue = val; }
+
+		float& getFloatValue(TestSerializableAccessor* obj) { return obj->floatValue; }
+		void setFloatValue(TestSerializableAccessor* obj, float& val) { obj->floatValue = val; }
+
+		String& getName(TestSerializableAccessor* obj) { return obj->name; }
+		void setName(TestSerializableAccessor* obj, String& val) { obj->name = val; }
+
+		float& getSample(TestSerializableAccessor* obj, UINT32 idx) { return obj->samples[idx]; }
+		void setSample(TestSerializableAccessor* obj, UINT32 idx, float& val) { obj->samples[idx] = val; }
+		UINT32 getNumSamples(TestSerializableAccessor* obj) { return (UINT32)obj->samples.size(); }
+		void setNumSamples(TestSerializableAccessor* obj, UINT32 size) { obj->samples.resize(size); }
+
+		SPtr<TestSerializableAccessor> getChild(TestSerializableAccessor* obj, UINT32 idx) { return obj->children[idx]; }
+		void setChild(TestSerializableAccessor* obj, UINT32 idx, SPtr<TestSerializableAccessor> val) { obj->children[idx] = val; }
+		UINT32 getNumChildren(TestSerializableAccessor* obj) { return (UINT32)obj->children.size(); }
+		void setNumChildren(TestSerializableAccessor* obj, UINT32 size) { obj->children.resize(size); }
+
+	public:
+		TestSerializableAccessorRTTI()
+		{
+			addPlainField("intValue", 0, &TestSerializableAccessorRTTI::getIntValue,
+				&TestSerializableAccessorRTTI::setIntValue);
+			addPlainField("longValue", 1, &TestSerializableAccessorRTTI::getLongValue,
+				&TestSerializableAccessorRTTI::setLongValue);
+			addPlainField("floatValue", 2, &TestSerializableAccessorRTTI::getFloatValue,
+				&TestSerializableAccessorRTTI::setFloatValue);
+			addPlainField("name", 3, &TestSerializableAccessorRTTI::getName, &TestSerializableAccessorRTTI::setName);
+			addPlainArrayField("samples", 4, &TestSerializableAccessorRTTI::getSample,
+				&TestSerializableAccessorRTTI::getNumSamples, &TestSerializableAccessorRTTI::setSample,
+				&TestSerializableAccessorRTTI::setNumSamples);
+			addReflectablePtrArrayField("children", 5, &TestSerializableAccessorRTTI::getChild,
+				&TestSerializableAccessorRTTI::getNumChildren, &TestSerializableAccessorRTTI::setChild,
+				&TestSerializableAccessorRTTI::setNumChildren);
+		}
+
+		const String& getRTTIName() override
+		{
+			static String name = "TestSerializableAccessor";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_TestSerializableAccessor;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<TestSerializableAccessor>();
+		}
+	};
+
+	RTTITypeBase* TestSerializableAccessor::getRTTIStatic()
+	{
+		return TestSerializableAccessorRTTI::instance();
+	}
+
+	RTTITypeBase* TestSerializableAccessor::getRTTI() const
+	{
+		return getRTTIStatic();
+	}
+
+	/** Creates a root object with @p numChildren children, filled with deterministic data. */
+	template<class T>
+	SPtr<T> createTestSerializable(UINT32 numChildren, UINT32 numSamples)
+	{
+		auto fill = [numSamples](T& object, UINT32 seed)
+		{
+			object.intValue = seed * 3 + 1;
+			object.longValue = (UINT64)seed << 40 | seed;
+			object.floatValue = seed * 0.25f;
+			object.name = "Object " + toString(seed);
+
+			object.samples.resize(numSamples);
+			for(UINT32 i = 0; i < numSamples; i++)
+				object.samples[i] = (float)(seed + i) * 0.5f;
+		};
+
+		SPtr<T> root = bs_shared_ptr_new<T>();
+		fill(*root, 0);
+
+		for(UINT32 i = 0; i < numChildren; i++)
+		{
+			SPtr<T> child = bs_shared_ptr_new<T>();
+			fill(*child, i + 1);
+
+			root->children.push_back(child);
+		}
+
+		return root;
+	}
+
+	/** Compares two test objects and their children, field by field. */
+	template<class T>
+	bool isEqual(const SPtr<T>& a, const SPtr<T>& b)
+	{
+		if(a == nullptr || b == nullptr)
+			return a == b;
+
+		if(a->intValue != b->intValue || a->longValue != b->longValue || a->floatValue != b->floatValue ||
+			a->name != b->name || a->samples != b->samples || a->children.size() != b->children.size())
+			return false;
+
+		for(UINT32 i = 0; i < (UINT32)a->children.size(); i++)
+		{
+			if(!isEqual(a->children[i], b->children[i]))
+				return false;
+		}
+
+		return true;
+	}
+
 	void UtilityTestSuite::startUp()
 	{
 		SPtr<TestSuite> fileSystemTests = create<FileSystemTestSuite>();
@@ -99,6 +316,13 @@ namespace bs
 		BS_ADD_TEST(UtilityTestSuite::testQuadtree)
 		BS_ADD_TEST(UtilityTestSuite::testVarInt)
 		BS_ADD_TEST(UtilityTestSuite::testBitStream)
+		BS_ADD_TEST(UtilityTestSuite::testAsyncLogging)
+		BS_ADD_TEST(UtilityTestSuite::testMathSIMD)
+		BS_ADD_TEST(UtilityTestSuite::testBinarySerializer)
+		BS_ADD_TEST(UtilityTestSuite::testParallelDecode)
+		BS_ADD_TEST(UtilityTestSuite::testBinaryDiff)
+		BS_ADD_TEST(UtilityTestSuite::testProfilerTimeline)
+		BS_ADD_TEST(UtilityTestSuite::testMemoryTracker)
 	}
 
 	void UtilityTestSuite::testBitfield()
@@ -844,4 +1068,704 @@ namespace bs
 		bs.read(ulv);
 		BS_TEST_ASSERT(ulv == v11);
 	}
+
+	void UtilityTestSuite::testAsyncLogging()
+	{
+		static constexpr UINT32 NUM_THREADS = 32;
+		static constexpr UINT32 NUM_MESSAGES = 2000;
+
+		Debug& debug = gDebug();
+		Log& log = debug.getLog();
+
+		// Counts unread log entries, and checks each thread's messages arrived in order
+		auto readEntries = [&log]()
+		{
+			UINT32 lastMessage[NUM_THREADS];
+			for(auto& entry : lastMessage)
+				entry = (UINT32)-1;
+
+			UINT32 numEntries = 0;
+			bool inOrder = true;
+
+			LogEntry entry;
+			while(log.getUnreadEntry(entry))
+			{
+				UINT32 threadIdx, messageIdx;
+				if(sscanf(entry.getMessage().c_str(), "Thread %u message %u", &threadIdx, &messageIdx) == 2 &&
+					threadIdx < NUM_THREADS)
+				{
+					inOrder &= lastMessage[threadIdx] == (UINT32)-1 || lastMessage[threadIdx] < messageIdx;
+					lastMessage[threadIdx] = messageIdx;
+				}
+
+				numEntries++;
+			}
+
+			log.clear();
+			return numEntries == NUM_THREADS * NUM_MESSAGES && inOrder;
+		};
+
+		// Logs from many threads at once, returning the time the logging threads spent logging
+		auto runBenchmark = [&debug]()
+		{
+			std::atomic<bool> start { false };
+
+			Vector<Thread> threads;
+			for(UINT32 i = 0; i < NUM_THREADS; i++)
+			{
+				threads.push_back(Thread([&debug, &start, i]()
+				{
+					while(!start.load())
+						std::this_thread::yield();
+
+					for(UINT32 j = 0; j < NUM_MESSAGES; j++)
+					{
+						static LogCallSite site;
+						debug.logDeferred(site, LogVerbosity::Log, BS_LOG_GET_CATEGORY_ID(Generic), "testAsyncLogging",
+							__FILE__, __LINE__, "Thread {0} message {1}: {2}", i, j, 1.5f);
+					}
+				}));
+			}
+
+			Timer timer;
+			start.store(true);
+
+			for(auto& thread : threads)
+				thread.join();
+
+			const UINT64 producerUs = timer.getMicroseconds();
+			debug.flushLog();
+
+			return producerUs;
+		};
+
+		debug.setLogRateLimit(0);
+		log.clear();
+
+		// Messages logged immediately, all threads contend for the log mutex
+		const UINT64 immediateUs = runBenchmark();
+		BS_TEST_ASSERT(readEntries());
+
+		// Messages formatted on the consumer thread
+		debug.startAsyncLogging();
+		const UINT64 asyncUs = runBenchmark();
+		debug.stopAsyncLogging();
+		BS_TEST_ASSERT(readEntries());
+
+		BS_LOG(Info, Generic, "Logging benchmark ({0} threads, {1} messages each): immediate {2} us, asynchronous {3} us.",
+			NUM_THREADS, NUM_MESSAGES, immediateUs, asyncUs);
+
+		// Messages over the rate limit get dropped, and reported with the next message logged from the same call site
+		debug.setLogRateLimit(10);
+		log.clear();
+
+		LogCallSite site;
+		for(UINT32 i = 0; i < 100; i++)
+		{
+			debug.logDeferred(site, LogVerbosity::Log, BS_LOG_GET_CATEGORY_ID(Generic), "testAsyncLogging", __FILE__,
+				__LINE__, "Rate limited message {0}", i);
+		}
+
+		UINT32 numEntries = 0;
+		LogEntry entry;
+		while(log.getUnreadEntry(entry))
+			numEntries++;
+
+		BS_TEST_ASSERT(numEntries == 10);
+
+		site.windowStart.store(0);
+		debug.logDeferred(site, LogVerbosity::Log, BS_LOG_GET_CATEGORY_ID(Generic), "testAsyncLogging", __FILE__,
+			__LINE__, "Rate limited message");
+
+		BS_TEST_ASSERT(log.getUnreadEntry(entry));
+		BS_TEST_ASSERT(entry.getMessage().find("90 similar messages were suppressed") != String::npos);
+
+		// Errors are never rate limited, and are logged synchronously even while asynchronous logging is active
+		debug.startAsyncLogging();
+		log.clear();
+
+		LogCallSite errorSite;
+		for(UINT32 i = 0; i < 100; i++)
+		{
+			debug.logDeferred(errorSite, LogVerbosity::Error, BS_LOG_GET_CATEGORY_ID(Generic), "testAsyncLogging",
+				__FILE__, __LINE__, "Error message {0}", i);
+		}
+
+		numEntries = 0;
+		while(log.getUnreadEntry(entry))
+			numEntries++;
+
+		BS_TEST_ASSERT(numEntries == 100);
+
+		// Messages from threads that exit before the consumer gets to them are still logged
+		debug.setLogRateLimit(0);
+		log.clear();
+
+		Thread exitingThread([&debug]()
+		{
+			static LogCallSite site;
+			for(UINT32 i = 0; i < NUM_MESSAGES; i++)
+			{
+				debug.logDeferred(site, LogVerbosity::Log, BS_LOG_GET_CATEGORY_ID(Generic), "testAsyncLogging",
+					__FILE__, __LINE__, "Thread {0} message {1}: {2}", 0, i, 1.5f);
+			}
+		});
+		exitingThread.join();
+
+		debug.flushLog();
+		debug.stopAsyncLogging();
+
+		numEntries = 0;
+		while(log.getUnreadEntry(entry))
+			numEntries++;
+
+		BS_TEST_ASSERT(numEntries == NUM_MESSAGES);
+
+		// Stopping while other threads are logging must not lose messages published after the consumer stops
+		log.clear();
+		debug.startAsyncLogging();
+
+		std::atomic<UINT32> numStarted { 0 };
+		Vector<Thread> threads;
+		for(UINT32 i = 0; i < NUM_THREADS; i++)
+		{
+			threads.push_back(Thread([&debug, &numStarted, i]()
+			{
+				numStarted.fetch_add(1);
+				for(UINT32 j = 0; j < NUM_MESSAGES; j++)
+				{
+					static LogCallSite site;
+					debug.logDeferred(site, LogVerbosity::Log, BS_LOG_GET_CATEGORY_ID(Generic), "testAsyncLogging",
+						__FILE__, __LINE__, "Thread {0} message {1}: {2}", i, j, 1.5f);
+				}
+			}));
+		}
+
+		while(numStarted.load() < NUM_THREADS)
+			std::this_thread::yield();
+
+		debug.stopAsyncLogging();
+
+		for(auto& thread : threads)
+			thread.join();
+
+		numEntries = 0;
+		while(log.getUnreadEntry(entry))
+			numEntries++;
+
+		BS_TEST_ASSERT(numEntries == NUM_THREADS * NUM_MESSAGES);
+
+		log.clear();
+
+		// Rate limiting is opt-in, a single call site logging many different messages must not lose any by default
+		Debug defaultDebug;
+
+		LogCallSite loopSite;
+		for(UINT32 i = 0; i < 1000; i++)
+		{
+			defaultDebug.logDeferred(loopSite, LogVerbosity::Log, BS_LOG_GET_CATEGORY_ID(Generic), "testAsyncLogging",
+				__FILE__, __LINE__, "Loop message {0}", i);
+		}
+
+		numEntries = 0;
+		while(defaultDebug.getLog().getUnreadEntry(entry))
+			numEntries++;
+
+		BS_TEST_ASSERT(numEntries == 1000);
+	}
+
+	void UtilityTestSuite::testMathSIMD()
+	{
+		static constexpr UINT32 NUM_ELEMENTS = 1023; // Not a multiple of four, to test the scalar tail
+		static constexpr UINT32 NUM_ITERATIONS = 100;
+		static constexpr float TOLERANCE = 1e-4f;
+
+		Random random(1234);
+
+		auto randomRotation = [&random]()
+		{
+			return Quaternion(random.getUnitVector(), Radian(random.getUNorm() * Math::TWO_PI));
+		};
+
+		auto randomMatrix = [&random, &randomRotation]()
+		{
+			return Matrix4::TRS(random.getPointInSphere() * 100.0f, randomRotation(),
+				Vector3::ONE + random.getPointInSphere() * 0.5f);
+		};
+
+		auto matrixEquals = [](const Matrix4& a, const Matrix4& b)
+		{
+			for(UINT32 i = 0; i < 4; i++)
+			{
+				if(!Math::approxEquals(a[i], b[i], TOLERANCE))
+					return false;
+			}
+
+			return true;
+		};
+
+		// Reference implementation of the matrix product, as it was before the SIMD version
+		auto multiplyScalar = [](const Matrix4& a, const Matrix4& b)
+		{
+			Matrix4 r;
+			for(UINT32 i = 0; i < 4; i++)
+			{
+				for(UINT32 j = 0; j < 4; j++)
+					r[i][j] = a[i][0] * b[0][j] + a[i][1] * b[1][j] + a[i][2] * b[2][j] + a[i][3] * b[3][j];
+			}
+
+			return r;
+		};
+
+		Vector<Matrix4> lhs(NUM_ELEMENTS);
+		Vector<Matrix4> rhs(NUM_ELEMENTS);
+		Vector<Matrix4> matrices(NUM_ELEMENTS);
+		Vector<Vector3> points(NUM_ELEMENTS);
+		Vector<Vector3> transformedPoints(NUM_ELEMENTS);
+		Vector<Vector4> vectors(NUM_ELEMENTS);
+		Vector<Vector4> transformedVectors(NUM_ELEMENTS);
+		Vector<Quaternion> lhsQuats(NUM_ELEMENTS);
+		Vector<Quaternion> rhsQuats(NUM_ELEMENTS);
+		Vector<Quaternion> quats(NUM_ELEMENTS);
+		Vector<AABox> boxes(NUM_ELEMENTS);
+		Vector<AABox> transformedBoxes(NUM_ELEMENTS);
+
+		for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+		{
+			lhs[i] = randomMatrix();
+			rhs[i] = randomMatrix();
+			points[i] = random.getPointInSphere() * 10.0f;
+			vectors[i] = Vector4(random.getPointInSphere() * 10.0f, 1.0f);
+			lhsQuats[i] = randomRotation();
+			rhsQuats[i] = randomRotation();
+
+			const Vector3 center = random.getPointInSphere() * 10.0f;
+			const Vector3 extents = Vector3::ONE + random.getPointInSphere() * 0.5f;
+			boxes[i] = AABox(center - extents, center + extents);
+		}
+
+		const Matrix4& transform = lhs[0];
+
+		// Check results against the scalar versions
+		Matrix4::multiply(lhs.data(), rhs.data(), matrices.data(), NUM_ELEMENTS);
+		for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+		{
+			BS_TEST_ASSERT(matrixEquals(matrices[i], multiplyScalar(lhs[i], rhs[i])));
+			BS_TEST_ASSERT(matrixEquals(lhs[i] * rhs[i], matrices[i]));
+		}
+
+		Matrix4::multiplyAffine(lhs.data(), rhs.data(), matrices.data(), NUM_ELEMENTS);
+		for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+		{
+			BS_TEST_ASSERT(matrixEquals(matrices[i], multiplyScalar(lhs[i], rhs[i])));
+			BS_TEST_ASSERT(matrixEquals(lhs[i].concatenateAffine(rhs[i]), matrices[i]));
+			BS_TEST_ASSERT(matrixEquals(lhs[i].inverseAffine() * lhs[i], Matrix4::IDENTITY));
+		}
+
+		transform.multiplyAffine(points.data(), transformedPoints.data(), NUM_ELEMENTS);
+		for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+			BS_TEST_ASSERT(Math::approxEquals(transformedPoints[i], transform.multiplyAffine(points[i]), TOLERANCE));
+
+		transform.multiplyDirection(points.data(), transformedPoints.data(), NUM_ELEMENTS);
+		for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+			BS_TEST_ASSERT(Math::approxEquals(transformedPoints[i], transform.multiplyDirection(points[i]), TOLERANCE));
+
+		transform.multiply(vectors.data(), transformedVectors.data(), NUM_ELEMENTS);
+		for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+			BS_TEST_ASSERT(Math::approxEquals(transformedVectors[i], transform.multiply(vectors[i]), TOLERANCE));
+
+		Quaternion::multiply(lhsQuats.data(), rhsQuats.data(), quats.data(), NUM_ELEMENTS);
+		for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+			BS_TEST_ASSERT(Math::approxEquals(quats[i], lhsQuats[i] * rhsQuats[i], TOLERANCE));
+
+		AABox::transformAffine(transform, boxes.data(), transformedBoxes.data(), NUM_ELEMENTS);
+		for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+		{
+			AABox box = boxes[i];
+			box.transformAffine(transform);
+
+			BS_TEST_ASSERT(Math::approxEquals(transformedBoxes[i].getMin(), box.getMin(), TOLERANCE));
+			BS_TEST_ASSERT(Math::approxEquals(transformedBoxes[i].getMax(), box.getMax(), TOLERANCE));
+		}
+
+		// Compare performance of the batch versions against the inline scalar operations they replace at their call sites
+		auto measure = [](const std::function<void()>& func)
+		{
+			Timer timer;
+			for(UINT32 i = 0; i < NUM_ITERATIONS; i++)
+				func();
+
+			return timer.getMicroseconds();
+		};
+
+		const UINT64 matrixScalarUs = measure([&]()
+		{
+			for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+				matrices[i] = lhs[i] * rhs[i];
+		});
+
+		const UINT64 matrixBatchUs = measure([&]()
+		{
+			Matrix4::multiply(lhs.data(), rhs.data(), matrices.data(), NUM_ELEMENTS);
+		});
+
+		// As used for skinning matrices by Skeleton::getPose()
+		const UINT64 affineScalarUs = measure([&]()
+		{
+			for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+				matrices[i] = lhs[i] * rhs[i];
+		});
+
+		const UINT64 affineBatchUs = measure([&]()
+		{
+			Matrix4::multiplyAffine(lhs.data(), rhs.data(), matrices.data(), NUM_ELEMENTS);
+		});
+
+		// As used for world space particles by ParticleEmitter::spawn() and for collision rays by ParticleCollisions
+		const UINT64 pointScalarUs = measure([&]()
+		{
+			for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+				transformedPoints[i] = transform.multiplyAffine(points[i]);
+		});
+
+		const UINT64 pointBatchUs = measure([&]()
+		{
+			transform.multiplyAffine(points.data(), transformedPoints.data(), NUM_ELEMENTS);
+		});
+
+		const UINT64 quatScalarUs = measure([&]()
+		{
+			for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+				quats[i] = lhsQuats[i] * rhsQuats[i];
+		});
+
+		const UINT64 quatBatchUs = measure([&]()
+		{
+			Quaternion::multiply(lhsQuats.data(), rhsQuats.data(), quats.data(), NUM_ELEMENTS);
+		});
+
+		const UINT64 boxScalarUs = measure([&]()
+		{
+			for(UINT32 i = 0; i < NUM_ELEMENTS; i++)
+			{
+				transformedBoxes[i] = boxes[i];
+				transformedBoxes[i].transformAffine(transform);
+			}
+		});
+
+		const UINT64 boxBatchUs = measure([&]()
+		{
+			AABox::transformAffine(transform, boxes.data(), transformedBoxes.data(), NUM_ELEMENTS);
+		});
+
+		BS_LOG(Info, Generic, "Math benchmark ({0} elements x {1} iterations, scalar/batch us): matrix multiply {2}/{3}, "
+			"affine matrix multiply {4}/{5}, point transform {6}/{7}, quaternion multiply {8}/{9}, AABox transform "
+			"{10}/{11}.", NUM_ELEMENTS, NUM_ITERATIONS, matrixScalarUs, matrixBatchUs, affineScalarUs, affineBatchUs,
+			pointScalarUs, pointBatchUs, quatScalarUs, quatBatchUs, boxScalarUs, boxBatchUs);
+
+#if !BS_DEBUG_MODE
+		// Batch versions are only worth calling from the hot paths if they are faster. Unoptimized builds don't inline
+		// the SIMD wrappers, so timings are only meaningful in optimized builds.
+		BS_TEST_ASSERT(affineBatchUs < affineScalarUs);
+		BS_TEST_ASSERT(pointBatchUs < pointScalarUs);
+#endif
+	}
+
+	void UtilityTestSuite::testBinarySerializer()
+	{
+		static constexpr UINT32 NUM_CHILDREN = 2000;
+		static constexpr UINT32 NUM_SAMPLES = 256;
+		static constexpr UINT32 NUM_ITERATIONS = 10;
+
+		// Encodes and decodes the object a number of times, returning the decoded object and the total time spent
+		auto runBenchmark = [](const SPtr<IReflectable>& object, UINT64& encodeUs, UINT64& decodeUs, UINT32& numBytes)
+		{
+			SPtr<IReflectable> output;
+			encodeUs = 0;
+			decodeUs = 0;
+
+			for(UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			{
+				SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>();
+
+				Timer timer;
+				BinarySerializer encoder;
+				encoder.encode(object.get(), stream);
+				encodeUs += timer.getMicroseconds();
+
+				numBytes = (UINT32)stream->size();
+				stream->seek(0);
+
+				timer.reset();
+				BinarySerializer decoder;
+				output = decoder.decode(stream, numBytes);
+				decodeUs += timer.getMicroseconds();
+			}
+
+			return output;
+		};
+
+		auto toMBps = [](UINT32 numBytes, UINT64 us)
+		{
+			return (numBytes * (double)NUM_ITERATIONS) / std::max(us, (UINT64)1);
+		};
+
+		SPtr<TestSerializable> direct = createTestSerializable<TestSerializable>(NUM_CHILDREN, NUM_SAMPLES);
+		SPtr<TestSerializableAccessor> accessor =
+			createTestSerializable<TestSerializableAccessor>(NUM_CHILDREN, NUM_SAMPLES);
+
+		UINT64 directEncodeUs, directDecodeUs, accessorEncodeUs, accessorDecodeUs;
+		UINT32 directBytes, accessorBytes;
+		SPtr<IReflectable> directOutput = runBenchmark(direct, directEncodeUs, directDecodeUs, directBytes);
+		SPtr<IReflectable> accessorOutput = runBenchmark(accessor, accessorEncodeUs, accessorDecodeUs, accessorBytes);
+
+		// Direct field access doesn't change the encoded format
+		BS_TEST_ASSERT(directBytes == accessorBytes);
+		BS_TEST_ASSERT(directOutput != nullptr && directOutput->getTypeId() == TID_TestSerializable);
+		BS_TEST_ASSERT(accessorOutput != nullptr && accessorOutput->getTypeId() == TID_TestSerializableAccessor);
+
+		BS_TEST_ASSERT(isEqual(direct, std::static_pointer_cast<TestSerializable>(directOutput)));
+		BS_TEST_ASSERT(isEqual(accessor, std::static_pointer_cast<TestSerializableAccessor>(accessorOutput)));
+
+		BS_LOG(Info, Generic, "Serialization benchmark ({0} bytes x {1} iterations, encode/decode MB/s): getter/setter "
+			"fields {2}/{3}, direct member fields {4}/{5}.", directBytes, NUM_ITERATIONS,
+			toMBps(accessorBytes, accessorEncodeUs), toMBps(accessorBytes, accessorDecodeUs),
+			toMBps(directBytes, directEncodeUs), toMBps(directBytes, directDecodeUs));
+	}
+
+	void UtilityTestSuite::testParallelDecode()
+	{
+		static constexpr UINT32 NUM_CHILDREN = 2000;
+		static constexpr UINT32 NUM_SAMPLES = 64;
+
+		ThreadPool::startUp<TThreadPool<ThreadNoPolicy>>(4);
+		TaskScheduler::startUp();
+
+		SPtr<TestSerializable> object = createTestSerializable<TestSerializable>(NUM_CHILDREN, NUM_SAMPLES);
+
+		// Make half of the children reference another child, so decoding requires multiple waves
+		for(UINT32 i = 1; i < NUM_CHILDREN; i += 2)
+			object->children[i]->children.push_back(object->children[i - 1]);
+
+		SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>();
+		BinarySerializer encoder;
+		encoder.encode(object.get(), stream);
+
+		const auto numBytes = (UINT32)stream->size();
+
+		stream->seek(0);
+		Timer timer;
+		BinarySerializer serialDecoder;
+		auto serialOutput = std::static_pointer_cast<TestSerializable>(serialDecoder.decode(stream, numBytes));
+		const UINT64 serialUs = timer.getMicroseconds();
+		BS_TEST_ASSERT(stream->tell() == numBytes);
+
+		stream->seek(0);
+		timer.reset();
+		BinarySerializer parallelDecoder;
+		auto parallelOutput = std::static_pointer_cast<TestSerializable>(parallelDecoder.decodeParallel(stream, numBytes));
+		const UINT64 parallelUs = timer.getMicroseconds();
+		BS_TEST_ASSERT(stream->tell() == numBytes);
+
+		BS_TEST_ASSERT(isEqual(object, serialOutput));
+		BS_TEST_ASSERT(isEqual(serialOutput, parallelOutput));
+
+		// Shared references resolve to the same object
+		if(parallelOutput != nullptr && parallelOutput->children.size() == NUM_CHILDREN)
+		{
+			bool sharedReferences = true;
+			for(UINT32 i = 1; i < NUM_CHILDREN; i += 2)
+				sharedReferences &= parallelOutput->children[i]->children[0] == parallelOutput->children[i - 1];
+
+			BS_TEST_ASSERT(sharedReferences);
+		}
+
+		BS_LOG(Info, Generic, "Decode benchmark ({0} objects, {1} bytes): serial {2} us, parallel {3} us.",
+			NUM_CHILDREN + 1, numBytes, serialUs, parallelUs);
+
+		TaskScheduler::shutDown();
+		ThreadPool::shutDown();
+	}
+
+	void UtilityTestSuite::testBinaryDiff()
+	{
+		static constexpr UINT32 NUM_CHILDREN = 100;
+		static constexpr UINT32 NUM_SAMPLES = 16;
+
+		IDiff& diffHandler = TestSerializable::getRTTIStatic()->getDiffHandler();
+
+		SPtr<TestSerializable> orgObj = createTestSerializable<TestSerializable>(NUM_CHILDREN, NUM_SAMPLES);
+		SPtr<TestSerializable> newObj = createTestSerializable<TestSerializable>(NUM_CHILDREN, NUM_SAMPLES);
+
+		// Unmodified objects
+		SPtr<SerializedObject> orgSerialized = SerializedObject::create(*orgObj);
+		SPtr<SerializedObject> newSerialized = SerializedObject::create(*newObj);
+
+		BS_TEST_ASSERT(orgSerialized->hash == newSerialized->hash);
+		BS_TEST_ASSERT(diffHandler.generateDiff(orgSerialized, newSerialized) == nullptr);
+
+		// Modified objects, both in a child and the root
+		newObj->children[NUM_CHILDREN / 2]->samples[3] += 1.0f;
+		newObj->name = "Modified";
+		newSerialized = SerializedObject::create(*newObj);
+
+		BS_TEST_ASSERT(orgSerialized->hash != newSerialized->hash);
+
+		SPtr<SerializedObject> diff = diffHandler.generateDiff(orgSerialized, newSerialized);
+		BS_TEST_ASSERT(diff != nullptr);
+
+		if(diff != nullptr)
+		{
+			diffHandler.applyDiff(orgObj, diff, nullptr);
+			BS_TEST_ASSERT(isEqual(orgObj, newObj));
+		}
+
+		// Matching hashes are trusted in release builds. Debug builds verify them, and diff in full on a collision.
+		SPtr<TestSerializable> otherObj = createTestSerializable<TestSerializable>(NUM_CHILDREN, NUM_SAMPLES);
+		otherObj->intValue++;
+
+		SPtr<SerializedObject> otherSerialized = SerializedObject::create(*otherObj);
+		otherSerialized->hash = newSerialized->hash;
+
+		diff = diffHandler.generateDiff(newSerialized, otherSerialized);
+#if BS_DEBUG_MODE
+		BS_TEST_ASSERT(diff != nullptr);
+
+		if(diff != nullptr)
+		{
+			diffHandler.applyDiff(newObj, diff, nullptr);
+			BS_TEST_ASSERT(isEqual(newObj, otherObj));
+		}
+#else
+		BS_TEST_ASSERT(diff == nullptr);
+#endif
+
+		// Encoded streams are compared byte for byte before being decoded
+		auto encode = [](const SPtr<TestSerializable>& object)
+		{
+			SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>();
+
+			BinarySerializer serializer;
+			serializer.encode(object.get(), stream);
+			stream->seek(0);
+
+			return stream;
+		};
+
+		SPtr<TestSerializable> streamOrgObj = createTestSerializable<TestSerializable>(NUM_CHILDREN, NUM_SAMPLES);
+		SPtr<TestSerializable> streamNewObj = createTestSerializable<TestSerializable>(NUM_CHILDREN, NUM_SAMPLES);
+
+		SPtr<MemoryDataStream> orgStream = encode(streamOrgObj);
+		SPtr<MemoryDataStream> newStream = encode(streamNewObj);
+		BS_TEST_ASSERT(diffHandler.generateDiff(orgStream, (UINT32)orgStream->size(), newStream,
+			(UINT32)newStream->size()) == nullptr);
+
+		streamNewObj->children[0]->samples[0] += 1.0f;
+		orgStream = encode(streamOrgObj);
+		newStream = encode(streamNewObj);
+
+		diff = diffHandler.generateDiff(orgStream, (UINT32)orgStream->size(), newStream, (UINT32)newStream->size());
+		BS_TEST_ASSERT(diff != nullptr);
+
+		if(diff != nullptr)
+		{
+			diffHandler.applyDiff(streamOrgObj, diff, nullptr);
+			BS_TEST_ASSERT(isEqual(streamOrgObj, streamNewObj));
+		}
+	}
+
+	void UtilityTestSuite::testProfilerTimeline()
+	{
+		ThreadPool::startUp<TThreadPool<ThreadNoPolicy>>(2);
+		TaskScheduler::startUp();
+
+		const UINT32 eventId = ProfilerTimeline::getEventId("TimelineTestEvent");
+		BS_TEST_ASSERT(eventId != ProfilerTimeline::INVALID_EVENT_ID);
+		BS_TEST_ASSERT(eventId == ProfilerTimeline::getEventId(String("TimelineTestEvent")));
+		BS_TEST_ASSERT(strcmp(ProfilerTimeline::getEventName(eventId), "TimelineTestEvent") == 0);
+
+		// Nothing should be recorded while disabled
+		ProfilerTimeline::clear();
+		ProfilerTimeline::beginEvent("TimelineDisabledEvent");
+		ProfilerTimeline::endEvent("TimelineDisabledEvent");
+
+		ProfilerTimeline::setEnabled(true);
+		ProfilerTimeline::setThreadName("TimelineTestThread");
+
+		ProfilerTimeline::beginEvent(eventId);
+		{
+			// Tasks record an event named after themselves while executing
+			SPtr<Task> task = Task::create("TimelineTestTask", []() { });
+			TaskScheduler::instance().addTask(task);
+			task->wait();
+
+			// Tasks in a group share the group's event
+			SPtr<TaskGroup> taskGroup = TaskGroup::create("TimelineTestGroup", [](UINT32) { }, 4);
+			TaskScheduler::instance().addTaskGroup(taskGroup);
+			taskGroup->wait();
+		}
+		ProfilerTimeline::endEvent(eventId);
+
+		ProfilerTimeline::setEnabled(false);
+
+		const String trace = ProfilerTimeline::exportChromeTrace();
+		BS_TEST_ASSERT(trace.find("\"traceEvents\":[") != String::npos);
+		BS_TEST_ASSERT(trace.find("\"name\":\"TimelineTestEvent\",\"cat\":\"bsf\",\"ph\":\"B\"") != String::npos);
+		BS_TEST_ASSERT(trace.find("\"name\":\"TimelineTestEvent\",\"cat\":\"bsf\",\"ph\":\"E\"") != String::npos);
+		BS_TEST_ASSERT(trace.find("\"name\":\"TimelineTestTask\",\"cat\":\"bsf\",\"ph\":\"B\"") != String::npos);
+		BS_TEST_ASSERT(trace.find("\"name\":\"TimelineTestGroup\",\"cat\":\"bsf\",\"ph\":\"B\"") != String::npos);
+		BS_TEST_ASSERT(trace.find("\"args\":{\"name\":\"TimelineTestThread\"}") != String::npos);
+		BS_TEST_ASSERT(trace.find("TimelineDisabledEvent") == String::npos);
+
+		// Clearing removes the recorded events but keeps the threads
+		ProfilerTimeline::clear();
+		const String clearedTrace = ProfilerTimeline::exportChromeTrace();
+		BS_TEST_ASSERT(clearedTrace.find("TimelineTestEvent") == String::npos);
+
+		TaskScheduler::shutDown();
+		ThreadPool::shutDown();
+	}
+
+	void UtilityTestSuite::testMemoryTracker()
+	{
+#if BS_PROFILING_ENABLED
+		static constexpr UINT32 ALLOC_SIZE = 12345;
+
+		MemoryTracker::setEnabled(true);
+		MemoryTracker::clear();
+
+		const MemoryTagStats before = MemoryTracker::generateReport().tags[(UINT32)MemoryTag::Physics];
+
+		void* data;
+		{
+			MemoryTagScope memoryTag(MemoryTag::Physics);
+			BS_TEST_ASSERT(MemoryTracker::getThreadTag() == MemoryTag::Physics);
+
+			data = bs_alloc(ALLOC_SIZE);
+		}
+
+		BS_TEST_ASSERT(MemoryTracker::getThreadTag() == MemoryTag::Untagged);
+
+		MemoryTrackerReport report = MemoryTracker::generateReport();
+		const MemoryTagStats& allocated = report.tags[(UINT32)MemoryTag::Physics];
+		BS_TEST_ASSERT(allocated.numAllocs == before.numAllocs + 1);
+		BS_TEST_ASSERT(allocated.allocatedBytes == before.allocatedBytes + ALLOC_SIZE);
+		BS_TEST_ASSERT(allocated.liveBytes == before.liveBytes + ALLOC_SIZE);
+		BS_TEST_ASSERT(allocated.peakLiveBytes >= allocated.liveBytes);
+
+		bool foundSite = false;
+		for(auto& site : report.sites)
+			foundSite |= site.liveBytes >= ALLOC_SIZE && !site.isFrameAlloc;
+
+		BS_TEST_ASSERT(foundSite);
+
+		bs_free(data);
+
+		const MemoryTagStats freed = MemoryTracker::generateReport().tags[(UINT32)MemoryTag::Physics];
+		BS_TEST_ASSERT(freed.liveBytes == before.liveBytes);
+		BS_TEST_ASSERT(freed.peakLiveBytes == allocated.peakLiveBytes);
+
+		MemoryTracker::setEnabled(false);
+#endif
+	}
 }
@@ -23,5 +23,12 @@ namespace bs
 		void testQuadtree();
 		void testVarInt();
 		void testBitStream();
+		void testAsyncLogging();
+		void testMathSIMD();
+		void testBinarySerializer();
+		void testParallelDecode();
+		void testBinaryDiff();
+		void testProfilerTimeline();
+		void testMemoryTracker();
 	};
 }
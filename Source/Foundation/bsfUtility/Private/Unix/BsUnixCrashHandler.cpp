@@ -172,6 +172,44 @@ namespace bs
 		return stackTrace.str();
 	}
 
+	UINT32 CrashHandler::getRawStackTrace(void** frames, UINT32 maxFrames, UINT32 skip)
+	{
+		void* trace[BS_MAX_STACKTRACE_DEPTH];
+
+		// Skip this method as well
+		skip++;
+
+		const UINT32 numToCapture = std::min(maxFrames + skip, (UINT32)BS_MAX_STACKTRACE_DEPTH);
+		const UINT32 traceSize = (UINT32)backtrace(trace, (int)numToCapture);
+		if(traceSize <= skip)
+			return 0;
+
+		const UINT32 numFrames = std::min(traceSize - skip, maxFrames);
+		memcpy(frames, &trace[skip], numFrames * sizeof(void*));
+
+		return numFrames;
+	}
+
+	String CrashHandler::getSymbolName(void* address)
+	{
+		Dl_info info;
+		if (dladdr(address, &info) && info.dli_sname)
+		{
+			int status = -1;
+			char* demangledName = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+
+			String output = status == 0 ? String(demangledName) : String(info.dli_sname);
+			free(demangledName);
+
+			return output;
+		}
+
+		StringStream output;
+		output << "0x" << std::hex << (UINT64)(size_t)address;
+
+		return output.str();
+	}
+
 	void CrashHandler::reportCrash(const String& type,
 								   const String& description,
 								   const String& function,
@@ -555,4 +555,31 @@ namespace bs
 		win32_loadSymbols();
 		return win32_getStackTrace(context, 2);
 	}
+
+	UINT32 CrashHandler::getRawStackTrace(void** frames, UINT32 maxFrames, UINT32 skip)
+	{
+		// Skip this method as well
+		return (UINT32)CaptureStackBackTrace((DWORD)(skip + 1), (DWORD)maxFrames, frames, nullptr);
+	}
+
+	String CrashHandler::getSymbolName(void* address)
+	{
+		win32_initPSAPI();
+		win32_loadSymbols();
+
+		UINT8 buffer[sizeof(IMAGEHLP_SYMBOL64) + BS_MAX_STACKTRACE_NAME_BYTES];
+
+		PIMAGEHLP_SYMBOL64 symbol = (PIMAGEHLP_SYMBOL64)buffer;
+		symbol->SizeOfStruct = sizeof(buffer);
+		symbol->MaxNameLength = BS_MAX_STACKTRACE_NAME_BYTES;
+
+		DWORD64 dummy;
+		if (SymGetSymFromAddr64(GetCurrentProcess(), (DWORD64)address, &dummy, symbol))
+			return String(symbol->Name);
+
+		StringStream output;
+		output << "0x" << std::hex << (UINT64)(size_t)address;
+
+		return output.str();
+	}
 }
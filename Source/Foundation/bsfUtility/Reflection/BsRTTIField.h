@@ -44,6 +44,48 @@ namespace bs
 		SerializableFT_ReflectablePtr
 	};
 
+	/**
+	 * Field properties that are resolved once when the field is registered with its RTTI type. Allows serializers to
+	 * avoid querying the same information through virtual calls every time the field is encoded or decoded.
+	 */
+	struct RTTIFieldSchema
+	{
+		/** Static size of a single field element in bytes. See RTTIField::getTypeSize(). */
+		UINT32 size = 0;
+
+		/** True if the field has a dynamic size. See RTTIField::hasDynamicSize(). */
+		bool hasDynamicSize = false;
+
+		/**
+		 * True if the field getter returns a reference to the value as stored in the owning object, and the value can be
+		 * copied using memcpy. This allows serializers to read and write the value memory directly, bypassing the
+		 * conversion through the field getter/setter methods.
+		 */
+		bool isDirect = false;
+
+		/**
+		 * True if the field is an array whose elements are stored contiguously in memory. Together with isDirect this
+		 * allows serializers to copy all array elements at once.
+		 */
+		bool isContiguous = false;
+	};
+
+	/**
+	 * Determines if the elements of the container type @p T are stored contiguously in memory. Specialize for custom
+	 * containers with contiguous storage that are registered through the BS_RTTI_MEMBER_PLAIN_ARRAY macros.
+	 */
+	template<class T>
+	struct RTTIContiguousStorage { enum { value = false }; };
+
+	template<class T, class A>
+	struct RTTIContiguousStorage<std::vector<T, A>> { enum { value = !std::is_same<T, bool>::value }; };
+
+	template<class T, size_t N>
+	struct RTTIContiguousStorage<std::array<T, N>> { enum { value = true }; };
+
+	template<class T, UINT32 N>
+	struct RTTIContiguousStorage<SmallVector<T, N>> { enum { value = true }; };
+
 	/**
 	 * Structure that keeps meta-data concerning a single class field. You can use this data for setting and getting values
 	 * for that field on a specific class instance.
@@ -62,6 +104,7 @@ namespace bs
 		bool mIsVectorType;
 		SerializableFieldType mType;
 		RTTIFieldInfo mInfo;
+		RTTIFieldSchema mSchema;
 
 		virtual ~RTTIField() = default;
 
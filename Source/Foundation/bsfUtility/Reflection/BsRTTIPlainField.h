@@ -98,6 +98,25 @@ namespace bs
 		 * less bytes than its raw type, and at sub-byte increments (e.g. one bit for a boolean).
 		 */
 		virtual void arrayElemFromBuffer(RTTITypeBase* rtti, void* object, int index, Bitstream& stream, bool compress = false) = 0;
+
+		/**
+		 * Returns a pointer to the memory of the value stored in the field, if the field is marked as direct (see
+		 * RTTIFieldSchema::isDirect). Returns null otherwise.
+		 */
+		virtual UINT8* getData(RTTITypeBase* rtti, void* object)
+		{
+			return nullptr;
+		}
+
+		/**
+		 * Returns a pointer to the first element of the array managed by the field, if the field is marked as direct and
+		 * contiguous (see RTTIFieldSchema::isDirect and RTTIFieldSchema::isContiguous). Returns null otherwise, in which
+		 * case the elements need to be accessed one by one. @p size must match the current size of the array.
+		 */
+		virtual UINT8* getArrayData(RTTITypeBase* rtti, void* object, UINT32 size)
+		{
+			return nullptr;
+		}
 	};
 
 	/** Represents a plain class field containing a specific type. */
@@ -112,6 +131,10 @@ namespace bs
 		typedef UINT32(InterfaceType::*ArrayGetSizeType)(ObjectType*);
 		typedef void(InterfaceType::*ArraySetSizeType)(ObjectType*, UINT32);
 
+		/** True if the data type is encoded by copying its memory, and can therefore be accessed directly. */
+		static constexpr bool IS_MEMCPYABLE = RTTIPlainType<DataType>::id == 0 &&
+			RTTIPlainType<DataType>::hasDynamicSize == 0 && std::is_trivially_copyable<DataType>::value;
+
 		/**
 		 * Initializes a plain field containing a single value.
 		 *
@@ -167,6 +190,20 @@ namespace bs
 			init(std::move(name), uniqueId, true, SerializableFT_Plain, info);
 		}
 
+		/**
+		 * Marks the field as directly referencing a value stored in the owning object. Caller must guarantee that the
+		 * getter method returns a reference to that value. This allows serializers to copy the value memory directly
+		 * instead of going through the getter and setter methods. Ignored if the data type cannot be serialized using
+		 * a memcpy.
+		 *
+		 * @param[in]	contiguous	For array fields, true if the container stores its elements contiguously in memory.
+		 */
+		void setDirect(bool contiguous = false)
+		{
+			mSchema.isDirect = IS_MEMCPYABLE;
+			mSchema.isContiguous = IS_MEMCPYABLE && contiguous && mIsVectorType;
+		}
+
 		/** @copydoc RTTIField::getTypeSize */
 		UINT32 getTypeSize() override
 		{
@@ -304,6 +341,34 @@ namespace bs
 			(rttiObject->*arraySetter)(castObject, index, value);
 		}
 
+		/** @copydoc RTTIPlainFieldBase::getData */
+		UINT8* getData(RTTITypeBase* rtti, void* object) override
+		{
+			checkIsArray(false);
+
+			if(!mSchema.isDirect)
+				return nullptr;
+
+			InterfaceType* rttiObject = static_cast<InterfaceType*>(rtti);
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+
+			return (UINT8*)&(rttiObject->*getter)(castObject);
+		}
+
+		/** @copydoc RTTIPlainFieldBase::getArrayData */
+		UINT8* getArrayData(RTTITypeBase* rtti, void* object, UINT32 size) override
+		{
+			checkIsArray(true);
+
+			if(!mSchema.isDirect || !mSchema.isContiguous || size == 0)
+				return nullptr;
+
+			InterfaceType* rttiObject = static_cast<InterfaceType*>(rtti);
+			ObjectType* castObject = static_cast<ObjectType*>(object);
+
+			return (UINT8*)&(rttiObject->*arrayGetter)(castObject, 0);
+		}
+
 	private:
 		union
 		{
@@ -26,12 +26,10 @@ namespace bs
 
 	RTTIField* RTTITypeBase::findField(int uniqueFieldId)
 	{
-		auto foundElement = std::find_if(mFields.begin(), mFields.end(), [&uniqueFieldId](RTTIField* x) { return x->mUniqueId == uniqueFieldId; });
-
-		if(foundElement == mFields.end())
+		if(uniqueFieldId < 0 || uniqueFieldId >= (int)mFieldsById.size())
 			return nullptr;
 
-		return *foundElement;
+		return mFieldsById[uniqueFieldId];
 	}
 
 	void RTTITypeBase::addNewField(RTTIField* field)
@@ -60,7 +58,17 @@ namespace bs
 				"Field with the same name already exists.");
 		}
 
+		// Resolve the properties serializers need up-front, so they don't need to be queried for every object
+		field->mSchema.hasDynamicSize = field->hasDynamicSize();
+		field->mSchema.size = field->getTypeSize();
+
 		mFields.push_back(field);
+
+		// Field IDs are small and densely packed in practice, so a directly indexed table is used for lookups
+		if(uniqueId >= (int)mFieldsById.size())
+			mFieldsById.resize(uniqueId + 1, nullptr);
+
+		mFieldsById[uniqueId] = field;
 	}
 
 	class SerializationContextRTTI : public RTTIType<SerializationContext, IReflectable, SerializationContextRTTI>
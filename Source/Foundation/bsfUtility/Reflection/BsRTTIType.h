@@ -45,7 +45,7 @@ namespace bs
 	struct META_NextEntry_##name{};																\
 	void META_InitPrevEntry(META_NextEntry_##name typeId)										\
 	{																							\
-		addPlainField(#name, id, &MyType::get##name, &MyType::set##name, info);					\
+		addPlainMemberField(#name, id, &MyType::get##name, &MyType::set##name, info);			\
 		META_InitPrevEntry(META_Entry_##name());												\
 	}																							\
 																								\
@@ -79,7 +79,8 @@ namespace bs
 	struct META_NextEntry_##name{};																\
 	void META_InitPrevEntry(META_NextEntry_##name typeId)										\
 	{																							\
-		addPlainArrayField(#name, id, &MyType::get##name, &MyType::getSize##name, &MyType::set##name, &MyType::setSize##name, info);					\
+		addPlainMemberArrayField(#name, id, &MyType::get##name, &MyType::getSize##name, &MyType::set##name, &MyType::setSize##name, info,		\
+			::bs::RTTIContiguousStorage<std::common_type<decltype(OwnerType::field)>::type>::value);							\
 		META_InitPrevEntry(META_Entry_##name());												\
 	}																							\
 																								\
@@ -400,6 +401,7 @@ namespace bs
 
 	private:
 		Vector<RTTIField*> mFields;
+		Vector<RTTIField*> mFieldsById;
 	};
 
 	/** Used for initializing a certain type as soon as the program is loaded. */
@@ -560,6 +562,29 @@ namespace bs
 			addNewField(newField);
 		}
 
+		/**
+		 * Registers a field referencing a plain type stored in a member variable. Same as addPlainField() except that the
+		 * getter must return a reference to the value as stored in the owning object, which allows serializers to access
+		 * the value memory directly, if the type permits it.
+		 */
+		template<class InterfaceType, class ObjectType, class DataType>
+		void addPlainMemberField(const String& name, UINT32 uniqueId,
+			DataType& (InterfaceType::*getter)(ObjectType*),
+			void (InterfaceType::*setter)(ObjectType*, DataType&),
+			const RTTIFieldInfo& info = RTTIFieldInfo::DEFAULT)
+		{
+			static_assert((std::is_base_of<bs::RTTIType<Type, BaseType, MyRTTIType>, InterfaceType>::value),
+				"Class with the get/set methods must derive from bs::RTTIType.");
+
+			static_assert(!(std::is_base_of<bs::IReflectable, DataType>::value),
+				"Data type derives from IReflectable but it is being added as a plain field.");
+
+			auto newField = bs_new<RTTIPlainField<InterfaceType, DataType, ObjectType>>();
+			newField->initSingle(name, uniqueId, getter, setter, info);
+			newField->setDirect();
+			addNewField(newField);
+		}
+
 		/** Registers a field referencing an IReflectable type passed by value. */
 		template<class InterfaceType, class ObjectType, class DataType>
 		void addReflectableField(const String& name, UINT32 uniqueId,
@@ -610,6 +635,33 @@ namespace bs
 			addNewField(newField);
 		}	
 
+		/**
+		 * Registers a field referencing an array of plain types stored directly in a member variable. Same as
+		 * addPlainArrayField() except that the getter must return a reference to the element as stored in the owning
+		 * object, which allows serializers to access element memory directly, if the type permits it. If @p contiguous is
+		 * true, the container must store its elements contiguously in memory (see RTTIContiguousStorage), allowing all
+		 * elements to be accessed at once.
+		 */
+		template<class InterfaceType, class ObjectType, class DataType>
+		void addPlainMemberArrayField(const String& name, UINT32 uniqueId,
+			DataType& (InterfaceType::*getter)(ObjectType*, UINT32),
+			UINT32(InterfaceType::*getSize)(ObjectType*),
+			void (InterfaceType::*setter)(ObjectType*, UINT32, DataType&),
+			void(InterfaceType::*setSize)(ObjectType*, UINT32),
+			const RTTIFieldInfo& info = RTTIFieldInfo::DEFAULT, bool contiguous = false)
+		{
+			static_assert((std::is_base_of<bs::RTTIType<Type, BaseType, MyRTTIType>, InterfaceType>::value),
+				"Class with the get/set methods must derive from bs::RTTIType.");
+
+			static_assert(!(std::is_base_of<bs::IReflectable, DataType>::value),
+				"Data type derives from IReflectable but it is being added as a plain field.");
+
+			auto newField = bs_new<RTTIPlainField<InterfaceType, DataType, ObjectType>>();
+			newField->initArray(name, uniqueId, getter, getSize, setter, setSize, info);
+			newField->setDirect(contiguous);
+			addNewField(newField);
+		}
+
 		/** Registers a field referencing an array of IReflectable objects. */
 		template<class InterfaceType, class ObjectType, class DataType>
 		void addReflectableArrayField(const String& name, UINT32 uniqueId,
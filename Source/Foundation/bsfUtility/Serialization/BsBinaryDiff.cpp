@@ -9,13 +9,184 @@
 
 namespace bs
 {
+#if BS_DEBUG_MODE
+	/** Pairs of serialized objects (original, new) whose comparison is in progress or has completed. */
+	using ComparedObjectSet = Set<std::pair<const SerializedObject*, const SerializedObject*>>;
+
+	static bool isEqual(const SPtr<SerializedInstance>& a, const SPtr<SerializedInstance>& b,
+		ComparedObjectSet& visited);
+
+	/**
+	 * Compares the contents of two serialized objects, including the contents of all their child objects. @p visited
+	 * contains pairs of objects whose comparison is already in progress, so that reference cycles terminate.
+	 */
+	static bool isEqual(const SerializedObject& a, const SerializedObject& b, ComparedObjectSet& visited)
+	{
+		if (!visited.insert(std::make_pair(&a, &b)).second)
+			return true;
+
+		if (a.subObjects.size() != b.subObjects.size())
+			return false;
+
+		for (size_t i = 0; i < a.subObjects.size(); i++)
+		{
+			const SerializedSubObject& subObjA = a.subObjects[i];
+			const SerializedSubObject& subObjB = b.subObjects[i];
+
+			if (subObjA.typeId != subObjB.typeId || subObjA.entries.size() != subObjB.entries.size())
+				return false;
+
+			for (auto& entry : subObjA.entries)
+			{
+				auto iterFind = subObjB.entries.find(entry.first);
+				if (iterFind == subObjB.entries.end())
+					return false;
+
+				if (!isEqual(entry.second.serialized, iterFind->second.serialized, visited))
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	/** Compares the contents of two serialized instances of any type. See isEqual(SerializedObject, SerializedObject). */
+	static bool isEqual(const SPtr<SerializedInstance>& a, const SPtr<SerializedInstance>& b,
+		ComparedObjectSet& visited)
+	{
+		if (a == b)
+			return true;
+
+		if (a == nullptr || b == nullptr)
+			return false;
+
+		const UINT32 typeId = a->getTypeId();
+		if (typeId != b->getTypeId())
+			return false;
+
+		switch (typeId)
+		{
+		case TID_SerializedObject:
+			return isEqual(static_cast<const SerializedObject&>(*a), static_cast<const SerializedObject&>(*b), visited);
+		case TID_SerializedField:
+		{
+			const auto& fieldA = static_cast<const SerializedField&>(*a);
+			const auto& fieldB = static_cast<const SerializedField&>(*b);
+
+			return fieldA.size == fieldB.size && memcmp(fieldA.value, fieldB.value, fieldA.size) == 0;
+		}
+		case TID_SerializedArray:
+		{
+			const auto& arrayA = static_cast<const SerializedArray&>(*a);
+			const auto& arrayB = static_cast<const SerializedArray&>(*b);
+
+			if (arrayA.numElements != arrayB.numElements || arrayA.entries.size() != arrayB.entries.size())
+				return false;
+
+			for (auto& entry : arrayA.entries)
+			{
+				auto iterFind = arrayB.entries.find(entry.first);
+				if (iterFind == arrayB.entries.end())
+					return false;
+
+				if (!isEqual(entry.second.serialized, iterFind->second.serialized, visited))
+					return false;
+			}
+
+			return true;
+		}
+		case TID_SerializedDataBlock:
+		{
+			const auto& blockA = static_cast<const SerializedDataBlock&>(*a);
+			const auto& blockB = static_cast<const SerializedDataBlock&>(*b);
+
+			if (blockA.size != blockB.size)
+				return false;
+
+			// Data blocks read from files need to be loaded in memory first
+			auto getData = [](const SerializedDataBlock& block, Vector<UINT8>& storage)
+			{
+				if (!block.stream->isFile())
+					return static_cast<MemoryDataStream&>(*block.stream).data() + block.offset;
+
+				storage.resize(block.size);
+				block.stream->seek(block.offset);
+				block.stream->read(storage.data(), block.size);
+
+				return storage.data();
+			};
+
+			Vector<UINT8> storageA, storageB;
+			return memcmp(getData(blockA, storageA), getData(blockB, storageB), blockA.size) == 0;
+		}
+		default:
+			return false;
+		}
+	}
+
+#endif
+
+	/**
+	 * Checks if two serialized objects are known to have identical contents, based on their hashes. Equal non-zero
+	 * hashes are trusted to mean equal contents, which lets the diff skip unchanged subtrees without visiting them. Debug
+	 * builds additionally compare the contents in full, and report any hash collisions.
+	 */
+	static bool isUnmodified(const SerializedObject& orgObj, const SerializedObject& newObj)
+	{
+		if (orgObj.hash == 0 || orgObj.hash != newObj.hash)
+			return false;
+
+#if BS_DEBUG_MODE
+		ComparedObjectSet visited;
+		if (!isEqual(orgObj, newObj, visited))
+		{
+			BS_LOG(Warning, Generic, "Serialized object hash collision detected. Falling back to a full diff.");
+			return false;
+		}
+#endif
+
+		return true;
+	}
+
 	SPtr<SerializedObject> IDiff::generateDiff(const SPtr<SerializedObject>& orgObj,
 		const SPtr<SerializedObject>& newObj)
 	{
+		if (isUnmodified(*orgObj, *newObj))
+			return nullptr;
+
 		ObjectMap objectMap;
 		return generateDiff(orgObj, newObj, objectMap);
 	}
 
+	SPtr<SerializedObject> IDiff::generateDiff(const SPtr<DataStream>& orgStream, UINT32 orgSize,
+		const SPtr<DataStream>& newStream, UINT32 newSize, SerializationContext* context)
+	{
+		const auto readData = [](const SPtr<DataStream>& stream, UINT32 size)
+		{
+			SPtr<MemoryDataStream> memStream = bs_shared_ptr_new<MemoryDataStream>(size);
+			if (stream->read(memStream->data(), size) != size)
+				BS_EXCEPT(InternalErrorException, "Error reading data.");
+
+			return memStream;
+		};
+
+		SPtr<MemoryDataStream> orgData = readData(orgStream, orgSize);
+		SPtr<MemoryDataStream> newData = readData(newStream, newSize);
+
+		// Identical encodings require no further processing, and don't need to be decoded
+		if (orgSize == newSize && memcmp(orgData->data(), newData->data(), newSize) == 0)
+			return nullptr;
+
+		BinarySerializer bs;
+		SPtr<IReflectable> orgObj = bs.decode(orgData, orgSize, context);
+		SPtr<IReflectable> newObj = bs.decode(newData, newSize, context);
+
+		if (orgObj == nullptr || newObj == nullptr)
+			return nullptr;
+
+		return generateDiff(SerializedObject::create(*orgObj), SerializedObject::create(*newObj));
+	}
+
 	SPtr<SerializedInstance> IDiff::generateDiff(RTTITypeBase* rtti, UINT32 fieldType, const SPtr<SerializedInstance>& orgData,
 		const SPtr<SerializedInstance>& newData, ObjectMap& objectMap)
 	{
@@ -31,6 +202,8 @@ namespace bs
 			auto iterFind = objectMap.find(newObjData);
 			if (iterFind != objectMap.end())
 				modification = iterFind->second;
+			else if (isUnmodified(*orgObjData, *newObjData))
+				break;
 			else
 			{
 				RTTITypeBase* childRtti = nullptr;
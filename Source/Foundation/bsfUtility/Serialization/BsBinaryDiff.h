@@ -33,6 +33,21 @@ namespace bs
 		 */
 		SPtr<SerializedObject> generateDiff(const SPtr<SerializedObject>& orgObj, const SPtr<SerializedObject>& newObj);
 
+		/**
+		 * Generates per-field differences between two objects encoded using the BinarySerializer. If the encoded data is
+		 * identical no decoding is performed and null is returned. Otherwise behaves the same as
+		 * generateDiff(const SPtr<SerializedObject>&, const SPtr<SerializedObject>&).
+		 *
+		 * @param[in]	orgStream	Stream containing the encoded original object, starting at the current position.
+		 * @param[in]	orgSize		Size of the encoded original object, in bytes.
+		 * @param[in]	newStream	Stream containing the encoded new object, starting at the current position.
+		 * @param[in]	newSize		Size of the encoded new object, in bytes.
+		 * @param[in]	context		Optional object that will be passed along to all objects through their
+		 *							deserialization callbacks.
+		 */
+		SPtr<SerializedObject> generateDiff(const SPtr<DataStream>& orgStream, UINT32 orgSize,
+			const SPtr<DataStream>& newStream, UINT32 newSize, SerializationContext* context = nullptr);
+
 		/**
 		 * Applies a previously generated per-field differences to the provided object. This will essentially transform the
 		 * original object the differences were generated for into the modified version.
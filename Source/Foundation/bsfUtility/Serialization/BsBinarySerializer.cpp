@@ -13,6 +13,7 @@
 #include "Reflection/BsRTTIManagedDataBlockField.h"
 #include "FileSystem/BsDataStream.h"
 #include "Utility/BsBufferedBitstream.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
@@ -20,6 +21,8 @@ namespace bs
 	constexpr UINT32 BinarySerializer::WRITE_BUFFER_SIZE;
 	constexpr UINT32 BinarySerializer::FLUSH_AFTER_BYTES;
 	constexpr UINT32 BinarySerializer::PRELOAD_CHUNK_BYTES;
+	constexpr UINT32 BinarySerializer::MIN_OBJECTS_PER_TASK;
+	constexpr UINT32 BinarySerializer::ObjectIdTable::MIN_CAPACITY;
 
 	BinarySerializer::BinarySerializer()
 		:mAlloc(&gFrameAlloc())
@@ -37,7 +40,6 @@ namespace bs
 
 		BufferedBitstreamWriter bufferedStream(&mBuffer, stream, WRITE_BUFFER_SIZE, FLUSH_AFTER_BYTES);
 
-		Vector<SPtr<IReflectable>> encodedObjects;
 		UINT32 objectId = findOrCreatePersistentId(object);
 		
 		// Encode primary object and its value types
@@ -47,47 +49,25 @@ namespace bs
 			return;
 		}
 
-		// Encode pointed to objects and their value types
-		UnorderedSet<UINT32> serializedObjects;
-		while(true)
+		// Encode pointed to objects and their value types. Objects are only ever registered once (see registerObjectPtr),
+		// so the list can be processed in order, as new entries get appended to its end while encoding.
+		for(UINT32 i = 0; i < (UINT32)mObjectsToEncode.size(); i++)
 		{
-			auto iter = mObjectsToEncode.begin();
-			bool foundObjectToProcess = false;
-			for(; iter != mObjectsToEncode.end(); ++iter)
-			{
-				auto foundExisting = serializedObjects.find(iter->objectId);
-				if(foundExisting != serializedObjects.end())
-					continue; // Already processed
-
-				SPtr<IReflectable> curObject = iter->object;
-				UINT32 curObjectid = iter->objectId;
-				serializedObjects.insert(curObjectid);
-				mObjectsToEncode.erase(iter);
-
-				if(!encodeEntry(curObject.get(), curObjectid, bufferedStream, shallow))
-				{
-					BS_LOG(Error, Serialization, "Destination buffer is null or not large enough.");
-					return;
-				}
-
-				foundObjectToProcess = true;
-
-				// Ensure we keep a reference to the object so it isn't released.
-				// The system assigns unique IDs to IReflectable objects based on pointer
-				// addresses but if objects get released then same address could be assigned twice.
-				// Note: To get around this I could assign unique IDs to IReflectable objects
-				encodedObjects.push_back(curObject);
+			// Note: Copying since mObjectsToEncode can be modified during encodeEntry
+			ObjectToEncode curEntry = mObjectsToEncode[i];
 
-				break; // Need to start over as mObjectsToSerialize was possibly modified
+			if(!encodeEntry(curEntry.object.get(), curEntry.objectId, bufferedStream, shallow))
+			{
+				BS_LOG(Error, Serialization, "Destination buffer is null or not large enough.");
+				return;
 			}
-
-			if(!foundObjectToProcess) // We're done
-				break;
 		}
 
 		bufferedStream.flush(true);
 
-		encodedObjects.clear();
+		// Note: mObjectsToEncode keeps a reference to all the encoded objects until this point so they aren't released.
+		// The system assigns unique IDs to IReflectable objects based on pointer addresses but if objects get released
+		// then same address could be assigned twice.
 		mObjectsToEncode.clear();
 		mObjectAddrToId.clear();
 
@@ -164,12 +144,7 @@ namespace bs
 			if(objToDecode.isDecoded)
 				continue;
 
-			bufferedStream.seek((uint32_t)objToDecode.offset);
-
-			objToDecode.decodeInProgress = true;
-			decodeEntry(bufferedStream, endBits, objToDecode.object);
-			objToDecode.decodeInProgress = false;
-			objToDecode.isDecoded = true;
+			decodeObject(bufferedStream, endBits, objToDecode);
 		}
 
 		mDecodeObjectMap.clear();
@@ -184,6 +159,184 @@ namespace bs
 		return rootObject;
 	}
 
+	SPtr<IReflectable> BinarySerializer::decodeParallel(const SPtr<DataStream>& stream, UINT32 dataLength,
+		SerializationContext* context, std::function<void(float)> progress)
+	{
+		if (!TaskScheduler::isStarted())
+			return decode(stream, dataLength, context, std::move(progress));
+
+		mContext = context;
+		mReportProgress = nullptr;
+		mTotalBytesToRead = dataLength;
+		mBuffer.seek(0);
+
+		if (dataLength == 0)
+		{
+			if(progress)
+				progress(1.0f);
+
+			return nullptr;
+		}
+
+		// Worker threads each need their own reader, which requires the data to be mapped in memory
+		SPtr<DataStream> memStream = stream;
+		if (stream->isFile())
+		{
+			SPtr<MemoryDataStream> fileData = bs_shared_ptr_new<MemoryDataStream>(dataLength);
+			if (stream->read(fileData->data(), dataLength) != dataLength)
+				BS_EXCEPT(InternalErrorException, "Error reading data.");
+
+			memStream = fileData;
+		}
+
+		const size_t start = memStream->tell();
+		const size_t end = start + dataLength;
+		const size_t endBits = end * 8;
+		mDecodeObjectMap.clear();
+
+		BufferedBitstreamReader bufferedStream(&mBuffer, memStream, PRELOAD_CHUNK_BYTES, FLUSH_AFTER_BYTES);
+
+		// Create empty instances of all ptr objects, and find out which objects each of them references
+		struct ObjectDependencies
+		{
+			ObjectToDecode* object;
+			Vector<UINT32> dependencies;
+			Vector<UINT32> dependents;
+			UINT32 numPendingDependencies = 0;
+		};
+
+		Vector<ObjectDependencies> objects;
+		UnorderedMap<UINT32, UINT32> objectIdToIdx;
+		SPtr<IReflectable> rootObject = nullptr;
+		bool hasMoreObjects = true;
+		while (hasMoreObjects)
+		{
+			ObjectMetaData objectMetaData;
+			objectMetaData.objectMeta = 0;
+			objectMetaData.typeId = 0;
+
+			if(bufferedStream.readBytes(objectMetaData) != sizeof(ObjectMetaData))
+				BS_EXCEPT(InternalErrorException, "Error decoding data.");
+
+			bufferedStream.skipBytes(-(int32_t)sizeof(ObjectMetaData));
+
+			UINT32 objectId = 0;
+			UINT32 objectTypeId = 0;
+			bool objectIsBaseClass = false;
+			decodeObjectMetaData(objectMetaData, objectId, objectTypeId, objectIsBaseClass);
+
+			if (objectIsBaseClass)
+			{
+				BS_EXCEPT(InternalErrorException, "Encountered a base-class object while looking for a new object. " \
+					"Base class objects are only supposed to be parts of a larger object.");
+			}
+
+			SPtr<IReflectable> object = IReflectable::createInstanceFromTypeId(objectTypeId);
+			auto insertResult = mDecodeObjectMap.insert(std::make_pair(objectId, ObjectToDecode(object, bufferedStream.tell())));
+
+			if(rootObject == nullptr)
+				rootObject = object;
+
+			ObjectDependencies objectDependencies;
+			objectDependencies.object = &insertResult.first->second;
+			hasMoreObjects = decodeEntry(bufferedStream, endBits, nullptr, &objectDependencies.dependencies);
+
+			objectIdToIdx[objectId] = (UINT32)objects.size();
+			objects.push_back(std::move(objectDependencies));
+		}
+
+		assert(bufferedStream.tell() == endBits);
+
+		// Build the dependency graph. Objects with no pending dependencies form the first wave.
+		Vector<UINT32> wave;
+		for(UINT32 i = 0; i < (UINT32)objects.size(); i++)
+		{
+			ObjectDependencies& entry = objects[i];
+			for(auto& dependencyId : entry.dependencies)
+			{
+				auto iterFind = objectIdToIdx.find(dependencyId);
+				if(iterFind == objectIdToIdx.end() || iterFind->second == i)
+					continue; // Missing objects are reported when decoding, and self-references need no ordering
+
+				objects[iterFind->second].dependents.push_back(i);
+				entry.numPendingDependencies++;
+			}
+
+			if(entry.numPendingDependencies == 0)
+				wave.push_back(i);
+		}
+
+		// Decode objects in waves, each wave only containing objects whose dependencies have been fully decoded
+		const auto decodeRange = [this, &objects, &wave, &memStream, endBits](UINT32 first, UINT32 last)
+		{
+			Bitstream buffer;
+			BufferedBitstreamReader workerStream(&buffer, memStream, PRELOAD_CHUNK_BYTES, FLUSH_AFTER_BYTES);
+
+			// Worker threads never clear their frame allocators on their own, so release the temporary RTTI instances
+			// once done
+			bs_frame_mark();
+			for(UINT32 i = first; i < last; i++)
+				decodeObject(workerStream, endBits, *objects[wave[i]].object);
+			bs_frame_clear();
+		};
+
+		UINT32 numDecoded = 0;
+		Vector<UINT32> nextWave;
+		while(!wave.empty())
+		{
+			const auto numObjects = (UINT32)wave.size();
+			const UINT32 numTasks = std::min(TaskScheduler::instance().getNumWorkers(),
+				numObjects / MIN_OBJECTS_PER_TASK);
+
+			if(numTasks > 1)
+			{
+				const UINT32 objectsPerTask = Math::divideAndRoundUp(numObjects, numTasks);
+				SPtr<TaskGroup> taskGroup = TaskGroup::create("BinarySerializer::decodeParallel",
+					[&decodeRange, objectsPerTask, numObjects](UINT32 idx)
+				{
+					const UINT32 first = idx * objectsPerTask;
+					decodeRange(first, std::min(first + objectsPerTask, numObjects));
+				}, numTasks);
+
+				TaskScheduler::instance().addTaskGroup(taskGroup);
+				taskGroup->wait();
+			}
+			else
+				decodeRange(0, numObjects);
+
+			numDecoded += numObjects;
+			if(progress)
+				progress(numDecoded / (float)objects.size());
+
+			nextWave.clear();
+			for(auto& idx : wave)
+			{
+				for(auto& dependentIdx : objects[idx].dependents)
+				{
+					if(--objects[dependentIdx].numPendingDependencies == 0)
+						nextWave.push_back(dependentIdx);
+				}
+			}
+
+			std::swap(wave, nextWave);
+		}
+
+		// Whatever remains is part of a reference cycle, decode it serially and let decodeEntry resolve the cycles
+		for(auto& entry : objects)
+		{
+			if(!entry.object->isDecoded)
+				decodeObject(bufferedStream, endBits, *entry.object);
+		}
+
+		mDecodeObjectMap.clear();
+		memStream->seek(end);
+
+		if(progress)
+			progress(1.0f);
+
+		return rootObject;
+	}
+
 	bool BinarySerializer::encodeEntry(IReflectable* object, UINT32 objectId, BufferedBitstreamWriter& stream, bool shallow)
 	{
 		RTTITypeBase* rtti = object->getRTTI();
@@ -219,10 +372,11 @@ namespace bs
 			for(UINT32 i = 0; i < numFields; i++)
 			{
 				RTTIField* curGenericField = rtti->getField(i);
+				const RTTIFieldSchema& fieldSchema = curGenericField->mSchema;
 
 				// Copy field ID & other meta-data like field size and type
-				int metaData = encodeFieldMetaData(curGenericField->mUniqueId, curGenericField->getTypeSize(),
-					curGenericField->mIsVectorType, curGenericField->mType, curGenericField->hasDynamicSize(), false);
+				int metaData = encodeFieldMetaData(curGenericField->mUniqueId, (UINT8)fieldSchema.size,
+					curGenericField->mIsVectorType, curGenericField->mType, fieldSchema.hasDynamicSize, false);
 
 				stream.writeBytes(metaData);
 				static_assert(sizeof(metaData) == META_SIZE, "Size mismatch");
@@ -275,8 +429,15 @@ namespace bs
 						{
 							RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
 
-							for(UINT32 arrIdx = 0; arrIdx < arrayNumElems; arrIdx++)
-								curField->arrayElemToStream(rttiInstance, object, arrIdx, stream.getBitstream());
+							// Contiguous direct arrays are encoded the same as element-by-element, just in one go
+							UINT8* arrayData = curField->getArrayData(rttiInstance, object, arrayNumElems);
+							if(arrayData)
+								stream.writeBytes(arrayData, arrayNumElems * fieldSchema.size);
+							else
+							{
+								for(UINT32 arrIdx = 0; arrIdx < arrayNumElems; arrIdx++)
+									curField->arrayElemToStream(rttiInstance, object, arrIdx, stream.getBitstream());
+							}
 
 							break;
 						}
@@ -319,7 +480,12 @@ namespace bs
 					case SerializableFT_Plain:
 						{
 							RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
-							curField->toStream(rttiInstance, object, stream.getBitstream());
+
+							// Direct values are copied as-is, same as their RTTIPlainType would encode them
+							if(fieldSchema.isDirect)
+								stream.writeBytes(curField->getData(rttiInstance, object), fieldSchema.size);
+							else
+								curField->toStream(rttiInstance, object, stream.getBitstream());
 
 							break;
 						}
@@ -362,7 +528,8 @@ namespace bs
 		return true;
 	}
 
-	bool BinarySerializer::decodeEntry(BufferedBitstreamReader& stream, size_t dataEnd, const SPtr<IReflectable>& output)
+	bool BinarySerializer::decodeEntry(BufferedBitstreamReader& stream, size_t dataEnd, const SPtr<IReflectable>& output,
+		Vector<UINT32>* outDependencies)
 	{
 		ObjectMetaData objectMetaData;
 		objectMetaData.objectMeta = 0;
@@ -385,9 +552,17 @@ namespace bs
 		if(output)
 			rtti = output->getRTTI();
 
+		// When only scanning for dependencies there is no output object, so field flags are looked up from the type IDs
+		// stored in the stream instead
+		RTTITypeBase* scanRtti = nullptr;
+		if(outDependencies)
+			scanRtti = IReflectable::_getRTTIfromTypeId(objectTypeId);
+
+		// Note: Using the allocator of the current thread, since entries can be decoded from worker threads
+		FrameAlloc& alloc = gFrameAlloc();
 		FrameVector<RTTITypeBase*> rttiInstances;
 
-		auto finalizeObject = [&rttiInstances, this](IReflectable* object)
+		auto finalizeObject = [&rttiInstances, &alloc, this](IReflectable* object)
 		{
 			// Note: It would make sense to finish deserializing derived classes before base classes, but some code
 			// depends on the old functionality, so we'll keep it this way
@@ -396,16 +571,28 @@ namespace bs
 				RTTITypeBase* curRTTI = *iter;
 
 				curRTTI->onDeserializationEnded(object, mContext);
-				mAlloc->destruct(curRTTI);
+				alloc.destruct(curRTTI);
 			}
 
 			rttiInstances.clear();
 		};
 
+		// Records a reference to another object, if scanning for dependencies
+		auto addDependency = [outDependencies, &scanRtti](UINT16 fieldId, int childObjectId)
+		{
+			if(!outDependencies || childObjectId == 0 || !scanRtti)
+				return;
+
+			// Fields that no longer exist are ignored on decode, and weak references don't need to be decoded first
+			RTTIField* field = scanRtti->findField(fieldId);
+			if(field && !field->getInfo().flags.isSet(RTTIFieldFlag::WeakRef))
+				outDependencies->push_back((UINT32)childObjectId);
+		};
+
 		RTTITypeBase* curRTTI = rtti;
 		while (curRTTI)
 		{
-			RTTITypeBase* rttiInstance = curRTTI->_clone(*mAlloc);
+			RTTITypeBase* rttiInstance = curRTTI->_clone(alloc);
 			rttiInstances.push_back(rttiInstance);
 
 			curRTTI = curRTTI->getBaseClass();
@@ -442,6 +629,9 @@ namespace bs
 				// If it's a base class, get base class RTTI and handle that
 				if (objIsBaseClass)
 				{
+					if (outDependencies)
+						scanRtti = IReflectable::_getRTTIfromTypeId(objTypeId);
+
 					if (rtti != nullptr)
 						rtti = rtti->getBaseClass();
 
@@ -493,11 +683,11 @@ namespace bs
 
 			if (curGenericField != nullptr)
 			{
-				if (!hasDynamicSize && curGenericField->getTypeSize() != fieldSize)
+				if (!hasDynamicSize && curGenericField->mSchema.size != fieldSize)
 				{
 					BS_EXCEPT(InternalErrorException,
 						"Data type mismatch. Type size stored in file and actual type size don't match. ("
-						+ toString(curGenericField->getTypeSize()) + " vs. " + toString(fieldSize) + ")");
+						+ toString(curGenericField->mSchema.size) + " vs. " + toString(fieldSize) + ")");
 				}
 
 				if (curGenericField->mIsVectorType != isArray)
@@ -531,6 +721,7 @@ namespace bs
 					{
 						int childObjectId = 0;
 						stream.readBytes(childObjectId);
+						addDependency(fieldId, childObjectId);
 
 						if (curField != nullptr)
 						{
@@ -592,7 +783,7 @@ namespace bs
 						if(curField)
 							childObj = curField->newObject();
 
-						decodeEntry(stream, dataEnd, childObj);
+						decodeEntry(stream, dataEnd, childObj, outDependencies);
 
 						if (curField != nullptr)
 						{
@@ -606,6 +797,17 @@ namespace bs
 				{
 					RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
 
+					// Contiguous direct arrays can be read in one go, as their elements are stored back to back
+					UINT8* arrayData = nullptr;
+					if (curField != nullptr && !hasDynamicSize)
+						arrayData = curField->getArrayData(rttiInstance, output.get(), arrayNumElems);
+
+					if (arrayData)
+					{
+						stream.readBytes(arrayData, arrayNumElems * fieldSize);
+						break;
+					}
+
 					for (int i = 0; i < arrayNumElems; i++)
 					{
 						UINT32 typeSize = fieldSize;
@@ -642,6 +844,7 @@ namespace bs
 
 					int childObjectId = 0;
 					stream.readBytes(childObjectId);
+					addDependency(fieldId, childObjectId);
 
 					if (curField != nullptr)
 					{
@@ -701,7 +904,7 @@ namespace bs
 					if (curField)
 						childObj = curField->newObject();
 
-					decodeEntry(stream, dataEnd, childObj);
+					decodeEntry(stream, dataEnd, childObj, outDependencies);
 
 					if (curField != nullptr)
 					{
@@ -724,9 +927,14 @@ namespace bs
 
 					if (curField != nullptr)
 					{
-						stream.preload(typeSize);
-						curField->fromBuffer(rttiInstance, output.get(), stream.getBitstream());
-						stream.skipBytes(typeSize);
+						if (curField->mSchema.isDirect)
+							stream.readBytes(curField->getData(rttiInstance, output.get()), typeSize);
+						else
+						{
+							stream.preload(typeSize);
+							curField->fromBuffer(rttiInstance, output.get(), stream.getBitstream());
+							stream.skipBytes(typeSize);
+						}
 					}
 					else
 						stream.skipBytes(typeSize);
@@ -794,6 +1002,16 @@ namespace bs
 		return false;
 	}
 
+	void BinarySerializer::decodeObject(BufferedBitstreamReader& stream, size_t dataEnd, ObjectToDecode& object)
+	{
+		stream.seek((uint32_t)object.offset);
+
+		object.decodeInProgress = true;
+		decodeEntry(stream, dataEnd, object.object);
+		object.decodeInProgress = false;
+		object.isDecoded = true;
+	}
+
 	bool BinarySerializer::complexTypeToStream(IReflectable* object, BufferedBitstreamWriter& stream, bool shallow)
 	{
 		if (object != nullptr)
@@ -901,37 +1119,88 @@ namespace bs
 
 	UINT32 BinarySerializer::findOrCreatePersistentId(IReflectable* object)
 	{
-		void* ptrAddress = (void*)object;
-
-		auto findIter = mObjectAddrToId.find(ptrAddress);
-		if(findIter != mObjectAddrToId.end())
-			return findIter->second;
+		bool inserted;
+		const UINT32 objectId = mObjectAddrToId.findOrInsert((void*)object, mLastUsedObjectId, inserted);
+		if(inserted)
+			mLastUsedObjectId++;
 
-		UINT32 objId = mLastUsedObjectId++;
-		mObjectAddrToId.insert(std::make_pair(ptrAddress, objId));
-
-		return objId;
+		return objectId;
 	}
 
-	UINT32 BinarySerializer::registerObjectPtr(SPtr<IReflectable> object)
+	UINT32 BinarySerializer::registerObjectPtr(const SPtr<IReflectable>& object)
 	{
 		if(object == nullptr)
 			return 0;
 
-		void* ptrAddress = (void*)object.get();
+		// Single lookup that both finds an existing ID, or registers a new one
+		bool inserted;
+		const UINT32 objectId = mObjectAddrToId.findOrInsert((void*)object.get(), mLastUsedObjectId, inserted);
+		if(inserted)
+		{
+			mLastUsedObjectId++;
+			mObjectsToEncode.push_back(ObjectToEncode(objectId, object));
+		}
+
+		return objectId;
+	}
+
+	UINT32 BinarySerializer::ObjectIdTable::findOrInsert(void* address, UINT32 newId, bool& inserted)
+	{
+		// Keep the table at most half full, so probe sequences stay short
+		if((mCount + 1) * 2 > (UINT32)mEntries.size())
+			grow();
 
-		auto iterFind = mObjectAddrToId.find(ptrAddress);
-		if(iterFind == mObjectAddrToId.end())
+		// Objects are at least 8 byte aligned, so the low bits carry no information
+		const UINT64 key = (UINT64)(size_t)address >> 3;
+		const UINT32 mask = (UINT32)mEntries.size() - 1;
+
+		UINT32 idx = (UINT32)((key * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+		while(true)
 		{
-			UINT32 objId = findOrCreatePersistentId(object.get());
+			Entry& entry = mEntries[idx];
+			if(entry.address == address)
+			{
+				inserted = false;
+				return entry.id;
+			}
+
+			if(entry.address == nullptr)
+			{
+				entry.address = address;
+				entry.id = newId;
+				mCount++;
 
-			mObjectsToEncode.push_back(ObjectToEncode(objId, object));
-			mObjectAddrToId.insert(std::make_pair(ptrAddress, objId));
+				inserted = true;
+				return newId;
+			}
 
-			return objId;
+			idx = (idx + 1) & mask;
 		}
+	}
 
-		return iterFind->second;
+	void BinarySerializer::ObjectIdTable::clear()
+	{
+		if(mCount == 0)
+			return;
+
+		std::fill(mEntries.begin(), mEntries.end(), Entry());
+		mCount = 0;
+	}
+
+	void BinarySerializer::ObjectIdTable::grow()
+	{
+		Vector<Entry> oldEntries(std::max((UINT32)mEntries.size() * 2, MIN_CAPACITY));
+		oldEntries.swap(mEntries);
+
+		mCount = 0;
+		for(auto& entry : oldEntries)
+		{
+			if(entry.address == nullptr)
+				continue;
+
+			bool inserted;
+			findOrInsert(entry.address, entry.id, inserted);
+		}
 	}
 }
 
@@ -68,6 +68,31 @@ namespace bs
 		 */
 		SPtr<IReflectable> decode(const SPtr<DataStream>& stream, UINT32 dataLength, SerializationContext* context = nullptr,
 			std::function<void(float)> progress = nullptr);
+
+		/**
+		 * Same as decode(), except that objects referenced by pointer are decoded in parallel on the worker threads of the
+		 * TaskScheduler, where possible. Objects are decoded in waves, where each wave contains objects whose (non-weak)
+		 * references have been fully decoded by previous waves, therefore preserving the guarantee that child elements are
+		 * fully deserialized before their parents. Objects that are part of reference cycles are decoded serially at
+		 * the end.
+		 *
+		 * @param[in]	stream  	Stream containing the binary data to decode. File streams will have the data read into
+		 *							memory first, so it can be accessed by multiple threads.
+		 * @param[in]	dataLength	Length of the data in bytes. If zero, all the data from the stream will be read.
+		 * @param[in]	context		Optional object that will be passed along to all serialized objects through
+		 *							their deserialization callbacks. Can be used for controlling deserialization,
+		 *							maintaining state or sharing information between objects during deserialization.
+		 * @param[in]	progress	Optional callback that will occassionally trigger, reporting the current progress
+		 *							of the operation. The reported value is in range [0, 1]. Always triggered on the
+		 *							calling thread.
+		 *
+		 * @note
+		 * Deserialization callbacks of independent objects may execute concurrently, in an unspecified order. Only use
+		 * this method if all the types contained in the stream (as well as the provided context) support concurrent
+		 * deserialization. Falls back to serial decoding if the TaskScheduler is not running.
+		 */
+		SPtr<IReflectable> decodeParallel(const SPtr<DataStream>& stream, UINT32 dataLength,
+			SerializationContext* context = nullptr, std::function<void(float)> progress = nullptr);
 	private:
 		/** Determines how many bytes need to be read before the progress report callback is triggered. */
 		static constexpr UINT32 REPORT_AFTER_BYTES = 32768;
@@ -81,6 +106,9 @@ namespace bs
 		/** Determines the minimum amount of bytes to preload into the temporary buffer. */
 		static constexpr UINT32 PRELOAD_CHUNK_BYTES = (UINT32)(WRITE_BUFFER_SIZE * 0.25f);
 
+		/** Minimum number of objects a single worker task will decode during decodeParallel(). */
+		static constexpr UINT32 MIN_OBJECTS_PER_TASK = 16;
+
 		struct ObjectMetaData
 		{
 			UINT32 objectMeta;
@@ -97,6 +125,40 @@ namespace bs
 			SPtr<IReflectable> object;
 		};
 
+		/**
+		 * Maps addresses of objects being encoded to their unique IDs, using open addressing. Its storage is kept between
+		 * encode() calls, so registering objects doesn't allocate once the table has grown to fit the typical object
+		 * count, unlike a node based hash map.
+		 */
+		class ObjectIdTable
+		{
+		public:
+			/**
+			 * Returns the ID assigned to @p address. If the address has no ID yet, @p newId is assigned to it and
+			 * @p inserted is set to true.
+			 */
+			UINT32 findOrInsert(void* address, UINT32 newId, bool& inserted);
+
+			/** Removes all entries, while keeping the allocated storage. */
+			void clear();
+
+		private:
+			struct Entry
+			{
+				void* address = nullptr;
+				UINT32 id = 0;
+			};
+
+			/** Minimum number of entries to allocate. Must be a power of two. */
+			static constexpr UINT32 MIN_CAPACITY = 1024;
+
+			/** Doubles the table capacity and re-inserts all existing entries. */
+			void grow();
+
+			Vector<Entry> mEntries;
+			UINT32 mCount = 0;
+		};
+
 		struct ObjectToDecode
 		{
 			ObjectToDecode(const SPtr<IReflectable>& _object, size_t offset = 0)
@@ -112,8 +174,15 @@ namespace bs
 		/** Encodes a single IReflectable object. */
 		bool encodeEntry(IReflectable* object, UINT32 objectId, BufferedBitstreamWriter& stream, bool shallow);
 
-		/**	Decodes a single IReflectable object. */
-		bool decodeEntry(BufferedBitstreamReader& stream, size_t dataLength, const SPtr<IReflectable>& output);
+		/**
+		 * Decodes a single IReflectable object. If @p outDependencies is provided (only valid when @p output is null)
+		 * the IDs of all objects referenced by the entry through non-weak pointer fields will be appended to it.
+		 */
+		bool decodeEntry(BufferedBitstreamReader& stream, size_t dataLength, const SPtr<IReflectable>& output,
+			Vector<UINT32>* outDependencies = nullptr);
+
+		/** Decodes a single IReflectable object at the specified offset, along with any non-decoded objects it depends on. */
+		void decodeObject(BufferedBitstreamReader& stream, size_t dataEnd, ObjectToDecode& object);
 
 		/**	Helper method for encoding a complex object and writing its data to a stream. */
 		bool complexTypeToStream(IReflectable* object, BufferedBitstreamWriter& stream, bool shallow);
@@ -125,7 +194,7 @@ namespace bs
 		 * Finds or creates an id for the provided object and returns it. And it adds the object to a list of objects that
 		 * need to be encoded, if it's not already there.
 		 */
-		UINT32 registerObjectPtr(SPtr<IReflectable> object);
+		UINT32 registerObjectPtr(const SPtr<IReflectable>& object);
 
 		/** Encodes data required for representing a serialized field, into 4 bytes. */
 		static UINT32 encodeFieldMetaData(UINT16 id, UINT8 size, bool array,
@@ -154,7 +223,7 @@ namespace bs
 
 		Map<UINT32, ObjectToDecode> mDecodeObjectMap;
 		Vector<ObjectToEncode> mObjectsToEncode;
-		UnorderedMap<void*, UINT32> mObjectAddrToId;
+		ObjectIdTable mObjectAddrToId;
 		UINT32 mLastUsedObjectId = 1;
 		UINT32 mTotalBytesToRead = 0;
 		UINT32 mNextProgressReport = REPORT_AFTER_BYTES;
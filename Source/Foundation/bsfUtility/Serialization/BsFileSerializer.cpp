@@ -70,6 +70,18 @@ namespace bs
 		return object;
 	}
 
+	SPtr<IReflectable> FileDecoder::decodeParallel(SerializationContext* context)
+	{
+		if (mInputStream->eof())
+			return nullptr;
+
+		UINT32 objectSize = 0;
+		mInputStream->read(&objectSize, sizeof(objectSize));
+
+		BinarySerializer bs;
+		return bs.decodeParallel(mInputStream, objectSize, context);
+	}
+
 	UINT32 FileDecoder::getSize() const
 	{
 		if (mInputStream->eof())
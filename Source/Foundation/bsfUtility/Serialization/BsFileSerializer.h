@@ -50,6 +50,13 @@ namespace bs
 		 */
 		SPtr<IReflectable> decode(SerializationContext* context = nullptr);
 
+		/**
+		 * Same as decode(), except that objects independent of each other are decoded in parallel using the task
+		 * scheduler. Caller must ensure the RTTI types of decoded objects are safe to deserialize concurrently.
+		 * See BinarySerializer::decodeParallel.
+		 */
+		SPtr<IReflectable> decodeParallel(SerializationContext* context = nullptr);
+
 		/** Gets the size in bytes of the next object in the file. Returns 0 if no next object. */
 		UINT32 getSize() const;
 
@@ -363,6 +363,9 @@ namespace bs
 			bool replicableOnly = flags.isSet(SerializedObjectEncodeFlag::ReplicableOnly);
 			SPtr<SerializedObject> output = bs_shared_ptr_new<SerializedObject>();
 
+			// Hash of all the encoded data, allowing diff generation to skip over unchanged objects
+			size_t hash = 0;
+
 			// If an object has base classes, we need to iterate through all of them
 			do
 			{
@@ -374,6 +377,7 @@ namespace bs
 				output->subObjects.push_back(SerializedSubObject());
 				SerializedSubObject& subObject = output->subObjects.back();
 				subObject.typeId = rtti->getRTTIId();
+				bs_hash_combine(hash, subObject.typeId);
 
 				const UINT32 numFields = rtti->getNumFields();
 				for (UINT32 i = 0; i < numFields; i++)
@@ -388,9 +392,12 @@ namespace bs
 							continue;
 					}
 
+					bs_hash_combine(hash, curGenericField->mUniqueId);
+
 					if (curGenericField->mIsVectorType)
 					{
 						const UINT32 arrayNumElems = curGenericField->getArraySize(rttiInstance, object);
+						bs_hash_combine(hash, arrayNumElems);
 
 						const SPtr<SerializedArray> serializedArray = bs_shared_ptr_new<SerializedArray>();
 						serializedArray->numElements = arrayNumElems;
@@ -415,6 +422,8 @@ namespace bs
 										serializedChildObj = encodeEntry(childObject.get(), flags);
 								}
 
+								bs_hash_combine(hash, serializedChildObj != nullptr ? serializedChildObj->hash : 0);
+
 								SerializedArrayEntry arrayEntry;
 								arrayEntry.serialized = serializedChildObj;
 								arrayEntry.index = arrIdx;
@@ -433,6 +442,7 @@ namespace bs
 								IReflectable& childObject = curField->getArrayValue(rttiInstance, object, arrIdx);
 
 								const SPtr<SerializedObject> serializedChildObj = encodeEntry(&childObject, flags);
+								bs_hash_combine(hash, serializedChildObj->hash);
 
 								SerializedArrayEntry arrayEntry;
 								arrayEntry.serialized = serializedChildObj;
@@ -463,6 +473,8 @@ namespace bs
 								Bitstream tempStream(serializedField->value, typeSize);
 								curField->arrayElemToStream(rttiInstance, object, arrIdx, tempStream);
 
+								bs_hash_combine(hash, bs_hash_bytes(serializedField->value, typeSize));
+
 								SerializedArrayEntry arrayEntry;
 								arrayEntry.serialized = serializedField;
 								arrayEntry.index = arrIdx;
@@ -491,7 +503,12 @@ namespace bs
 								SPtr<IReflectable> childObject = curField->getValue(rttiInstance, object);
 
 								if (childObject)
-									serializedEntry = encodeEntry(childObject.get(), flags);
+								{
+									SPtr<SerializedObject> serializedChildObj = encodeEntry(childObject.get(), flags);
+									bs_hash_combine(hash, serializedChildObj->hash);
+
+									serializedEntry = serializedChildObj;
+								}
 							}
 
 							break;
@@ -501,7 +518,10 @@ namespace bs
 							auto curField = static_cast<RTTIReflectableFieldBase*>(curGenericField);
 							IReflectable& childObject = curField->getValue(rttiInstance, object);
 
-							serializedEntry = encodeEntry(&childObject, flags);
+							SPtr<SerializedObject> serializedChildObj = encodeEntry(&childObject, flags);
+							bs_hash_combine(hash, serializedChildObj->hash);
+
+							serializedEntry = serializedChildObj;
 
 							break;
 						}
@@ -523,6 +543,7 @@ namespace bs
 							Bitstream tempStream(serializedField->value, typeSize);
 							curField->toStream(rttiInstance, object, tempStream);
 
+							bs_hash_combine(hash, bs_hash_bytes(serializedField->value, typeSize));
 							serializedEntry = serializedField;
 
 							break;
@@ -536,6 +557,7 @@ namespace bs
 
 							SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>(dataBlockSize);
 							blockStream->read(stream->data(), dataBlockSize);
+							bs_hash_combine(hash, bs_hash_bytes(stream->data(), dataBlockSize));
 
 							SPtr<SerializedDataBlock> serializedDataBlock = bs_shared_ptr_new<SerializedDataBlock>();
 							serializedDataBlock->stream = stream;
@@ -566,6 +588,8 @@ namespace bs
 
 			cleanup();
 
+			// Reserve zero for unknown hashes
+			output->hash = hash != 0 ? hash : 1;
 			return output;
 		}
 	}
@@ -587,6 +611,7 @@ namespace bs
 	{
 		SPtr<SerializedObject> copy = bs_shared_ptr_new<SerializedObject>();
 		copy->subObjects = Vector<SerializedSubObject>(subObjects.size());
+		copy->hash = hash;
 
 		UINT32 i = 0;
 		for (auto& subObject : subObjects)
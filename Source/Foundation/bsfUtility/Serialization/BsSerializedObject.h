@@ -123,6 +123,14 @@ namespace bs
 
 		Vector<SerializedSubObject> subObjects;
 
+		/**
+		 * Hash of the object contents, including the contents of all referenced child objects. Calculated when the object
+		 * is created through create(). Objects with equal non-zero hashes can be assumed to have equal contents. Zero if
+		 * the hash is not known, in which case it must not be used for comparison. Must be reset to zero if the object
+		 * contents are modified after creation.
+		 */
+		size_t hash = 0;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
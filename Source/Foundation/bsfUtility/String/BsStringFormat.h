@@ -57,12 +57,50 @@ namespace bs
 		template<class T, class... Args>
 		static BasicString<T> format(const T* source, Args&& ...args)
 		{
-			UINT32 strLength = getLength(source);
-
 			ParamData<T> parameters[MAX_PARAMS];
 			memset(parameters, 0, sizeof(parameters));
 			getParams(parameters, 0U, std::forward<Args>(args)...);
 
+			BasicString<T> outputStr = formatInternal(source, parameters);
+
+			for (UINT32 i = 0; i < MAX_PARAMS; i++)
+			{
+				if (parameters[i].buffer != nullptr)
+					bs_free(parameters[i].buffer);
+			}
+
+			return outputStr;
+		}
+
+		/**
+		 * Same as format(), except the parameters are provided as an array of already converted strings. Useful when the
+		 * number of parameters is only known at runtime.
+		 */
+		template<class T>
+		static BasicString<T> formatParams(const T* source, const BasicString<T>* params, UINT32 numParams)
+		{
+			ParamData<T> parameters[MAX_PARAMS];
+			memset(parameters, 0, sizeof(parameters));
+
+			if (numParams > MAX_PARAMS)
+				numParams = MAX_PARAMS;
+
+			for (UINT32 i = 0; i < numParams; i++)
+			{
+				parameters[i].buffer = const_cast<T*>(params[i].data());
+				parameters[i].size = (UINT32)params[i].size();
+			}
+
+			return formatInternal(source, parameters);
+		}
+
+	private:
+		/** Replaces the identifiers in @p source with the provided parameters. See format(). */
+		template<class T>
+		static BasicString<T> formatInternal(const T* source, const ParamData<T>* parameters)
+		{
+			UINT32 strLength = getLength(source);
+
 			T bracketChars[MAX_IDENTIFIER_SIZE + 1];
 			UINT32 bracketWriteIdx = 0;
 
@@ -156,16 +194,9 @@ namespace bs
 			BasicString<T> outputStr(outputBuffer, finalStringSize);
 			bs_free(outputBuffer);
 
-			for (UINT32 i = 0; i < MAX_PARAMS; i++)
-			{
-				if (parameters[i].buffer != nullptr)
-					bs_free(parameters[i].buffer);
-			}
-
 			return outputStr;
 		}
 
-	private:
 		/**
 		 * Set of methods that can be specialized so we have a generalized way for retrieving length of strings of
 		 * different types.
@@ -2,12 +2,14 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Threading/BsTaskScheduler.h"
 #include "Threading/BsThreadPool.h"
+#include "Debug/BsProfilerTimeline.h"
 
 namespace bs
 {
 	Task::Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker,
-		TaskPriority priority, SPtr<Task> dependency)
-		: mName(name), mPriority(priority), mTaskWorker(std::move(taskWorker)), mTaskDependency(std::move(dependency))
+		TaskPriority priority, SPtr<Task> dependency, const TaskGroup* group)
+		: mName(name), mPriority(priority), mEventId(ProfilerTimeline::INVALID_EVENT_ID)
+		, mTaskWorker(std::move(taskWorker)), mTaskDependency(std::move(dependency)), mGroup(group)
 	{
 
 	}
@@ -18,6 +20,22 @@ namespace bs
 		return bs_shared_ptr_new<Task>(PrivatelyConstruct(), name, std::move(taskWorker), priority, std::move(dependency));
 	}
 
+	UINT32 Task::getEventId() const
+	{
+		// Tasks spawned from a group share its identifier, so the name is only registered once per group
+		if(mGroup != nullptr)
+			return mGroup->getEventId();
+
+		UINT32 eventId = mEventId.load(std::memory_order_relaxed);
+		if(eventId == ProfilerTimeline::INVALID_EVENT_ID)
+		{
+			eventId = ProfilerTimeline::getEventId(mName);
+			mEventId.store(eventId, std::memory_order_relaxed);
+		}
+
+		return eventId;
+	}
+
 	bool Task::isComplete() const
 	{
 		return mState == 2;
@@ -48,7 +66,8 @@ namespace bs
 
 	TaskGroup::TaskGroup(const PrivatelyConstruct& dummy, String name, std::function<void(UINT32)> taskWorker,
 		UINT32 count, TaskPriority priority, SPtr<Task> dependency)
-		: mName(std::move(name)), mCount(count), mPriority(priority), mTaskWorker(std::move(taskWorker))
+		: mName(std::move(name)), mEventId(ProfilerTimeline::INVALID_EVENT_ID), mCount(count), mPriority(priority)
+		, mTaskWorker(std::move(taskWorker))
 		, mTaskDependency(std::move(dependency))
 	{
 
@@ -61,6 +80,18 @@ namespace bs
 			std::move(dependency));
 	}
 
+	UINT32 TaskGroup::getEventId() const
+	{
+		UINT32 eventId = mEventId.load(std::memory_order_relaxed);
+		if(eventId == ProfilerTimeline::INVALID_EVENT_ID)
+		{
+			eventId = ProfilerTimeline::getEventId(mName);
+			mEventId.store(eventId, std::memory_order_relaxed);
+		}
+
+		return eventId;
+	}
+
 	bool TaskGroup::isComplete() const
 	{
 		return mNumRemainingTasks == 0;
@@ -137,7 +168,8 @@ namespace bs
 				--taskGroup->mNumRemainingTasks;
 			};
 
-			SPtr<Task> task = Task::create(taskGroup->mName, worker, taskGroup->mPriority, taskGroup->mTaskDependency);
+			SPtr<Task> task = bs_shared_ptr_new<Task>(Task::PrivatelyConstruct(), taskGroup->mName, worker,
+				taskGroup->mPriority, taskGroup->mTaskDependency, taskGroup.get());
 			task->mParent = this;
 			task->mTaskId = mNextTaskId++;
 			task->mState.store(0); // Reset state in case the task is getting re-queued
@@ -225,7 +257,13 @@ namespace bs
 
 	void TaskScheduler::runTask(SPtr<Task> task)
 	{
-		task->mTaskWorker();
+		if(ProfilerTimeline::isEnabled())
+		{
+			ProfilerTimelineScope timelineScope(task->getEventId());
+			task->mTaskWorker();
+		}
+		else
+			task->mTaskWorker();
 
 		{
 			Lock lock(mReadyMutex);
@@ -12,6 +12,7 @@ namespace bs
 	 *  @{
 	 */
 	class TaskScheduler;
+	class TaskGroup;
 
 	/** Task priority. Tasks with higher priority will get executed sooner. */
 	enum class TaskPriority
@@ -34,7 +35,7 @@ namespace bs
 
 	public:
 		Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker,
-			TaskPriority priority, SPtr<Task> dependency);
+			TaskPriority priority, SPtr<Task> dependency, const TaskGroup* group = nullptr);
 
 		/**
 		 * Creates a new task. Task should be provided to TaskScheduler in order for it to start.
@@ -70,14 +71,22 @@ namespace bs
 	private:
 		friend class TaskScheduler;
 
+		/**
+		 * Returns the identifier of the task's name in ProfilerTimeline. The name is registered on first call, so tasks
+		 * only pay for the lookup when the timeline is recording.
+		 */
+		UINT32 getEventId() const;
+
 		String mName;
 		TaskPriority mPriority;
 		UINT32 mTaskId = 0;
+		mutable std::atomic<UINT32> mEventId; /**< Identifier of the task's name in ProfilerTimeline, resolved lazily. */
 		std::function<void()> mTaskWorker;
 		SPtr<Task> mTaskDependency;
 		std::atomic<UINT32> mState{0}; /**< 0 - Inactive, 1 - In progress, 2 - Completed, 3 - Canceled */
 
 		TaskScheduler* mParent = nullptr;
+		const TaskGroup* mGroup = nullptr; /**< Group the task was spawned from, if any. Kept alive by the task worker. */
 	};
 
 	/**
@@ -118,9 +127,14 @@ namespace bs
 		void wait();
 
 	private:
+		friend class Task;
 		friend class TaskScheduler;
 
+		/** @copydoc Task::getEventId */
+		UINT32 getEventId() const;
+
 		String mName;
+		mutable std::atomic<UINT32> mEventId; /**< Identifier of the group's name in ProfilerTimeline, resolved lazily. */
 		UINT32 mCount;
 		TaskPriority mPriority;
 		std::function<void(UINT32)> mTaskWorker;
@@ -5,6 +5,21 @@
 
 namespace bs
 {
+	size_t bs_hash_bytes(const void* data, size_t size)
+	{
+		// 64-bit FNV-1a
+		UINT64 hash = 0xcbf29ce484222325ULL;
+
+		const auto* bytes = (const UINT8*)data;
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 0x100000001b3ULL;
+		}
+
+		return (size_t)hash;
+	}
+
 	String md5(const WString& source)
 	{
 		MD5 md5;
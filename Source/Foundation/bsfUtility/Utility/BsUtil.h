@@ -28,6 +28,12 @@ namespace bs
 		return hasher(v);
 	}
 
+	/**
+	 * Generates a non-cryptographic hash for the provided block of memory. Suitable for quickly checking if two blocks
+	 * of data differ.
+	 */
+	size_t BS_UTILITY_EXPORT bs_hash_bytes(const void* data, size_t size);
+
 	/** Generates an MD5 hash string for the provided source string. */
 	String BS_UTILITY_EXPORT md5(const WString& source);
 
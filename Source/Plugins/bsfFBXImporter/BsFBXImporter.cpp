@@ -143,6 +143,22 @@ namespace bs
 		{
 			output.push_back({ u8"primary", mesh });
 
+			// Generate lower detail meshes, each one simplified from the previous level
+			SPtr<MeshData> lodMeshData = rendererMeshData->getData();
+			Vector<SubMesh> lodSubMeshes = desc.subMeshes;
+			for(UINT32 i = 0; i < meshImportOptions->numGeneratedLODs; i++)
+			{
+				MESH_DESC lodDesc = desc;
+				lodMeshData = MeshUtility::simplify(lodMeshData, lodSubMeshes, meshImportOptions->lodTriangleRatio,
+					lodDesc.subMeshes);
+				lodSubMeshes = lodDesc.subMeshes;
+
+				SPtr<Mesh> lodMesh = Mesh::_createPtr(lodMeshData, lodDesc);
+				lodMesh->setName(fileName + "_LOD" + toString(i + 1));
+
+				output.push_back({ u8"LOD" + toString(i + 1), lodMesh });
+			}
+
 			CollisionMeshType collisionMeshType = meshImportOptions->collisionMeshType;
 			if(collisionMeshType != CollisionMeshType::None)
 			{
@@ -234,7 +250,20 @@ namespace bs
 			convertAnimations(importedScene.clips, splits, skeleton, meshImportOptions->importRootMotion, animation);
 		}
 
-		// TODO - Later: Optimize mesh: Remove bad and degenerate polygons, weld nearby vertices, optimize for vertex cache
+		// TODO - Later: Remove bad and degenerate polygons, weld nearby vertices
+		if (meshImportOptions->optimizeMesh && rendererMeshData != nullptr)
+		{
+			SPtr<MeshData> meshData = rendererMeshData->getData();
+			VertexCacheStatistics statsBefore = MeshUtility::analyzeVertexCache(meshData, subMeshes);
+
+			// Morph shapes reference vertices by index, so the vertex order must be kept if there are any
+			MeshUtility::optimize(meshData, subMeshes, morphShapes == nullptr);
+
+			VertexCacheStatistics statsAfter = MeshUtility::analyzeVertexCache(meshData, subMeshes);
+			BS_LOG(Info, FBXImporter, "Optimized mesh \"{0}\". ACMR: {1} -> {2}, ATVR: {3} -> {4}, overfetch: {5} -> {6}",
+				filePath.getFilename(false), statsBefore.acmr, statsAfter.acmr, statsBefore.atvr, statsAfter.atvr,
+				statsBefore.overfetch, statsAfter.overfetch);
+		}
 
 		shutDownSdk();
 
@@ -1,6 +1,7 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsFontImporter.h"
+#include "BsFreeTypeRasterizer.h"
 #include "Text/BsFontImportOptions.h"
 #include "Image/BsPixelData.h"
 #include "Image/BsTexture.h"
@@ -47,6 +48,9 @@ namespace bs
 	{
 		const FontImportOptions* fontImportOptions = static_cast<const FontImportOptions*>(importOptions.get());
 
+		if(fontImportOptions->dynamic)
+			return importDynamic(filePath, *fontImportOptions);
+
 		FT_Library library;
 
 		FT_Error error = FT_Init_FreeType(&library);
@@ -73,25 +77,7 @@ namespace bs
 		Vector<UINT32> fontSizes = fontImportOptions->fontSizes;
 		UINT32 dpi = fontImportOptions->dpi;
 
-		FT_Int32 loadFlags;
-		switch (fontImportOptions->renderMode)
-		{
-		case FontRenderMode::Smooth:
-			loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
-			break;
-		case FontRenderMode::Raster:
-			loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_HINTING;
-			break;
-		case FontRenderMode::HintedSmooth:
-			loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_AUTOHINT;
-			break;
-		case FontRenderMode::HintedRaster:
-			loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
-			break;
-		default:
-			loadFlags = FT_LOAD_TARGET_NORMAL;
-			break;
-		}
+		FT_Int32 loadFlags = getFreeTypeLoadFlags(fontImportOptions->renderMode);
 
 		FT_Render_Mode renderMode = FT_LOAD_TARGET_MODE(loadFlags);
 
@@ -226,42 +212,9 @@ namespace bs
 					if(slot->bitmap.buffer == nullptr && slot->bitmap.rows > 0 && slot->bitmap.width > 0)
 						BS_EXCEPT(InternalErrorException, "Failed to render glyph bitmap");
 
-					UINT8* sourceBuffer = slot->bitmap.buffer;
 					UINT8* dstBuffer = pixelBuffer + (curElement.output.y * pageIter->width * 2) + curElement.output.x * 2;
 
-					if(slot->bitmap.pixel_mode == ft_pixel_mode_grays)
-					{
-						for(INT32 bitmapRow = 0; bitmapRow < slot->bitmap.rows; bitmapRow++)
-						{
-							for(INT32 bitmapColumn = 0; bitmapColumn < slot->bitmap.width; bitmapColumn++)
-							{
-								dstBuffer[bitmapColumn * 2 + 0] = sourceBuffer[bitmapColumn];
-								dstBuffer[bitmapColumn * 2 + 1] = sourceBuffer[bitmapColumn];
-							}
-
-							dstBuffer += pageIter->width * 2;
-							sourceBuffer += slot->bitmap.pitch;
-						}
-					}
-					else if(slot->bitmap.pixel_mode == ft_pixel_mode_mono)
-					{
-						// 8 pixels are packed into a byte, so do some unpacking
-						for(INT32 bitmapRow = 0; bitmapRow < slot->bitmap.rows; bitmapRow++)
-						{
-							for(INT32 bitmapColumn = 0; bitmapColumn < slot->bitmap.width; bitmapColumn++)
-							{
-								UINT8 srcValue = sourceBuffer[bitmapColumn >> 3];
-								UINT8 dstValue = (srcValue & (128 >> (bitmapColumn & 7))) != 0 ? 255 : 0;
-
-								dstBuffer[bitmapColumn * 2 + 0] = dstValue;
-								dstBuffer[bitmapColumn * 2 + 1] = dstValue;
-							}
-
-							dstBuffer += pageIter->width * 2;
-							sourceBuffer += slot->bitmap.pitch;
-						}
-					}
-					else
+					if(!copyFreeTypeBitmap(slot->bitmap, dstBuffer, pageIter->width * 2, 2))
 						BS_EXCEPT(InternalErrorException, "Unsupported pixel mode for a FreeType bitmap.");
 
 					// Store character information
@@ -372,4 +325,28 @@ namespace bs
 
 		return newFont;
 	}
+
+	SPtr<Resource> FontImporter::importDynamic(const Path& filePath, const FontImportOptions& importOptions)
+	{
+		DYNAMIC_FONT_DESC desc;
+		desc.renderMode = importOptions.renderMode;
+		desc.dpi = importOptions.dpi;
+
+		// Font keeps a copy of the entire file, which it then renders the characters from
+		SPtr<Font> newFont;
+		{
+			Lock fileLock = FileScheduler::getLock(filePath);
+
+			SPtr<DataStream> fileStream = FileSystem::openFile(filePath, true);
+			if(fileStream == nullptr)
+				BS_EXCEPT(InternalErrorException, "Failed to load font file: " + filePath.toString() + ".");
+
+			newFont = Font::_createDynamicPtr(fileStream, desc);
+		}
+
+		const String fileName = filePath.getFilename(false);
+		newFont->setName(fileName);
+
+		return newFont;
+	}
 }
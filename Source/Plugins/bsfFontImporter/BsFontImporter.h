@@ -31,6 +31,12 @@ namespace bs
 		/** @copydoc SpecificImporter::createImportOptions */
 		SPtr<ImportOptions> createImportOptions() const override;
 	private:
+		/**
+		 * Creates a dynamic font that keeps the contents of the font file and renders characters on demand, instead of
+		 * pre-rendering them.
+		 */
+		SPtr<Resource> importDynamic(const Path& filePath, const FontImportOptions& importOptions);
+
 		Vector<String> mExtensions;
 
 		const static int MAXIMUM_TEXTURE_SIZE = 2048;
@@ -3,6 +3,8 @@
 #include "BsFontPrerequisites.h"
 #include "Importer/BsImporter.h"
 #include "BsFontImporter.h"
+#include "BsFreeTypeRasterizer.h"
+#include "Text/BsFontManager.h"
 
 namespace bs
 {
@@ -19,6 +21,10 @@ namespace bs
 		FontImporter* importer = bs_new<FontImporter>();
 		Importer::instance()._registerAssetImporter(importer);
 
+		// Allows fonts imported as dynamic to rasterize their characters at runtime
+		if(FontManager::isStarted())
+			FontManager::instance().registerRasterizerFactory(bs_shared_ptr_new<FreeTypeRasterizerFactory>());
+
 		return nullptr;
 	}
 }
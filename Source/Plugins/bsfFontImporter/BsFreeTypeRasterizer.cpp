@@ -0,0 +1,202 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsFreeTypeRasterizer.h"
+#include "FileSystem/BsDataStream.h"
+
+namespace bs
+{
+	FT_Int32 getFreeTypeLoadFlags(FontRenderMode renderMode)
+	{
+		switch (renderMode)
+		{
+		case FontRenderMode::Smooth:
+			return FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
+		case FontRenderMode::Raster:
+			return FT_LOAD_TARGET_MONO | FT_LOAD_NO_HINTING;
+		case FontRenderMode::HintedSmooth:
+			return FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_AUTOHINT;
+		case FontRenderMode::HintedRaster:
+			return FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
+		default:
+			return FT_LOAD_TARGET_NORMAL;
+		}
+	}
+
+	bool copyFreeTypeBitmap(const FT_Bitmap& bitmap, UINT8* dst, UINT32 dstRowPitch, UINT32 dstNumChannels)
+	{
+		const UINT8* sourceBuffer = bitmap.buffer;
+
+		if(bitmap.pixel_mode == ft_pixel_mode_grays)
+		{
+			for(INT32 bitmapRow = 0; bitmapRow < (INT32)bitmap.rows; bitmapRow++)
+			{
+				for(INT32 bitmapColumn = 0; bitmapColumn < (INT32)bitmap.width; bitmapColumn++)
+				{
+					for(UINT32 channel = 0; channel < dstNumChannels; channel++)
+						dst[bitmapColumn * dstNumChannels + channel] = sourceBuffer[bitmapColumn];
+				}
+
+				dst += dstRowPitch;
+				sourceBuffer += bitmap.pitch;
+			}
+		}
+		else if(bitmap.pixel_mode == ft_pixel_mode_mono)
+		{
+			// 8 pixels are packed into a byte, so do some unpacking
+			for(INT32 bitmapRow = 0; bitmapRow < (INT32)bitmap.rows; bitmapRow++)
+			{
+				for(INT32 bitmapColumn = 0; bitmapColumn < (INT32)bitmap.width; bitmapColumn++)
+				{
+					UINT8 srcValue = sourceBuffer[bitmapColumn >> 3];
+					UINT8 dstValue = (srcValue & (128 >> (bitmapColumn & 7))) != 0 ? 255 : 0;
+
+					for(UINT32 channel = 0; channel < dstNumChannels; channel++)
+						dst[bitmapColumn * dstNumChannels + channel] = dstValue;
+				}
+
+				dst += dstRowPitch;
+				sourceBuffer += bitmap.pitch;
+			}
+		}
+		else
+			return false;
+
+		return true;
+	}
+
+	FreeTypeRasterizer::FreeTypeRasterizer(const SPtr<MemoryDataStream>& fontData, const DYNAMIC_FONT_DESC& desc)
+		:mFontData(fontData), mLoadFlags(getFreeTypeLoadFlags(desc.renderMode)), mDPI(desc.dpi)
+	{
+		if(FT_Init_FreeType(&mLibrary))
+		{
+			mLibrary = nullptr;
+			return;
+		}
+
+		if(FT_New_Memory_Face(mLibrary, (const FT_Byte*)mFontData->data(), (FT_Long)mFontData->size(), 0, &mFace))
+			mFace = nullptr;
+	}
+
+	FreeTypeRasterizer::~FreeTypeRasterizer()
+	{
+		if(mFace != nullptr)
+			FT_Done_Face(mFace);
+
+		if(mLibrary != nullptr)
+			FT_Done_FreeType(mLibrary);
+	}
+
+	bool FreeTypeRasterizer::setSize(UINT32 size)
+	{
+		if(size == mActiveSize)
+			return true;
+
+		FT_F26Dot6 ftSize = (FT_F26Dot6)(size * (1 << 6));
+		if(size == 0 || FT_Set_Char_Size(mFace, ftSize, 0, mDPI, mDPI))
+			return false;
+
+		mActiveSize = size;
+		return true;
+	}
+
+	bool FreeTypeRasterizer::getSizeMetrics(UINT32 size, FontSizeMetrics& output)
+	{
+		if(!setSize(size))
+			return false;
+
+		const FT_Size_Metrics& metrics = mFace->size->metrics;
+		output.baselineOffset = (INT32)((metrics.ascender + 63) >> 6);
+		output.lineHeight = (UINT32)((metrics.ascender - metrics.descender + 63) >> 6);
+		output.spaceWidth = 0;
+
+		if(FT_Load_Char(mFace, 32, mLoadFlags) == 0)
+			output.spaceWidth = (UINT32)(mFace->glyph->advance.x >> 6);
+
+		return true;
+	}
+
+	bool FreeTypeRasterizer::rasterize(UINT32 charId, UINT32 size, RasterizedGlyph& output)
+	{
+		if(!setSize(size))
+			return false;
+
+		FT_UInt glyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)charId);
+		if(glyphIdx == 0)
+			return false;
+
+		return renderGlyph(glyphIdx, charId, output);
+	}
+
+	bool FreeTypeRasterizer::rasterizeMissingGlyph(UINT32 size, RasterizedGlyph& output)
+	{
+		if(!setSize(size))
+			return false;
+
+		return renderGlyph(0, 0, output);
+	}
+
+	INT32 FreeTypeRasterizer::getKerning(UINT32 left, UINT32 right, UINT32 size)
+	{
+		if(!FT_HAS_KERNING(mFace) || !setSize(size))
+			return 0;
+
+		FT_Vector kerning;
+		if(FT_Get_Kerning(mFace, FT_Get_Char_Index(mFace, left), FT_Get_Char_Index(mFace, right), FT_KERNING_DEFAULT,
+			&kerning))
+		{
+			return 0;
+		}
+
+		return (INT32)(kerning.x >> 6); // Y kerning is ignored because it is so rare
+	}
+
+	bool FreeTypeRasterizer::renderGlyph(FT_UInt glyphIdx, UINT32 charId, RasterizedGlyph& output)
+	{
+		if(FT_Load_Glyph(mFace, glyphIdx, mLoadFlags))
+			return false;
+
+		FT_GlyphSlot slot = mFace->glyph;
+		if(FT_Render_Glyph(slot, (FT_Render_Mode)FT_LOAD_TARGET_MODE(mLoadFlags)))
+			return false;
+
+		const UINT32 width = (UINT32)slot->bitmap.width;
+		const UINT32 height = (UINT32)slot->bitmap.rows;
+
+		if(slot->bitmap.buffer == nullptr && width > 0 && height > 0)
+			return false;
+
+		output.pixels.resize(width * height);
+		if(width > 0 && height > 0)
+		{
+			if(!copyFreeTypeBitmap(slot->bitmap, output.pixels.data(), width, 1))
+				return false;
+		}
+
+		CharDesc& desc = output.desc;
+		desc.charId = charId;
+		desc.page = 0;
+		desc.uvX = 0.0f;
+		desc.uvY = 0.0f;
+		desc.uvWidth = 0.0f;
+		desc.uvHeight = 0.0f;
+		desc.width = width;
+		desc.height = height;
+		desc.xOffset = slot->bitmap_left;
+		desc.yOffset = slot->bitmap_top;
+		desc.xAdvance = (INT32)(slot->advance.x >> 6);
+		desc.yAdvance = (INT32)(slot->advance.y >> 6);
+		desc.kerningPairs.clear();
+
+		return true;
+	}
+
+	SPtr<GlyphRasterizer> FreeTypeRasterizerFactory::create(const SPtr<MemoryDataStream>& fontData,
+		const DYNAMIC_FONT_DESC& desc)
+	{
+		SPtr<FreeTypeRasterizer> rasterizer = bs_shared_ptr_new<FreeTypeRasterizer>(fontData, desc);
+		if(!rasterizer->isValid())
+			return nullptr;
+
+		return rasterizer;
+	}
+}
@@ -0,0 +1,79 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsFontPrerequisites.h"
+#include "Text/BsGlyphRasterizer.h"
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+namespace bs
+{
+	/** @addtogroup Font
+	 *  @{
+	 */
+
+	/** Returns FreeType glyph load flags corresponding to the provided render mode. */
+	FT_Int32 getFreeTypeLoadFlags(FontRenderMode renderMode);
+
+	/**
+	 * Copies a rendered FreeType glyph bitmap into a buffer with 8-bit coverage values.
+	 *
+	 * @param[in]	bitmap			Rendered glyph bitmap, either in the 8-bit grayscale or the 1-bit monochrome format.
+	 * @param[out]	dst				Buffer to write the coverage values to.
+	 * @param[in]	dstRowPitch		Number of bytes between two rows in the destination buffer.
+	 * @param[in]	dstNumChannels	Number of bytes per pixel in the destination buffer. The coverage value is written
+	 *								to all of them.
+	 * @return						False if the bitmap is in an unsupported format.
+	 */
+	bool copyFreeTypeBitmap(const FT_Bitmap& bitmap, UINT8* dst, UINT32 dstRowPitch, UINT32 dstNumChannels);
+
+	/** Glyph rasterizer for dynamic fonts, using the FreeType library. */
+	class FreeTypeRasterizer : public GlyphRasterizer
+	{
+	public:
+		FreeTypeRasterizer(const SPtr<MemoryDataStream>& fontData, const DYNAMIC_FONT_DESC& desc);
+		~FreeTypeRasterizer();
+
+		/** Checks if the font data was successfully loaded. */
+		bool isValid() const { return mFace != nullptr; }
+
+		/** @copydoc GlyphRasterizer::getSizeMetrics */
+		bool getSizeMetrics(UINT32 size, FontSizeMetrics& output) override;
+
+		/** @copydoc GlyphRasterizer::rasterize */
+		bool rasterize(UINT32 charId, UINT32 size, RasterizedGlyph& output) override;
+
+		/** @copydoc GlyphRasterizer::rasterizeMissingGlyph */
+		bool rasterizeMissingGlyph(UINT32 size, RasterizedGlyph& output) override;
+
+		/** @copydoc GlyphRasterizer::getKerning */
+		INT32 getKerning(UINT32 left, UINT32 right, UINT32 size) override;
+
+	private:
+		/** Makes the provided size active on the font face, if it isn't already. */
+		bool setSize(UINT32 size);
+
+		/** Renders the glyph with the specified FreeType glyph index into the output. */
+		bool renderGlyph(FT_UInt glyphIdx, UINT32 charId, RasterizedGlyph& output);
+
+		SPtr<MemoryDataStream> mFontData; // Must outlive the face
+		FT_Library mLibrary = nullptr;
+		FT_Face mFace = nullptr;
+
+		FT_Int32 mLoadFlags;
+		UINT32 mDPI;
+		UINT32 mActiveSize = 0;
+	};
+
+	/** Creates FreeTypeRasterizer instances for any font format supported by FreeType. */
+	class FreeTypeRasterizerFactory : public GlyphRasterizerFactory
+	{
+	public:
+		/** @copydoc GlyphRasterizerFactory::create */
+		SPtr<GlyphRasterizer> create(const SPtr<MemoryDataStream>& fontData, const DYNAMIC_FONT_DESC& desc) override;
+	};
+
+	/** @} */
+}
@@ -1,6 +1,7 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsNullBuffers.h"
+#include "Profiling/BsRenderStats.h"
 
 namespace bs { namespace ct
 {
@@ -82,12 +83,20 @@ namespace bs { namespace ct
 	{
 		mBuffer = bs_pool_new<NullHardwareBuffer>(mUsage, 1, mSize);
 		GpuParamBlockBuffer::initialize();
+
+		BS_INC_RENDER_STAT(NumParamBuffersCreated);
 	}
 
 	NullHardwareBuffer::NullHardwareBuffer(GpuBufferUsage usage, UINT32 elementCount, UINT32 elementSize)
 		: HardwareBuffer(elementCount * elementSize, usage, GDF_DEFAULT)
 	{ }
 
+	void NullHardwareBuffer::writeData(UINT32 offset, UINT32 length, const void* source, BufferWriteType writeFlags,
+		UINT32 queueIdx)
+	{
+		BS_ADD_RENDER_STAT(NumBufferBytesWritten, length);
+	}
+
 	void* NullHardwareBuffer::map(UINT32 offset, UINT32 length, GpuLockOptions options, UINT32 deviceIdx, UINT32 queueIdx)
 	{
 		assert(mStagingBuffer == nullptr);
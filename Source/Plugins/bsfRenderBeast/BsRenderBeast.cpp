@@ -12,6 +12,7 @@
 #include "RenderAPI/BsGpuParamBlockBuffer.h"
 #include "Profiling/BsProfilerCPU.h"
 #include "Profiling/BsProfilerGPU.h"
+#include "Allocators/BsMemoryTracker.h"
 #include "Utility/BsTime.h"
 #include "Animation/BsAnimationManager.h"
 #include "Animation/BsSkeleton.h"
@@ -368,6 +369,8 @@ namespace bs { namespace ct
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
+		MemoryTagScope memoryTag(MemoryTag::Renderer);
+
 		gProfilerGPU().beginFrame();
 		gProfilerCPU().beginSample("Render");
 
@@ -385,8 +388,8 @@ namespace bs { namespace ct
 		if(perFrameData.particles)
 			PROFILE_CALL(mScene->updateParticleSystemBounds(perFrameData.particles), "Particle bounds")
 
-		sceneInfo.renderableReady.resize(sceneInfo.renderables.size(), false);
-		sceneInfo.renderableReady.assign(sceneInfo.renderables.size(), false);
+		sceneInfo.renderablePreparedLODs.resize(sceneInfo.renderables.size(), 0);
+		sceneInfo.renderablePreparedLODs.assign(sceneInfo.renderables.size(), 0);
 		
 		FrameInfo frameInfo(timings, perFrameData);
 
@@ -396,13 +399,10 @@ namespace bs { namespace ct
 		// If any reflection probes were updated or added, we need to copy them over in the global reflection probe array
 		updateReflProbeArray();
 
-		// Update material parameters & animation times for all renderables
+		// Update material animation times for all renderables. Times are applied to the elements of the levels of detail
+		// being rendered when the renderable is prepared.
 		for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
-		{
-			RendererRenderable* renderable = sceneInfo.renderables[i];
-			for (auto& element : renderable->elements)
-				element.materialAnimationTime += timings.timeDelta;
-		}
+			sceneInfo.renderables[i]->materialAnimationTime += timings.timeDelta;
 
 		for (UINT32 i = 0; i < sceneInfo.particleSystems.size(); i++)
 			mScene->prepareParticleSystem(i, frameInfo);
@@ -463,7 +463,7 @@ namespace bs { namespace ct
 			if (!visibility.renderables[i])
 				continue;
 
-			mScene->prepareRenderable(i, frameInfo);
+			mScene->prepareRenderable(i, frameInfo, visibility.renderableLODs[i]);
 		}
 
 		UINT32 numViews = viewGroup.getNumViews();
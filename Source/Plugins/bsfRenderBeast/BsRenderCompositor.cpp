@@ -32,17 +32,85 @@ namespace bs { namespace ct
 {
 	UnorderedMap<StringID, RenderCompositor::NodeType*> RenderCompositor::mNodeTypes;
 
-	/** Renders all elements in a render queue. */
-	void renderQueueElements(const Vector<RenderQueueElement>& elements)
+	/** Returns the renderable element referenced by the queue entry, if it uses the instanced shader variation. */
+	const RenderableElement* getInstancedElement(const RenderQueueElement& entry)
 	{
-		for(auto& entry : elements)
+		if (entry.renderElem->type != (UINT32)RenderElementType::Renderable)
+			return nullptr;
+
+		const auto* element = static_cast<const RenderableElement*>(entry.renderElem);
+		return element->instanced ? element : nullptr;
+	}
+
+	/** Checks can two instanced queue entries be rendered using the same instanced draw call. */
+	bool canShareInstancedDraw(const RenderQueueElement& entryA, const RenderableElement& elementA,
+		const RenderQueueElement& entryB, const RenderableElement& elementB)
+	{
+		return !entryB.applyPass &&
+			entryA.passIdx == entryB.passIdx &&
+			entryA.techniqueIdx == entryB.techniqueIdx &&
+			elementA.material == elementB.material &&
+			elementA.mesh == elementB.mesh &&
+			elementA.subMesh.indexOffset == elementB.subMesh.indexOffset &&
+			elementA.subMesh.indexCount == elementB.subMesh.indexCount &&
+			elementA.subMesh.drawOp == elementB.subMesh.drawOp &&
+			elementA.materialAnimationTime == elementB.materialAnimationTime;
+	}
+
+	/**
+	 * Renders all elements in a render queue. If @p instanceBuffers is provided, consecutive elements using the instanced
+	 * shader variation and sharing the same mesh and material are rendered using a single instanced draw call. Must be
+	 * provided if the queue contains any instanced elements.
+	 */
+	void renderQueueElements(const Vector<RenderQueueElement>& elements, InstanceBufferPool* instanceBuffers = nullptr)
+	{
+		const auto numElements = (UINT32)elements.size();
+		for(UINT32 i = 0; i < numElements;)
 		{
+			const RenderQueueElement& entry = elements[i];
 			if (entry.applyPass)
 				gRendererUtility().setPass(entry.renderElem->material, entry.passIdx, entry.techniqueIdx);
 
+			const RenderableElement* instancedElement = instanceBuffers ? getInstancedElement(entry) : nullptr;
+			if(instancedElement)
+			{
+				// Extend the batch over all following elements that can be rendered using the same draw call
+				UINT32 numInstances = 1;
+				while(numInstances < MAX_INSTANCES_PER_DRAW && (i + numInstances) < numElements)
+				{
+					const RenderQueueElement& otherEntry = elements[i + numInstances];
+					const RenderableElement* otherElement = getInstancedElement(otherEntry);
+
+					if(!otherElement || !canShareInstancedDraw(entry, *instancedElement, otherEntry, *otherElement))
+						break;
+
+					numInstances++;
+				}
+
+				SPtr<GpuBuffer> instanceBuffer = instanceBuffers->alloc();
+				auto* instanceData = (PerInstanceData*)instanceBuffer->lock(0,
+					numInstances * sizeof(PerInstanceData), GBL_WRITE_ONLY_DISCARD);
+
+				for(UINT32 j = 0; j < numInstances; j++)
+				{
+					const auto* element = static_cast<const RenderableElement*>(elements[i + j].renderElem);
+					instanceData[j] = *element->instanceData;
+				}
+
+				instanceBuffer->unlock();
+				instancedElement->instanceDataParam.set(instanceBuffer);
+
+				gRendererUtility().setPassParams(entry.renderElem->params, entry.passIdx);
+				gRendererUtility().draw(instancedElement->mesh, instancedElement->subMesh, numInstances);
+
+				i += numInstances;
+				continue;
+			}
+
 			gRendererUtility().setPassParams(entry.renderElem->params, entry.passIdx);
 
 			entry.renderElem->draw();
+			i++;
 		}
 	}
 
@@ -320,8 +388,12 @@ namespace bs { namespace ct
 			RendererRenderable* rendererRenderable = inputs.scene.renderables[i];
 			rendererRenderable->updatePerCallBuffer(viewProps.viewProjTransform);
 
-			for (auto& element : inputs.scene.renderables[i]->elements)
+			const UINT32 lodIdx = inputs.view.getRenderableLOD(i);
+			for (auto& element : rendererRenderable->elements)
 			{
+				if (element.lodIdx != lodIdx)
+					continue;
+
 				SPtr<GpuParams> gpuParams = element.params->getGpuParams();
 				for(UINT32 j = 0; j < GPT_COUNT; j++)
 				{
@@ -422,8 +494,13 @@ namespace bs { namespace ct
 		}
 
 		// Render all visible opaque elements that use the deferred pipeline
+		if(!mInstanceBuffers)
+			mInstanceBuffers = bs_shared_ptr_new<InstanceBufferPool>();
+
+		mInstanceBuffers->reset();
+
 		const Vector<RenderQueueElement>& opaqueElements = inputs.view.getOpaqueQueue(false)->getSortedElements();
-		renderQueueElements(opaqueElements);
+		renderQueueElements(opaqueElements, mInstanceBuffers.get());
 
 		// Determine MSAA coverage if required
 		if (viewProps.target.numSamples > 1)
@@ -1269,10 +1346,9 @@ namespace bs { namespace ct
 		}
 		else
 		{
-			// Note: Store these instead of creating them every time?
-			standardForwardBuffers.lightsParamBlock = gLightsParamDef.createBuffer();
-			standardForwardBuffers.reflProbesParamBlock = gReflProbesParamDef.createBuffer();
-			standardForwardBuffers.lightAndReflProbeParamsParamBlock = gLightAndReflProbeParamsParamDef.createBuffer();
+			standardForwardBuffers.lightsParamBlock = gLightsParamDef.getFrameBuffer();
+			standardForwardBuffers.reflProbesParamBlock = gReflProbesParamDef.getFrameBuffer();
+			standardForwardBuffers.lightAndReflProbeParamsParamBlock = gLightAndReflProbeParamsParamDef.getFrameBuffer();
 		}
 
 		Skybox* skybox = nullptr;
@@ -1422,8 +1498,12 @@ namespace bs { namespace ct
 			if (!visibility.renderables[i])
 				continue;
 
+			const UINT32 lodIdx = inputs.view.getRenderableLOD(i);
 			for (auto& element : sceneInfo.renderables[i]->elements)
 			{
+				if (element.lodIdx != lodIdx)
+					continue;
+
 				ShaderFlags shaderFlags = element.material->getShader()->getFlags();
 
 				const bool useForwardRendering = shaderFlags.isSet(ShaderFlag::Forward) || shaderFlags.isSet(ShaderFlag::Transparent);
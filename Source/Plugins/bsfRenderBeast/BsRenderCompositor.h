@@ -16,6 +16,7 @@ namespace ct
 	struct PooledStorageBuffer;
 	struct FrameInfo;
 	class RCNodeLightAccumulation;
+	class InstanceBufferPool;
 
 	/** @addtogroup RenderBeast
 	 *  @{
@@ -224,6 +225,8 @@ namespace ct
 
 		/** @copydoc RenderCompositorNode::clear */
 		void clear() override;
+
+		SPtr<InstanceBufferPool> mInstanceBuffers;
 	};
 
 	/** Initializes the scene color texture and/or buffer. Does not perform any rendering. */
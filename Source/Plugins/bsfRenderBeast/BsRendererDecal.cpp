@@ -17,9 +17,9 @@ namespace bs { namespace ct
 
 	RendererDecal::RendererDecal()
 	{
-		decalParamBuffer = gDecalParamDef.createBuffer();
-		perObjectParamBuffer = gPerObjectParamDef.createBuffer();
-		perCallParamBuffer = gPerCallParamDef.createBuffer();
+		decalParamBuffer = gDecalParamDef.allocBuffer();
+		perObjectParamBuffer = gPerObjectParamDef.allocBuffer();
+		perCallParamBuffer = gPerCallParamDef.allocBuffer();
 	}
 
 	void RendererDecal::updatePerObjectBuffer()
@@ -4,6 +4,7 @@
 #include "Renderer/BsRendererUtility.h"
 #include "Mesh/BsMesh.h"
 #include "Utility/BsBitwise.h"
+#include "RenderAPI/BsGpuBuffer.h"
 
 namespace bs { namespace ct
 {
@@ -21,6 +22,24 @@ namespace bs { namespace ct
 		gPerObjectParamDef.gLayer.set(buffer, (INT32)layer);
 	}
 
+	SPtr<GpuBuffer> InstanceBufferPool::alloc()
+	{
+		if(mNextFree < (UINT32)mBuffers.size())
+			return mBuffers[mNextFree++];
+
+		GPU_BUFFER_DESC bufferDesc;
+		bufferDesc.type = GBT_STRUCTURED;
+		bufferDesc.elementCount = MAX_INSTANCES_PER_DRAW;
+		bufferDesc.elementSize = sizeof(PerInstanceData);
+		bufferDesc.format = BF_UNKNOWN;
+		bufferDesc.usage = GBU_DYNAMIC;
+
+		mBuffers.push_back(GpuBuffer::create(bufferDesc));
+		mNextFree++;
+
+		return mBuffers.back();
+	}
+
 	void RenderableElement::draw() const
 	{
 		if (morphVertexDeclaration == nullptr)
@@ -31,17 +50,33 @@ namespace bs { namespace ct
 
 	RendererRenderable::RendererRenderable()
 	{
-		perObjectParamBuffer = gPerObjectParamDef.createBuffer();
-		perCallParamBuffer = gPerCallParamDef.createBuffer();
+		perObjectParamBuffer = gPerObjectParamDef.allocBuffer();
+		perCallParamBuffer = gPerCallParamDef.allocBuffer();
+	}
+
+	RendererRenderable::~RendererRenderable()
+	{
+		ParamBlock::releaseBuffer(perObjectParamBuffer);
+		ParamBlock::releaseBuffer(perCallParamBuffer);
 	}
 
 	void RendererRenderable::updatePerObjectBuffer()
 	{
+		static UINT64 sNextVersion = 0;
+		version = ++sNextVersion;
+
 		const Matrix4 worldTransform = renderable->getMatrix();
 		const Matrix4 worldNoScaleTransform = renderable->getMatrixNoScale();
 		const UINT32 layer = Bitwise::mostSignificantBit(renderable->getLayer());
 
 		PerObjectBuffer::update(perObjectParamBuffer, worldTransform, worldNoScaleTransform, layer);
+
+		instanceData.worldTfrm = worldTransform;
+		instanceData.invWorldTfrm = worldTransform.inverseAffine();
+		instanceData.worldNoScaleTfrm = worldNoScaleTransform;
+		instanceData.invWorldNoScaleTfrm = worldNoScaleTransform.inverseAffine();
+		instanceData.worldDeterminantSign = worldTransform.determinant3x3() >= 0.0f ? 1.0f : -1.0f;
+		instanceData.layer = layer;
 	}
 
 	void RendererRenderable::updatePerCallBuffer(const Matrix4& viewProj, bool flush)
@@ -42,6 +42,42 @@ namespace bs { namespace ct
 			UINT32 layer);
 	};
 
+	/** Per-object data for a single instance rendered using GPU instancing. Mirrors the layout of PerObjectParamDef. */
+	struct PerInstanceData
+	{
+		Matrix4 worldTfrm;
+		Matrix4 invWorldTfrm;
+		Matrix4 worldNoScaleTfrm;
+		Matrix4 invWorldNoScaleTfrm;
+		float worldDeterminantSign;
+		UINT32 layer;
+		Vector2 padding;
+	};
+
+	/** Maximum number of instances that can be rendered using a single instanced draw call. */
+	static constexpr UINT32 MAX_INSTANCES_PER_DRAW = 256;
+
+	/** Maximum number of levels of detail a renderable can be split into. */
+	static constexpr UINT32 MAX_RENDERABLE_LODS = 32;
+
+	/**
+	 * Provides GPU buffers for holding per-instance data of instanced draw calls. Buffers are allocated on demand and
+	 * recycled once the pool is reset.
+	 */
+	class InstanceBufferPool
+	{
+	public:
+		/** Returns a buffer able to hold MAX_INSTANCES_PER_DRAW entries. The buffer stays reserved until reset() is called. */
+		SPtr<GpuBuffer> alloc();
+
+		/** Makes all previously allocated buffers available for re-use. */
+		void reset() { mNextFree = 0; }
+
+	private:
+		Vector<SPtr<GpuBuffer>> mBuffers;
+		UINT32 mNextFree = 0;
+	};
+
 	struct MaterialSamplerOverrides;
 
 	/**
@@ -57,6 +93,9 @@ namespace bs { namespace ct
 		 */
 		MaterialSamplerOverrides* samplerOverrides;
 
+		/** Version of the sampler state overrides last applied to the element's parameters. */
+		UINT32 samplerOverridesVersion = 0;
+
 		/** Identifier of the animation running on the renderable's mesh. -1 if no animation. */
 		UINT64 animationId;
 
@@ -81,12 +120,31 @@ namespace bs { namespace ct
 		/** Vertex declaration used for rendering meshes containing morph shape information. */
 		SPtr<VertexDeclaration> morphVertexDeclaration;
 
-		/** Time to used for evaluating material animation. */
+		/** Level of detail the element belongs to. Only elements matching the LOD selected for the view are rendered. */
+		UINT32 lodIdx = 0;
+
+		/**
+		 * Time to used for evaluating material animation. Copied from RendererRenderable::materialAnimationTime when the
+		 * element's level of detail is prepared for rendering.
+		 */
 		float materialAnimationTime = 0.0f;
 
 		/** Version of the morph shape vertices in the buffer. */
 		mutable UINT32 morphShapeVersion;
 
+		/**
+		 * True if the element uses the instanced shader variation. Such elements read their per-object data from
+		 * a per-instance buffer, allowing consecutive elements sharing the same mesh and material to be rendered with a
+		 * single draw call.
+		 */
+		bool instanced = false;
+
+		/** Parameter the per-instance data buffer is bound to. Only valid for instanced elements. */
+		GpuParamBuffer instanceDataParam;
+
+		/** Per-object data of the parent renderable, as stored in the per-instance data buffer. */
+		const PerInstanceData* instanceData = nullptr;
+
 		/** @copydoc RenderElement::draw */
 		void draw() const override;
 	};
@@ -95,6 +153,7 @@ namespace bs { namespace ct
 	struct RendererRenderable
 	{
 		RendererRenderable();
+		~RendererRenderable();
 
 		/** Updates the per-object GPU buffer according to the currently set properties. */
 		void updatePerObjectBuffer();
@@ -110,6 +169,21 @@ namespace bs { namespace ct
 		Renderable* renderable;
 		Vector<RenderableElement> elements;
 
+		/** Number of levels of detail the elements are split into. See RenderableElement::lodIdx. */
+		UINT32 numLODs = 1;
+
+		/** Time used for evaluating material animation of all the elements. */
+		float materialAnimationTime = 0.0f;
+
+		/** Per-object data used when the renderable's elements are rendered using GPU instancing. */
+		PerInstanceData instanceData;
+
+		/**
+		 * Value unique across all renderables, assigned whenever the per-object buffer is updated (i.e. on registration
+		 * and whenever the transform or bounds change). Allows data derived from the renderable to be cached.
+		 */
+		UINT64 version = 0;
+
 		SPtr<GpuParamBlockBuffer> perObjectParamBuffer;
 		SPtr<GpuParamBlockBuffer> perCallParamBuffer;
 	};
@@ -240,15 +240,31 @@ namespace bs {	namespace ct
 		renderable->setRendererId(renderableId);
 
 		mInfo.renderables.push_back(bs_new<RendererRenderable>());
-		mInfo.renderableCullInfos.push_back(CullInfo(renderable->getBounds(), renderable->getLayer(), renderable->getCullDistanceFactor()));
+		bool isStatic = renderable->getMobility() == ObjectMobility::Static;
+		mInfo.renderableCullInfos.push_back(CullInfo(renderable->getBounds(), renderable->getLayer(),
+			renderable->getCullDistanceFactor(), isStatic));
+
+		if (isStatic)
+			mInfo.renderableCullVersion++;
 
 		RendererRenderable* rendererRenderable = mInfo.renderables.back();
 		rendererRenderable->renderable = renderable;
 		rendererRenderable->updatePerObjectBuffer();
 
-		SPtr<Mesh> mesh = renderable->getMesh();
-		if (mesh != nullptr)
+		// Level 0 uses the primary mesh, followed by any lower detail meshes. Levels must be contiguous, so stop at the
+		// first one that is missing its mesh or screen size.
+		const Vector<SPtr<Mesh>>& lodMeshes = renderable->getLODMeshes();
+		const auto numLODs = (UINT32)std::min({ lodMeshes.size(), renderable->getLODScreenSizes().size(),
+			(size_t)MAX_RENDERABLE_LODS - 1 }) + 1;
+
+		for (UINT32 lodIdx = 0; lodIdx < numLODs; lodIdx++)
 		{
+			SPtr<Mesh> mesh = lodIdx == 0 ? renderable->getMesh() : lodMeshes[lodIdx - 1];
+			if (mesh == nullptr)
+				break;
+
+			rendererRenderable->numLODs = lodIdx + 1;
+
 			const MeshProperties& meshProps = mesh->getProperties();
 			SPtr<VertexDeclaration> vertexDecl = mesh->getVertexData()->vertexDeclaration;
 
@@ -258,6 +274,7 @@ namespace bs {	namespace ct
 				RenderableElement& renElement = rendererRenderable->elements.back();
 
 				renElement.type = (UINT32)RenderElementType::Renderable;
+				renElement.lodIdx = lodIdx;
 				renElement.mesh = mesh;
 				renElement.subMesh = meshProps.getSubMesh(i);
 				renElement.animType = renderable->getAnimType();
@@ -314,13 +331,45 @@ namespace bs {	namespace ct
 					VAR_LOOKUP[3] = &getVertexInputVariation<true, true>();
 				}
 
-				const ShaderVariation* variation = VAR_LOOKUP[(int)animType];
+				UINT32 techniqueIdx = (UINT32)-1;
 
-				FIND_TECHNIQUE_DESC findDesc;
-				findDesc.variation = variation;
-				findDesc.override = true;
+				// Non-animated elements using the deferred pipeline can be rendered using GPU instancing, if the shader
+				// supports it. Instancing requires structured buffer support, which the macOS feature set lacks.
+				const bool supportsInstancing = gRenderBeast()->getFeatureSet() != RenderBeastFeatureSet::DesktopMacOS;
+				if(supportsInstancing && !useForwardRendering && animType == RenderableAnimType::None)
+				{
+					FIND_TECHNIQUE_DESC findDesc;
+					findDesc.variation = &getInstancedVertexInputVariation();
+					findDesc.override = true;
 
-				UINT32 techniqueIdx = renElement.material->findTechnique(findDesc);
+					techniqueIdx = renElement.material->findTechnique(findDesc);
+
+					// Shaders without the instanced variation will match some other technique
+					if (techniqueIdx != (UINT32)-1)
+					{
+						const ShaderVariation& techniqueVariation =
+							renElement.material->getTechnique(techniqueIdx)->getVariation();
+
+						const auto& variationParams = techniqueVariation.getParams();
+						const auto iterFind = variationParams.find("INSTANCED");
+
+						if (iterFind != variationParams.end() && iterFind->second.i != 0)
+							renElement.instanced = true;
+						else
+							techniqueIdx = (UINT32)-1;
+					}
+				}
+
+				if(techniqueIdx == (UINT32)-1)
+				{
+					const ShaderVariation* variation = VAR_LOOKUP[(int)animType];
+
+					FIND_TECHNIQUE_DESC findDesc;
+					findDesc.variation = variation;
+					findDesc.override = true;
+
+					techniqueIdx = renElement.material->findTechnique(findDesc);
+				}
 
 				if (techniqueIdx == (UINT32)-1)
 					techniqueIdx = renElement.material->getDefaultTechnique();
@@ -412,6 +461,14 @@ namespace bs {	namespace ct
 			if (gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "boneMatrices"))
 				gpuParams->setBuffer(GPT_VERTEX_PROGRAM, "boneMatrices", element.boneMatrixBuffer);
 
+			if (element.instanced)
+			{
+				if (gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "gPerInstanceData"))
+					gpuParams->getBufferParam(GPT_VERTEX_PROGRAM, "gPerInstanceData", element.instanceDataParam);
+
+				element.instanceData = &rendererRenderable->instanceData;
+			}
+
 			ShaderFlags shaderFlags = shader->getFlags();
 			const bool useForwardRendering = shaderFlags.isSet(ShaderFlag::Forward) || shaderFlags.isSet(ShaderFlag::Transparent);
 
@@ -433,6 +490,9 @@ namespace bs {	namespace ct
 		mInfo.renderables[renderableId]->updatePerObjectBuffer();
 		mInfo.renderableCullInfos[renderableId].bounds = renderable->getBounds();
 		mInfo.renderableCullInfos[renderableId].cullDistanceFactor = renderable->getCullDistanceFactor();
+
+		if (mInfo.renderableCullInfos[renderableId].isStatic)
+			mInfo.renderableCullVersion++;
 	}
 
 	void RendererScene::unregisterRenderable(Renderable* renderable)
@@ -461,6 +521,7 @@ namespace bs {	namespace ct
 		// Last element is the one we want to erase
 		mInfo.renderables.erase(mInfo.renderables.end() - 1);
 		mInfo.renderableCullInfos.erase(mInfo.renderableCullInfos.end() - 1);
+		mInfo.renderableCullVersion++;
 
 		bs_delete(rendererRenderable);
 	}
@@ -622,8 +683,11 @@ namespace bs {	namespace ct
 			return;
 		}
 
-		SPtr<GpuParamBlockBuffer> perObjectParamBuffer = gPerObjectParamDef.createBuffer();
-		SPtr<GpuParamBlockBuffer> particlesParamBuffer = gParticlesParamDef.createBuffer();
+		ParamBlock::releaseBuffer(rendererParticles.perObjectParamBuffer);
+		ParamBlock::releaseBuffer(rendererParticles.particlesParamBuffer);
+
+		SPtr<GpuParamBlockBuffer> perObjectParamBuffer = gPerObjectParamDef.allocBuffer();
+		SPtr<GpuParamBlockBuffer> particlesParamBuffer = gParticlesParamDef.allocBuffer();
 		PerObjectBuffer::update(perObjectParamBuffer, rendererParticles.localToWorld, localToWorldNoScale, layer);
 
 		Vector3 axisForward = settings.orientationPlaneNormal;
@@ -905,6 +969,11 @@ namespace bs {	namespace ct
 			rendererParticles.gpuParticleSystem = nullptr;
 		}
 
+		ParamBlock::releaseBuffer(rendererParticles.perObjectParamBuffer);
+		ParamBlock::releaseBuffer(rendererParticles.particlesParamBuffer);
+		rendererParticles.perObjectParamBuffer = nullptr;
+		rendererParticles.particlesParamBuffer = nullptr;
+
 		ParticleSystem* lastSystem = mInfo.particleSystems.back().particleSystem;
 		const UINT32 lastRendererId = lastSystem->getRendererId();
 
@@ -1022,6 +1091,10 @@ namespace bs {	namespace ct
 		freeSamplerStateOverrides(renElement);
 		renElement.samplerOverrides = nullptr;
 
+		ParamBlock::releaseBuffer(rendererDecal.decalParamBuffer);
+		ParamBlock::releaseBuffer(rendererDecal.perObjectParamBuffer);
+		ParamBlock::releaseBuffer(rendererDecal.perCallParamBuffer);
+
 		if (rendererId != lastDecalId)
 		{
 			// Swap current last element with the one we want to erase
@@ -1222,47 +1295,15 @@ namespace bs {	namespace ct
 		if (!anyDirty)
 			return;
 
-		UINT32 numRenderables = (UINT32)mInfo.renderables.size();
-		for (UINT32 i = 0; i < numRenderables; i++)
+		// Overrides are applied to renderable elements when they are prepared, so only elements of the levels of detail
+		// actually being rendered are updated
+		for (auto& entry : mSamplerOverrides)
 		{
-			for(auto& element : mInfo.renderables[i]->elements)
-			{
-				MaterialSamplerOverrides* overrides = element.samplerOverrides;
-				if(overrides != nullptr && overrides->isDirty)
-				{
-					UINT32 numPasses = element.material->getNumPasses();
-					for(UINT32 j = 0; j < numPasses; j++)
-					{
-						SPtr<GpuParams> params = element.params->getGpuParams(j);
-
-						const UINT32 numStages = 6;
-						for (UINT32 k = 0; k < numStages; k++)
-						{
-							GpuProgramType type = (GpuProgramType)k;
+			if (entry.second->isDirty)
+				entry.second->version++;
 
-							SPtr<GpuParamDesc> paramDesc = params->getParamDesc(type);
-							if (paramDesc == nullptr)
-								continue;
-
-							for (auto& samplerDesc : paramDesc->samplers)
-							{
-								UINT32 set = samplerDesc.second.set;
-								UINT32 slot = samplerDesc.second.slot;
-
-								UINT32 overrideIndex = overrides->passes[j].stateOverrides[set][slot];
-								if (overrideIndex == (UINT32)-1)
-									continue;
-
-								params->setSamplerState(set, slot, overrides->overrides[overrideIndex].state);
-							}
-						}
-					}
-				}
-			}
-		}
-
-		for (auto& entry : mSamplerOverrides)
 			entry.second->isDirty = false;
+		}
 	}
 
 	void RendererScene::setParamFrameParams(float time)
@@ -1270,22 +1311,39 @@ namespace bs {	namespace ct
 		gPerFrameParamDef.gTime.set(mPerFrameParamBuffer, time);
 	}
 
-	void RendererScene::prepareRenderable(UINT32 idx, const FrameInfo& frameInfo)
+	void RendererScene::prepareRenderable(UINT32 idx, const FrameInfo& frameInfo, UINT32 lodMask)
 	{
-		if (mInfo.renderableReady[idx])
+		UINT32& preparedLODs = mInfo.renderablePreparedLODs[idx];
+		const UINT32 newLODs = lodMask & ~preparedLODs;
+		if (newLODs == 0)
 			return;
-		
-		// Note: Before uploading bone matrices perhaps check if they has actually been changed since last frame
-		if(frameInfo.perFrameData.animation != nullptr)
-			mInfo.renderables[idx]->renderable->updateAnimationBuffers(*frameInfo.perFrameData.animation);
-		
+
+		RendererRenderable* rendererRenderable = mInfo.renderables[idx];
+
+		// Data shared between all levels of detail only needs to be updated the first time
+		if (preparedLODs == 0)
+		{
+			// Note: Before uploading bone matrices perhaps check if they has actually been changed since last frame
+			if(frameInfo.perFrameData.animation != nullptr)
+				rendererRenderable->renderable->updateAnimationBuffers(*frameInfo.perFrameData.animation);
+
+			rendererRenderable->perObjectParamBuffer->flushToGPU();
+		}
+
 		// Note: Could this step be moved in notifyRenderableUpdated, so it only triggers when material actually gets
 		// changed? Although it shouldn't matter much because if the internal versions keeping track of dirty params.
-		for (auto& element : mInfo.renderables[idx]->elements)
+		for (auto& element : rendererRenderable->elements)
+		{
+			if ((newLODs & (1 << element.lodIdx)) == 0)
+				continue;
+
+			applySamplerStateOverrides(element);
+
+			element.materialAnimationTime = rendererRenderable->materialAnimationTime;
 			element.material->updateParamsSet(element.params, element.materialAnimationTime);
-		
-		mInfo.renderables[idx]->perObjectParamBuffer->flushToGPU();
-		mInfo.renderableReady[idx] = true;
+		}
+
+		preparedLODs |= newLODs;
 	}
 
 	void RendererScene::prepareParticleSystem(UINT32 idx, const FrameInfo& frameInfo)
@@ -1351,6 +1409,43 @@ namespace bs {	namespace ct
 		}
 	}
 
+	void RendererScene::applySamplerStateOverrides(RenderableElement& elem)
+	{
+		MaterialSamplerOverrides* overrides = elem.samplerOverrides;
+		if (overrides == nullptr || overrides->version == elem.samplerOverridesVersion)
+			return;
+
+		UINT32 numPasses = elem.material->getNumPasses();
+		for(UINT32 i = 0; i < numPasses; i++)
+		{
+			SPtr<GpuParams> params = elem.params->getGpuParams(i);
+
+			const UINT32 numStages = 6;
+			for (UINT32 j = 0; j < numStages; j++)
+			{
+				GpuProgramType type = (GpuProgramType)j;
+
+				SPtr<GpuParamDesc> paramDesc = params->getParamDesc(type);
+				if (paramDesc == nullptr)
+					continue;
+
+				for (auto& samplerDesc : paramDesc->samplers)
+				{
+					UINT32 set = samplerDesc.second.set;
+					UINT32 slot = samplerDesc.second.slot;
+
+					UINT32 overrideIndex = overrides->passes[i].stateOverrides[set][slot];
+					if (overrideIndex == (UINT32)-1)
+						continue;
+
+					params->setSamplerState(set, slot, overrides->overrides[overrideIndex].state);
+				}
+			}
+		}
+
+		elem.samplerOverridesVersion = overrides->version;
+	}
+
 	void RendererScene::freeSamplerStateOverrides(RenderElement& elem)
 	{
 		SamplerOverrideKey samplerKey(elem.material, elem.techniqueIdx);
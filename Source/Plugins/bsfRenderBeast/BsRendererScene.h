@@ -39,6 +39,12 @@ namespace bs
 		Vector<RendererRenderable*> renderables;
 		Vector<CullInfo> renderableCullInfos;
 
+		/**
+		 * Incremented whenever a static renderable is added or modified, or when renderable indices change. Allows views
+		 * to detect when their cached visibility is no longer valid.
+		 */
+		UINT64 renderableCullVersion = 0;
+
 		// Lights
 		Vector<RendererLight> directionalLights;
 		Vector<RendererLight> radialLights;
@@ -68,7 +74,7 @@ namespace bs
 
 		// Buffers for various transient data that gets rebuilt every frame
 		//// Rebuilt every frame
-		mutable Vector<bool> renderableReady;
+		mutable Vector<UINT32> renderablePreparedLODs; /**< Bitmask of levels of detail prepared for each renderable. */
 	};
 
 	/** Contains information about the scene (e.g. renderables, lights, cameras) required by the renderer. */
@@ -175,13 +181,14 @@ namespace bs
 
 		/**
 		 * Performs necessary steps to make a renderable ready for rendering. This must be called at least once every frame
-		 * for every renderable that will be drawn. Multiple calls for the same renderable during a single frame will result
-		 * in a no-op.
+		 * for every renderable that will be drawn. Only elements belonging to the requested levels of detail are prepared.
+		 * Multiple calls for the same renderable and level of detail during a single frame will result in a no-op.
 		 *
 		 * @param[in]	idx			Index of the renderable to prepare.
 		 * @param[in]	frameInfo	Global information describing the current frame.
+		 * @param[in]	lodMask		Bitmask of the levels of detail to prepare. See RenderableElement::lodIdx.
 		 */
-		void prepareRenderable(UINT32 idx, const FrameInfo& frameInfo);
+		void prepareRenderable(UINT32 idx, const FrameInfo& frameInfo, UINT32 lodMask);
 
 		/**
 		 * Performs necessary steps to make a particle system ready for rendering. This must be called at least once every
@@ -225,6 +232,9 @@ namespace bs
 		/** Frees sampler state overrides previously allocated with allocSamplerStateOverrides(). */
 		void freeSamplerStateOverrides(RenderElement& elem);
 
+		/** Applies the element's sampler state overrides to its GPU parameters, if they changed since last applied. */
+		void applySamplerStateOverrides(RenderableElement& elem);
+
 		SceneInfo mInfo;
 		SPtr<GpuParamBlockBuffer> mPerFrameParamBuffer;
 		UnorderedMap<SamplerOverrideKey, MaterialSamplerOverrides*> mSamplerOverrides;
@@ -11,6 +11,8 @@
 #include "BsRendererScene.h"
 #include "BsRenderBeast.h"
 #include <BsRendererDecal.h>
+#include "Threading/BsTaskScheduler.h"
+#include "Profiling/BsRenderStats.h"
 
 namespace bs { namespace ct
 {
@@ -180,15 +182,22 @@ namespace bs { namespace ct
 	}
 
 	void RendererView::determineVisible(const Vector<RendererRenderable*>& renderables, const Vector<CullInfo>& cullInfos,
-		Vector<bool>* visibility)
+		UINT64 cullInfoVersion, Vector<bool>* visibility)
 	{
 		mVisibility.renderables.clear();
 		mVisibility.renderables.resize(renderables.size(), false);
+		mCullStats = ViewCullStats();
 
 		if (mRenderSettings->overlayOnly)
 			return;
 
-		calculateVisibility(cullInfos, mVisibility.renderables);
+		calculateRenderableVisibility(cullInfos, cullInfoVersion, mVisibility.renderables);
+
+		BS_ADD_RENDER_STAT(NumCullTests, mCullStats.numTested);
+		BS_ADD_RENDER_STAT(NumCullCached, mCullStats.numCached);
+
+		if (mRenderSettings->enableOcclusionCulling)
+			calculateOcclusion(renderables, cullInfos, mVisibility.renderables);
 
 		if(visibility != nullptr)
 		{
@@ -326,6 +335,267 @@ namespace bs { namespace ct
 		}
 	}
 
+	void RendererView::calculateRenderableVisibility(const Vector<CullInfo>& cullInfos, UINT64 cullInfoVersion,
+		Vector<bool>& visibility)
+	{
+		// Maximum camera rotation since the cache was built, before the cache is rebuilt from scratch
+		static constexpr float MAX_CACHED_ROTATION = 10.0f * Math::DEG2RAD;
+
+		// Rebuild the cache when more than this fraction of previously classified static objects needed to be re-tested
+		static constexpr float MAX_RETEST_FRACTION = 0.5f;
+
+		UINT64 cameraLayers = mProperties.visibleLayers;
+		const Vector<Plane>& planes = mProperties.cullFrustum.getPlanes();
+		const Vector3& worldCameraPosition = mProperties.viewOrigin;
+		float baseCullDistance = mRenderSettings->cullDistance;
+		Matrix3 viewRotation = mProperties.viewTransform.get3x3();
+
+		const auto numObjects = (UINT32)cullInfos.size();
+
+		// Performs the same test as calculateVisibility()
+		auto isVisible = [&](const CullInfo& cullInfo)
+		{
+			if ((cullInfo.layer & cameraLayers) == 0)
+				return false;
+
+			const Sphere& boundingSphere = cullInfo.bounds.getSphere();
+
+			float distanceToCameraSq = worldCameraPosition.squaredDistance(boundingSphere.getCenter());
+			float maxDistanceToCamera = cullInfo.cullDistanceFactor * baseCullDistance + boundingSphere.getRadius();
+
+			if (distanceToCameraSq > maxDistanceToCamera * maxDistanceToCamera)
+				return false;
+
+			return mProperties.cullFrustum.intersects(boundingSphere) &&
+				mProperties.cullFrustum.intersects(cullInfo.bounds.getBox());
+		};
+
+		// Check if the camera moved little enough for the cache to remain usable
+		StaticVisibilityCache& cache = mStaticVisibility;
+		float cameraOffset = 0.0f;
+		float cameraRotation = 0.0f;
+
+		bool useCache = cache.valid &&
+			cache.cullInfoVersion == cullInfoVersion &&
+			cache.visibleLayers == cameraLayers &&
+			cache.cullDistance == baseCullDistance &&
+			cache.projTransform == mProperties.projTransform;
+
+		if (useCache)
+		{
+			cameraOffset = worldCameraPosition.distance(cache.viewOrigin);
+
+			// Angle of the rotation between the cached and the current view, from the trace of R * R_cached^T
+			float trace = 0.0f;
+			for (UINT32 row = 0; row < 3; row++)
+			{
+				for (UINT32 col = 0; col < 3; col++)
+					trace += viewRotation[row][col] * cache.viewRotation[row][col];
+			}
+
+			float cosAngle = Math::clamp((trace - 1.0f) * 0.5f, -1.0f, 1.0f);
+			cameraRotation = Math::acos(cosAngle).valueRadians();
+
+			if (cameraRotation > MAX_CACHED_ROTATION)
+				useCache = false;
+		}
+
+		if (useCache)
+		{
+			// A point at distance 'r' from the cached view origin moves relative to the frustum planes by at most
+			// 'offset + angle * r', which allows us to skip objects whose cached margin is larger than that
+			const auto numCached = std::min(numObjects, (UINT32)cache.entries.size());
+			UINT32 numClassified = 0;
+			UINT32 numRetested = 0;
+
+			for (UINT32 i = 0; i < numObjects; i++)
+			{
+				if (i < numCached && cullInfos[i].isStatic)
+				{
+					const StaticCullEntry& entry = cache.entries[i];
+					if (entry.margin > 0.0f)
+					{
+						numClassified++;
+
+						float maxMovement = cameraOffset + cameraRotation * entry.reach;
+						if (maxMovement < entry.margin)
+						{
+							visibility[i] = entry.visible;
+							mCullStats.numCached++;
+							continue;
+						}
+
+						numRetested++;
+					}
+				}
+
+				visibility[i] = isVisible(cullInfos[i]);
+				mCullStats.numTested++;
+			}
+
+			// Most of the cached objects are getting re-tested, camera moved too far from the cached position
+			if ((float)numRetested > numClassified * MAX_RETEST_FRACTION)
+				cache.valid = false;
+
+			return;
+		}
+
+		// Rebuild the cache, classifying each static object as fully inside or fully outside the culling boundaries (in
+		// which case we record how far the boundaries would have to move to change that), or intersecting the boundaries
+		cache.valid = true;
+		cache.cullInfoVersion = cullInfoVersion;
+		cache.visibleLayers = cameraLayers;
+		cache.cullDistance = baseCullDistance;
+		cache.viewOrigin = worldCameraPosition;
+		cache.viewRotation = viewRotation;
+		cache.projTransform = mProperties.projTransform;
+		cache.entries.resize(numObjects);
+
+		for (UINT32 i = 0; i < numObjects; i++)
+		{
+			const CullInfo& cullInfo = cullInfos[i];
+			StaticCullEntry& entry = cache.entries[i];
+
+			mCullStats.numTested++;
+
+			if (!cullInfo.isStatic)
+			{
+				entry.margin = 0.0f;
+				visibility[i] = isVisible(cullInfo);
+				continue;
+			}
+
+			if ((cullInfo.layer & cameraLayers) == 0)
+			{
+				entry.margin = std::numeric_limits<float>::max();
+				entry.reach = 0.0f;
+				entry.visible = false;
+
+				visibility[i] = false;
+				continue;
+			}
+
+			const Sphere& boundingSphere = cullInfo.bounds.getSphere();
+			const Vector3& center = boundingSphere.getCenter();
+			float radius = boundingSphere.getRadius();
+
+			float distanceToCamera = worldCameraPosition.distance(center);
+			float maxDistanceToCamera = cullInfo.cullDistanceFactor * baseCullDistance + radius;
+
+			// Positive if fully inside all boundaries, otherwise negative
+			float insideMargin = maxDistanceToCamera - distanceToCamera;
+
+			// Positive if fully outside of at least one boundary, otherwise negative
+			float outsideMargin = distanceToCamera - maxDistanceToCamera;
+
+			for (auto& plane : planes)
+			{
+				float distance = plane.getDistance(center);
+
+				insideMargin = std::min(insideMargin, distance - radius);
+				outsideMargin = std::max(outsideMargin, -distance - radius);
+			}
+
+			entry.reach = distanceToCamera + radius;
+
+			if (insideMargin > 0.0f)
+			{
+				entry.margin = insideMargin;
+				entry.visible = true;
+			}
+			else if (outsideMargin > 0.0f)
+			{
+				entry.margin = outsideMargin;
+				entry.visible = false;
+			}
+			else
+			{
+				entry.margin = 0.0f;
+				entry.visible = isVisible(cullInfo);
+			}
+
+			visibility[i] = entry.visible;
+		}
+	}
+
+	void RendererView::calculateOcclusion(const Vector<RendererRenderable*>& renderables,
+		const Vector<CullInfo>& cullInfos, Vector<bool>& visibility)
+	{
+		static constexpr UINT32 MIN_RENDERABLES_PER_OCCLUSION_TASK = 256;
+
+		const auto numRenderables = (UINT32)renderables.size();
+
+		bool anyOccluders = false;
+		for (UINT32 i = 0; i < numRenderables; i++)
+		{
+			if (!visibility[i])
+				continue;
+
+			const Renderable* renderable = renderables[i]->renderable;
+
+			const SPtr<MeshData>& occluderData = renderable->getOccluderData();
+			if (occluderData == nullptr)
+				continue;
+
+			if (!anyOccluders)
+			{
+				if (mOcclusionBuffer == nullptr)
+					mOcclusionBuffer = bs_unique_ptr_new<OcclusionBuffer>();
+
+				mOcclusionBuffer->clear(mProperties.viewProjTransform, gCaps().minDepth);
+				anyOccluders = true;
+			}
+
+			mOcclusionBuffer->rasterize(renderable->getMatrix(), *occluderData);
+		}
+
+		if (!anyOccluders)
+			return;
+
+		mOcclusionBuffer->buildHierarchy();
+
+		// Test the bounds against the occlusion buffer. Results are written into a byte array first, as different
+		// threads cannot safely write to the same bit array.
+		bs_frame_mark();
+		{
+			FrameVector<UINT8> occluded(numRenderables, 0);
+			auto testRange = [this, &cullInfos, &visibility, &occluded](UINT32 first, UINT32 last)
+			{
+				for (UINT32 i = first; i < last; i++)
+				{
+					if (visibility[i] && !mOcclusionBuffer->isVisible(cullInfos[i].bounds.getBox()))
+						occluded[i] = 1;
+				}
+			};
+
+			const UINT32 numTasks = std::min(TaskScheduler::instance().getNumWorkers(),
+				numRenderables / MIN_RENDERABLES_PER_OCCLUSION_TASK);
+
+			if (numTasks > 1)
+			{
+				const UINT32 renderablesPerTask = Math::divideAndRoundUp(numRenderables, numTasks);
+				SPtr<TaskGroup> taskGroup = TaskGroup::create("RendererView::calculateOcclusion",
+					[&testRange, renderablesPerTask, numRenderables](UINT32 idx)
+				{
+					const UINT32 first = idx * renderablesPerTask;
+					testRange(first, std::min(first + renderablesPerTask, numRenderables));
+				}, numTasks);
+
+				TaskScheduler::instance().addTaskGroup(taskGroup);
+				taskGroup->wait();
+			}
+			else
+				testRange(0, numRenderables);
+
+			for (UINT32 i = 0; i < numRenderables; i++)
+			{
+				if (occluded[i])
+					visibility[i] = false;
+			}
+		}
+		bs_frame_clear();
+	}
+
 	void RendererView::calculateVisibility(const Vector<Sphere>& bounds, Vector<bool>& visibility) const
 	{
 		const ConvexVolume& worldFrustum = mProperties.cullFrustum;
@@ -348,22 +618,57 @@ namespace bs { namespace ct
 		}
 	}
 
+	UINT32 RendererView::selectLOD(const Sphere& bounds, const Vector<float>& screenSizes, UINT32 numLODs,
+		UINT32 currentLOD) const
+	{
+		// Projected diameter of the sphere, relative to the viewport size
+		const Matrix4& proj = mProperties.projTransform;
+		const float projScale = std::max(Math::abs(proj[0][0]), Math::abs(proj[1][1]));
+
+		float screenSize = bounds.getRadius() * projScale;
+		if (mProperties.projType == PT_PERSPECTIVE)
+		{
+			const float distance = (bounds.getCenter() - mProperties.viewOrigin).length();
+			screenSize /= std::max(distance, 0.0001f);
+		}
+
+		return Renderable::selectLOD(screenSize, screenSizes, numLODs, currentLOD);
+	}
+
 	void RendererView::queueRenderElements(const SceneInfo& sceneInfo)
 	{
 		if (mRenderSettings->overlayOnly)
 			return;
 
 		// Queue renderables
+		// Note: LOD state is tracked by renderable index, so it may briefly be off when renderables are removed
+		mRenderableLODs.resize(sceneInfo.renderables.size(), 0);
+
 		for(UINT32 i = 0; i < (UINT32)sceneInfo.renderables.size(); i++)
 		{
 			if (!mVisibility.renderables[i])
 				continue;
 
-			const AABox& boundingBox = sceneInfo.renderableCullInfos[i].bounds.getBox();
+			const RendererRenderable* rendererRenderable = sceneInfo.renderables[i];
+			const Bounds& bounds = sceneInfo.renderableCullInfos[i].bounds;
+
+			UINT32 lodIdx = 0;
+			if (rendererRenderable->numLODs > 1)
+			{
+				lodIdx = selectLOD(bounds.getSphere(), rendererRenderable->renderable->getLODScreenSizes(),
+					rendererRenderable->numLODs, mRenderableLODs[i]);
+
+				mRenderableLODs[i] = (UINT8)lodIdx;
+			}
+
+			const AABox& boundingBox = bounds.getBox();
 			const float distanceToCamera = (mProperties.viewOrigin - boundingBox.getCenter()).length();
 
-			for (auto& renderElem : sceneInfo.renderables[i]->elements)
+			for (auto& renderElem : rendererRenderable->elements)
 			{
+				if (renderElem.lodIdx != lodIdx)
+					continue;
+
 				// Note: I could keep renderables in multiple separate arrays, so I don't need to do the check here
 				ShaderFlags shaderFlags = renderElem.material->getShader()->getFlags();
 
@@ -372,7 +677,11 @@ namespace bs { namespace ct
 				else if (shaderFlags.isSet(ShaderFlag::Forward))
 					mForwardOpaqueQueue->add(&renderElem, distanceToCamera, renderElem.techniqueIdx);
 				else
-					mDeferredOpaqueQueue->add(&renderElem, distanceToCamera, renderElem.techniqueIdx);
+				{
+					// Group instanced elements by mesh, otherwise distance sorting rarely keeps them adjacent
+					mDeferredOpaqueQueue->add(&renderElem, distanceToCamera, renderElem.techniqueIdx,
+						renderElem.instanced);
+				}
 			}
 		}
 
@@ -703,14 +1012,56 @@ namespace bs { namespace ct
 
 		for(UINT32 i = 0; i < numViews; i++)
 		{
-			mViews[i]->determineVisible(sceneInfo.renderables, sceneInfo.renderableCullInfos, &mVisibility.renderables);
+			mViews[i]->determineVisible(sceneInfo.renderables, sceneInfo.renderableCullInfos, sceneInfo.renderableCullVersion,
+				&mVisibility.renderables);
 			mViews[i]->determineVisible(sceneInfo.particleSystems, sceneInfo.particleSystemCullInfos, &mVisibility.particleSystems);
 			mViews[i]->determineVisible(sceneInfo.decals, sceneInfo.decalCullInfos, &mVisibility.decals);
 		}
 		
-		// Generate render queues per camera
-		for(UINT32 i = 0; i < numViews; i++)
-			mViews[i]->queueRenderElements(sceneInfo);
+		// Generate render queues per camera. Each view only writes to its own queues, so when there is enough work to go
+		// around the queues are built and sorted on worker threads.
+		static constexpr UINT32 MIN_ELEMENTS_FOR_PARALLEL_QUEUES = 256;
+
+		const auto numSceneElements = (UINT32)(sceneInfo.renderables.size() + sceneInfo.particleSystems.size() +
+			sceneInfo.decals.size());
+
+		const bool parallelQueues = numViews > 1 && numSceneElements >= MIN_ELEMENTS_FOR_PARALLEL_QUEUES &&
+			TaskScheduler::instance().getNumWorkers() > 1;
+
+		if(parallelQueues)
+		{
+			SPtr<TaskGroup> taskGroup = TaskGroup::create("RendererViewGroup::queueRenderElements",
+				[this, &sceneInfo](UINT32 idx)
+			{
+				mViews[idx]->queueRenderElements(sceneInfo);
+			}, numViews);
+
+			TaskScheduler::instance().addTaskGroup(taskGroup);
+			taskGroup->wait();
+		}
+		else
+		{
+			for(UINT32 i = 0; i < numViews; i++)
+				mViews[i]->queueRenderElements(sceneInfo);
+		}
+
+		// Gather the levels of detail used by any view, so elements of other levels can be skipped when preparing
+		const auto numRenderables = (UINT32)sceneInfo.renderables.size();
+		mVisibility.renderableLODs.resize(numRenderables, 0);
+		mVisibility.renderableLODs.assign(numRenderables, 0);
+
+		for (UINT32 i = 0; i < numViews; i++)
+		{
+			if (mViews[i]->getRenderSettings().overlayOnly)
+				continue;
+
+			const VisibilityInfo& viewVisibility = mViews[i]->getVisibilityMasks();
+			for (UINT32 j = 0; j < numRenderables; j++)
+			{
+				if (viewVisibility.renderables[j])
+					mVisibility.renderableLODs[j] |= 1 << mViews[i]->getRenderableLOD(j);
+			}
+		}
 
 		// Calculate light visibility for all views
 		const auto numRadialLights = (UINT32)sceneInfo.radialLights.size();
@@ -6,6 +6,7 @@
 #include "Renderer/BsRenderQueue.h"
 #include "Renderer/BsLight.h"
 #include "Renderer/BsRenderSettings.h"
+#include "Renderer/BsOcclusionBuffer.h"
 #include "Math/BsBounds.h"
 #include "Math/BsConvexVolume.h"
 #include "Shading/BsLightGrid.h"
@@ -191,6 +192,7 @@ namespace bs { namespace ct
 	struct VisibilityInfo
 	{
 		Vector<bool> renderables;
+		Vector<UINT32> renderableLODs; /**< Bitmask of the levels of detail in use, per renderable. Set by view groups. */
 		Vector<bool> radialLights;
 		Vector<bool> spotLights;
 		Vector<bool> reflProbes;
@@ -201,13 +203,26 @@ namespace bs { namespace ct
 	/** Information used for culling an object against a view. */
 	struct CullInfo
 	{
-		CullInfo(const Bounds& bounds, UINT64 layer = -1, float cullDistanceFactor = 1.0f)
-			:layer(layer), bounds(bounds), cullDistanceFactor(cullDistanceFactor)
+		CullInfo(const Bounds& bounds, UINT64 layer = -1, float cullDistanceFactor = 1.0f, bool isStatic = false)
+			:layer(layer), bounds(bounds), cullDistanceFactor(cullDistanceFactor), isStatic(isStatic)
 		{ }
 
 		UINT64 layer;
 		Bounds bounds;
 		float cullDistanceFactor;
+
+		/** True if the object is not expected to move, allowing its visibility to be cached between frames. */
+		bool isStatic;
+	};
+
+	/** Statistics about the last renderable visibility calculation performed by a view. */
+	struct ViewCullStats
+	{
+		/** Number of renderables whose bounds were tested against the view during the last frame. */
+		UINT32 numTested = 0;
+
+		/** Number of static renderables whose visibility was re-used from a previous frame, without testing. */
+		UINT32 numCached = 0;
 	};
 
 	/**	Renderer information specific to a single render target. */
@@ -278,6 +293,8 @@ namespace bs { namespace ct
 		 * @param[in]	renderables			A set of renderable objects to iterate over and determine visibility for.
 		 * @param[in]	cullInfos			A set of world bounds & other information relevant for culling the provided
 		 *									renderable objects. Must be the same size as the @p renderables array.
+		 * @param[in]	cullInfoVersion		Version of the @p cullInfos array, as reported by the scene. Cached visibility
+		 *									of static renderables is discarded whenever the version changes.
 		 * @param[out]	visibility			Output parameter that will have the true bit set for any visible renderable
 		 *									object. If the bit for an object is already set to true, the method will never
 		 *									change it to false which allows the same bitfield to be provided to multiple
@@ -287,7 +304,7 @@ namespace bs { namespace ct
 		 *									retrieved by calling getVisibilityMask().
 		 */
 		void determineVisible(const Vector<RendererRenderable*>& renderables, const Vector<CullInfo>& cullInfos,
-			Vector<bool>* visibility = nullptr);
+			UINT64 cullInfoVersion, Vector<bool>* visibility = nullptr);
 
 		/**
 		 * Populates view render queues by determining visible particle systems.
@@ -359,16 +376,64 @@ namespace bs { namespace ct
 		 */
 		void calculateVisibility(const Vector<AABox>& bounds, Vector<bool>& visibility) const;
 
+		/**
+		 * Culls the provided set of renderable bounds against the current frustum, same as calculateVisibility(). Static
+		 * renderables are classified against the frustum and the classification is cached. On subsequent frames, as long
+		 * as the camera moves only a small amount, only static renderables close to the frustum boundaries are re-tested.
+		 *
+		 * @param[in]	cullInfos			Bounds & other culling information of the renderables.
+		 * @param[in]	cullInfoVersion		Version of the @p cullInfos array. A change in version invalidates the cache.
+		 * @param[out]	visibility			Visibility flag per renderable. Must be the same size as @p cullInfos.
+		 */
+		void calculateRenderableVisibility(const Vector<CullInfo>& cullInfos, UINT64 cullInfoVersion,
+			Vector<bool>& visibility);
+
+		/**
+		 * Rasterizes all visible occluders into the view's occlusion buffer, and then marks any renderables hidden behind
+		 * them as not visible. Does nothing if no occluders are visible.
+		 *
+		 * @param[in]		renderables		Renderables to test, including the occluders.
+		 * @param[in]		cullInfos		Bounds of the renderables in @p renderables.
+		 * @param[in, out]	visibility		Visibility of the renderables as determined by frustum culling. Entries of
+		 *									occluded renderables will be set to false.
+		 */
+		void calculateOcclusion(const Vector<RendererRenderable*>& renderables, const Vector<CullInfo>& cullInfos,
+			Vector<bool>& visibility);
+
 		/**
 		 * Inserts all visible renderable elements into render queues. Assumes visibility has been calculated beforehand
 		 * by calling determineVisible(). After the call render elements can be retrieved from the queues using
-		 * getOpaqueQueue or getTransparentQueue() calls.
+		 * getOpaqueQueue or getTransparentQueue() calls. Only modifies state owned by this view, meaning it may be called
+		 * for different views in parallel.
 		 */
 		void queueRenderElements(const SceneInfo& sceneInfo);
 
+		/**
+		 * Selects the level of detail to render a renderable with, based on its projected size on the screen. To avoid
+		 * flickering between levels the switch happens only once the screen size moves a certain distance past the
+		 * threshold, relative to the currently used level.
+		 *
+		 * @param[in]	bounds			World space bounding sphere of the renderable.
+		 * @param[in]	screenSizes		Screen size thresholds for each level beyond the first. See
+		 *								Renderable::setLODScreenSizes().
+		 * @param[in]	numLODs			Number of available levels of detail.
+		 * @param[in]	currentLOD		Level of detail the renderable was rendered with last time.
+		 * @return						Index of the level of detail to use.
+		 */
+		UINT32 selectLOD(const Sphere& bounds, const Vector<float>& screenSizes, UINT32 numLODs, UINT32 currentLOD) const;
+
 		/** Returns the visibility mask calculated with the last call to determineVisible(). */
 		const VisibilityInfo& getVisibilityMasks() const { return mVisibility; }
 
+		/**
+		 * Returns the level of detail the renderable with the specified index was queued with, during the last call to
+		 * queueRenderElements().
+		 */
+		UINT32 getRenderableLOD(UINT32 idx) const { return idx < mRenderableLODs.size() ? mRenderableLODs[idx] : 0; }
+
+		/** Returns statistics about the renderable culling performed during the last call to determineVisible(). */
+		const ViewCullStats& getCullStats() const { return mCullStats; }
+
 		/** Returns per-view settings that control rendering. */
 		const RenderSettings& getRenderSettings() const { return *mRenderSettings; }
 
@@ -433,6 +498,35 @@ namespace bs { namespace ct
 		 */
 		static Vector2 getNDCZToDeviceZ();
 	private:
+		/** Frustum classification of a single static renderable, cached between frames. */
+		struct StaticCullEntry
+		{
+			/**
+			 * Distance by which the frustum or cull distance boundary needs to move in order for the visibility of the
+			 * object to change. Zero or negative for objects that intersect a boundary and must be tested every frame.
+			 */
+			float margin;
+
+			/** Distance from the cached view origin to the furthest point on the object's bounding sphere. */
+			float reach;
+
+			/** Visibility of the object at the time the entry was created. */
+			bool visible;
+		};
+
+		/** Visibility of static renderables, as determined with the view transform at the time of caching. */
+		struct StaticVisibilityCache
+		{
+			bool valid = false;
+			UINT64 cullInfoVersion = 0;
+			UINT64 visibleLayers = 0;
+			float cullDistance = 0.0f;
+			Vector3 viewOrigin = Vector3::ZERO;
+			Matrix3 viewRotation = Matrix3::IDENTITY;
+			Matrix4 projTransform = Matrix4::IDENTITY;
+			Vector<StaticCullEntry> entries;
+		};
+
 		RendererViewProperties mProperties;
 		Camera* mCamera;
 
@@ -447,6 +541,10 @@ namespace bs { namespace ct
 
 		SPtr<GpuParamBlockBuffer> mParamBuffer;
 		VisibilityInfo mVisibility;
+		Vector<UINT8> mRenderableLODs;
+		UPtr<OcclusionBuffer> mOcclusionBuffer;
+		StaticVisibilityCache mStaticVisibility;
+		ViewCullStats mCullStats;
 		LightGrid mLightGrid;
 		UINT32 mViewIdx;
 	};
@@ -12,6 +12,8 @@
 #include "RenderAPI/BsVertexDataDesc.h"
 #include "Renderer/BsRenderer.h"
 #include "BsRendererRenderable.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Profiling/BsRenderStats.h"
 
 namespace bs { namespace ct
 {
@@ -439,88 +441,140 @@ namespace bs { namespace ct
 	 */
 	class ShadowRenderQueue
 	{
+		/** Minimum number of casters each worker thread must process, in order for parallel queue construction to be used. */
+		static constexpr UINT32 MIN_CASTERS_PER_TASK = 512;
 	public:
+		/** Caster that intersects the shadow volume, queued for rendering. */
 		struct Command
 		{
-			Command()
-			{ }
-
-			Command(RenderableElement* element)
-				:element(element), isElement(true)
-			{ }
-
-			union
-			{
-				RenderableElement* element;
-				RendererRenderable* renderable;
-			};
-
+			RendererRenderable* renderable;
+			UINT32 renderableIdx;
+			UINT32 mask;
+		};
 
-			bool isElement : 1;
-			UINT32 mask : 6;
+		/** Queues built from a contiguous range of casters, one per vertex input variation. */
+		struct Chunk
+		{
+			Vector<Command> commands[(UINT32)RenderableAnimType::Count];
+			Vector<UINT32> visible;
 		};
 
+		/**
+		 * Renders the casters from the provided set that intersect the shadow volume described by @p opt. Returns the
+		 * number of renderables that were rendered.
+		 */
 		template<class Options>
-		static void execute(RendererScene& scene, const FrameInfo& frameInfo, const Options& opt)
+		static UINT32 execute(RendererScene& scene, const FrameInfo& frameInfo, const Options& opt,
+			const Vector<UINT32>& casters)
 		{
 			static_assert((UINT32)RenderableAnimType::Count == 4, "RenderableAnimType is expected to have four sequential entries.");
 
 			const SceneInfo& sceneInfo = scene.getSceneInfo();
-
-			bs_frame_mark();
+			const auto numCasters = (UINT32)casters.size();
+			UINT32 numRendered = 0;
+
+			// Cull the casters against the shadow volume and build sorted queues from the ones that intersect it. None of
+			// this touches shared state, so for large scenes it is split between worker threads, each building the queues
+			// for a contiguous range of casters.
+			const UINT32 numTasks = std::max(1U, std::min(TaskScheduler::instance().getNumWorkers(),
+				numCasters / MIN_CASTERS_PER_TASK));
+			const UINT32 castersPerTask = Math::divideAndRoundUp(numCasters, numTasks);
+
+			Vector<Chunk> chunks(numTasks);
+			auto buildChunk = [&sceneInfo, &opt, &casters, &chunks, castersPerTask, numCasters](UINT32 idx)
 			{
-				FrameVector<Command> commands[4];
+				Chunk& chunk = chunks[idx];
 
-				// Make a list of relevant renderables and prepare them for rendering
-				for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
+				const UINT32 first = idx * castersPerTask;
+				const UINT32 last = std::min(first + castersPerTask, numCasters);
+				for (UINT32 i = first; i < last; i++)
 				{
-					const Sphere& bounds = sceneInfo.renderableCullInfos[i].bounds.getSphere();
+					const UINT32 renderableIdx = casters[i];
+					const Sphere& bounds = sceneInfo.renderableCullInfos[renderableIdx].bounds.getSphere();
 					if (!opt.intersects(bounds))
 						continue;
 
-					scene.prepareRenderable(i, frameInfo);
-
-					Command renderableCommand;
-					renderableCommand.mask = 0;
+					Command command;
+					command.renderable = sceneInfo.renderables[renderableIdx];
+					command.renderableIdx = renderableIdx;
+					command.mask = 0;
 
-					RendererRenderable* renderable = sceneInfo.renderables[i];
-					renderableCommand.isElement = false;
-					renderableCommand.renderable = renderable;
+					opt.prepare(command, bounds);
+					chunk.visible.push_back(renderableIdx);
 
-					opt.prepare(renderableCommand, bounds);
+					bool renderableQueued[4];
+					bs_zero_out(renderableQueued);
 
-					bool renderableBound[4];
-					bs_zero_out(renderableBound);
-
-					for (auto& element : renderable->elements)
+					for (auto& element : command.renderable->elements)
 					{
-						UINT32 arrayIdx = (int)element.animType;
+						// Shadow casters always use the full detail mesh, as the LOD is selected per view
+						if (element.lodIdx != 0)
+							continue;
 
-						if (!renderableBound[arrayIdx])
+						const auto arrayIdx = (UINT32)element.animType;
+						if (!renderableQueued[arrayIdx])
 						{
-							commands[arrayIdx].push_back(renderableCommand);
-							renderableBound[arrayIdx] = true;
+							chunk.commands[arrayIdx].push_back(command);
+							renderableQueued[arrayIdx] = true;
 						}
-
-						commands[arrayIdx].push_back(Command(&element));
 					}
 				}
 
-				static const ShaderVariation* VAR_LOOKUP[4];
-				VAR_LOOKUP[0] = &getVertexInputVariation<false, false>();
-				VAR_LOOKUP[1] = &getVertexInputVariation<true, false>();
-				VAR_LOOKUP[2] = &getVertexInputVariation<false, true>();
-				VAR_LOOKUP[3] = &getVertexInputVariation<true, true>();
-
-				for (UINT32 i = 0; i < (UINT32)RenderableAnimType::Count; i++)
+				// Material is the same for all casters in a queue, so group casters sharing a mesh instead
+				for (auto& commands : chunk.commands)
 				{
-					opt.bindMaterial(*VAR_LOOKUP[i]);
+					std::sort(commands.begin(), commands.end(), [](const Command& a, const Command& b)
+					{
+						const Mesh* meshA = a.renderable->elements[0].mesh.get();
+						const Mesh* meshB = b.renderable->elements[0].mesh.get();
+						if (meshA != meshB)
+							return std::less<const Mesh*>()(meshA, meshB);
+
+						return a.renderableIdx < b.renderableIdx;
+					});
+				}
+			};
+
+			if (numTasks > 1)
+			{
+				SPtr<TaskGroup> taskGroup = TaskGroup::create("ShadowRenderQueue::build", buildChunk, numTasks);
+
+				TaskScheduler::instance().addTaskGroup(taskGroup);
+				taskGroup->wait();
+			}
+			else
+				buildChunk(0);
 
-					for (auto& command : commands[i])
+			// Prepare the casters for rendering. This updates shared GPU buffers so it must happen on this thread.
+			for (auto& chunk : chunks)
+			{
+				// Shadow casters always use the full detail mesh
+				for (auto& renderableIdx : chunk.visible)
+					scene.prepareRenderable(renderableIdx, frameInfo, 1);
+
+				numRendered += (UINT32)chunk.visible.size();
+			}
+
+			static const ShaderVariation* VAR_LOOKUP[4];
+			VAR_LOOKUP[0] = &getVertexInputVariation<false, false>();
+			VAR_LOOKUP[1] = &getVertexInputVariation<true, false>();
+			VAR_LOOKUP[2] = &getVertexInputVariation<false, true>();
+			VAR_LOOKUP[3] = &getVertexInputVariation<true, true>();
+
+			for (UINT32 i = 0; i < (UINT32)RenderableAnimType::Count; i++)
+			{
+				opt.bindMaterial(*VAR_LOOKUP[i]);
+
+				for (auto& chunk : chunks)
+				{
+					for (auto& command : chunk.commands[i])
 					{
-						if (command.isElement)
+						opt.bindRenderable(command);
+
+						for (auto& element : command.renderable->elements)
 						{
-							const RenderableElement& element = *command.element;
+							if (element.lodIdx != 0 || (UINT32)element.animType != i)
+								continue;
 
 							if (element.morphVertexDeclaration == nullptr)
 								gRendererUtility().draw(element.mesh, element.subMesh);
@@ -528,12 +582,11 @@ namespace bs { namespace ct
 								gRendererUtility().drawMorph(element.mesh, element.subMesh, element.morphShapeBuffer,
 									element.morphVertexDeclaration);
 						}
-						else
-							opt.bindRenderable(command);
 					}
 				}
 			}
-			bs_frame_clear();
+
+			return numRendered;
 		}
 	};
 
@@ -767,6 +820,7 @@ namespace bs { namespace ct
 		mCascadedShadowMaps.clear();
 		mDynamicShadowMaps.clear();
 		mShadowCubemaps.clear();
+		mStaticShadowCaches.clear();
 
 		mShadowMapSize = size;
 	}
@@ -774,10 +828,9 @@ namespace bs { namespace ct
 	void ShadowRendering::renderShadowMaps(RendererScene& scene, const RendererViewGroup& viewGroup,
 		const FrameInfo& frameInfo)
 	{
-		// Note: Currently all shadows are dynamic and are rebuilt every frame. I should later added support for static
-		// shadow maps which can be used for immovable lights. Such a light can then maintain a set of shadow maps,
-		// one of which is static and only effects the static geometry, while the rest are per-object shadow maps used
-		// for dynamic objects. Then only a small subset of geometry needs to be redrawn, instead of everything.
+		// Note: Static casters are cached in a separate depth layer per shadow map, which is copied into the shadow map
+		// before the dynamic casters are rendered on top. Dynamic casters are still rendered every frame. Per-object
+		// shadow maps for dynamic objects could reduce that cost further.
 
 		// Note: Add support for per-object shadows and a way to force a renderable to use per-object shadows. This can be
 		// used for adding high quality shadows on specific objects (e.g. important characters during cinematics).
@@ -787,6 +840,9 @@ namespace bs { namespace ct
 		
 		// Clear all transient data from last frame
 		mShadowInfos.clear();
+		mStats = ShadowRenderingStats();
+
+		updateCasterCandidates(sceneInfo);
 
 		mSpotLightShadows.resize(sceneInfo.spotLights.size());
 		mRadialLightShadows.resize(sceneInfo.radialLights.size());
@@ -892,6 +948,14 @@ namespace bs { namespace ct
 				++iter;
 		}
 
+		for(auto iter = mStaticShadowCaches.begin(); iter != mStaticShadowCaches.end();)
+		{
+			if (iter->second.lastUsedCounter++ >= MAX_UNUSED_FRAMES)
+				iter = mStaticShadowCaches.erase(iter);
+			else
+				++iter;
+		}
+
 		// Render shadow maps
 		for (UINT32 i = 0; i < (UINT32)sceneInfo.directionalLights.size(); ++i)
 		{
@@ -1021,8 +1085,8 @@ namespace bs { namespace ct
 		const RenderAPICapabilities& caps = gCaps();
 		// TODO - Calculate and set a scissor rectangle for the light
 
-		SPtr<GpuParamBlockBuffer> shadowParamBuffer = gShadowProjectParamsDef.createBuffer();
-		SPtr<GpuParamBlockBuffer> shadowOmniParamBuffer = gShadowProjectOmniParamsDef.createBuffer();
+		SPtr<GpuParamBlockBuffer> shadowParamBuffer = gShadowProjectParamsDef.getFrameBuffer();
+		SPtr<GpuParamBlockBuffer> shadowOmniParamBuffer = gShadowProjectOmniParamsDef.getFrameBuffer();
 
 		UINT32 viewIdx = view.getViewIdx();
 		Vector<const ShadowInfo*> shadowInfos;
@@ -1230,7 +1294,7 @@ namespace bs { namespace ct
 
 		const Transform& tfrm = light->getTransform();
 		Vector3 lightDir = -tfrm.getRotation().zAxis();
-		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.createBuffer();
+		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.getFrameBuffer();
 
 		ShadowInfo shadowInfo;
 		shadowInfo.lightIdx = lightIdx;
@@ -1268,6 +1332,8 @@ namespace bs { namespace ct
 		Quaternion lightRotation(BsIdentity);
 		lightRotation.lookRotation(lightDir, Vector3::UNIT_Y);
 
+		StaticShadowCache& staticCache = getStaticShadowCache(light, &view, numCascades);
+
 		ProfileGPUBlock profileSample("Project directional light shadow");
 
 		for (UINT32 i = 0; i < numCascades; ++i)
@@ -1328,18 +1394,50 @@ namespace bs { namespace ct
 			gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, shadowInfo.shadowVPTransform);
 			gShadowParamsDef.gNDCZToDeviceZ.set(shadowParamsBuffer, RendererView::getNDCZToDeviceZ());
 
-			rapi.setRenderTarget(shadowMap.getTarget(i));
-			rapi.clearRenderTarget(FBT_DEPTH);
-
-			ShadowDepthDirectionalMat* depthDirMat = ShadowDepthDirectionalMat::get();
-			depthDirMat->bind(shadowParamsBuffer);
-
-			// Render all renderables into the shadow map
 			ShadowRenderQueueDirOptions dirOptions(
 				cascadeCullVolume,
 				shadowParamsBuffer);
-			
-			ShadowRenderQueue::execute(scene, frameInfo, dirOptions);
+
+			StaticShadowLayer& staticLayer = staticCache.layers[i];
+			StaticCasterMode staticMode = updateStaticLayer(staticLayer, sceneInfo, cascadeCullVolume,
+				shadowInfo.shadowVPTransform, shadowInfo.depthBias, mapSize);
+			updateStaticLayerStats(staticLayer, staticMode);
+
+			if (staticMode == StaticCasterMode::RenderStatic)
+			{
+				allocateStaticDepth(staticCache, TEX_TYPE_2D, mapSize, numCascades);
+
+				RENDER_TEXTURE_DESC rtDesc;
+				rtDesc.depthStencilSurface.texture = staticCache.depth->texture;
+				rtDesc.depthStencilSurface.face = i;
+				rtDesc.depthStencilSurface.numFaces = 1;
+
+				rapi.setRenderTarget(RenderTexture::create(rtDesc));
+				rapi.clearRenderTarget(FBT_DEPTH);
+
+				addRenderedCasters(ShadowRenderQueue::execute(scene, frameInfo, dirOptions,
+					staticLayer.casters));
+				staticLayer.isValid = true;
+			}
+
+			if (staticMode == StaticCasterMode::Direct)
+			{
+				rapi.setRenderTarget(shadowMap.getTarget(i));
+				rapi.clearRenderTarget(FBT_DEPTH);
+			}
+			else
+			{
+				TEXTURE_COPY_DESC copyDesc;
+				copyDesc.srcFace = i;
+				copyDesc.dstFace = i;
+
+				staticCache.depth->texture->copy(shadowMap.getTexture(), copyDesc);
+				rapi.setRenderTarget(shadowMap.getTarget(i));
+			}
+
+			// Render the remaining casters into the shadow map
+			const Vector<UINT32>& casters = getDirectCasters(staticLayer, staticMode);
+			addRenderedCasters(ShadowRenderQueue::execute(scene, frameInfo, dirOptions, casters));
 
 			shadowMap.setShadowInfo(i, shadowInfo);
 		}
@@ -1353,7 +1451,7 @@ namespace bs { namespace ct
 	{
 		Light* light = rendererLight.internal;
 
-		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.createBuffer();
+		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.getFrameBuffer();
 
 		ShadowInfo mapInfo;
 		mapInfo.fadePerView = options.fadePercents;
@@ -1389,9 +1487,6 @@ namespace bs { namespace ct
 		ProfileGPUBlock profileSample("Project spot light shadows");
 
 		RenderAPI& rapi = RenderAPI::instance();
-		rapi.setRenderTarget(atlas.getTarget());
-		rapi.setViewport(mapInfo.normArea);
-		rapi.clearViewport(FBT_DEPTH);
 
 		mapInfo.depthNear = 0.05f;
 		mapInfo.depthFar = light->getAttenuationRadius();
@@ -1429,12 +1524,42 @@ namespace bs { namespace ct
 
 		ConvexVolume worldFrustum(worldPlanes);
 
-		// Render all renderables into the shadow map
 		ShadowRenderQueueSpotOptions spotOptions(
 			worldFrustum,
 			shadowParamsBuffer);
 
-		ShadowRenderQueue::execute(scene, frameInfo, spotOptions);
+		StaticShadowCache& staticCache = getStaticShadowCache(light, nullptr, 1);
+		StaticShadowLayer& staticLayer = staticCache.layers[0];
+		StaticCasterMode staticMode = updateStaticLayer(staticLayer, scene.getSceneInfo(), worldFrustum,
+			mapInfo.shadowVPTransform, mapInfo.depthBias, options.mapSize);
+		updateStaticLayerStats(staticLayer, staticMode);
+
+		if (staticMode == StaticCasterMode::RenderStatic)
+		{
+			allocateStaticDepth(staticCache, TEX_TYPE_2D, options.mapSize, 1);
+
+			rapi.setRenderTarget(staticCache.depth->renderTexture);
+			rapi.clearRenderTarget(FBT_DEPTH);
+
+			addRenderedCasters(ShadowRenderQueue::execute(scene, frameInfo, spotOptions, staticLayer.casters));
+			staticLayer.isValid = true;
+		}
+
+		rapi.setRenderTarget(atlas.getTarget());
+		rapi.setViewport(mapInfo.normArea);
+
+		if (staticMode == StaticCasterMode::Direct)
+			rapi.clearViewport(FBT_DEPTH);
+		else
+		{
+			// Depth-stencil surfaces can't be partially copied on all APIs, so the static layer is blitted instead
+			Rect2I staticArea(0, 0, options.mapSize, options.mapSize);
+			gRendererUtility().blit(staticCache.depth->texture, staticArea, false, true);
+		}
+
+		// Render the remaining casters into the shadow map
+		const Vector<UINT32>& casters = getDirectCasters(staticLayer, staticMode);
+		addRenderedCasters(ShadowRenderQueue::execute(scene, frameInfo, spotOptions, casters));
 
 		// Restore viewport
 		rapi.setViewport(Rect2(0.0f, 0.0f, 1.0f, 1.0f));
@@ -1450,7 +1575,7 @@ namespace bs { namespace ct
 	{
 		Light* light = rendererLight.internal;
 
-		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.createBuffer();
+		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.getFrameBuffer();
 
 		ShadowInfo mapInfo;
 		mapInfo.lightIdx = options.lightIdx;
@@ -1523,8 +1648,8 @@ namespace bs { namespace ct
 		SPtr<GpuParamBlockBuffer> shadowCubeMasksBuffer;
 		if(renderAllFacesAtOnce)
 		{
-			shadowCubeMatricesBuffer = gShadowCubeMatricesDef.createBuffer();
-			shadowCubeMasksBuffer = gShadowCubeMasksDef.createBuffer();
+			shadowCubeMatricesBuffer = gShadowCubeMatricesDef.getFrameBuffer();
+			shadowCubeMasksBuffer = gShadowCubeMasksDef.getFrameBuffer();
 		}
 
 		gShadowParamsDef.gDepthBias.set(shadowParamsBuffer, mapInfo.depthBias);
@@ -1533,6 +1658,7 @@ namespace bs { namespace ct
 		gShadowParamsDef.gNDCZToDeviceZ.set(shadowParamsBuffer, RendererView::getNDCZToDeviceZ());
 
 		ConvexVolume frustums[6];
+		Matrix4 faceViewProj[6];
 		Vector<Plane> boundingPlanes;
 		for (UINT32 i = 0; i < 6; i++)
 		{
@@ -1573,7 +1699,7 @@ namespace bs { namespace ct
 			Matrix4 view = Matrix4(viewRotationMat.transpose()) * viewOffsetMat;
 			mapInfo.shadowVPTransforms[i] = proj * view;
 
-			Matrix4 shadowViewProj = adjustedProj * view;
+			faceViewProj[i] = adjustedProj * view;
 
 			// Calculate world frustum for culling
 			const Vector<Plane>& frustumPlanes = localFrustum.getPlanes();
@@ -1588,65 +1714,250 @@ namespace bs { namespace ct
 				j++;
 			}
 
-			ConvexVolume frustum(worldPlanes);
+			frustums[i] = ConvexVolume(worldPlanes);
+
+			// Register far plane of all frustums
+			boundingPlanes.push_back(worldPlanes[FRUSTUM_PLANE_FAR]);
 
+			if(renderAllFacesAtOnce)
+				gShadowCubeMatricesDef.gFaceVPMatrices.set(shadowCubeMatricesBuffer, faceViewProj[i], i);
+		}
+
+		ConvexVolume boundingVolume(boundingPlanes);
+
+		// Renders the provided casters into all faces of a cubemap, returns the number of rendered casters
+		auto renderCasters = [&](const SPtr<Texture>& target, const SPtr<RenderTexture>& allFacesTarget,
+			const Vector<UINT32>& casters, bool clear)
+		{
 			if(renderAllFacesAtOnce)
 			{
-				frustums[i] = frustum;
+				rapi.setRenderTarget(allFacesTarget);
 
-				// Register far plane of all frustums
-				boundingPlanes.push_back(worldPlanes[FRUSTUM_PLANE_FAR]);
-				gShadowCubeMatricesDef.gFaceVPMatrices.set(shadowCubeMatricesBuffer, shadowViewProj, i);
+				if(clear)
+					rapi.clearRenderTarget(FBT_DEPTH);
+
+				ShadowRenderQueueCubeOptions cubeOptions(
+						frustums,
+						boundingVolume,
+						shadowParamsBuffer,
+						shadowCubeMatricesBuffer,
+						shadowCubeMasksBuffer
+				);
+
+				return ShadowRenderQueue::execute(scene, frameInfo, cubeOptions, casters);
 			}
-			else
+
+			UINT32 numRendered = 0;
+			for (UINT32 i = 0; i < 6; i++)
 			{
-				gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, shadowViewProj);
+				gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, faceViewProj[i]);
 
 				RENDER_TEXTURE_DESC rtDesc;
-				rtDesc.depthStencilSurface.texture = cubemap.getTexture();
+				rtDesc.depthStencilSurface.texture = target;
 				rtDesc.depthStencilSurface.face = i;
 				rtDesc.depthStencilSurface.numFaces = 1;
 
 				SPtr<RenderTarget> faceRt = RenderTexture::create(rtDesc);
 
 				rapi.setRenderTarget(faceRt);
-				rapi.clearRenderTarget(FBT_DEPTH);
 
-				// Render all renderables into the shadow map
-				ConvexVolume boundingVolume(boundingPlanes);
+				if(clear)
+					rapi.clearRenderTarget(FBT_DEPTH);
+
 				ShadowRenderQueueCubeSingleOptions cubeOptions(
-						frustum,
+						frustums[i],
 						shadowParamsBuffer
 				);
 
-				ShadowRenderQueue::execute(scene, frameInfo, cubeOptions);
+				numRendered += ShadowRenderQueue::execute(scene, frameInfo, cubeOptions, casters);
 			}
-		}
 
-		if(renderAllFacesAtOnce)
+			return numRendered;
+		};
+
+		StaticShadowCache& staticCache = getStaticShadowCache(light, nullptr, 1);
+		StaticShadowLayer& staticLayer = staticCache.layers[0];
+
+		// All faces share the position and projection, so the transform of the first face identifies the shadow
+		StaticCasterMode staticMode = updateStaticLayer(staticLayer, scene.getSceneInfo(), boundingVolume,
+			mapInfo.shadowVPTransforms[0], mapInfo.depthBias, options.mapSize);
+		updateStaticLayerStats(staticLayer, staticMode);
+
+		if (staticMode == StaticCasterMode::RenderStatic)
 		{
-			rapi.setRenderTarget(cubemap.getTarget());
-			rapi.clearRenderTarget(FBT_DEPTH);
+			allocateStaticDepth(staticCache, TEX_TYPE_CUBE_MAP, options.mapSize, 1);
+
+			addRenderedCasters(renderCasters(staticCache.depth->texture, staticCache.depth->renderTexture,
+				staticLayer.casters, true));
+			staticLayer.isValid = true;
+		}
 
-			// Render all renderables into the shadow map
-			ConvexVolume boundingVolume(boundingPlanes);
-			ShadowRenderQueueCubeOptions cubeOptions(
-					frustums,
-					boundingVolume,
-					shadowParamsBuffer,
-					shadowCubeMatricesBuffer,
-					shadowCubeMasksBuffer
-			);
+		if (staticMode != StaticCasterMode::Direct)
+		{
+			for (UINT32 i = 0; i < 6; i++)
+			{
+				TEXTURE_COPY_DESC copyDesc;
+				copyDesc.srcFace = i;
+				copyDesc.dstFace = i;
 
-			ShadowRenderQueue::execute(scene, frameInfo, cubeOptions);
+				staticCache.depth->texture->copy(cubemap.getTexture(), copyDesc);
+			}
 		}
 
+		// Render the remaining casters into the shadow map
+		const Vector<UINT32>& casters = getDirectCasters(staticLayer, staticMode);
+		addRenderedCasters(renderCasters(cubemap.getTexture(), cubemap.getTarget(), casters,
+			staticMode == StaticCasterMode::Direct));
+
 		LightShadows& lightShadows = mRadialLightShadows[options.lightIdx];
 
 		mShadowInfos[lightShadows.startIdx + lightShadows.numShadows] = mapInfo;
 		lightShadows.numShadows++;
 	}
 
+	void ShadowRendering::updateCasterCandidates(const SceneInfo& sceneInfo)
+	{
+		// Dynamic renderables are added without changing the cull version, so the renderable count is checked as well
+		const auto numRenderables = (UINT32)sceneInfo.renderables.size();
+		if (mSceneCullVersion == sceneInfo.renderableCullVersion && mSceneNumRenderables == numRenderables)
+			return;
+
+		mStaticCasterCandidates.clear();
+		mDynamicCasterCandidates.clear();
+
+		for (UINT32 i = 0; i < numRenderables; i++)
+		{
+			// Animated renderables change their shape every frame even if they don't move
+			const bool isAnimated = sceneInfo.renderables[i]->renderable->getAnimType() != RenderableAnimType::None;
+
+			if (sceneInfo.renderableCullInfos[i].isStatic && !isAnimated)
+				mStaticCasterCandidates.push_back(i);
+			else
+				mDynamicCasterCandidates.push_back(i);
+		}
+
+		mSceneCullVersion = sceneInfo.renderableCullVersion;
+		mSceneNumRenderables = numRenderables;
+		mCasterCandidatesVersion++;
+	}
+
+	ShadowRendering::StaticShadowCache& ShadowRendering::getStaticShadowCache(const Light* light,
+		const RendererView* view, UINT32 numLayers)
+	{
+		StaticShadowCache& cache = mStaticShadowCaches[std::make_pair(light, view)];
+		cache.lastUsedCounter = 0;
+
+		if (cache.layers.size() != numLayers)
+		{
+			cache.layers.clear();
+			cache.layers.resize(numLayers);
+		}
+
+		return cache;
+	}
+
+	ShadowRendering::StaticCasterMode ShadowRendering::updateStaticLayer(StaticShadowLayer& layer,
+		const SceneInfo& sceneInfo, const ConvexVolume& volume, const Matrix4& viewProj, float depthBias, UINT32 mapSize)
+	{
+		const bool shadowChanged = layer.viewProj != viewProj || layer.depthBias != depthBias || layer.mapSize != mapSize;
+		const size_t prevCastersHash = layer.castersHash;
+
+		if (shadowChanged || layer.candidatesVersion != mCasterCandidatesVersion)
+		{
+			layer.casters.clear();
+			layer.castersHash = 0;
+
+			for (auto& entry : mStaticCasterCandidates)
+			{
+				const Sphere& bounds = sceneInfo.renderableCullInfos[entry].bounds.getSphere();
+				if (!volume.intersects(bounds))
+					continue;
+
+				// Version changes on any transform update, and is unique across renderables, so it also differentiates
+				// between a renderable and a new one that was allocated at the same address
+				layer.casters.push_back(entry);
+				bs_hash_combine(layer.castersHash, sceneInfo.renderables[entry]->version);
+			}
+
+			layer.candidatesVersion = mCasterCandidatesVersion;
+		}
+
+		layer.viewProj = viewProj;
+		layer.depthBias = depthBias;
+		layer.mapSize = mapSize;
+
+		// Only start caching once the shadow is stable, otherwise the copy would just add to the cost
+		if (shadowChanged || layer.castersHash != prevCastersHash)
+		{
+			layer.isValid = false;
+			return StaticCasterMode::Direct;
+		}
+
+		if (layer.casters.empty())
+			return StaticCasterMode::Direct;
+
+		return layer.isValid ? StaticCasterMode::ReuseStatic : StaticCasterMode::RenderStatic;
+	}
+
+	const Vector<UINT32>& ShadowRendering::getDirectCasters(const StaticShadowLayer& layer, StaticCasterMode mode)
+	{
+		if (mode != StaticCasterMode::Direct)
+			return mDynamicCasterCandidates;
+
+		mDirectCasters.clear();
+		mDirectCasters.insert(mDirectCasters.end(), layer.casters.begin(), layer.casters.end());
+		mDirectCasters.insert(mDirectCasters.end(), mDynamicCasterCandidates.begin(), mDynamicCasterCandidates.end());
+
+		return mDirectCasters;
+	}
+
+	void ShadowRendering::allocateStaticDepth(StaticShadowCache& cache, TextureType type, UINT32 size,
+		UINT32 numArraySlices)
+	{
+		if (cache.depth != nullptr)
+		{
+			const TextureProperties& props = cache.depth->texture->getProperties();
+			if (props.getTextureType() == type && props.getWidth() == size && props.getNumArraySlices() == numArraySlices)
+				return;
+		}
+
+		for (auto& layer : cache.layers)
+			layer.isValid = false;
+
+		// Release the old texture first, so the pool can re-use it
+		cache.depth = nullptr;
+
+		if (type == TEX_TYPE_CUBE_MAP)
+		{
+			cache.depth = GpuResourcePool::instance().get(
+				POOLED_RENDER_TEXTURE_DESC::createCube(SHADOW_MAP_FORMAT, size, size, TU_DEPTHSTENCIL));
+		}
+		else
+		{
+			cache.depth = GpuResourcePool::instance().get(POOLED_RENDER_TEXTURE_DESC::create2D(SHADOW_MAP_FORMAT, size,
+				size, TU_DEPTHSTENCIL, 0, false, numArraySlices));
+		}
+	}
+
+	void ShadowRendering::updateStaticLayerStats(const StaticShadowLayer& layer, StaticCasterMode mode)
+	{
+		if (mode == StaticCasterMode::RenderStatic)
+			mStats.numStaticLayersRendered++;
+		else if (mode == StaticCasterMode::ReuseStatic)
+		{
+			mStats.numStaticLayersReused++;
+			mStats.numCastersCached += (UINT32)layer.casters.size();
+
+			BS_ADD_RENDER_STAT(NumShadowCastersCached, (UINT32)layer.casters.size());
+		}
+	}
+
+	void ShadowRendering::addRenderedCasters(UINT32 count)
+	{
+		mStats.numCastersRendered += count;
+		BS_ADD_RENDER_STAT(NumShadowCastersRendered, count);
+	}
+
 	void ShadowRendering::calcShadowMapProperties(const RendererLight& light, const RendererViewGroup& viewGroup,
 		UINT32 border, UINT32& size, SmallVector<float, 6>& fadePercents, float& maxFadePercent) const
 	{
@@ -17,6 +17,7 @@ namespace bs { namespace ct
 	struct FrameInfo;
 	class RendererLight;
 	class RendererScene;
+	struct SceneInfo;
 	struct ShadowInfo;
 
 	/** @addtogroup RenderBeast
@@ -400,6 +401,22 @@ namespace bs { namespace ct
 		SmallVector<float, 6> fadePerView;
 	};
 
+	/** Statistics about the shadow maps rendered during the last frame. */
+	struct ShadowRenderingStats
+	{
+		/** Number of renderables that were drawn into shadow maps, including the static layers. */
+		UINT32 numCastersRendered = 0;
+
+		/** Number of static casters that weren't drawn because their depth was copied from a cached static layer. */
+		UINT32 numCastersCached = 0;
+
+		/** Number of static layers that had to be (re)rendered. */
+		UINT32 numStaticLayersRendered = 0;
+
+		/** Number of static layers that were re-used from a previous frame. */
+		UINT32 numStaticLayersReused = 0;
+	};
+
 	/**
 	 * Contains a texture that serves as an atlas for one or multiple shadow maps. Provides methods for inserting new maps
 	 * in the atlas.
@@ -532,6 +549,56 @@ namespace bs { namespace ct
 		{
 			SmallVector<LightShadows, 6> viewShadows;
 		};
+
+		/** Determines how are static casters rendered into a single shadow map. */
+		enum class StaticCasterMode
+		{
+			/** Static casters are rendered directly into the shadow map, along with the dynamic casters. */
+			Direct,
+
+			/**
+			 * Static casters are rendered into the static layer, which is then copied into the shadow map. Dynamic
+			 * casters are rendered on top.
+			 */
+			RenderStatic,
+
+			/** Static layer is up to date and is copied into the shadow map. Dynamic casters are rendered on top. */
+			ReuseStatic
+		};
+
+		/**
+		 * Depth of static casters cached for a single shadow map, or a single cascade of a cascaded shadow map. The layer
+		 * is only valid as long as the shadow transform and the static casters it was rendered with remain the same.
+		 */
+		struct StaticShadowLayer
+		{
+			Matrix4 viewProj = Matrix4::ZERO;
+			float depthBias = 0.0f;
+			UINT32 mapSize = 0;
+
+			/** Static casters intersecting the shadow volume, as indices into the scene's renderable array. */
+			Vector<UINT32> casters;
+
+			/** Value of mCasterCandidatesVersion at the time @p casters was built. */
+			UINT64 candidatesVersion = (UINT64)-1;
+
+			/** Hash of the versions of all entries in @p casters. See RendererRenderable::version. */
+			size_t castersHash = 0;
+
+			bool isValid = false;
+		};
+
+		/** Static caster depth cached for a single light. Directional lights have a separate entry for each view. */
+		struct StaticShadowCache
+		{
+			/** Texture containing the static layers. 2D for spot lights, cube for radial and 2D array for directional. */
+			SPtr<PooledRenderTexture> depth;
+
+			/** One layer for spot and radial lights, or one per cascade for directional lights. */
+			Vector<StaticShadowLayer> layers;
+
+			UINT32 lastUsedCounter = 0;
+		};
 	public:
 		ShadowRendering(UINT32 shadowMapSize);
 
@@ -546,6 +613,9 @@ namespace bs { namespace ct
 
 		/** Changes the default shadow map size. Will cause all shadow maps to be rebuilt. */
 		void setShadowMapSize(UINT32 size);
+
+		/** Returns statistics about the shadow maps rendered during the last call to renderShadowMaps(). */
+		const ShadowRenderingStats& getStats() const { return mStats; }
 	private:
 		/** Renders cascaded shadow maps for the provided directional light viewed from the provided view. */
 		void renderCascadedShadowMaps(const RendererView& view, UINT32 lightIdx, RendererScene& scene,
@@ -559,6 +629,57 @@ namespace bs { namespace ct
 		void renderRadialShadowMap(const RendererLight& light, const ShadowMapOptions& options, RendererScene& scene,
 			const FrameInfo& frameInfo);
 
+		/**
+		 * Rebuilds the lists of static and dynamic shadow caster candidates if renderables were added, removed or
+		 * static renderables were modified since the last call.
+		 */
+		void updateCasterCandidates(const SceneInfo& sceneInfo);
+
+		/**
+		 * Returns the static caster cache for the provided light, creating it if it doesn't exist. Resizes the cache to
+		 * hold @p numLayers layers and marks it as used this frame.
+		 *
+		 * @param[in]	light		Light casting the shadow.
+		 * @param[in]	view		View the shadow is rendered for. Only relevant for directional lights, null otherwise.
+		 * @param[in]	numLayers	Number of shadow maps (cascades) rendered for the light.
+		 */
+		StaticShadowCache& getStaticShadowCache(const Light* light, const RendererView* view, UINT32 numLayers);
+
+		/**
+		 * Determines how to handle static casters for a single shadow map, and rebuilds the list of static casters
+		 * intersecting the shadow volume if the shadow or the scene changed. The static layer is only rendered after
+		 * the shadow transform and its static casters remain unchanged for a frame, so lights or cascades that change
+		 * every frame don't pay for the extra copy.
+		 *
+		 * @param[in, out]	layer		Static layer of the shadow map.
+		 * @param[in]		sceneInfo	Information about the scene the shadow is rendered for.
+		 * @param[in]		volume		Volume used for finding static casters that intersect the shadow map.
+		 * @param[in]		viewProj	View-projection transform used for rendering the shadow map.
+		 * @param[in]		depthBias	Depth bias used for rendering the shadow map.
+		 * @param[in]		mapSize		Size of the shadow map, in pixels.
+		 * @return						Mode that determines how to render the static casters.
+		 */
+		StaticCasterMode updateStaticLayer(StaticShadowLayer& layer, const SceneInfo& sceneInfo,
+			const ConvexVolume& volume, const Matrix4& viewProj, float depthBias, UINT32 mapSize);
+
+		/**
+		 * Returns the casters that need to be rendered directly into a shadow map. This is every dynamic caster, and
+		 * static casters from @p layer if they aren't rendered through the static layer.
+		 */
+		const Vector<UINT32>& getDirectCasters(const StaticShadowLayer& layer, StaticCasterMode mode);
+
+		/**
+		 * Makes sure the static depth texture of the cache has the provided type, size and number of array slices, and
+		 * invalidates all of its layers if the texture had to be re-created.
+		 */
+		static void allocateStaticDepth(StaticShadowCache& cache, TextureType type, UINT32 size, UINT32 numArraySlices);
+
+		/** Updates the statistics according to the mode used for rendering the provided static layer. */
+		void updateStaticLayerStats(const StaticShadowLayer& layer, StaticCasterMode mode);
+
+		/** Records the number of casters that were drawn into a shadow map. */
+		void addRenderedCasters(UINT32 count);
+
 		/**
 		 * Calculates optimal shadow map size, taking into account all views in the scene. Also calculates a fade value
 		 * that can be used for fading out small shadow maps.
@@ -685,7 +806,17 @@ namespace bs { namespace ct
 		mutable SPtr<IndexBuffer> mFrustumIB;
 		mutable SPtr<VertexBuffer> mFrustumVB;
 
-		Vector<bool> mRenderableVisibility; // Transient
+		Map<std::pair<const Light*, const RendererView*>, StaticShadowCache> mStaticShadowCaches;
+
+		Vector<UINT32> mStaticCasterCandidates;
+		Vector<UINT32> mDynamicCasterCandidates;
+		UINT64 mCasterCandidatesVersion = 0;
+		UINT64 mSceneCullVersion = (UINT64)-1;
+		UINT32 mSceneNumRenderables = 0;
+
+		ShadowRenderingStats mStats;
+
+		Vector<UINT32> mDirectCasters; // Transient
 		Vector<ShadowMapOptions> mSpotLightShadowOptions; // Transient
 		Vector<ShadowMapOptions> mRadialLightShadowOptions; // Transient
 	};
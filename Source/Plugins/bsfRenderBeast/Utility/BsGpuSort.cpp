@@ -48,12 +48,12 @@ namespace bs { namespace ct
 	void runSortTest();
 
 	/**
-	 * Creates a new GPU parameter block buffer according to gRadixSortParamDef definition and writes GpuSort properties
-	 * into the buffer.
+	 * Allocates a frame-transient GPU parameter block buffer according to gRadixSortParamDef definition and writes
+	 * GpuSort properties into the buffer. The buffer must not be used past the end of the current frame.
 	 */
 	SPtr<GpuParamBlockBuffer> createGpuSortParams(const GpuSortProperties& props)
 	{
-		SPtr<GpuParamBlockBuffer> buffer = gRadixSortParamsDef.createBuffer();
+		SPtr<GpuParamBlockBuffer> buffer = gRadixSortParamsDef.getFrameBuffer();
 
 		gRadixSortParamsDef.gTilesPerGroup.set(buffer, props.tilesPerGroup);
 		gRadixSortParamsDef.gNumGroups.set(buffer, props.numGroups);
@@ -131,6 +131,7 @@ namespace bs { namespace ct
 			outputData += sizeof(MaterialSamplerOverrides);
 
 			output->refCount = 0;
+			output->version = 0;
 			output->numPasses = numPasses;
 			output->passes = (PassSamplerOverrides*)outputData;
 			output->isDirty = true;
@@ -35,6 +35,7 @@ namespace bs { namespace ct
 		UINT32 numPasses;
 		UINT32 numOverrides;
 		UINT32 refCount;
+		UINT32 version; /**< Incremented every time the overridden states change. */
 		bool isDirty;
 	};
 